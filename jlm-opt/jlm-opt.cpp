@@ -12,6 +12,7 @@
 #include <jlm/ir/ipgraph-module.hpp>
 #include <jlm/ir/operators.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/RvsdgSerialization.hpp>
 #include <jlm/opt/optimization.hpp>
 #include <jlm/tooling/CommandLine.hpp>
 
@@ -21,6 +22,9 @@
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/SourceMgr.h>
 
+#include <unistd.h>
+#include <zlib.h>
+
 #include <iostream>
 
 static std::unique_ptr<llvm::Module>
@@ -59,6 +63,81 @@ print_as_xml(
 			fclose(fd);
 }
 
+/**
+ * Writes compressed output to a gzip file. The sink owns the file, and closes it when it is destroyed without
+ * being closed explicitly.
+ */
+class GzipSink final : public jive::xml_sink {
+public:
+  ~GzipSink() override
+  {
+    if (File_ != nullptr)
+      gzclose(File_);
+  }
+
+  explicit
+  GzipSink(gzFile file)
+    : File_(file)
+  {}
+
+  GzipSink(const GzipSink &) = delete;
+
+  GzipSink &
+  operator=(const GzipSink &) = delete;
+
+  void
+  write(const char * data, size_t size) override
+  {
+    if (gzwrite(File_, data, size) != static_cast<int>(size))
+      throw jlm::error("Failed to write compressed output.");
+  }
+
+  /**
+   * Flushes the remaining compressed output and closes the file.
+   */
+  void
+  Close()
+  {
+    auto status = gzclose(File_);
+    File_ = nullptr;
+    if (status != Z_OK)
+      throw jlm::error("Failed to write compressed output.");
+  }
+
+private:
+  gzFile File_;
+};
+
+static void
+print_as_xml_gzip(
+  const jlm::RvsdgModule & rm,
+  const jlm::filepath & fp,
+  jlm::StatisticsCollector&)
+{
+  auto file = fp == "" ? gzdopen(dup(fileno(stdout)), "wb") : gzopen(fp.to_str().c_str(), "wb");
+  if (file == nullptr)
+    throw jlm::error("Cannot open " + (fp == "" ? std::string("stdout") : fp.to_str()) + ".");
+
+  GzipSink sink(file);
+  jive::view_xml(rm.Rvsdg().root(), sink);
+  sink.Close();
+}
+
+static void
+print_as_rvsdg(
+	const jlm::RvsdgModule & rm,
+	const jlm::filepath & fp,
+	jlm::StatisticsCollector&)
+{
+	if (fp == "") {
+		auto bytes = jlm::SerializeRvsdgModule(rm);
+		fwrite(bytes.data(), 1, bytes.size(), stdout);
+		return;
+	}
+
+	jlm::WriteRvsdgModule(rm, fp);
+}
+
 static void
 print_as_llvm(
 	const jlm::RvsdgModule & rm,
@@ -94,44 +173,73 @@ print(
     std::function<void(const RvsdgModule&, const filepath&, StatisticsCollector&)>
   > formatters(
     {
-      {JlmOptCommandLineOptions::OutputFormat::Xml,  print_as_xml},
-      {JlmOptCommandLineOptions::OutputFormat::Llvm, print_as_llvm}
+      {JlmOptCommandLineOptions::OutputFormat::Xml,   print_as_xml},
+      {JlmOptCommandLineOptions::OutputFormat::XmlGzip, print_as_xml_gzip},
+      {JlmOptCommandLineOptions::OutputFormat::Llvm,  print_as_llvm},
+      {JlmOptCommandLineOptions::OutputFormat::Rvsdg, print_as_rvsdg}
     });
 
   JLM_ASSERT(formatters.find(format) != formatters.end());
   formatters[format](rm, fp, statisticsCollector);
 }
 
-int
-main(int argc, char ** argv)
+static std::unique_ptr<jlm::RvsdgModule>
+read_llvm_file(
+  const char * executable,
+  const jlm::filepath & file,
+  jlm::StatisticsCollector & statisticsCollector)
 {
-  auto & commandLineOptions = jlm::JlmOptCommandLineParser::Parse(argc, argv);
-
-  jlm::StatisticsCollector statisticsCollector(commandLineOptions.StatisticsCollectorSettings_);
-
   llvm::LLVMContext llvmContext;
-  auto llvmModule = parse_llvm_file(
-    argv[0],
-    commandLineOptions.InputFile_,
-    llvmContext);
+  auto llvmModule = parse_llvm_file(executable, file, llvmContext);
 
   auto interProceduralGraphModule = construct_jlm_module(*llvmModule);
   llvmModule.reset();
 
-  auto rvsdgModule = jlm::ConvertInterProceduralGraphModule(
+  return jlm::ConvertInterProceduralGraphModule(
     *interProceduralGraphModule,
     statisticsCollector);
+}
+
+static std::unique_ptr<jlm::RvsdgModule>
+read_rvsdg_file(
+  const char * executable,
+  const jlm::filepath & file)
+{
+  try {
+    return jlm::ReadRvsdgModule(file);
+  } catch (const jlm::error & e) {
+    std::cerr << executable << ": " << e.what() << "\n";
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+main(int argc, char ** argv)
+{
+  auto & commandLineOptions = jlm::JlmOptCommandLineParser::Parse(argc, argv);
+
+  jlm::StatisticsCollector statisticsCollector(commandLineOptions.StatisticsCollectorSettings_);
+
+  auto rvsdgModule = commandLineOptions.InputFormat_ == jlm::JlmOptCommandLineOptions::InputFormat::Rvsdg
+    ? read_rvsdg_file(argv[0], commandLineOptions.InputFile_)
+    : read_llvm_file(argv[0], commandLineOptions.InputFile_, statisticsCollector);
 
   optimize(
     *rvsdgModule,
     statisticsCollector,
-    commandLineOptions.Optimizations_);
-
-  print(
-    *rvsdgModule,
-    commandLineOptions.OutputFile_,
-    commandLineOptions.OutputFormat_,
-    statisticsCollector);
+    commandLineOptions.Optimizations_,
+    commandLineOptions.NumThreads_);
+
+  try {
+    print(
+      *rvsdgModule,
+      commandLineOptions.OutputFile_,
+      commandLineOptions.OutputFormat_,
+      statisticsCollector);
+  } catch (const jlm::error & e) {
+    std::cerr << argv[0] << ": " << e.what() << "\n";
+    exit(EXIT_FAILURE);
+  }
 
   statisticsCollector.PrintStatistics();
 
@@ -34,6 +34,9 @@ public:
 	virtual bool
 	operator==(const jive::type & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::unique_ptr<jive::type>
 	copy() const override;
 
@@ -50,7 +53,7 @@ private:
 static inline bool
 is_ctltype(const jive::type & type) noexcept
 {
-	return dynamic_cast<const ctltype*>(&type) != nullptr;
+	return dyn_cast<ctltype>(&type) != nullptr;
 }
 
 /* control value representation */
@@ -88,6 +91,23 @@ private:
 	size_t nalternatives_;
 };
 
+}
+
+namespace std {
+
+template<>
+struct hash<jive::ctlvalue_repr> {
+	size_t
+	operator()(const jive::ctlvalue_repr & repr) const noexcept
+	{
+		return repr.alternative() ^ (repr.nalternatives() << 32);
+	}
+};
+
+}
+
+namespace jive {
+
 /* control constant */
 
 struct ctltype_of_value {
@@ -110,7 +130,7 @@ typedef domain_const_op<ctltype, ctlvalue_repr, ctlformat_value, ctltype_of_valu
 static inline bool
 is_ctlconstant_op(const jive::operation & op) noexcept
 {
-	return dynamic_cast<const ctlconstant_op*>(&op) != nullptr;
+	return dyn_cast<ctlconstant_op>(&op) != nullptr;
 }
 
 static inline const ctlconstant_op &
@@ -138,6 +158,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual jive_unop_reduction_path_t
 	can_reduce_operand(const jive::output * arg) const noexcept override;
 
@@ -224,7 +224,7 @@ public:
 	static jive::gamma_node *
 	create(jive::output * predicate, size_t nalternatives)
 	{
-		return new jive::gamma_node(predicate, nalternatives);
+		return new (predicate->region()->graph()->arena()) jive::gamma_node(predicate, nalternatives);
 	}
 
 	jive::gamma_input *
@@ -356,7 +356,7 @@ public:
 static inline bool
 is_gamma_input(const jive::input * input) noexcept
 {
-	return dynamic_cast<const jive::gamma_input*>(input) != nullptr;
+	return dyn_cast<jive::gamma_input>(input) != nullptr;
 }
 
 /* gamma output */
@@ -425,7 +425,7 @@ public:
 static inline bool
 is_gamma_output(const jive::input * input) noexcept
 {
-	return dynamic_cast<const jive::gamma_input*>(input) != nullptr;
+	return dyn_cast<jive::gamma_input>(input) != nullptr;
 }
 
 /* gamma node method definitions */
@@ -435,7 +435,7 @@ gamma_node::gamma_node(jive::output * predicate, size_t nalternatives)
 : structural_node(jive::gamma_op(nalternatives), predicate->region(), nalternatives)
 {
 	node::add_input(std::unique_ptr<node_input>(
-		new gamma_input(this, predicate, ctltype(nalternatives))));
+		new (graph()->arena()) gamma_input(this, predicate, ctltype(nalternatives))));
 }
 inline jive::gamma_input *
 gamma_node::predicate() const noexcept
@@ -459,7 +459,7 @@ inline jive::gamma_input *
 gamma_node::add_entryvar(jive::output * origin)
 {
 	node::add_input(std::unique_ptr<node_input>(
-		new gamma_input(this, origin, origin->type())));
+		new (graph()->arena()) gamma_input(this, origin, origin->type())));
 
 	for (size_t n = 0; n < nsubregions(); n++)
 		argument::create(subregion(n), input(ninputs()-1), origin->type());
@@ -474,7 +474,7 @@ gamma_node::add_exitvar(const std::vector<jive::output*> & values)
 		throw jive::compiler_error("Incorrect number of values.");
 
 	const auto & port = values[0]->port();
-	node::add_output(std::unique_ptr<node_output>(new gamma_output(this, port)));
+	node::add_output(std::unique_ptr<node_output>(new (graph()->arena()) gamma_output(this, port)));
 
 	auto output = exitvar(nexitvars()-1);
 	for (size_t n = 0; n < nsubregions(); n++)
@@ -10,13 +10,18 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include <typeindex>
 
 #include <jive/common.hpp>
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/node.hpp>
+#include <jive/rvsdg/notifiers.hpp>
 #include <jive/rvsdg/region.hpp>
 #include <jive/rvsdg/tracker.hpp>
+#include <jive/util/id-allocator.hpp>
 
 namespace jive {
 
@@ -115,6 +120,14 @@ private:
 /* graph */
 
 class graph {
+	friend jive::input;
+	friend jive::node;
+	friend jive::output;
+	friend struct tracker;
+
+	friend bool
+	has_active_trackers(const jive::graph * graph);
+
 public:
 	~graph();
 
@@ -129,14 +142,34 @@ public:
 	inline void
 	mark_denormalized() noexcept
 	{
-		normalized_ = false;
+		normalized_.store(false, std::memory_order_relaxed);
+	}
+
+	/**
+		\brief Number of mutations of the graph so far
+
+		The count is incremented whenever a node, an input, or an output is
+		created or destroyed, and whenever an input is diverted. A graph is
+		unchanged between two points in time if the counts at these points
+		are equal.
+	*/
+	inline size_t
+	mutation_count() const noexcept
+	{
+		return nmutations_.load(std::memory_order_relaxed);
+	}
+
+	inline void
+	count_mutation() noexcept
+	{
+		nmutations_.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	inline void
 	normalize()
 	{
 		root()->normalize(true);
-		normalized_ = true;
+		normalized_.store(true, std::memory_order_relaxed);
 	}
 
 	std::unique_ptr<jive::graph>
@@ -145,6 +178,81 @@ public:
 	jive::node_normal_form *
 	node_normal_form(const std::type_info & type) noexcept;
 
+	/**
+		\brief Enable concurrent mutation of disjoint regions
+
+		If enabled, the arena, the identifier allocators, the notifiers, and
+		the normal form lookup of the graph are synchronized. Different
+		threads can then mutate disjoint regions of the graph concurrently,
+		as long as every thread confines its mutations to the interior of
+		its regions and no thread changes the normal form settings.
+
+		The notifiers of the regions are not synchronized. Callbacks that
+		only observe a single region should connect to them, see
+		jive::region::notifiers().
+
+		Must not be toggled while other threads use the graph.
+	*/
+	void
+	set_concurrent(bool concurrent);
+
+	inline bool
+	concurrent() const noexcept
+	{
+		return concurrent_;
+	}
+
+	/**
+		\brief Begin a batch of mutations
+
+		Within a batch, the depths of nodes are not recomputed upon every
+		mutation. The nodes whose depth might have changed are recorded
+		instead, and their depths are updated at the end of the outermost
+		batch. The successors of a node are only updated if its depth
+		changed. Depth change notifications, and therefore the
+		updates of trackers, are deferred accordingly. This avoids the
+		repeated depth recomputation of successors when many inputs of a
+		region are diverted.
+
+		Batches can be nested, but must not be used while the graph is
+		concurrent. The result of node::depth() is not up to date within
+		a batch, see \ref FlushBatch().
+	*/
+	inline void
+	BeginBatch() noexcept
+	{
+		JIVE_DEBUG_ASSERT(!concurrent());
+		batch_depth_++;
+	}
+
+	/**
+		\brief End a batch of mutations
+
+		Updates the depths of all recorded nodes if the outermost batch
+		ends.
+	*/
+	inline void
+	EndBatch() noexcept
+	{
+		JIVE_DEBUG_ASSERT(InBatch());
+		if (--batch_depth_ == 0)
+			FlushBatch();
+	}
+
+	inline bool
+	InBatch() const noexcept
+	{
+		return batch_depth_ != 0;
+	}
+
+	/**
+		\brief Update the depths of all nodes recorded in the current batch
+
+		The batch itself stays open.
+	*/
+	void
+	FlushBatch() noexcept;
+
 	inline jive::argument *
 	add_import(const impport & port)
 	{
@@ -163,12 +271,109 @@ public:
 		root()->prune(true);
 	}
 
+	/**
+		\brief Arena for the nodes, inputs, and outputs of the graph
+
+		The arena is released in bulk when the graph is destroyed.
+	*/
+	inline jive::detail::arena &
+	arena() noexcept
+	{
+		return arena_;
+	}
+
+	inline const jive::detail::arena &
+	arena() const noexcept
+	{
+		return arena_;
+	}
+
+	/**
+		\brief Upper bound of the identifiers of all live nodes
+	*/
+	inline size_t
+	node_id_bound() const noexcept
+	{
+		return node_ids_.bound();
+	}
+
+	/**
+		\brief Upper bound of the identifiers of all live inputs
+	*/
+	inline size_t
+	input_id_bound() const noexcept
+	{
+		return input_ids_.bound();
+	}
+
+	/**
+		\brief Upper bound of the identifiers of all live outputs
+	*/
+	inline size_t
+	output_id_bound() const noexcept
+	{
+		return output_ids_.bound();
+	}
+
+	/**
+		\brief Notifiers for the mutations of the graph
+
+		Callbacks connected to these notifiers are only invoked for
+		mutations of this graph.
+	*/
+	inline jive::graph_notifiers &
+	notifiers() noexcept
+	{
+		return notifiers_;
+	}
+
 private:
-	bool normalized_;
+	jive::detail::arena arena_;
+	jive::graph_notifiers notifiers_;
+	jive::detail::id_allocator node_ids_;
+	jive::detail::id_allocator input_ids_;
+	jive::detail::id_allocator output_ids_;
+	std::atomic<size_t> ntrackers_;
+	std::atomic<bool> normalized_;
+	std::atomic<size_t> nmutations_;
+	bool concurrent_;
+	size_t batch_depth_;
+	std::vector<jive::node*> batch_nodes_;
+	std::shared_mutex normal_forms_mutex_;
 	jive::region * root_;
 	jive::node_normal_form_hash node_normal_forms_;
 };
 
+/**
+	\brief Scoped batch of mutations
+
+	Begins a batch of mutations of a graph upon construction and ends it
+	upon destruction, see \ref graph::BeginBatch().
+*/
+class mutation_batch final {
+public:
+	inline
+	~mutation_batch() noexcept
+	{
+		graph_.EndBatch();
+	}
+
+	inline explicit
+	mutation_batch(jive::graph & graph) noexcept
+	: graph_(graph)
+	{
+		graph_.BeginBatch();
+	}
+
+	mutation_batch(const mutation_batch &) = delete;
+
+	mutation_batch &
+	operator=(const mutation_batch &) = delete;
+
+private:
+	jive::graph & graph_;
+};
+
 }
 
 #endif
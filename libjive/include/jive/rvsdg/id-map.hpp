@@ -0,0 +1,233 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_RVSDG_ID_MAP_HPP
+#define JIVE_RVSDG_ID_MAP_HPP
+
+#include <jive/rvsdg/node.hpp>
+
+#include <vector>
+
+namespace jive {
+
+/**
+	\brief Set of graph entities keyed on their dense identifiers
+
+	The entities are nodes, inputs, or outputs. Membership is recorded in a bitset, which
+	makes insertion, removal, and lookup an array access.
+
+	Identifiers are recycled by the graph once an entity is destroyed. A set must therefore
+	not be queried with entities that were created after a member of the set was destroyed.
+
+	\tparam T The type of the entities. Must provide an id() method.
+*/
+template<typename T>
+class id_set final {
+public:
+	inline
+	id_set()
+	: size_(0)
+	{}
+
+	/**
+		\brief Inserts \p key into the set
+
+		\return True if \p key was not already part of the set, otherwise false.
+	*/
+	inline bool
+	insert(const T & key)
+	{
+		auto id = key.id();
+		if (id >= bits_.size())
+			bits_.resize(id+1, false);
+
+		if (bits_[id])
+			return false;
+
+		bits_[id] = true;
+		size_++;
+		return true;
+	}
+
+	/**
+		\brief Removes \p key from the set
+
+		\return True if \p key was part of the set, otherwise false.
+	*/
+	inline bool
+	remove(const T & key)
+	{
+		if (!contains(key))
+			return false;
+
+		bits_[key.id()] = false;
+		size_--;
+		return true;
+	}
+
+	inline bool
+	contains(const T & key) const noexcept
+	{
+		auto id = key.id();
+		return id < bits_.size() && bits_[id];
+	}
+
+	/**
+		\brief Preallocates the set for all identifiers smaller than \p bound
+
+		Insertions of these identifiers do not need to grow the set afterwards.
+
+		\see jive::graph::node_id_bound(), jive::graph::input_id_bound(),
+		jive::graph::output_id_bound()
+	*/
+	inline void
+	reserve(size_t bound)
+	{
+		if (bound > bits_.size())
+			bits_.resize(bound, false);
+	}
+
+	inline size_t
+	size() const noexcept
+	{
+		return size_;
+	}
+
+	inline void
+	clear() noexcept
+	{
+		bits_.clear();
+		size_ = 0;
+	}
+
+private:
+	size_t size_;
+	std::vector<bool> bits_;
+};
+
+/**
+	\brief Side table that associates graph entities with values
+
+	The entities are nodes, inputs, or outputs. The table is keyed on the dense identifiers
+	the graph assigns to the entities and stores the values in a vector indexed by these
+	identifiers, while the presence of a key is recorded in a bitset.
+
+	Identifiers are recycled by the graph once an entity is destroyed. Entries of destroyed
+	entities must therefore be removed before new entities are looked up in the table.
+
+	\tparam K The type of the entities. Must provide an id() method.
+	\tparam V The type of the values. Must be default constructible.
+*/
+template<typename K, typename V>
+class id_map final {
+public:
+	inline
+	id_map()
+	: size_(0)
+	{}
+
+	/**
+		\brief Retrieves the value associated with \p key
+
+		A default constructed value is inserted if \p key is not part of the map.
+	*/
+	inline V &
+	operator[](const K & key)
+	{
+		auto id = key.id();
+		if (id >= values_.size()) {
+			values_.resize(id+1);
+			present_.resize(id+1, false);
+		}
+
+		if (!present_[id]) {
+			present_[id] = true;
+			size_++;
+		}
+
+		return values_[id];
+	}
+
+	/**
+		\brief Associates \p value with \p key
+
+		An existing association of \p key is replaced.
+	*/
+	inline void
+	insert(const K & key, V value)
+	{
+		(*this)[key] = std::move(value);
+	}
+
+	/**
+		\brief Removes \p key and its associated value from the map
+
+		\return True if \p key was part of the map, otherwise false.
+	*/
+	inline bool
+	remove(const K & key)
+	{
+		if (!contains(key))
+			return false;
+
+		values_[key.id()] = V();
+		present_[key.id()] = false;
+		size_--;
+		return true;
+	}
+
+	inline bool
+	contains(const K & key) const noexcept
+	{
+		auto id = key.id();
+		return id < present_.size() && present_[id];
+	}
+
+	/**
+		\return The value associated with \p key, or nullptr if \p key is not part of the map.
+	*/
+	inline V *
+	lookup(const K & key) noexcept
+	{
+		return contains(key) ? &values_[key.id()] : nullptr;
+	}
+
+	inline const V *
+	lookup(const K & key) const noexcept
+	{
+		return contains(key) ? &values_[key.id()] : nullptr;
+	}
+
+	inline size_t
+	size() const noexcept
+	{
+		return size_;
+	}
+
+	inline void
+	clear() noexcept
+	{
+		values_.clear();
+		present_.clear();
+		size_ = 0;
+	}
+
+private:
+	size_t size_;
+	std::vector<V> values_;
+	std::vector<bool> present_;
+};
+
+template<typename V> using node_map = id_map<jive::node, V>;
+template<typename V> using input_map = id_map<jive::input, V>;
+template<typename V> using output_map = id_map<jive::output, V>;
+
+typedef id_set<jive::node> node_set;
+typedef id_set<jive::input> input_set;
+typedef id_set<jive::output> output_set;
+
+}
+
+#endif
@@ -10,11 +10,12 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <jive/common.hpp>
 #include <jive/rvsdg/operation.hpp>
+#include <jive/util/arena.hpp>
 #include <jive/util/intrusive-list.hpp>
 #include <jive/util/strfmt.hpp>
 
@@ -30,8 +31,21 @@ class substitution_map;
 
 /* inputs */
 
-class input {
+/**
+	\brief Kind of an input
+
+	Distinguishes inputs of simple nodes, inputs of structural nodes, and
+	region results without RTTI.
+*/
+enum class input_kind : uint8_t {
+	simple,
+	structural,
+	result
+};
+
+class input : public jive::detail::arena_allocated {
 	friend jive::node;
+	friend jive::output;
 	friend jive::region;
 
 public:
@@ -39,6 +53,7 @@ public:
 	~input() noexcept;
 
 	input(
+		jive::input_kind kind,
 		jive::output * origin,
 		jive::region * region,
 		const jive::port & port);
@@ -53,6 +68,23 @@ public:
 	input &
 	operator=(input &&) = delete;
 
+	inline input_kind
+	kind() const noexcept
+	{
+		return kind_;
+	}
+
+	/**
+		\brief Dense identifier of the input within its graph
+
+		Identifiers are recycled after the input is destroyed.
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
 	inline size_t
 	index() const noexcept
 	{
@@ -92,7 +124,7 @@ public:
 	inline void
 	replace(const jive::port & port)
 	{
-		if (port_->type() != port.type())
+		if (!equal_canonical_types(port_->type(), port.type()))
 			throw type_error(port_->type().debug_string(), port.type().debug_string());
 
 		port_ = port.copy();
@@ -268,7 +300,11 @@ public:
 	};
 
 private:
+	input_kind kind_;
+	size_t id_;
 	size_t index_;
+	/* position of this input in the users vector of its origin */
+	size_t user_index_;
 	jive::output * origin_;
 	jive::region * region_;
 	std::unique_ptr<jive::port> port_;
@@ -280,22 +316,35 @@ is(const jive::input & input) noexcept
 	static_assert(std::is_base_of<jive::input, T>::value,
 		"Template parameter T must be derived from jive::input.");
 
-	return dynamic_cast<const T*>(&input) != nullptr;
+	return isa<T>(input);
 }
 
 /* outputs */
 
-class output {
+/**
+	\brief Kind of an output
+
+	Distinguishes outputs of simple nodes, outputs of structural nodes, and
+	region arguments without RTTI.
+*/
+enum class output_kind : uint8_t {
+	simple,
+	structural,
+	argument
+};
+
+class output : public jive::detail::arena_allocated {
 	friend input;
 	friend jive::node;
 	friend jive::region;
 
-	typedef std::unordered_set<jive::input*>::const_iterator user_iterator;
+	typedef std::vector<jive::input*>::const_iterator user_iterator;
 public:
 	virtual
 	~output() noexcept;
 
 	output(
+		jive::output_kind kind,
 		jive::region * region,
 		const jive::port & port);
 
@@ -309,6 +358,23 @@ public:
 	output &
 	operator=(output &&) = delete;
 
+	inline output_kind
+	kind() const noexcept
+	{
+		return kind_;
+	}
+
+	/**
+		\brief Dense identifier of the output within its graph
+
+		Identifiers are recycled after the output is destroyed.
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
 	inline size_t
 	index() const noexcept
 	{
@@ -328,7 +394,7 @@ public:
 			return;
 
 		while (users_.size())
-			(*users_.begin())->divert_to(new_origin);
+			users_.back()->divert_to(new_origin);
 	}
 
 	inline user_iterator
@@ -367,7 +433,7 @@ public:
 	inline void
 	replace(const jive::port & port)
 	{
-		if (port_->type() != port.type())
+		if (!equal_canonical_types(port_->type(), port.type()))
 			throw type_error(port_->type().debug_string(), port.type().debug_string());
 
 		port_ = port.copy();
@@ -540,10 +606,17 @@ private:
 	void
 	add_user(jive::input * user);
 
+	output_kind kind_;
+	size_t id_;
 	size_t index_;
 	jive::region * region_;
 	std::unique_ptr<jive::port> port_;
-	std::unordered_set<jive::input*> users_;
+	/*
+		Users are kept in a vector. Every input records its position in the
+		vector of its origin such that it can be removed in constant time by
+		swapping it with the last user.
+	*/
+	std::vector<jive::input*> users_;
 };
 
 template <class T> static inline bool
@@ -552,7 +625,7 @@ is(const jive::output * output) noexcept
 	static_assert(std::is_base_of<jive::output, T>::value,
 		"Template parameter T must be derived from jive::output.");
 
-	return dynamic_cast<const T*>(output) != nullptr;
+	return output != nullptr && isa<T>(*output);
 }
 
 /* node_input class */
@@ -560,6 +633,7 @@ is(const jive::output * output) noexcept
 class node_input : public jive::input {
 public:
 	node_input(
+		jive::input_kind kind,
 		jive::output * origin,
 		jive::node * node,
 		const jive::port & port);
@@ -581,7 +655,7 @@ public:
   [[nodiscard]] static jive::node *
   node(const jive::input & input)
   {
-    auto nodeInput = dynamic_cast<const node_input*>(&input);
+    auto nodeInput = dyn_cast<node_input>(&input);
     return nodeInput != nullptr
            ? nodeInput->node()
            : nullptr;
@@ -591,11 +665,23 @@ private:
 	jive::node * node_;
 };
 
+template<>
+struct cast_traits<node_input> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::input & input) noexcept
+	{
+		return input.kind() != input_kind::result;
+	}
+};
+
 /* node_output class */
 
 class node_output : public jive::output {
 public:
 	node_output(
+		jive::output_kind kind,
 		jive::node * node,
 		const jive::port & port);
 
@@ -608,7 +694,7 @@ public:
 	static jive::node *
 	node(const jive::output * output)
 	{
-		auto no = dynamic_cast<const node_output*>(output);
+		auto no = dyn_cast<node_output>(output);
 		return no != nullptr ? no->node() : nullptr;
 	}
 
@@ -616,15 +702,39 @@ private:
 	jive::node * node_;
 };
 
+template<>
+struct cast_traits<node_output> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::output & output) noexcept
+	{
+		return output.kind() != output_kind::argument;
+	}
+};
+
 /* node class */
 
-class node {
+class node : public jive::detail::arena_allocated {
+	friend jive::graph;
+
 public:
 	virtual
 	~node();
 
 	node(std::unique_ptr<jive::operation> op, jive::region * region);
 
+	/**
+		\brief Dense identifier of the node within its graph
+
+		Identifiers are recycled after the node is destroyed.
+	*/
+	inline size_t
+	id() const noexcept
+	{
+		return id_;
+	}
+
 	inline const jive::operation &
 	operation() const noexcept
 	{
@@ -784,7 +894,9 @@ public:
 	> region_bottom_node_list_accessor;
 
 private:
+	size_t id_;
 	size_t depth_;
+	size_t batch_index_;
 	jive::graph * graph_;
 	jive::region * region_;
 	std::unique_ptr<jive::operation> operation_;
@@ -8,6 +8,8 @@
 
 #include <jive/util/callbacks.hpp>
 
+#include <mutex>
+
 namespace jive {
 
 class input;
@@ -15,22 +17,108 @@ class node;
 class output;
 class region;
 
-extern notifier<jive::region*> on_region_create;
-extern notifier<jive::region*> on_region_destroy;
+/**
+	\brief Notifiers for the mutations of a single graph
+
+	Every graph owns an instance of this class. Callbacks connected to it
+	are only invoked for mutations of the owning graph, i.e., independent
+	graphs do not share any notifier state.
+*/
+class graph_notifiers final {
+public:
+	inline
+	graph_notifiers() = default;
+
+	graph_notifiers(const graph_notifiers &) = delete;
+
+	graph_notifiers(graph_notifiers &&) = delete;
+
+	graph_notifiers &
+	operator=(const graph_notifiers &) = delete;
+
+	graph_notifiers &
+	operator=(graph_notifiers &&) = delete;
+
+	/**
+		\brief Guard all notifiers with a common mutex
+
+		Must not be toggled while other threads use the notifiers.
+	*/
+	inline void
+	set_synchronized(bool synchronized) noexcept
+	{
+		auto mutex = synchronized ? &mutex_ : nullptr;
+		on_region_create.set_mutex(mutex);
+		on_region_destroy.set_mutex(mutex);
+		on_node_create.set_mutex(mutex);
+		on_node_destroy.set_mutex(mutex);
+		on_node_depth_change.set_mutex(mutex);
+		on_input_create.set_mutex(mutex);
+		on_input_change.set_mutex(mutex);
+		on_input_destroy.set_mutex(mutex);
+		on_output_create.set_mutex(mutex);
+		on_output_destroy.set_mutex(mutex);
+	}
+
+	notifier<jive::region*> on_region_create;
+	notifier<jive::region*> on_region_destroy;
+
+	notifier<jive::node*> on_node_create;
+	notifier<jive::node*> on_node_destroy;
+	notifier<jive::node*, size_t> on_node_depth_change;
+
+	notifier<jive::input*> on_input_create;
+	notifier<jive::input*,
+		jive::output*,	/* old */
+		jive::output*		/* new */
+	> on_input_change;
+	notifier<jive::input*> on_input_destroy;
+
+	notifier<jive::output*> on_output_create;
+	notifier<jive::output*> on_output_destroy;
+
+private:
+	std::recursive_mutex mutex_;
+};
+
+/**
+	\brief Notifiers for the mutations of the nodes of a single region
+
+	Every region owns an instance of this class. Its notifiers are invoked
+	in addition to the corresponding notifiers of the graph for all nodes
+	and inputs of the region.
+
+	The notifiers are never synchronized, as concurrent mutations of a
+	graph are confined to disjoint regions. Callbacks that are only
+	interested in a single region, such as the trackers of traversers,
+	should connect here. They are then neither invoked for the mutations
+	of other regions, nor do the mutations of other regions contend for
+	the lock of the graph notifiers.
+*/
+class region_notifiers final {
+public:
+	inline
+	region_notifiers() = default;
+
+	region_notifiers(const region_notifiers &) = delete;
+
+	region_notifiers(region_notifiers &&) = delete;
+
+	region_notifiers &
+	operator=(const region_notifiers &) = delete;
 
-extern notifier<jive::node*> on_node_create;
-extern notifier<jive::node*> on_node_destroy;
-extern notifier<jive::node*, size_t> on_node_depth_change;
+	region_notifiers &
+	operator=(region_notifiers &&) = delete;
 
-extern notifier<jive::input*> on_input_create;
-extern notifier<jive::input*,
-	jive::output*,	/* old */
-	jive::output*		/* new */
-> on_input_change;
-extern notifier<jive::input*> on_input_destroy;
+	notifier<jive::node*> on_node_create;
+	notifier<jive::node*> on_node_destroy;
+	notifier<jive::node*, size_t> on_node_depth_change;
 
-extern notifier<jive::output*> on_output_create;
-extern notifier<jive::output*> on_output_destroy;
+	notifier<jive::input*,
+		jive::output*,	/* old */
+		jive::output*		/* new */
+	> on_input_change;
+};
 
 }
 
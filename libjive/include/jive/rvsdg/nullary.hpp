@@ -11,6 +11,7 @@
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/simple-node.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -82,6 +83,14 @@ public:
 		return op && op->value_ == value_;
 	}
 
+	virtual size_t
+	hash() const noexcept override
+	{
+		auto seed = typeid(*this).hash_code();
+		jive::detail::hash_combine(seed, value_);
+		return seed;
+	}
+
 	virtual std::string
 	debug_string() const override
 	{
@@ -34,37 +34,15 @@ public:
 
 	port(std::unique_ptr<jive::type> type);
 
-	inline
-	port(const port & other)
-	: type_(other.type_->copy())
-	{}
-
-	inline
-	port(port && other)
-	: type_(std::move(other.type_))
-	{}
+	port(const port & other) = default;
 
-	inline port &
-	operator=(const port & other)
-	{
-		if (&other == this)
-			return *this;
-
-		type_ = other.type_->copy();
+	port(port && other) = default;
 
-		return *this;
-	}
-
-	inline port &
-	operator=(port && other)
-	{
-		if (&other == this)
-			return *this;
+	port &
+	operator=(const port & other) = default;
 
-		type_ = std::move(other.type_);
-
-		return *this;
-	}
+	port &
+	operator=(port && other) = default;
 
 	virtual bool
 	operator==(const port&) const noexcept;
@@ -85,15 +63,39 @@ public:
 	copy() const;
 
 private:
-	std::unique_ptr<jive::type> type_;
+	/* canonical instance, see canonical_type() */
+	const jive::type * type_;
 };
 
 /* operation */
 
+/**
+	\brief Kind of an operation
+
+	Distinguishes simple and structural operations without RTTI.
+*/
+enum class operation_kind : uint8_t {
+	simple,
+	structural
+};
+
 class operation {
 public:
 	virtual ~operation() noexcept;
 
+protected:
+	inline constexpr
+	operation(operation_kind kind) noexcept
+	: kind_(kind)
+	{}
+
+public:
+	inline operation_kind
+	kind() const noexcept
+	{
+		return kind_;
+	}
+
 	virtual bool
 	operator==(const operation & other) const noexcept = 0;
 
@@ -103,6 +105,18 @@ public:
 	virtual std::unique_ptr<jive::operation>
 	copy() const = 0;
 
+	/**
+		\brief Hash value of the operation
+
+		Operations that compare equal must return the same hash value. The
+		default implementation only distinguishes the dynamic type of an
+		operation. Operations that are parameterized, e.g., by a constant
+		value or a bit width, should override this method to mix in their
+		parameters.
+	*/
+	virtual size_t
+	hash() const noexcept;
+
 	inline bool
 	operator!=(const operation & other) const noexcept
 	{
@@ -111,6 +125,9 @@ public:
 
 	static jive::node_normal_form *
 	normal_form(jive::graph * graph) noexcept;
+
+private:
+	operation_kind kind_;
 };
 
 template <class T> static inline bool
@@ -119,7 +136,7 @@ is(const jive::operation & operation) noexcept
 	static_assert(std::is_base_of<jive::operation, T>::value,
 		"Template parameter T must be derived from jive::operation.");
 
-	return dynamic_cast<const T*>(&operation) != nullptr;
+	return isa<T>(operation);
 }
 
 /* simple operation */
@@ -133,7 +150,8 @@ public:
 	simple_op(
 		const std::vector<jive::port> & operands,
 		const std::vector<jive::port> & results)
-	: results_(results)
+	: operation(operation_kind::simple)
+	, results_(results)
 	, operands_(operands)
 	{}
 
@@ -157,10 +175,26 @@ private:
 	std::vector<jive::port> operands_;
 };
 
+template<>
+struct cast_traits<simple_op> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::operation & operation) noexcept
+	{
+		return operation.kind() == operation_kind::simple;
+	}
+};
+
 /* structural operation */
 
 class structural_op : public operation {
 public:
+	inline constexpr
+	structural_op() noexcept
+	: operation(operation_kind::structural)
+	{}
+
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
@@ -168,6 +202,17 @@ public:
 	normal_form(jive::graph * graph) noexcept;
 };
 
+template<>
+struct cast_traits<structural_op> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::operation & operation) noexcept
+	{
+		return operation.kind() == operation_kind::structural;
+	}
+};
+
 }
 
 #endif
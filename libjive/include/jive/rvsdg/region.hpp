@@ -12,6 +12,9 @@
 
 #include <jive/common.hpp>
 #include <jive/rvsdg/node.hpp>
+#include <jive/rvsdg/notifiers.hpp>
+
+#include <unordered_map>
 
 namespace jive {
 
@@ -71,6 +74,17 @@ private:
 	jive::structural_input * input_;
 };
 
+template<>
+struct cast_traits<argument> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::output & output) noexcept
+	{
+		return output.kind() == output_kind::argument;
+	}
+};
+
 class result : public input {
 	jive::detail::intrusive_list_anchor<
 		jive::result
@@ -120,7 +134,21 @@ private:
 	jive::structural_output * output_;
 };
 
+template<>
+struct cast_traits<result> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::input & input) noexcept
+	{
+		return input.kind() == input_kind::result;
+	}
+};
+
 class region {
+	friend jive::input;
+	friend jive::simple_node;
+
 	typedef jive::detail::intrusive_list<
 		jive::node,
 		jive::node::region_node_list_accessor
@@ -175,6 +203,17 @@ public:
 		return graph_;
 	}
 
+	/**
+		\brief Notifiers for the mutations of the nodes of this region
+
+		\see jive::region_notifiers
+	*/
+	inline jive::region_notifiers &
+	notifiers() noexcept
+	{
+		return notifiers_;
+	}
+
 	inline jive::structural_node *
 	node() const noexcept
 	{
@@ -250,6 +289,24 @@ public:
 	void
 	remove_node(jive::node * node);
 
+	/**
+		\brief Find a simple node that is equivalent to a (prospective) node
+		\param op Operation of the node
+		\param operands Operands of the node
+		\param exclude Node that is not considered a match
+		\return A simple node of the region with an operation equal to \p op and
+		the same operands as \p operands, or nullptr if no such node exists.
+
+		The lookup is performed with the help of a hash table that is keyed on
+		the hash of the operation and the origins of the operands, i.e., its
+		cost is independent of the number of users of the operands.
+	*/
+	jive::simple_node *
+	find_equivalent_node(
+		const jive::operation & op,
+		const std::vector<jive::output*> & operands,
+		const jive::node * exclude = nullptr) const noexcept;
+
 	/**
 		\brief Copy a region with substitutions
 		\param target Target region to create nodes in
@@ -303,11 +360,19 @@ public:
 	region_bottom_node_list bottom_nodes;
 
 private:
+	void
+	cse_insert(jive::simple_node * node);
+
+	void
+	cse_remove(jive::simple_node * node) noexcept;
+
 	size_t index_;
 	jive::graph * graph_;
+	jive::region_notifiers notifiers_;
 	jive::structural_node * node_;
 	std::vector<jive::result*> results_;
 	std::vector<jive::argument*> arguments_;
+	std::unordered_multimap<size_t, jive::simple_node*> cse_table_;
 };
 
 static inline void
@@ -52,7 +52,7 @@ public:
 		const jive::simple_op & op,
 		const std::vector<jive::output*> & operands)
 	{
-		return new simple_node(region, op, operands);
+		return new (region->graph()->arena()) simple_node(region, op, operands);
 	}
 
 	static inline std::vector<jive::output*>
@@ -66,6 +66,17 @@ public:
 	}
 };
 
+template<>
+struct cast_traits<simple_node> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::node & node) noexcept
+	{
+		return node.operation().kind() == operation_kind::simple;
+	}
+};
+
 /* inputs */
 
 class simple_input final : public node_input {
@@ -88,6 +99,17 @@ public:
 	}
 };
 
+template<>
+struct cast_traits<simple_input> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::input & input) noexcept
+	{
+		return input.kind() == input_kind::simple;
+	}
+};
+
 /* outputs */
 
 class simple_output final : public node_output {
@@ -109,6 +131,17 @@ public:
 	}
 };
 
+template<>
+struct cast_traits<simple_output> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::output & output) noexcept
+	{
+		return output.kind() == output_kind::simple;
+	}
+};
+
 /* simple node method definitions */
 
 inline jive::simple_input *
@@ -73,6 +73,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -89,7 +92,7 @@ public:
 static inline bool
 is_mux_op(const jive::operation & op)
 {
-	return dynamic_cast<const jive::mux_op*>(&op) != nullptr;
+	return dyn_cast<jive::mux_op>(&op) != nullptr;
 }
 
 static inline std::vector<jive::output*>
@@ -101,7 +104,7 @@ create_state_mux(
 	if (operands.empty())
 		throw jive::compiler_error("Insufficient number of operands.");
 
-	auto st = dynamic_cast<const jive::statetype*>(&type);
+	auto st = dyn_cast<jive::statetype>(&type);
 	if (!st) throw jive::compiler_error("Expected state type.");
 
 	auto region = operands.front()->region();
@@ -6,6 +6,7 @@
 #ifndef JIVE_RVSDG_STRUCTURAL_NODE_HPP
 #define JIVE_RVSDG_STRUCTURAL_NODE_HPP
 
+#include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/region.hpp>
 
@@ -71,6 +72,17 @@ private:
 	std::vector<std::unique_ptr<jive::region>> subregions_;
 };
 
+template<>
+struct cast_traits<structural_node> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::node & node) noexcept
+	{
+		return node.operation().kind() == operation_kind::structural;
+	}
+};
+
 /* structural input class */
 
 typedef jive::detail::intrusive_list<
@@ -97,7 +109,8 @@ public:
 		jive::output * origin,
 		const jive::port & port)
 	{
-		auto input = std::unique_ptr<structural_input>(new structural_input(node, origin, port));
+		auto input = std::unique_ptr<structural_input>(
+			new (node->graph()->arena()) structural_input(node, origin, port));
 		return node->append_input(std::move(input));
 	}
 
@@ -110,6 +123,17 @@ public:
 	argument_list arguments;
 };
 
+template<>
+struct cast_traits<structural_input> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::input & input) noexcept
+	{
+		return input.kind() == input_kind::structural;
+	}
+};
+
 /* structural output class */
 
 typedef jive::detail::intrusive_list<
@@ -135,7 +159,8 @@ public:
 		structural_node * node,
 		const jive::port & port)
 	{
-		auto output = std::unique_ptr<structural_output>(new structural_output(node, port));
+		auto output = std::unique_ptr<structural_output>(
+			new (node->graph()->arena()) structural_output(node, port));
 		return node->append_output(std::move(output));
 	}
 
@@ -148,6 +173,17 @@ public:
 	result_list results;
 };
 
+template<>
+struct cast_traits<structural_output> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::output & output) noexcept
+	{
+		return output.kind() == output_kind::structural;
+	}
+};
+
 /* structural node method definitions */
 
 inline jive::structural_input *
@@ -177,7 +213,7 @@ region::Contains(const jive::region & region, bool checkSubregions)
       continue;
     }
 
-    if (auto structuralNode = dynamic_cast<const jive::structural_node*>(&node))
+    if (auto structuralNode = dyn_cast<jive::structural_node>(&node))
     {
       for (size_t n = 0; n < structuralNode->nsubregions(); n++)
       {
@@ -17,6 +17,14 @@ class output;
 class region;
 class structural_input;
 
+/**
+	\brief Maps original regions, outputs, and structural inputs to their copies
+
+	The map is hash-based rather than keyed on the dense identifiers of jive::id_map. A new
+	map is created for every copied region, e.g., for every inlined call, and only holds the
+	entities of that region. A dense map would instead have to be sized to the largest
+	identifier in the graph for each copy.
+*/
 class substitution_map final {
 public:
 	bool
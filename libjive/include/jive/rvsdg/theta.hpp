@@ -8,6 +8,7 @@
 #define JIVE_RVSDG_THETA_HPP
 
 #include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/region.hpp>
 #include <jive/rvsdg/structural-node.hpp>
 
@@ -101,7 +102,7 @@ public:
 	static jive::theta_node *
 	create(jive::region * parent)
 	{
-		return new jive::theta_node(parent);
+		return new (parent->graph()->arena()) jive::theta_node(parent);
 	}
 
 	inline jive::region *
@@ -114,7 +115,7 @@ public:
 	predicate() const noexcept
 	{
 		auto result = subregion()->result(0);
-		JIVE_DEBUG_ASSERT(dynamic_cast<const ctltype*>(&result->type()));
+		JIVE_DEBUG_ASSERT(dyn_cast<ctltype>(&result->type()));
 		return result;
 	}
 
@@ -212,7 +213,7 @@ private:
 static inline bool
 is_theta_input(const jive::input * input) noexcept
 {
-	return dynamic_cast<const jive::theta_input*>(input) != nullptr;
+	return dyn_cast<jive::theta_input>(input) != nullptr;
 }
 
 static inline bool
@@ -272,7 +273,7 @@ private:
 static inline bool
 is_theta_output(const jive::theta_output * output) noexcept
 {
-	return dynamic_cast<const jive::theta_output*>(output) != nullptr;
+	return dyn_cast<jive::theta_output>(output) != nullptr;
 }
 
 static inline bool
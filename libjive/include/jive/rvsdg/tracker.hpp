@@ -10,7 +10,9 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <jive/util/callbacks.hpp>
 
@@ -36,6 +38,9 @@ public:
 	
 	tracker(jive::graph * graph, size_t nstates);
 
+	/* track only the nodes of the given region, ignoring all others */
+	tracker(jive::region * region, size_t nstates);
+
 	/* get state of the node */
 	ssize_t
 	get_nodestate(jive::node * node);
@@ -69,13 +74,20 @@ private:
 	node_destroy(jive::node * node);
 
 	jive::graph * graph_;
+	jive::region * region_;
 
 	/* FIXME: need RAII idiom for state reservation */
 	std::vector<std::unique_ptr<tracker_depth_state>> states_;
 
 	callback depth_callback_, destroy_callback_;
 
-	std::unordered_map<jive::node*, std::unique_ptr<jive::tracker_nodestate>> nodestates_;
+	/*
+		Keyed on the nodes rather than on their dense identifiers, such that
+		the table only grows with the nodes that are actually tracked. A
+		tracker of a small region in a large graph would otherwise allocate
+		a table for the entire graph.
+	*/
+	std::unordered_map<const jive::node*, std::unique_ptr<jive::tracker_nodestate>> nodestates_;
 };
 
 class tracker_nodestate {
@@ -10,6 +10,8 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include <vector>
+
 namespace jive {
 namespace detail {
 
@@ -73,7 +75,7 @@ enum class traversal_nodestate {
 class traversal_tracker final {
 public:
 	inline
-	traversal_tracker(jive::graph * graph);
+	traversal_tracker(jive::region * region);
 	
 	inline traversal_nodestate
 	get_nodestate(jive::node * node);
@@ -193,10 +195,97 @@ private:
 	traversal_nodestate new_node_state_;
 };
 
+namespace detail {
+
+/**
+	\brief Fills \p nodes with the nodes of \p region sorted by depth
+
+	The nodes are sorted in ascending depth order, or in descending depth
+	order if \p bottomup is true.
+*/
+void
+sort_by_depth(
+	const jive::region * region,
+	bool bottomup,
+	std::vector<const jive::node*> & nodes);
+
+/**
+	\brief Acquires a scratch buffer for a read-only traversal
+
+	Buffers are pooled per thread and must be released in reverse order of
+	acquisition. A released buffer keeps its capacity and is handed out
+	again by the next acquisition, such that traversals do not allocate
+	once the pool is warmed up.
+*/
+std::vector<const jive::node*> &
+acquire_traversal_buffer();
+
+void
+release_traversal_buffer(std::vector<const jive::node*> & buffer) noexcept;
+
+template<bool BottomUp>
+class depth_order_traverser final {
+public:
+	inline
+	~depth_order_traverser() noexcept
+	{
+		release_traversal_buffer(nodes_);
+	}
+
+	inline explicit
+	depth_order_traverser(const jive::region * region)
+	: nodes_(acquire_traversal_buffer())
+	{
+		sort_by_depth(region, BottomUp, nodes_);
+	}
+
+	depth_order_traverser(const depth_order_traverser &) = delete;
+
+	depth_order_traverser(depth_order_traverser &&) = delete;
+
+	depth_order_traverser &
+	operator=(const depth_order_traverser &) = delete;
+
+	depth_order_traverser &
+	operator=(depth_order_traverser &&) = delete;
+
+	typedef std::vector<const jive::node*>::const_iterator iterator;
+	typedef const jive::node * value_type;
+	inline iterator begin() const noexcept { return nodes_.begin(); }
+	inline iterator end() const noexcept { return nodes_.end(); }
+
+private:
+	std::vector<const jive::node*> & nodes_;
+};
+
+}
+
+/** \brief Read-only TopDown Traverser
+ *
+ * Visits all nodes of a region in ascending order of node::depth(), i.e., every node is visited after all its
+ * predecessors in the region. In contrast to topdown_traverser, it does not register any callbacks and keeps no
+ * per-node state. The order is computed upfront into a pooled scratch buffer, which makes the traversal allocation-free
+ * once the pool is warmed up.
+ *
+ * The region must not be mutated while it is traversed.
+ *
+ * @see topdown_traverser
+ */
+typedef detail::depth_order_traverser<false> topdown_const_traverser;
+
+/** \brief Read-only BottomUp Traverser
+ *
+ * Visits all nodes of a region in descending order of node::depth(), i.e., every node is visited before all its
+ * predecessors in the region. The region must not be mutated while it is traversed.
+ *
+ * @see topdown_const_traverser
+ */
+typedef detail::depth_order_traverser<true> bottomup_const_traverser;
+
 /* traversal tracker implementation */
 
-traversal_tracker::traversal_tracker(jive::graph * graph)
-	: tracker_(graph, 2)
+traversal_tracker::traversal_tracker(jive::region * region)
+	: tracker_(region, 2)
 {
 }
 
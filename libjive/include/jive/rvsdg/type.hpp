@@ -7,11 +7,24 @@
 #ifndef JIVE_RVSDG_TYPE_HPP
 #define JIVE_RVSDG_TYPE_HPP
 
+#include <jive/util/casting.hpp>
+
+#include <cstdint>
 #include <memory>
 #include <string>
 
 namespace jive {
 
+/**
+	\brief Kind of a type
+
+	Distinguishes value and state types without RTTI.
+*/
+enum class type_kind : uint8_t {
+	value,
+	state
+};
+
 class type {
 public:
 	virtual
@@ -19,10 +32,17 @@ public:
 
 protected:
 	inline constexpr
-	type() noexcept
+	type(type_kind kind) noexcept
+	: kind_(kind)
 	{}
 
 public:
+	inline type_kind
+	kind() const noexcept
+	{
+		return kind_;
+	}
+
 	virtual bool
 	operator==(const jive::type & other) const noexcept = 0;
 
@@ -37,6 +57,19 @@ public:
 
 	virtual std::string
 	debug_string() const = 0;
+
+	/**
+		\brief Hash of the type
+
+		Types that compare equal must have the same hash. The default
+		implementation only hashes the class of the type and should be
+		overridden by parameterized types.
+	*/
+	virtual size_t
+	hash() const noexcept;
+
+private:
+	type_kind kind_;
 };
 
 class valuetype : public jive::type {
@@ -47,10 +80,21 @@ public:
 protected:
 	inline constexpr
 	valuetype() noexcept
-	: jive::type()
+	: jive::type(type_kind::value)
 	{}
 };
 
+template<>
+struct cast_traits<valuetype> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::type & type) noexcept
+	{
+		return type.kind() == type_kind::value;
+	}
+};
+
 class statetype : public jive::type {
 public:
 	virtual
@@ -59,17 +103,62 @@ public:
 protected:
 	inline constexpr
 	statetype() noexcept
-	: jive::type()
+	: jive::type(type_kind::state)
 	{}
 };
 
+template<>
+struct cast_traits<statetype> {
+	static constexpr bool has_classof = true;
+
+	static inline bool
+	classof(const jive::type & type) noexcept
+	{
+		return type.kind() == type_kind::state;
+	}
+};
+
+/**
+	\brief Returns the canonical instance of \p type
+
+	Types of the same class that compare equal are mapped to a single
+	immutable instance. Ports hold canonical instances, which makes the
+	comparison of their types an identity check in the common case. This
+	function is thread-safe.
+
+	Retention: The canonical instances are kept in a process-global table
+	that is neither bounded nor ever freed, since ports of operations
+	outside of any graph refer to them as well. The table holds one
+	instance for every distinct type that was ever canonicalized, i.e.,
+	its size grows with the number of distinct types and not with the
+	number of graphs. Long-lived processes that create many distinct types,
+	e.g., a new set of struct types for every module, retain all of them.
+	The table stays reachable until the end of the process and is thus
+	reported as still reachable rather than leaked by leak checkers.
+*/
+const jive::type &
+canonical_type(const jive::type & type);
+
+/**
+	\brief Compares two canonical types
+
+	Canonical types are equal if they are identical. The comparison only
+	falls back to operator== for types of different classes, which might
+	still compare equal.
+*/
+static inline bool
+equal_canonical_types(const jive::type & type1, const jive::type & type2) noexcept
+{
+	return &type1 == &type2 || type1 == type2;
+}
+
 template <class T> static inline bool
 is(const jive::type & type) noexcept
 {
 	static_assert(std::is_base_of<jive::type, T>::value,
 		"Template parameter T must be derived from jive::type.");
 
-	return dynamic_cast<const T*>(&type) != nullptr;
+	return isa<T>(type);
 }
 
 }
@@ -26,6 +26,9 @@ public:
 	: unary_op(type, type)
 	{}
 
+	virtual size_t
+	hash() const noexcept override;
+
 	inline const bittype &
 	type() const noexcept
 	{
@@ -63,6 +66,9 @@ public:
 	: binary_op(std::vector<jive::port>(arity, {type}), type)
 	{}
 
+	virtual size_t
+	hash() const noexcept override;
+
 	/* reduction methods */
 	virtual jive_binop_reduction_path_t
 	can_reduce_operand_pair(
@@ -106,6 +112,9 @@ public:
 	: binary_op({type, type}, bit1)
 	{}
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual jive_binop_reduction_path_t
 	can_reduce_operand_pair(
 		const jive::output * arg1,
@@ -28,6 +28,9 @@ public:
 	virtual bool
 	operator==(const jive::operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual jive_binop_reduction_path_t
 	can_reduce_operand_pair(
 		const jive::output * arg1,
@@ -30,6 +30,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
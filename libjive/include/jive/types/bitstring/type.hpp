@@ -39,6 +39,9 @@ public:
 	virtual bool
 	operator==(const jive::type & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::unique_ptr<jive::type>
 	copy() const override;
 
@@ -23,12 +23,83 @@ namespace jive {
 	- '1' : one
 	- 'D' : defined, but unknown
 	- 'X' : undefined and unknown
+
+ The bits are packed into limbs of 64 bits. Representations of at most 64
+ bits are stored inline. Operations on representations without unknown bits
+ are performed word-parallel, while all other operations fall back to a
+ bit-serial evaluation that tracks the unknown bits.
 */
 
 class bitvalue_repr {
+	/*
+		A limb stores 64 bits in two words. The value word holds the values of
+		the known bits, and the mask word marks the unknown bits. An unknown bit
+		is undefined if its value bit is set, and defined otherwise:
+
+			value mask
+			  0     0  : '0'
+			  1     0  : '1'
+			  0     1  : 'D'
+			  1     1  : 'X'
+
+		The bits of the last limb beyond nbits() are always zero in both words.
+	*/
+	struct limb {
+		uint64_t value;
+		uint64_t mask;
+
+		inline bool
+		operator==(const limb & other) const noexcept
+		{
+			return value == other.value && mask == other.mask;
+		}
+
+		inline bool
+		operator!=(const limb & other) const noexcept
+		{
+			return !(*this == other);
+		}
+	};
+
 public:
+	/** \brief Reference to a single bit of a value representation */
+	class reference final {
+		friend bitvalue_repr;
+
+		inline
+		reference(bitvalue_repr & repr, size_t n) noexcept
+		: n_(n)
+		, repr_(repr)
+		{}
+
+	public:
+		inline
+		operator char() const noexcept
+		{
+			return repr_.get_bit(n_);
+		}
+
+		inline reference &
+		operator=(char bit)
+		{
+			repr_.set_bit(n_, bit);
+			return *this;
+		}
+
+		inline reference &
+		operator=(const reference & other)
+		{
+			return *this = char(other);
+		}
+
+	private:
+		size_t n_;
+		bitvalue_repr & repr_;
+	};
+
 	inline
 	bitvalue_repr(size_t nbits, int64_t value)
+	: nbits_(nbits)
 	{
 		if (nbits == 0)
 			throw compiler_error("Number of bits is zero.");
@@ -36,37 +107,42 @@ public:
 		if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
 			throw compiler_error("Value cannot be represented with the given number of bits.");
 
-		for (size_t n = 0; n < nbits; ++n) {
-			data_.push_back('0' + (value & 1));
-			value = value >> 1;
-		}
+		allocate();
+		auto limbs = data();
+		limbs[0].value = value;
+		for (size_t n = 1; n < nlimbs(); n++)
+			limbs[n].value = value < 0 ? ~uint64_t(0) : 0;
+		normalize();
 	}
 
 	inline
 	bitvalue_repr(const char * s)
+	: nbits_(strlen(s))
 	{
-		if (strlen(s) == 0)
+		if (nbits_ == 0)
 			throw compiler_error("Number of bits is zero.");
 
-		for (size_t n = 0; n < strlen(s); n++) {
-			if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
-				throw compiler_error("Not a valid bit.");
-			data_.push_back(s[n]);
-		}
+		allocate();
+		for (size_t n = 0; n < nbits_; n++)
+			set_bit(n, s[n]);
 	}
 
-	bitvalue_repr(const bitvalue_repr & other)
-	: data_(other.data_)
-	{}
+	bitvalue_repr(const bitvalue_repr & other) = default;
 
-	bitvalue_repr(bitvalue_repr && other)
-	: data_(std::move(other.data_))
-	{}
+	bitvalue_repr(bitvalue_repr && other) = default;
 
 	inline static bitvalue_repr
 	repeat(size_t nbits, char bit)
 	{
-		return bitvalue_repr(std::string(nbits, bit).c_str());
+		bitvalue_repr result(nbits, 0);
+		auto pattern = encode(bit);
+		for (size_t n = 0; n < result.nlimbs(); n++) {
+			result.data()[n].value = pattern.value ? ~uint64_t(0) : 0;
+			result.data()[n].mask = pattern.mask ? ~uint64_t(0) : 0;
+		}
+		result.normalize();
+
+		return result;
 	}
 
 private:
@@ -157,6 +233,174 @@ private:
 		return lxor(lxor(a,b), c);
 	}
 
+	static inline limb
+	encode(char bit)
+	{
+		switch (bit) {
+			case '0':
+				return {0, 0};
+			case '1':
+				return {1, 0};
+			case 'D':
+				return {0, 1};
+			case 'X':
+				return {1, 1};
+			default:
+				throw compiler_error("Not a valid bit.");
+		}
+	}
+
+	static inline size_t
+	nlimbs(size_t nbits) noexcept
+	{
+		return (nbits + 63) / 64;
+	}
+
+	inline size_t
+	nlimbs() const noexcept
+	{
+		return nlimbs(nbits_);
+	}
+
+	inline limb *
+	data() noexcept
+	{
+		return nbits_ <= 64 ? &inline_limb_ : limbs_.data();
+	}
+
+	inline const limb *
+	data() const noexcept
+	{
+		return nbits_ <= 64 ? &inline_limb_ : limbs_.data();
+	}
+
+	/*
+		Returns a word with all bits of the last limb set that are part of the
+		representation.
+	*/
+	inline uint64_t
+	top_mask() const noexcept
+	{
+		size_t remainder = nbits_ % 64;
+		return remainder == 0 ? ~uint64_t(0) : (uint64_t(1) << remainder) - 1;
+	}
+
+	inline void
+	allocate()
+	{
+		inline_limb_ = {0, 0};
+		if (nbits_ > 64)
+			limbs_.assign(nlimbs(), {0, 0});
+	}
+
+	inline void
+	normalize() noexcept
+	{
+		auto & top = data()[nlimbs()-1];
+		top.value &= top_mask();
+		top.mask &= top_mask();
+	}
+
+	inline char
+	get_bit(size_t n) const noexcept
+	{
+		JIVE_DEBUG_ASSERT(n < nbits());
+		auto & l = data()[n / 64];
+		uint64_t bit = uint64_t(1) << (n % 64);
+		if (l.mask & bit)
+			return (l.value & bit) ? 'X' : 'D';
+
+		return (l.value & bit) ? '1' : '0';
+	}
+
+	inline void
+	set_bit(size_t n, char bit)
+	{
+		JIVE_DEBUG_ASSERT(n < nbits());
+		auto pattern = encode(bit);
+		auto & l = data()[n / 64];
+		size_t shift = n % 64;
+		l.value = (l.value & ~(uint64_t(1) << shift)) | (pattern.value << shift);
+		l.mask = (l.mask & ~(uint64_t(1) << shift)) | (pattern.mask << shift);
+	}
+
+	/*
+		Returns the value word of a representation of at most 64 bits
+		sign-extended to 64 bits.
+	*/
+	inline uint64_t
+	sext_value() const noexcept
+	{
+		JIVE_DEBUG_ASSERT(nbits_ <= 64);
+		uint64_t value = inline_limb_.value;
+		if (nbits_ < 64 && (value >> (nbits_ - 1)) & 1)
+			value |= ~top_mask();
+
+		return value;
+	}
+
+	static inline char
+	to_bit(bool value) noexcept
+	{
+		return value ? '1' : '0';
+	}
+
+	inline void
+	check_nbits(const bitvalue_repr & other) const
+	{
+		if (nbits() != other.nbits())
+			throw compiler_error("Unequal number of bits.");
+	}
+
+	/* Word-parallel kernels for operands without unknown bits */
+
+	bool
+	known_ult(const bitvalue_repr & other) const noexcept;
+
+	bool
+	known_slt(const bitvalue_repr & other) const noexcept;
+
+	bitvalue_repr
+	known_add(const bitvalue_repr & other) const;
+
+	bitvalue_repr
+	known_neg() const;
+
+	bitvalue_repr
+	known_mul(const bitvalue_repr & other) const;
+
+	void
+	known_udiv(
+		const bitvalue_repr & divisor,
+		bitvalue_repr & quotient,
+		bitvalue_repr & remainder) const;
+
+	/* Bit-serial kernels for operands with unknown bits */
+
+	char
+	serial_ult(const bitvalue_repr & other) const;
+
+	char
+	serial_ule(const bitvalue_repr & other) const;
+
+	char
+	serial_ne(const bitvalue_repr & other) const;
+
+	bitvalue_repr
+	serial_add(const bitvalue_repr & other) const;
+
+	bitvalue_repr
+	serial_neg() const;
+
+	void
+	serial_udiv(
+		const bitvalue_repr & divisor,
+		bitvalue_repr & quotient,
+		bitvalue_repr & remainder) const;
+
+	static void
+	serial_mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product);
+
 	inline void
 	udiv(
 		const bitvalue_repr & divisor,
@@ -166,80 +410,63 @@ private:
 		JIVE_DEBUG_ASSERT(quotient == 0);
 		JIVE_DEBUG_ASSERT(remainder == 0);
 
-		if (divisor.nbits() != nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(divisor);
 
-		/*
-			FIXME: This should check whether divisor is zero, not whether nbits() is zero.
-		*/
-		if (divisor.nbits() == 0)
-			throw compiler_error("Division by zero.");
-
-		for (size_t n = 0; n < nbits(); n++) {
-			remainder = remainder.shl(1);
-			remainder[0] = data_[nbits()-n-1];
-			if (remainder.uge(divisor) == '1') {
-				remainder = remainder.sub(divisor);
-				quotient[nbits()-n-1] = '1';
-			}
-		}
+		if (is_known() && divisor.is_known())
+			known_udiv(divisor, quotient, remainder);
+		else
+			serial_udiv(divisor, quotient, remainder);
 	}
 
-	inline void
-	mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product) const
-	{
-		JIVE_DEBUG_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
-
-		for (size_t i = 0; i < factor1.nbits(); i++) {
-			char c = '0';
-			for (size_t j = 0; j < factor2.nbits(); j++) {
-				char s = land(factor1[i], factor2[j]);
-				char nc = carry(s, product[i+j], c);
-				product[i+j] = add(s, product[i+j], c);
-				c = nc;
-			}
-		}
+	/*
+		Returns the bits [nbits, 2*nbits) of a 128-bit product given by its
+		low and high word.
+	*/
+	inline bitvalue_repr
+	high_product(uint64_t low, uint64_t high) const
+	{
+		bitvalue_repr result(nbits(), 0);
+		result.inline_limb_.value = nbits_ == 64 ? high : (low >> nbits_) | (high << (64 - nbits_));
+		result.normalize();
+		return result;
 	}
 
 public:
 	/*
 		FIXME: add <, <=, >, >= operator for uint64_t and int64_t
 	*/
-	inline bitvalue_repr &
-	operator=(const bitvalue_repr & other)
-	{
-		data_ = other.data_;
-		return *this;
-	}
-
 	bitvalue_repr &
-	operator=(bitvalue_repr && other)
-	{
-		if (this == &other)
-			return *this;
+	operator=(const bitvalue_repr & other) = default;
 
-		data_ = std::move(other.data_);
-		return *this;
-	}
+	bitvalue_repr &
+	operator=(bitvalue_repr && other) = default;
 
-	inline char &
+	inline reference
 	operator[](size_t n)
 	{
 		JIVE_DEBUG_ASSERT(n < nbits());
-		return data_[n];
+		return reference(*this, n);
 	}
 
-	inline const char &
+	inline char
 	operator[](size_t n) const
 	{
 		JIVE_DEBUG_ASSERT(n < nbits());
-		return data_[n];
+		return get_bit(n);
 	}
 
 	inline bool
 	operator==(const bitvalue_repr & other) const noexcept
 	{
-		return data_ == other.data_;
+		if (nbits() != other.nbits())
+			return false;
+
+		for (size_t n = 0; n < nlimbs(); n++) {
+			if (data()[n] != other.data()[n])
+				return false;
+		}
+
+		return true;
 	}
 
 	inline bool
@@ -267,7 +494,7 @@ public:
 			return false;
 
 		for (size_t n = 0; n < other.size(); n++) {
-			if (data_[n] != other[n])
+			if (get_bit(n) != other[n])
 				return false;
 		}
 
@@ -283,14 +510,14 @@ public:
 	inline char
 	sign() const noexcept
 	{
-		return data_[nbits()-1];
+		return get_bit(nbits()-1);
 	}
 
 	inline bool
 	is_defined() const noexcept
 	{
-		for (auto bit : data_) {
-			if (bit == 'X')
+		for (size_t n = 0; n < nlimbs(); n++) {
+			if (data()[n].value & data()[n].mask)
 				return false;
 		}
 
@@ -300,8 +527,8 @@ public:
 	inline bool
 	is_known() const noexcept
 	{
-		for (auto bit : data_) {
-			if (bit == 'X' || bit == 'D')
+		for (size_t n = 0; n < nlimbs(); n++) {
+			if (data()[n].mask)
 				return false;
 		}
 
@@ -314,23 +541,11 @@ public:
 		return sign() == '1';
 	}
 
-	inline bitvalue_repr
-	concat(const bitvalue_repr & other) const
-	{
-		bitvalue_repr result(*this);
-		result.data_.insert(result.data_.end(), other.data_.begin(), other.data_.end());
-		return result;
-	}
-
-	inline bitvalue_repr
-	slice(size_t low, size_t high) const
-	{
-		if (high <= low || high > nbits()) {
-			throw compiler_error("Slice is out of bound.");
-		}
+	bitvalue_repr
+	concat(const bitvalue_repr & other) const;
 
-		return bitvalue_repr(std::string(&data_[low], high - low).c_str());
-	}
+	bitvalue_repr
+	slice(size_t low, size_t high) const;
 
 	inline bitvalue_repr
 	zext(size_t nbits) const
@@ -353,14 +568,14 @@ public:
 	inline size_t
 	nbits() const noexcept
 	{
-		return data_.size();
+		return nbits_;
 	}
 
-	inline std::string
-	str() const
-	{
-		return std::string(data_.begin(), data_.end());
-	}
+	std::string
+	str() const;
+
+	size_t
+	hash() const noexcept;
 
 	uint64_t
 	to_uint() const;
@@ -371,19 +586,22 @@ public:
 	inline char
 	ult(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		char v = land(lnot(data_[0]), other[0]);
-		for (size_t n = 1; n < nbits(); n++)
-			v = land(lor(lnot(data_[n]), other[n]), lor(land(lnot(data_[n]), other[n]), v));
+		if (is_known() && other.is_known())
+			return to_bit(known_ult(other));
 
-		return v;
+		return serial_ult(other);
 	}
 
 	inline char
 	slt(const bitvalue_repr & other) const
 	{
+		check_nbits(other);
+
+		if (is_known() && other.is_known())
+			return to_bit(known_slt(other));
+
 		bitvalue_repr t1(*this), t2(other);
 		t1[t1.nbits()-1] = lnot(t1.sign());
 		t2[t2.nbits()-1] = lnot(t2.sign());
@@ -393,19 +611,22 @@ public:
 	inline char
 	ule(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		char v = '1';
-		for (size_t n = 0; n < nbits(); n++)
-			v = land(land(lor(lnot(data_[n]), other[n]), lor(lnot(data_[n]), v)), lor(v, other[n]));
+		if (is_known() && other.is_known())
+			return to_bit(!other.known_ult(*this));
 
-		return v;
+		return serial_ule(other);
 	}
 
 	inline char
 	sle(const bitvalue_repr & other) const
 	{
+		check_nbits(other);
+
+		if (is_known() && other.is_known())
+			return to_bit(!other.known_slt(*this));
+
 		bitvalue_repr t1(*this), t2(other);
 		t1[t1.nbits()-1] = lnot(t1.sign());
 		t2[t2.nbits()-1] = lnot(t2.sign());
@@ -415,13 +636,12 @@ public:
 	inline char
 	ne(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		char v = '0';
-		for (size_t n = 0; n < nbits(); n++)
-			v = lor(v, lxor(data_[n], other[n]));
-		return v;
+		if (is_known() && other.is_known())
+			return to_bit(*this != other);
+
+		return serial_ne(other);
 	}
 
 	inline char
@@ -457,28 +677,30 @@ public:
 	inline bitvalue_repr
 	add(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		char c = '0';
-		bitvalue_repr sum = repeat(nbits(), 'X');
-		for (size_t n = 0; n < nbits(); n++) {
-			sum[n] = add(data_[n], other[n], c);
-			c = carry(data_[n], other[n], c);
-		}
+		if (is_known() && other.is_known())
+			return known_add(other);
 
-		return sum;
+		return serial_add(other);
 	}
 
 	inline bitvalue_repr
 	land(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		bitvalue_repr result = repeat(nbits(), 'X');
-		for (size_t n = 0; n < nbits(); n++)
-			result[n] = land(data_[n], other[n]);
+		bitvalue_repr result(*this);
+		for (size_t n = 0; n < nlimbs(); n++) {
+			auto & a = data()[n];
+			auto & b = other.data()[n];
+			uint64_t zero = (~a.value & ~a.mask) | (~b.value & ~b.mask);
+			uint64_t one = (a.value & ~a.mask) & (b.value & ~b.mask);
+			uint64_t undefined = ((a.value & a.mask) | (b.value & b.mask)) & ~zero;
+			result.data()[n].value = one | undefined;
+			result.data()[n].mask = (a.mask | b.mask) & ~zero;
+		}
+		result.normalize();
 
 		return result;
 	}
@@ -486,12 +708,18 @@ public:
 	inline bitvalue_repr
 	lor(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		bitvalue_repr result = repeat(nbits(), 'X');
-		for (size_t n = 0; n < nbits(); n++)
-			result[n] = lor(data_[n], other[n]);
+		bitvalue_repr result(*this);
+		for (size_t n = 0; n < nlimbs(); n++) {
+			auto & a = data()[n];
+			auto & b = other.data()[n];
+			uint64_t one = (a.value & ~a.mask) | (b.value & ~b.mask);
+			uint64_t undefined = ((a.value & a.mask) | (b.value & b.mask)) & ~one;
+			result.data()[n].value = one | undefined;
+			result.data()[n].mask = (a.mask | b.mask) & ~one;
+		}
+		result.normalize();
 
 		return result;
 	}
@@ -499,12 +727,18 @@ public:
 	inline bitvalue_repr
 	lxor(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
 
-		bitvalue_repr result = repeat(nbits(), 'X');
-		for (size_t n = 0; n < nbits(); n++)
-			result[n] = lxor(data_[n], other[n]);
+		bitvalue_repr result(*this);
+		for (size_t n = 0; n < nlimbs(); n++) {
+			auto & a = data()[n];
+			auto & b = other.data()[n];
+			uint64_t unknown = a.mask | b.mask;
+			uint64_t undefined = (a.value & a.mask) | (b.value & b.mask);
+			result.data()[n].value = ((a.value ^ b.value) & ~unknown) | undefined;
+			result.data()[n].mask = unknown;
+		}
+		result.normalize();
 
 		return result;
 	}
@@ -512,21 +746,23 @@ public:
 	inline bitvalue_repr
 	lnot() const
 	{
-		return lxor(repeat(nbits(), '1'));
+		bitvalue_repr result(*this);
+		for (size_t n = 0; n < nlimbs(); n++) {
+			auto & a = data()[n];
+			result.data()[n].value = (~a.value & ~a.mask) | (a.value & a.mask);
+		}
+		result.normalize();
+
+		return result;
 	}
 
 	inline bitvalue_repr
 	neg() const
 	{
-		char c = '1';
-		bitvalue_repr result = repeat(nbits(), 'X');
-		for (size_t n = 0; n < nbits(); n++) {
-			char tmp = lxor(data_[n], '1');
-			result[n] = add(tmp, '0', c);
-			c = carry(tmp, '0', c);
-		}
+		if (is_known())
+			return known_neg();
 
-		return result;
+		return serial_neg();
 	}
 
 	inline bitvalue_repr
@@ -541,8 +777,7 @@ public:
 		if (shift >= nbits())
 			return repeat(nbits(), '0');
 
-		bitvalue_repr result(std::string(&data_[shift], nbits()-shift).c_str());
-		return result.zext(shift);
+		return slice(shift, nbits()).zext(shift);
 	}
 
 	inline bitvalue_repr
@@ -551,8 +786,7 @@ public:
 		if (shift >= nbits())
 			return repeat(nbits(), sign());
 
-		bitvalue_repr result(std::string(&data_[shift], nbits()-shift).c_str());
-		return result.sext(shift);
+		return slice(shift, nbits()).sext(shift);
 	}
 
 	inline bitvalue_repr
@@ -631,43 +865,41 @@ public:
 	inline bitvalue_repr
 	mul(const bitvalue_repr & other) const
 	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+		check_nbits(other);
+
+		if (is_known() && other.is_known())
+			return known_mul(other);
 
 		bitvalue_repr product(2*nbits(), 0);
-		mul(*this, other, product);
+		serial_mul(*this, other, product);
 		return product.slice(0, nbits());
 	}
 
-	inline bitvalue_repr
-	umulh(const bitvalue_repr & other) const
-	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+	bitvalue_repr
+	umulh(const bitvalue_repr & other) const;
 
-		bitvalue_repr product(4*nbits(), 0);
-		bitvalue_repr factor1 = this->zext(nbits());
-		bitvalue_repr factor2 = other.zext(nbits());
-		mul(factor1, factor2, product);
-		return product.slice(nbits(), 2*nbits());
-	}
+	bitvalue_repr
+	smulh(const bitvalue_repr & other) const;
 
-	inline bitvalue_repr
-	smulh(const bitvalue_repr & other) const
-	{
-		if (nbits() != other.nbits())
-			throw compiler_error("Unequal number of bits.");
+private:
+	size_t nbits_;
+	/* limb of representations with at most 64 bits */
+	limb inline_limb_;
+	/* [lsb ... msb] limbs of representations with more than 64 bits */
+	std::vector<limb> limbs_;
+};
 
-		bitvalue_repr product(4*nbits(), 0);
-		bitvalue_repr factor1 = this->sext(nbits());
-		bitvalue_repr factor2 = other.sext(nbits());
-		mul(factor1, factor2, product);
-		return product.slice(nbits(), 2*nbits());
-	}
+}
 
-private:
-	/* [lsb ... msb] */
-	std::vector<char> data_;
+namespace std {
+
+template<>
+struct hash<jive::bitvalue_repr> {
+	size_t
+	operator()(const jive::bitvalue_repr & repr) const noexcept
+	{
+		return repr.hash();
+	}
 };
 
 }
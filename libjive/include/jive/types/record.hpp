@@ -98,6 +98,9 @@ public:
 	virtual bool
 	operator==(const jive::type & type) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::unique_ptr<jive::type>
 	copy() const override;
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_ARENA_HPP
+#define JIVE_UTIL_ARENA_HPP
+
+#include <jive/util/per-thread.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace jive {
+namespace detail {
+
+/**
+	\brief Memory arena with size-class free lists
+
+	The arena hands out memory by bumping a pointer through large chunks.
+	Blocks up to \ref max_size_class bytes are grouped into size classes
+	of \ref granularity bytes. A deallocated block is put on the free list
+	of its size class and is reused by the next allocation of the same
+	class. Larger blocks are forwarded to the global allocator.
+
+	All chunks are released in bulk upon destruction of the arena, i.e.,
+	the arena must outlive all objects allocated from it. The arena is
+	only thread-safe if it is synchronized, see \ref set_synchronized().
+*/
+class arena final {
+	struct free_block {
+		free_block * next;
+	};
+
+public:
+	static constexpr size_t granularity = alignof(std::max_align_t);
+	static constexpr size_t max_size_class = 512;
+	static constexpr size_t chunk_size = 64 * 1024;
+
+	struct statistics {
+		size_t nallocations = 0;
+		size_t ndeallocations = 0;
+		size_t nreused = 0;
+		size_t nlarge_allocations = 0;
+		size_t nchunks = 0;
+		size_t nbytes_reserved = 0;
+	};
+
+	~arena() noexcept;
+
+	arena() noexcept;
+
+	arena(const arena &) = delete;
+
+	arena(arena &&) = delete;
+
+	arena &
+	operator=(const arena &) = delete;
+
+	arena &
+	operator=(arena &&) = delete;
+
+	void *
+	allocate(size_t size);
+
+	void
+	deallocate(void * p, size_t size) noexcept;
+
+	/**
+		\brief Statistics about the allocations of all threads
+
+		Must not be invoked while other threads use the arena.
+	*/
+	statistics
+	stats() const noexcept;
+
+	/**
+		\brief Enable allocations and deallocations from several threads
+
+		A synchronized arena serves every thread from a shard of its own,
+		i.e., from its own chunk and free lists. Only the allocation of a
+		new chunk takes a lock. Once the arena is no longer synchronized,
+		the blocks on the free lists of the shards are handed back to the
+		arena.
+
+		Must not be toggled while other threads use the arena.
+	*/
+	void
+	set_synchronized(bool synchronized) noexcept;
+
+	inline bool
+	synchronized() const noexcept
+	{
+		return synchronized_;
+	}
+
+private:
+	struct shard {
+		inline
+		shard() noexcept
+		: current(nullptr)
+		, end(nullptr)
+		{
+			free_lists.fill(nullptr);
+		}
+
+		char * current;
+		char * end;
+		statistics stats;
+		std::array<free_block*, max_size_class / granularity + 1> free_lists;
+	};
+
+	static inline size_t
+	size_class(size_t size) noexcept
+	{
+		return (size + granularity - 1) / granularity;
+	}
+
+	void *
+	allocate(shard & s, size_t size);
+
+	static void
+	deallocate(shard & s, void * p, size_t size) noexcept;
+
+	void *
+	allocate_chunk(size_t size);
+
+	bool synchronized_;
+	shard shard_;
+	per_thread<shard> shards_;
+	std::mutex mutex_;
+	size_t nchunks_;
+	size_t nbytes_reserved_;
+	std::vector<void*> chunks_;
+};
+
+/**
+	\brief Mixin for classes whose instances can be allocated from an arena
+
+	Instances can be allocated from the global allocator with an ordinary
+	new-expression, or from an arena with a placement new-expression:
+
+	\code
+	auto obj = new (arena) T(...);
+	\endcode
+
+	Both kinds of instances are destroyed with an ordinary delete-expression.
+	Every allocation is prefixed with a small header that records the arena
+	an instance was allocated from. Classes deriving from this mixin must
+	therefore have a virtual destructor if they are deleted through a
+	pointer to a base class.
+*/
+class arena_allocated {
+	struct header {
+		detail::arena * arena;
+		size_t size;
+	};
+
+	static constexpr size_t header_size =
+		(sizeof(header) + arena::granularity - 1) / arena::granularity * arena::granularity;
+
+public:
+	struct statistics {
+		size_t nheap_allocations = 0;
+		size_t nheap_deallocations = 0;
+	};
+
+	static void *
+	operator new(size_t size);
+
+	static void *
+	operator new(size_t size, detail::arena & arena);
+
+	static void
+	operator delete(void * p, size_t size) noexcept;
+
+	static void
+	operator delete(void * p, detail::arena & arena) noexcept;
+
+	/**
+		\brief Statistics about instances allocated from the global allocator
+	*/
+	static statistics
+	heap_stats() noexcept;
+};
+
+}
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 namespace jive {
 
@@ -133,6 +134,10 @@ private:
 			if (!notifier_) {
 				return;
 			}
+
+			std::unique_lock<std::recursive_mutex> lock;
+			if (notifier_->mutex_)
+				lock = std::unique_lock<std::recursive_mutex>(*notifier_->mutex_);
 			
 			if (prev_) {
 				prev_->next_ = next_;
@@ -144,6 +149,7 @@ private:
 			} else {
 				notifier_->last_ = prev_;
 			}
+			notifier_->nconnections_.fetch_sub(1, std::memory_order_relaxed);
 			
 			notifier_ = 0;
 		}
@@ -165,13 +171,21 @@ public:
 	
 	inline constexpr
 	notifier() noexcept
-		: first_(nullptr), last_(nullptr)
+		: first_(nullptr), last_(nullptr), mutex_(nullptr), nconnections_(0)
 	{
 	}
 
 	inline void
 	operator()(Args... args) const
 	{
+		/* do not contend for the mutex if nobody listens */
+		if (nconnections_.load(std::memory_order_acquire) == 0)
+			return;
+
+		std::unique_lock<std::recursive_mutex> lock;
+		if (mutex_)
+			lock = std::unique_lock<std::recursive_mutex>(*mutex_);
+
 		callback_impl * current = first_;
 		while (current) {
 			current->fn_(args...);
@@ -183,6 +197,10 @@ public:
 	connect(function_type fn)
 	{
 		callback_impl * c = new callback_impl(this, std::move(fn));
+
+		std::unique_lock<std::recursive_mutex> lock;
+		if (mutex_)
+			lock = std::unique_lock<std::recursive_mutex>(*mutex_);
 		
 		c->prev_ = last_;
 		c->next_ = nullptr;
@@ -192,6 +210,7 @@ public:
 			first_ = c;
 		}
 		last_ = c;
+		nconnections_.fetch_add(1, std::memory_order_release);
 		
 		return callback(c);
 	}
@@ -202,9 +221,24 @@ public:
 		return notifier_proxy<Args...>(*this);
 	}
 
+	/**
+		\brief Guard connections, disconnections, and notifications with \p mutex
+
+		Callbacks are invoked with the mutex held. A null mutex disables
+		the synchronization. Must not be changed while other threads use
+		the notifier.
+	*/
+	inline void
+	set_mutex(std::recursive_mutex * mutex) noexcept
+	{
+		mutex_ = mutex;
+	}
+
 private:
 	callback_impl * first_;
 	callback_impl * last_;
+	std::recursive_mutex * mutex_;
+	std::atomic<size_t> nconnections_;
 };
 
 }
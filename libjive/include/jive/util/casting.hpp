@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_CASTING_HPP
+#define JIVE_UTIL_CASTING_HPP
+
+#include <type_traits>
+#include <typeinfo>
+
+namespace jive {
+
+/**
+	\brief Customization point for isa() and dyn_cast()
+
+	A specialization for class \c T provides a static function classof()
+	that checks whether an object is an instance of \c T without consulting
+	RTTI, usually by inspecting a kind tag of the base class. Specializations
+	are not inherited, which prevents a derived class from silently using
+	the check of its base class.
+*/
+template<class T>
+struct cast_traits {
+	static constexpr bool has_classof = false;
+};
+
+/**
+	\brief Checks whether \p value is an instance of class \p T
+
+	The check prefers the classof() function of cast_traits. Final classes
+	are checked by comparing the dynamic type of \p value, and all other
+	classes fall back to dynamic_cast.
+*/
+template<class T, class U> static inline bool
+isa(const U & value) noexcept
+{
+	static_assert(std::is_polymorphic<U>::value,
+		"Template parameter U must be a polymorphic type.");
+
+	if constexpr (std::is_base_of<T, U>::value)
+		return true;
+	else if constexpr (cast_traits<T>::has_classof)
+		return cast_traits<T>::classof(value);
+	else if constexpr (std::is_final<T>::value)
+		return typeid(value) == typeid(T);
+	else
+		return dynamic_cast<const T*>(&value) != nullptr;
+}
+
+/**
+	\brief Casts \p value to class \p T
+
+	\return \p value cast to \p T if it is an instance of \p T, otherwise null.
+*/
+template<class T, class U> static inline
+typename std::conditional<std::is_const<U>::value, const T, T>::type *
+dyn_cast(U * value) noexcept
+{
+	using result_type = typename std::conditional<std::is_const<U>::value, const T, T>::type;
+
+	if (value == nullptr || !isa<T>(*value))
+		return nullptr;
+
+	return static_cast<result_type*>(value);
+}
+
+}
+
+#endif
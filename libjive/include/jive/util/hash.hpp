@@ -0,0 +1,27 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_HASH_HPP
+#define JIVE_UTIL_HASH_HPP
+
+#include <functional>
+
+namespace jive {
+namespace detail {
+
+/**
+	\brief Mixes the hash of \p value into \p seed.
+*/
+template<typename T>
+static inline void
+hash_combine(size_t & seed, const T & value) noexcept
+{
+	seed ^= std::hash<T>()(value) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_ID_ALLOCATOR_HPP
+#define JIVE_UTIL_ID_ALLOCATOR_HPP
+
+#include <jive/common.hpp>
+#include <jive/util/per-thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace jive {
+namespace detail {
+
+/**
+	\brief Allocator for dense identifiers
+
+	Hands out identifiers in the range [0, \ref bound()). Released
+	identifiers are recycled by subsequent allocations such that the
+	range stays proportional to the maximal number of live identifiers.
+	The allocator is only thread-safe if it is synchronized, see
+	\ref set_synchronized().
+*/
+class id_allocator final {
+	struct block {
+		inline
+		block() noexcept
+		: next(0)
+		, end(0)
+		{}
+
+		size_t next;
+		size_t end;
+		std::vector<size_t> free;
+	};
+
+public:
+	/**
+		\brief Number of identifiers a thread obtains at once if synchronized
+	*/
+	static constexpr size_t block_size = 64;
+
+	inline
+	id_allocator() noexcept
+	: bound_(0)
+	, synchronized_(false)
+	{}
+
+	id_allocator(const id_allocator &) = delete;
+
+	id_allocator(id_allocator &&) = delete;
+
+	id_allocator &
+	operator=(const id_allocator &) = delete;
+
+	id_allocator &
+	operator=(id_allocator &&) = delete;
+
+	inline size_t
+	allocate()
+	{
+		if (synchronized_)
+			return allocate(blocks_.local());
+
+		if (free_.empty())
+			return bound_++;
+
+		auto id = free_.back();
+		free_.pop_back();
+		return id;
+	}
+
+	inline void
+	release(size_t id)
+	{
+		if (synchronized_) {
+			release(blocks_.local(), id);
+			return;
+		}
+
+		JIVE_DEBUG_ASSERT(id < bound_);
+		free_.push_back(id);
+	}
+
+	/**
+		\brief Enable allocations and releases from several threads
+
+		A synchronized allocator hands out blocks of \ref block_size
+		identifiers to the threads, which then allocate and release
+		identifiers without any synchronization. Only obtaining a new
+		block, or handing back a surplus of released identifiers, takes a
+		lock. Once the allocator is no longer synchronized, all identifiers
+		that the threads hold are handed back.
+
+		Must not be toggled while other threads use the allocator.
+	*/
+	inline void
+	set_synchronized(bool synchronized)
+	{
+		synchronized_ = synchronized;
+		if (synchronized)
+			return;
+
+		blocks_.for_each([&](block & b)
+		{
+			for (; b.next != b.end; b.next++)
+				free_.push_back(b.next);
+			free_.insert(free_.end(), b.free.begin(), b.free.end());
+			b.free.clear();
+		});
+	}
+
+	/**
+		\brief Upper bound of all identifiers handed out so far
+
+		Includes the identifiers that are held by threads if synchronized.
+	*/
+	inline size_t
+	bound() const noexcept
+	{
+		return bound_;
+	}
+
+	/**
+		\brief Number of identifiers that are currently in use
+
+		Only exact if the allocator is not synchronized.
+	*/
+	inline size_t
+	nallocated() const noexcept
+	{
+		return bound_ - free_.size();
+	}
+
+private:
+	inline size_t
+	allocate(block & b)
+	{
+		if (b.free.empty() && b.next == b.end) {
+			std::lock_guard<std::mutex> guard(mutex_);
+			if (free_.empty()) {
+				b.next = bound_;
+				b.end = bound_ + block_size;
+				bound_ = b.end;
+			} else {
+				auto n = std::min(free_.size(), block_size);
+				b.free.assign(free_.end() - n, free_.end());
+				free_.resize(free_.size() - n);
+			}
+		}
+
+		if (!b.free.empty()) {
+			auto id = b.free.back();
+			b.free.pop_back();
+			return id;
+		}
+
+		return b.next++;
+	}
+
+	inline void
+	release(block & b, size_t id)
+	{
+		b.free.push_back(id);
+		if (b.free.size() < 2 * block_size)
+			return;
+
+		std::lock_guard<std::mutex> guard(mutex_);
+		free_.insert(free_.end(), b.free.end() - block_size, b.free.end());
+		b.free.resize(b.free.size() - block_size);
+	}
+
+	size_t bound_;
+	bool synchronized_;
+	std::mutex mutex_;
+	std::vector<size_t> free_;
+	per_thread<block> blocks_;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JIVE_UTIL_PER_THREAD_HPP
+#define JIVE_UTIL_PER_THREAD_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace jive {
+namespace detail {
+
+/**
+	\brief Instances of a type that are private to the threads using them
+
+	Every thread that invokes \ref local() obtains its own default
+	constructed instance, which it can use without any synchronization.
+	The instance of a thread is remembered in a small thread-local cache,
+	such that only the first access of a thread takes a lock. All
+	instances live until the destruction of this object.
+
+	\tparam T The type of the instances. Must be default constructible.
+*/
+template<typename T>
+class per_thread final {
+	struct cache_entry {
+		uint64_t generation = 0;
+		T * instance = nullptr;
+	};
+
+	static constexpr size_t cache_size = 16;
+
+public:
+	inline
+	per_thread()
+	: generation_(next_generation())
+	{}
+
+	per_thread(const per_thread &) = delete;
+
+	per_thread(per_thread &&) = delete;
+
+	per_thread &
+	operator=(const per_thread &) = delete;
+
+	per_thread &
+	operator=(per_thread &&) = delete;
+
+	/**
+		\brief Returns the instance of the calling thread
+	*/
+	inline T &
+	local()
+	{
+		thread_local std::array<cache_entry, cache_size> cache;
+
+		auto & entry = cache[generation_ % cache_size];
+		if (entry.generation == generation_)
+			return *entry.instance;
+
+		std::lock_guard<std::mutex> guard(mutex_);
+		auto id = std::this_thread::get_id();
+		T * instance = nullptr;
+		for (auto & pair : instances_) {
+			if (pair.first == id)
+				instance = pair.second.get();
+		}
+
+		if (instance == nullptr) {
+			instances_.emplace_back(id, std::make_unique<T>());
+			instance = instances_.back().second.get();
+		}
+
+		entry.generation = generation_;
+		entry.instance = instance;
+		return *instance;
+	}
+
+	/**
+		\brief Invokes \p f on the instances of all threads
+
+		Must not be invoked while other threads use their instances.
+	*/
+	template<typename F> inline void
+	for_each(const F & f) const
+	{
+		for (auto & pair : instances_)
+			f(*pair.second);
+	}
+
+private:
+	/*
+		Every object obtains a unique generation, which is used to identify
+		its entries in the thread-local caches. An object that is allocated
+		at the address of a destroyed object therefore never observes the
+		stale entries of its predecessor.
+	*/
+	static inline uint64_t
+	next_generation() noexcept
+	{
+		static std::atomic<uint64_t> generation(1);
+		return generation.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint64_t generation_;
+	std::mutex mutex_;
+	std::vector<std::pair<std::thread::id, std::unique_ptr<T>>> instances_;
+};
+
+}
+}
+
+#endif
@@ -33,9 +33,30 @@ region_tree(const jive::region * region);
 void
 region_tree(const jive::region * region, FILE * out);
 
+/** \brief Destination of the XML representation of a region
+*
+* The XML writer passes the document to the sink in consecutive chunks. Exceptions thrown by
+* write() are propagated to the caller of view_xml().
+*/
+class xml_sink {
+public:
+	virtual
+	~xml_sink();
+
+	virtual void
+	write(const char * data, size_t size) = 0;
+};
+
 std::string
 to_xml(const jive::region * region);
 
+/** \brief Streams the XML representation of \p region to \p sink
+*
+* The document is emitted while the region is traversed and never materialized as a whole.
+*/
+void
+view_xml(const jive::region * region, xml_sink & sink);
+
 void
 view_xml(const jive::region * region, FILE * out);
 
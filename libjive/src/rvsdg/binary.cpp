@@ -11,6 +11,7 @@
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/structural-node.hpp>
 #include <jive/rvsdg/traverser.hpp>
+#include <jive/util/hash.hpp>
 
 #include <deque>
 
@@ -317,6 +318,14 @@ flattened_binary_op::operator==(const operation & other) const noexcept
 	    && op->narguments() == narguments();
 }
 
+size_t
+flattened_binary_op::hash() const noexcept
+{
+	auto seed = bin_operation().hash();
+	jive::detail::hash_combine(seed, narguments());
+	return seed;
+}
+
 std::string
 flattened_binary_op::debug_string() const
 {
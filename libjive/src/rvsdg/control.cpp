@@ -13,6 +13,7 @@
 #include <jive/rvsdg/control.hpp>
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/region.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -47,6 +48,14 @@ ctltype::operator==(const jive::type & other) const noexcept
 	return type && type->nalternatives_ == nalternatives_;
 }
 
+size_t
+ctltype::hash() const noexcept
+{
+	auto seed = typeid(ctltype).hash_code();
+	detail::hash_combine(seed, nalternatives_);
+	return seed;
+}
+
 std::unique_ptr<jive::type>
 ctltype::copy() const
 {
@@ -91,6 +100,16 @@ match_op::operator==(const operation & other) const noexcept
 	    && op->nalternatives() == nalternatives();
 }
 
+size_t
+match_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, nbits());
+	jive::detail::hash_combine(seed, default_alternative_);
+	jive::detail::hash_combine(seed, nalternatives());
+	return seed;
+}
+
 jive_unop_reduction_path_t
 match_op::can_reduce_operand(const jive::output * arg) const noexcept
 {
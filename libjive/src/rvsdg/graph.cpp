@@ -6,6 +6,11 @@
 
 #include <cxxabi.h>
 
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node-normal-form.hpp>
 #include <jive/rvsdg/node.hpp>
@@ -66,7 +71,11 @@ graph::~graph()
 }
 
 graph::graph()
-	: normalized_(false)
+	: ntrackers_(0)
+	, normalized_(false)
+	, nmutations_(0)
+	, concurrent_(false)
+	, batch_depth_(0)
 	, root_(new jive::region(nullptr, this))
 {}
 
@@ -79,16 +88,121 @@ graph::copy() const
 	return graph;
 }
 
+void
+graph::set_concurrent(bool concurrent)
+{
+	concurrent_ = concurrent;
+	arena_.set_synchronized(concurrent);
+	node_ids_.set_synchronized(concurrent);
+	input_ids_.set_synchronized(concurrent);
+	output_ids_.set_synchronized(concurrent);
+	notifiers_.set_synchronized(concurrent);
+}
+
+void
+graph::FlushBatch() noexcept
+{
+	if (batch_nodes_.empty())
+		return;
+
+	/*
+		The depths are recomputed with a worklist that is seeded with the recorded nodes. The
+		successors of a node are only revisited if its depth changed, so the work is
+		proportional to the nodes whose depths change instead of the successors of all recorded
+		nodes. The worklist is ordered by depth, which is a topological order apart from the
+		edges that were added within the batch. A node whose producer is updated after the node
+		itself is simply revisited.
+	*/
+	auto compare = [](const std::pair<size_t, jive::node*> & a, const std::pair<size_t, jive::node*> & b)
+	{
+		return a.first > b.first;
+	};
+	std::priority_queue<
+		std::pair<size_t, jive::node*>,
+		std::vector<std::pair<size_t, jive::node*>>,
+		decltype(compare)
+	> worklist(compare);
+
+	std::unordered_set<jive::node*> queued;
+	auto push = [&](jive::node * node)
+	{
+		if (queued.insert(node).second)
+			worklist.push({node->depth(), node});
+	};
+
+	for (auto node : batch_nodes_) {
+		node->batch_index_ = SIZE_MAX;
+		push(node);
+	}
+	batch_nodes_.clear();
+
+	std::unordered_map<jive::node*, size_t> old_depths;
+	std::vector<jive::node*> changed;
+	while (!worklist.empty()) {
+		auto node = worklist.top().second;
+		worklist.pop();
+		queued.erase(node);
+
+		size_t depth = 0;
+		for (size_t i = 0; i < node->ninputs(); i++) {
+			auto producer = node_output::node(node->input(i)->origin());
+			depth = std::max(depth, producer ? producer->depth()+1 : 0);
+		}
+
+		if (depth == node->depth())
+			continue;
+
+		if (old_depths.insert({node, node->depth()}).second)
+			changed.push_back(node);
+		node->depth_ = depth;
+
+		for (size_t o = 0; o < node->noutputs(); o++) {
+			for (auto user : *node->output(o)) {
+				if (auto successor = input::GetNode(*user))
+					push(successor);
+			}
+		}
+	}
+
+	/* notify once per node, as a node might have been revisited */
+	for (auto node : changed) {
+		auto old_depth = old_depths[node];
+		if (node->depth() != old_depth) {
+			notifiers().on_node_depth_change(node, old_depth);
+			node->region()->notifiers().on_node_depth_change(node, old_depth);
+		}
+	}
+}
+
 jive::node_normal_form *
 graph::node_normal_form(const std::type_info & type) noexcept
 {
-	auto i = node_normal_forms_.find(std::type_index(type));
-	if (i != node_normal_forms_.end())
-		return i.ptr();
+	/*
+		The normal forms of all operations are usually created early on, so
+		concurrent lookups only share the lock for reading.
+	*/
+	{
+		std::shared_lock<std::shared_mutex> lock(normal_forms_mutex_, std::defer_lock);
+		if (concurrent_)
+			lock.lock();
+
+		auto i = node_normal_forms_.find(std::type_index(type));
+		if (i != node_normal_forms_.end())
+			return i.ptr();
+	}
 
 	const auto cinfo = dynamic_cast<const abi::__si_class_type_info *>(&type);
 	auto parent_normal_form = cinfo ? node_normal_form(*cinfo->__base_type) : nullptr;
 
+	std::unique_lock<std::shared_mutex> lock(normal_forms_mutex_, std::defer_lock);
+	if (concurrent_)
+		lock.lock();
+
+	/* another thread might have created the normal form in the meantime */
+	auto i = node_normal_forms_.find(std::type_index(type));
+	if (i != node_normal_forms_.end())
+		return i.ptr();
+
 	std::unique_ptr<jive::node_normal_form> nf(
 		jive::node_normal_form::create(type, parent_normal_form, this));
 
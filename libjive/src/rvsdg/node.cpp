@@ -22,13 +22,18 @@ namespace jive {
 input::~input() noexcept
 {
 	origin()->remove_user(this);
+	region()->graph()->input_ids_.release(id_);
 }
 
 input::input(
+	jive::input_kind kind,
 	jive::output * origin,
 	jive::region * region,
 	const jive::port & port)
-: index_(0)
+: kind_(kind)
+, id_(region->graph()->input_ids_.allocate())
+, index_(0)
+, user_index_(0)
 , origin_(origin)
 , region_(region)
 , port_(port.copy())
@@ -36,7 +41,7 @@ input::input(
 	if (region != origin->region())
 		throw jive::compiler_error("Invalid operand region.");
 
-	if (port.type() != origin->type())
+	if (!equal_canonical_types(port.type(), origin->type()))
 		throw jive::type_error(port.type().debug_string(), origin->type().debug_string());
 
 	origin->add_user(this);
@@ -54,22 +59,35 @@ input::divert_to(jive::output * new_origin)
 	if (origin() == new_origin)
 		return;
 
-	if (type() != new_origin->type())
+	if (!equal_canonical_types(type(), new_origin->type()))
 		throw jive::type_error(type().debug_string(), new_origin->type().debug_string());
 
 	if (region() != new_origin->region())
 		throw jive::compiler_error("Invalid operand region.");
 
+	/*
+		The origins of a simple node's inputs are part of its key in the
+		region's CSE table. Re-insert the node under its new key.
+	*/
+	auto snode = is<simple_input>(*this) ? static_cast<simple_input*>(this)->node() : nullptr;
+	if (snode)
+		region()->cse_remove(snode);
+
 	auto old_origin = origin();
 	old_origin->remove_user(this);
 	this->origin_ = new_origin;
 	new_origin->add_user(this);
 
+	if (snode)
+		region()->cse_insert(snode);
+
 	if (is<node_input>(*this))
 		static_cast<node_input*>(this)->node()->recompute_depth();
 
 	region()->graph()->mark_denormalized();
-	on_input_change(this, old_origin, new_origin);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_input_change(this, old_origin, new_origin);
+	region()->notifiers().on_input_change(this, old_origin, new_origin);
 }
 
 jive::node*
@@ -86,12 +104,17 @@ input::GetNode(const jive::input &input) noexcept
 output::~output() noexcept
 {
 	JIVE_DEBUG_ASSERT(nusers() == 0);
+
+	region()->graph()->output_ids_.release(id_);
 }
 
 output::output(
+	jive::output_kind kind,
 	jive::region * region,
 	const jive::port & port)
-: index_(0)
+: kind_(kind)
+, id_(region->graph()->output_ids_.allocate())
+, index_(0)
 , region_(region)
 , port_(port.copy())
 {}
@@ -105,9 +128,12 @@ output::debug_string() const
 void
 output::remove_user(jive::input * user)
 {
-	JIVE_DEBUG_ASSERT(users_.find(user) != users_.end());
+	JIVE_DEBUG_ASSERT(user->user_index_ < users_.size() && users_[user->user_index_] == user);
 
-	users_.erase(user);
+	auto last = users_.back();
+	last->user_index_ = user->user_index_;
+	users_[user->user_index_] = last;
+	users_.pop_back();
 
 	if (auto node = node_output::node(this)) {
 		if (!node->has_users())
@@ -118,13 +144,15 @@ output::remove_user(jive::input * user)
 void
 output::add_user(jive::input * user)
 {
-	JIVE_DEBUG_ASSERT(users_.find(user) == users_.end());
+	JIVE_DEBUG_ASSERT(user->origin() == this);
+	JIVE_DEBUG_ASSERT(user->user_index_ >= users_.size() || users_[user->user_index_] != user);
 
 	if (auto node = node_output::node(this)) {
 		if (!node->has_users())
 			region()->bottom_nodes.erase(node);
 	}
-	users_.insert(user);
+	user->user_index_ = users_.size();
+	users_.push_back(user);
 }
 
 }	//jive namespace
@@ -152,26 +180,30 @@ namespace jive {
 /* node_input  class */
 
 node_input::node_input(
+	jive::input_kind kind,
 	jive::output * origin,
 	jive::node * node,
 	const jive::port & port)
-: jive::input(origin, node->region(), port)
+: jive::input(kind, origin, node->region(), port)
 , node_(node)
 {}
 
 /* node_output class */
 
 node_output::node_output(
+	jive::output_kind kind,
 	jive::node * node,
 	const jive::port & port)
-: jive::output(node->region(), port)
+: jive::output(kind, node->region(), port)
 , node_(node)
 {}
 
 /* node class */
 
 node::node(std::unique_ptr<jive::operation> op, jive::region * region)
-	: depth_(0)
+	: id_(region->graph()->node_ids_.allocate())
+	, depth_(0)
+	, batch_index_(SIZE_MAX)
 	, graph_(region->graph())
 	, region_(region)
 	, operation_(std::move(op))
@@ -191,6 +223,15 @@ node::~node()
 	inputs_.clear();
 
 	region()->nodes.erase(this);
+
+	if (batch_index_ != SIZE_MAX) {
+		auto & batch_nodes = graph()->batch_nodes_;
+		batch_nodes[batch_index_] = batch_nodes.back();
+		batch_nodes[batch_index_]->batch_index_ = batch_index_;
+		batch_nodes.pop_back();
+	}
+
+	graph()->node_ids_.release(id_);
 }
 
 node_input *
@@ -199,7 +240,7 @@ node::add_input(std::unique_ptr<node_input> input)
 	auto producer = node_output::node(input->origin());
 
 	if (ninputs() == 0) {
-		JIVE_DEBUG_ASSERT(depth() == 0);
+		JIVE_DEBUG_ASSERT(graph()->InBatch() || depth() == 0);
 		region()->top_nodes.erase(this);
 	}
 
@@ -227,7 +268,7 @@ node::remove_input(size_t index)
 	inputs_.pop_back();
 
 	/* recompute depth */
-	if (producer) {
+	if (producer && !graph()->InBatch()) {
 		auto pdepth = producer->depth();
 		JIVE_DEBUG_ASSERT(pdepth < depth());
 		if (pdepth != depth()-1)
@@ -237,7 +278,7 @@ node::remove_input(size_t index)
 
 	/* add to region's top nodes */
 	if (ninputs() == 0) {
-		JIVE_DEBUG_ASSERT(depth() == 0);
+		JIVE_DEBUG_ASSERT(graph()->InBatch() || depth() == 0);
 		region()->top_nodes.push_back(this);
 	}
 }
@@ -263,6 +304,14 @@ node::recompute_depth() noexcept
 		to visit the node's successors in top down order to ensure
 		that each node is only visited once.
 	*/
+	if (graph()->InBatch()) {
+		if (batch_index_ == SIZE_MAX) {
+			batch_index_ = graph()->batch_nodes_.size();
+			graph()->batch_nodes_.push_back(this);
+		}
+		return;
+	}
+
 	size_t new_depth = 0;
 	for (size_t n = 0; n < ninputs(); n++) {
 		auto producer = node_output::node(input(n)->origin());
@@ -273,7 +322,8 @@ node::recompute_depth() noexcept
 
 	size_t old_depth = depth();
 	depth_ = new_depth;
-	on_node_depth_change(this, old_depth);
+	graph()->notifiers().on_node_depth_change(this, old_depth);
+	region()->notifiers().on_node_depth_change(this, old_depth);
 
 	for (size_t n = 0; n < noutputs(); n++) {
 		for (auto user : *(output(n))) {
@@ -17,17 +17,17 @@ port::~port()
 {}
 
 port::port(const jive::type & type)
-: port(type.copy())
+: type_(&canonical_type(type))
 {}
 
 port::port(std::unique_ptr<jive::type> type)
-: type_(std::move(type))
+: port(*type)
 {}
 
 bool
 port::operator==(const port & other) const noexcept
 {
-	return *type_ == *other.type_;
+	return equal_canonical_types(*type_, *other.type_);
 }
 
 std::unique_ptr<port>
@@ -41,6 +41,12 @@ port::copy() const
 operation::~operation() noexcept
 {}
 
+size_t
+operation::hash() const noexcept
+{
+	return typeid(*this).hash_code();
+}
+
 jive::node_normal_form *
 operation::normal_form(jive::graph * graph) noexcept
 {
@@ -13,6 +13,46 @@
 #include <jive/rvsdg/structural-node.hpp>
 #include <jive/rvsdg/substitution.hpp>
 #include <jive/rvsdg/traverser.hpp>
+#include <jive/util/hash.hpp>
+
+static size_t
+cse_hash(
+	const jive::operation & op,
+	const std::vector<jive::output*> & operands) noexcept
+{
+	auto hash = op.hash();
+	for (const auto & operand : operands)
+		jive::detail::hash_combine(hash, operand);
+
+	return hash;
+}
+
+static size_t
+cse_hash(const jive::node & node) noexcept
+{
+	auto hash = node.operation().hash();
+	for (size_t n = 0; n < node.ninputs(); n++)
+		jive::detail::hash_combine(hash, node.input(n)->origin());
+
+	return hash;
+}
+
+static bool
+cse_equal(
+	const jive::node & node,
+	const jive::operation & op,
+	const std::vector<jive::output*> & operands) noexcept
+{
+	if (node.ninputs() != operands.size())
+		return false;
+
+	for (size_t n = 0; n < operands.size(); n++) {
+		if (node.input(n)->origin() != operands[n])
+			return false;
+	}
+
+	return node.operation() == op;
+}
 
 namespace jive {
 
@@ -20,7 +60,8 @@ namespace jive {
 
 argument::~argument() noexcept
 {
-	on_output_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_output_destroy(this);
 
 	if (input())
 		input()->arguments.erase(this);
@@ -30,7 +71,7 @@ argument::argument(
 	jive::region * region,
 	jive::structural_input * input,
 	const jive::port & port)
-: output(region, port)
+: output(output_kind::argument, region, port)
 , input_(input)
 {
 	if (input) {
@@ -47,7 +88,7 @@ argument::create(
 	structural_input * input,
 	const jive::port & port)
 {
-	auto argument = new jive::argument(region, input, port);
+	auto argument = new (region->graph()->arena()) jive::argument(region, input, port);
 	region->append_argument(argument);
 	return argument;
 }
@@ -56,7 +97,8 @@ argument::create(
 
 result::~result() noexcept
 {
-	on_input_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_input_destroy(this);
 
 	if (output())
 		output()->results.erase(this);
@@ -67,7 +109,7 @@ result::result(
 	jive::output * origin,
 	jive::structural_output * output,
 	const jive::port & port)
-: input(origin, region, port)
+: input(input_kind::result, origin, region, port)
 , output_(output)
 {
 	if (output) {
@@ -85,7 +127,7 @@ result::create(
 	jive::structural_output * output,
 	const jive::port & port)
 {
-	auto result = new jive::result(region, origin, output, port);
+	auto result = new (region->graph()->arena()) jive::result(region, origin, output, port);
 	region->append_result(result);
 	return result;
 }
@@ -94,7 +136,7 @@ result::create(
 
 region::~region()
 {
-	on_region_destroy(this);
+	graph()->notifiers().on_region_destroy(this);
 
 	while (results_.size())
 		remove_result(results_.size()-1);
@@ -113,7 +155,7 @@ region::region(jive::region * parent, jive::graph * graph)
 	, graph_(graph)
 	, node_(nullptr)
 {
-	on_region_create(this);
+	graph->notifiers().on_region_create(this);
 }
 
 region::region(
@@ -123,7 +165,7 @@ region::region(
 , graph_(node->graph())
 , node_(node)
 {
-	on_region_create(this);
+	graph()->notifiers().on_region_create(this);
 }
 
 void
@@ -140,7 +182,8 @@ region::append_argument(jive::argument * argument)
 
 	argument->index_ = narguments();
 	arguments_.push_back(argument);
-	on_output_create(argument);
+	graph()->count_mutation();
+	graph()->notifiers().on_output_create(argument);
 }
 
 void
@@ -174,7 +217,8 @@ region::append_result(jive::result * result)
 
 	result->index_ = nresults();
 	results_.push_back(result);
-	on_input_create(result);
+	graph()->count_mutation();
+	graph()->notifiers().on_input_create(result);
 }
 
 void
@@ -197,6 +241,43 @@ region::remove_node(jive::node * node)
 	delete node;
 }
 
+jive::simple_node *
+region::find_equivalent_node(
+	const jive::operation & op,
+	const std::vector<jive::output*> & operands,
+	const jive::node * exclude) const noexcept
+{
+	auto range = cse_table_.equal_range(cse_hash(op, operands));
+	for (auto it = range.first; it != range.second; it++) {
+		auto node = it->second;
+		if (node != exclude && cse_equal(*node, op, operands))
+			return node;
+	}
+
+	return nullptr;
+}
+
+void
+region::cse_insert(jive::simple_node * node)
+{
+	JIVE_DEBUG_ASSERT(node->region() == this);
+	cse_table_.emplace(cse_hash(*node), node);
+}
+
+void
+region::cse_remove(jive::simple_node * node) noexcept
+{
+	auto range = cse_table_.equal_range(cse_hash(*node));
+	for (auto it = range.first; it != range.second; it++) {
+		if (it->second == node) {
+			cse_table_.erase(it);
+			return;
+		}
+	}
+
+	JIVE_DEBUG_ASSERT(0 && "Node not found in CSE table.");
+}
+
 void
 region::copy(
 	region * target,
@@ -206,6 +287,10 @@ region::copy(
 {
 	smap.insert(this, target);
 
+	/* the nodes are ordered by their depth, which must be up to date */
+	if (graph()->InBatch())
+		graph()->FlushBatch();
+
 	/* order nodes top-down */
 	std::vector<std::vector<const jive::node*>> context(nnodes());
 	for (const auto & node : nodes) {
@@ -18,14 +18,15 @@ namespace jive {
 
 simple_input::~simple_input() noexcept
 {
-	on_input_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_input_destroy(this);
 }
 
 simple_input::simple_input(
 	jive::simple_node * node,
 	jive::output * origin,
 	const jive::port & port)
-: node_input(origin, node, port)
+: node_input(input_kind::simple, origin, node, port)
 {}
 
 /* outputs */
@@ -33,19 +34,23 @@ simple_input::simple_input(
 simple_output::simple_output(
 	jive::simple_node * node,
 	const jive::port & port)
-: node_output(node, port)
+: node_output(output_kind::simple, node, port)
 {}
 
 simple_output::~simple_output() noexcept
 {
-	on_output_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_output_destroy(this);
 }
 
 /* simple nodes */
 
 simple_node::~simple_node()
 {
-	on_node_destroy(this);
+	graph()->count_mutation();
+	graph()->notifiers().on_node_destroy(this);
+	region()->notifiers().on_node_destroy(this);
+	region()->cse_remove(this);
 }
 
 simple_node::simple_node(
@@ -60,14 +65,17 @@ simple_node::simple_node(
 
 	for (size_t n = 0; n < operation().narguments(); n++) {
 		node::add_input(std::unique_ptr<node_input>(
-			new simple_input(this, operands[n], operation().argument(n))));
+			new (graph()->arena()) simple_input(this, operands[n], operation().argument(n))));
 	}
 
 	for (size_t n = 0; n < operation().nresults(); n++)
 		node::add_output(std::unique_ptr<node_output>(
-			new simple_output(this, operation().result(n))));
+			new (graph()->arena()) simple_output(this, operation().result(n))));
 
-	on_node_create(this);
+	region->cse_insert(this);
+	graph()->count_mutation();
+	graph()->notifiers().on_node_create(this);
+	region->notifiers().on_node_create(this);
 }
 
 jive::node *
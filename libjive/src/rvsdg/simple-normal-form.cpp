@@ -9,36 +9,6 @@
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/simple-normal-form.hpp>
 
-static jive::node *
-node_cse(
-	jive::region * region,
-	const jive::operation & op,
-	const std::vector<jive::output*> & arguments)
-{
-	auto cse_test = [&](const jive::node * node)
-	{
-		return node->operation() == op && arguments == jive::operands(node);
-	};
-
-	if (!arguments.empty()) {
-		for (const auto & user : *arguments[0]) {
-			if (!jive::is<jive::node_input>(*user))
-				continue;
-
-			auto node = static_cast<jive::node_input*>(user)->node();
-			if (cse_test(node))
-				return node;
-		}
-	} else {
-		for (auto & node : region->top_nodes) {
-			if (cse_test(&node))
-				return &node;
-		}
-	}
-
-	return nullptr;
-}
-
 namespace jive {
 
 simple_normal_form::~simple_normal_form() noexcept
@@ -62,9 +32,8 @@ simple_normal_form::normalize_node(jive::node * node) const
 		return true;
 
 	if (get_cse()) {
-		auto new_node = node_cse(node->region(), node->operation(), operands(node));
-		JIVE_DEBUG_ASSERT(new_node);
-		if (new_node != node) {
+		auto new_node = node->region()->find_equivalent_node(node->operation(), operands(node), node);
+		if (new_node) {
 			divert_users(node, outputs(new_node));
 			remove(node);
 			return false;
@@ -82,7 +51,7 @@ simple_normal_form::normalized_create(
 {
 	jive::node * node = nullptr;
 	if (get_mutable() && get_cse())
-		node = node_cse(region, op, arguments);
+		node = region->find_equivalent_node(op, arguments);
 	if (!node)
 		node = simple_node::create(region, op, arguments);
 
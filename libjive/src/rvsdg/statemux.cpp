@@ -9,6 +9,7 @@
 #include <jive/rvsdg/node.hpp>
 #include <jive/rvsdg/region.hpp>
 #include <jive/rvsdg/statemux.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -26,6 +27,15 @@ mux_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+mux_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, narguments());
+	jive::detail::hash_combine(seed, nresults());
+	return seed;
+}
+
 std::string
 mux_op::debug_string() const
 {
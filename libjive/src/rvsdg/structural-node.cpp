@@ -17,16 +17,18 @@ structural_input::~structural_input() noexcept
 {
 	JIVE_DEBUG_ASSERT(arguments.empty());
 
-	on_input_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_input_destroy(this);
 }
 
 structural_input::structural_input(
 	jive::structural_node * node,
 	jive::output * origin,
 	const jive::port & port)
-: node_input(origin, node, port)
+: node_input(input_kind::structural, origin, node, port)
 {
-	on_input_create(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_input_create(this);
 }
 
 /* structural output */
@@ -35,22 +37,26 @@ structural_output::~structural_output() noexcept
 {
 	JIVE_DEBUG_ASSERT(results.empty());
 
-	on_output_destroy(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_output_destroy(this);
 }
 
 structural_output::structural_output(
 	jive::structural_node * node,
 	const jive::port & port)
-: node_output(node, port)
+: node_output(output_kind::structural, node, port)
 {
-	on_output_create(this);
+	region()->graph()->count_mutation();
+	region()->graph()->notifiers().on_output_create(this);
 }
 
 /* structural node */
 
 structural_node::~structural_node()
 {
-	on_node_destroy(this);
+	graph()->count_mutation();
+	graph()->notifiers().on_node_destroy(this);
+	region()->notifiers().on_node_destroy(this);
 
 	subregions_.clear();
 }
@@ -67,7 +73,9 @@ structural_node::structural_node(
 	for (size_t n = 0; n < nsubregions; n++)
 		subregions_.emplace_back(std::unique_ptr<jive::region>(new jive::region(this, n)));
 
-	on_node_create(this);
+	graph()->count_mutation();
+	graph()->notifiers().on_node_create(this);
+	region->notifiers().on_node_create(this);
 }
 
 structural_input *
@@ -68,8 +68,8 @@ theta_node::loopvar_iterator::operator++() noexcept
 jive::theta_output *
 theta_node::add_loopvar(jive::output * origin)
 {
-	node::add_input(std::unique_ptr<node_input>(new theta_input(this, origin, origin->type())));
-	node::add_output(std::unique_ptr<node_output>(new theta_output(this, origin->type())));
+	node::add_input(std::unique_ptr<node_input>(new (graph()->arena()) theta_input(this, origin, origin->type())));
+	node::add_output(std::unique_ptr<node_output>(new (graph()->arena()) theta_output(this, origin->type())));
 
 	auto input = theta_node::input(ninputs()-1);
 	auto output = theta_node::output(noutputs()-1);
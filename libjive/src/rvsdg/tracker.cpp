@@ -12,41 +12,12 @@
 
 using namespace std::placeholders;
 
-namespace {
-
-typedef std::unordered_set<const jive::graph*> tracker_set;
-
-tracker_set *
-active_trackers()
-{
-	static std::unique_ptr<tracker_set> trackers;
-	if (!trackers)
-		trackers.reset(new tracker_set());
-
-	return trackers.get();
-}
-
-void
-register_tracker(const jive::tracker * tracker)
-{
-	active_trackers()->insert(tracker->graph());
-}
-
-void
-unregister_tracker(const jive::tracker * tracker)
-{
-	active_trackers()->erase(tracker->graph());
-}
-
-}
-
 namespace jive {
 
 bool
 has_active_trackers(const jive::graph * graph)
 {
-	auto at = active_trackers();
-	return at->find(graph) != at->end();
+	return graph->ntrackers_ != 0;
 }
 
 /* tracker depth state */
@@ -159,26 +130,50 @@ private:
 
 tracker::~tracker() noexcept
 {
-	unregister_tracker(this);
+	JIVE_DEBUG_ASSERT(graph_->ntrackers_ != 0);
+	graph_->ntrackers_--;
 }
 
 tracker::tracker(jive::graph * graph, size_t nstates)
 	: graph_(graph)
+	, region_(nullptr)
 	, states_(nstates)
 {
 	for (size_t n = 0; n < states_.size(); n++)
 		states_[n]= std::make_unique<tracker_depth_state>();
 
-	depth_callback_ = on_node_depth_change.connect(
+	depth_callback_ = graph->notifiers().on_node_depth_change.connect(
 		std::bind(&tracker::node_depth_change, this, _1, _2));
-	destroy_callback_ = on_node_destroy.connect(std::bind(&tracker::node_destroy, this, _1));
+	destroy_callback_ = graph->notifiers().on_node_destroy.connect(std::bind(&tracker::node_destroy, this, _1));
 
-	register_tracker(this);
+	graph_->ntrackers_++;
+}
+
+tracker::tracker(jive::region * region, size_t nstates)
+	: graph_(region->graph())
+	, region_(region)
+	, states_(nstates)
+{
+	for (size_t n = 0; n < states_.size(); n++)
+		states_[n]= std::make_unique<tracker_depth_state>();
+
+	/*
+		Only listen to the region, such that the concurrent mutations of
+		other regions neither invoke the tracker nor wait for it.
+	*/
+	depth_callback_ = region->notifiers().on_node_depth_change.connect(
+		std::bind(&tracker::node_depth_change, this, _1, _2));
+	destroy_callback_ = region->notifiers().on_node_destroy.connect(std::bind(&tracker::node_destroy, this, _1));
+
+	graph_->ntrackers_++;
 }
 
 void
 tracker::node_depth_change(jive::node * node, size_t old_depth)
 {
+	if (region_ && node->region() != region_)
+		return;
+
 	auto nstate = nodestate(node);
 	if (nstate->state() < states_.size()) {
 		states_[nstate->state()]->remove(nstate, old_depth);
@@ -189,6 +184,9 @@ tracker::node_depth_change(jive::node * node, size_t old_depth)
 void
 tracker::node_destroy(jive::node * node)
 {
+	if (region_ && node->region() != region_)
+		return;
+
 	auto nstate = nodestate(node);
 	if (nstate->state() < states_.size())
 		states_[nstate->state()]->remove(nstate, node->depth());
@@ -247,12 +245,11 @@ tracker::peek_bottom(size_t state) const
 jive::tracker_nodestate *
 tracker::nodestate(jive::node * node)
 {
-	auto it = nodestates_.find(node);
-	if (it != nodestates_.end())
-		return it->second.get();
+	auto & nodestate = nodestates_[node];
+	if (!nodestate)
+		nodestate = std::make_unique<jive::tracker_nodestate>(node);
 
-	nodestates_[node] = std::make_unique<jive::tracker_nodestate>(node);
-	return nodestates_[node].get();
+	return nodestate.get();
 }
 
 }
@@ -25,7 +25,7 @@ topdown_traverser::~topdown_traverser() noexcept {}
 
 topdown_traverser::topdown_traverser(jive::region * region)
 	: region_(region)
-	, tracker_(region->graph())
+	, tracker_(region)
 {
 	for (auto & node : region->top_nodes)
 		tracker_.set_nodestate(&node, traversal_nodestate::frontier);
@@ -44,9 +44,9 @@ topdown_traverser::topdown_traverser(jive::region * region)
 		}
 	}
 
-	callbacks_.push_back(on_node_create.connect(
+	callbacks_.push_back(region->notifiers().on_node_create.connect(
 		std::bind(&topdown_traverser::node_create, this, _1)));
-	callbacks_.push_back(on_input_change.connect(
+	callbacks_.push_back(region->notifiers().on_input_change.connect(
 		std::bind(&topdown_traverser::input_change, this, _1, _2, _3)));
 }
 
@@ -123,7 +123,7 @@ bottomup_traverser::~bottomup_traverser() noexcept {}
 
 bottomup_traverser::bottomup_traverser(jive::region * region, bool revisit)
 	: region_(region)
-	, tracker_(region->graph())
+	, tracker_(region)
 	, new_node_state_(revisit ? traversal_nodestate::frontier : traversal_nodestate::behind)
 {
 	for (auto & node : region->bottom_nodes)
@@ -135,11 +135,11 @@ bottomup_traverser::bottomup_traverser(jive::region * region, bool revisit)
 			tracker_.set_nodestate(node, traversal_nodestate::frontier);
 	}
 
-	callbacks_.push_back(on_node_create.connect(
+	callbacks_.push_back(region->notifiers().on_node_create.connect(
 		std::bind(&bottomup_traverser::node_create, this, _1)));
-	callbacks_.push_back(on_node_destroy.connect(
+	callbacks_.push_back(region->notifiers().on_node_destroy.connect(
 		std::bind(&bottomup_traverser::node_destroy, this, _1)));
-	callbacks_.push_back(on_input_change.connect(
+	callbacks_.push_back(region->notifiers().on_input_change.connect(
 		std::bind(&bottomup_traverser::input_change, this, _1, _2, _3)));
 }
 
@@ -201,4 +201,68 @@ bottomup_traverser::input_change(input * in, output * old_origin, output * new_o
 	tracker_.set_nodestate(node, traversal_nodestate::frontier);
 }
 
+/* read-only traversers */
+
+namespace detail {
+
+void
+sort_by_depth(
+	const jive::region * region,
+	bool bottomup,
+	std::vector<const jive::node*> & nodes)
+{
+	/*
+		Counting sort over the node depths. The counts are kept in a
+		thread-local buffer that retains its capacity across invocations.
+	*/
+	static thread_local std::vector<size_t> counts;
+
+	size_t max_depth = 0;
+	for (const auto & node : region->nodes)
+		max_depth = std::max(max_depth, node.depth());
+
+	counts.assign(max_depth+2, 0);
+	for (const auto & node : region->nodes)
+		counts[node.depth()+1]++;
+
+	for (size_t n = 1; n < counts.size(); n++)
+		counts[n] += counts[n-1];
+
+	nodes.resize(region->nnodes());
+	for (const auto & node : region->nodes) {
+		auto index = counts[node.depth()]++;
+		nodes[bottomup ? nodes.size()-1-index : index] = &node;
+	}
+}
+
+namespace {
+
+struct traversal_buffer_pool {
+	size_t nused = 0;
+	std::vector<std::unique_ptr<std::vector<const jive::node*>>> buffers;
+};
+
+thread_local traversal_buffer_pool pool;
+
+}
+
+std::vector<const jive::node*> &
+acquire_traversal_buffer()
+{
+	if (pool.nused == pool.buffers.size())
+		pool.buffers.push_back(std::make_unique<std::vector<const jive::node*>>());
+
+	return *pool.buffers[pool.nused++];
+}
+
+void
+release_traversal_buffer(std::vector<const jive::node*> & buffer) noexcept
+{
+	JIVE_DEBUG_ASSERT(pool.nused != 0 && pool.buffers[pool.nused-1].get() == &buffer);
+	buffer.clear();
+	pool.nused--;
+}
+
+}
+
 }
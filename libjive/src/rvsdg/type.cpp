@@ -6,15 +6,90 @@
 
 #include <jive/rvsdg/type.hpp>
 
+#include <mutex>
+#include <typeinfo>
+#include <unordered_set>
+
 namespace jive {
 
 type::~type() noexcept
 {}
 
+size_t
+type::hash() const noexcept
+{
+	return typeid(*this).hash_code();
+}
+
 valuetype::~valuetype() noexcept
 {}
 
 statetype::~statetype() noexcept
 {}
 
+namespace {
+
+/**
+	\brief Table of canonical types
+
+	The table is split into shards with their own lock in order to reduce
+	the contention between threads that create nodes concurrently.
+*/
+class type_table final {
+	struct hasher {
+		size_t
+		operator()(const jive::type * type) const noexcept
+		{
+			return type->hash();
+		}
+	};
+
+	struct equal {
+		bool
+		operator()(const jive::type * type1, const jive::type * type2) const noexcept
+		{
+			return typeid(*type1) == typeid(*type2) && *type1 == *type2;
+		}
+	};
+
+	struct shard {
+		std::mutex mutex;
+		std::unordered_set<const jive::type*, hasher, equal> types;
+	};
+
+	static constexpr size_t nshards = 16;
+
+public:
+	const jive::type &
+	intern(const jive::type & type)
+	{
+		auto & shard = shards_[(type.hash() >> 4) % nshards];
+		std::lock_guard<std::mutex> guard(shard.mutex);
+
+		auto it = shard.types.find(&type);
+		if (it != shard.types.end())
+			return **it;
+
+		auto canonical = type.copy().release();
+		shard.types.insert(canonical);
+		return *canonical;
+	}
+
+private:
+	shard shards_[nshards];
+};
+
+}
+
+const jive::type &
+canonical_type(const jive::type & type)
+{
+	/*
+		The table is deliberately never destroyed, such that canonical types
+		remain valid during the destruction of static objects.
+	*/
+	static auto table = new type_table();
+	return table->intern(type);
+}
+
 }
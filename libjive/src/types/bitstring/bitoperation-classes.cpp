@@ -10,6 +10,7 @@
 #include <jive/types/bitstring/constant.hpp>
 
 #include <jive/rvsdg/control.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -18,6 +19,14 @@ namespace jive {
 bitunary_op::~bitunary_op() noexcept
 {}
 
+size_t
+bitunary_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, type().nbits());
+	return seed;
+}
+
 jive_binop_reduction_path_t
 bitunary_op::can_reduce_operand(
 	const jive::output * arg) const noexcept
@@ -47,6 +56,14 @@ bitunary_op::reduce_operand(
 bitbinary_op::~bitbinary_op() noexcept
 {}
 
+size_t
+bitbinary_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, type().nbits());
+	return seed;
+}
+
 jive_binop_reduction_path_t
 bitbinary_op::can_reduce_operand_pair(
 	const jive::output * arg1,
@@ -78,6 +95,14 @@ bitbinary_op::reduce_operand_pair(
 bitcompare_op::~bitcompare_op() noexcept
 {}
 
+size_t
+bitcompare_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, type().nbits());
+	return seed;
+}
+
 jive_binop_reduction_path_t
 bitcompare_op::can_reduce_operand_pair(
 	const jive::output * arg1,
@@ -17,6 +17,7 @@
 #include <jive/types/bitstring/constant.hpp>
 #include <jive/types/bitstring/slice.hpp>
 #include <jive/types/bitstring/type.hpp>
+#include <jive/util/hash.hpp>
 
 jive::output *
 jive_bitconcat(const std::vector<jive::output*> & operands)
@@ -45,16 +46,8 @@ concat_reduce_arg_pair(jive::output * arg1, jive::output * arg2)
 	auto arg1_constant = dynamic_cast<const bitconstant_op*>(&node1->operation());
 	auto arg2_constant = dynamic_cast<const bitconstant_op*>(&node2->operation());
 	if (arg1_constant && arg2_constant) {
-		size_t nbits = arg1_constant->value().nbits() + arg2_constant->value().nbits();
-		std::vector<char> bits(nbits);
-		memcpy(&bits[0], &arg1_constant->value()[0], arg1_constant->value().nbits());
-		memcpy(
-			&bits[0] + arg1_constant->value().nbits(),
-			&arg2_constant->value()[0],
-			arg2_constant->value().nbits());
-
-		std::string s(&bits[0], nbits);
-		return create_bitconstant(node1->region(), s.c_str());
+		auto value = arg1_constant->value().concat(arg2_constant->value());
+		return create_bitconstant(node1->region(), value);
 	}
 
 	auto arg1_slice = dynamic_cast<const bitslice_op*>(&node1->operation());
@@ -266,6 +259,14 @@ bitconcat_op::operator==(const jive::operation & other) const noexcept
 	return true;
 }
 
+size_t
+bitconcat_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, narguments());
+	return seed;
+}
+
 jive_binop_reduction_path_t
 bitconcat_op::can_reduce_operand_pair(
 	const jive::output * arg1,
@@ -314,15 +315,8 @@ bitconcat_op::reduce_operand_pair(
 		auto & arg1_constant = static_cast<const bitconstant_op&>(node1->operation());
 		auto & arg2_constant = static_cast<const bitconstant_op&>(node2->operation());
 
-		size_t nbits = arg1_constant.value().nbits() + arg2_constant.value().nbits();
-		std::vector<char> bits(nbits);
-		memcpy(&bits[0], &arg1_constant.value()[0], arg1_constant.value().nbits());
-		memcpy(
-			&bits[0] + arg1_constant.value().nbits(),
-			&arg2_constant.value()[0],
-			arg2_constant.value().nbits());
-
-		return create_bitconstant(arg1->region(), &bits[0]);
+		auto value = arg1_constant.value().concat(arg2_constant.value());
+		return create_bitconstant(arg1->region(), value);
 	}
 
 	if (path == jive_binop_reduction_merge) {
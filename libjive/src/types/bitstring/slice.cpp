@@ -14,6 +14,7 @@
 #include <jive/types/bitstring/concat.hpp>
 #include <jive/types/bitstring/constant.hpp>
 #include <jive/types/bitstring/type.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -30,6 +31,15 @@ bitslice_op::operator==(const operation & other) const noexcept
 	    && op->argument(0) == argument(0);
 }
 
+size_t
+bitslice_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, low());
+	jive::detail::hash_combine(seed, high());
+	return seed;
+}
+
 std::string
 bitslice_op::debug_string() const
 {
@@ -75,8 +85,7 @@ bitslice_op::reduce_operand(
 	
 	if (path == jive_unop_reduction_constant) {
 		auto op = static_cast<const bitconstant_op&>(node->operation());
-		std::string s(&op.value()[0]+low(), high()-low());
-		return create_bitconstant(arg->region(), s.c_str());
+		return create_bitconstant(arg->region(), op.value().slice(low(), high()));
 	}
 	
 	if (path == jive_unop_reduction_distribute) {
@@ -8,6 +8,7 @@
 
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/node.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -29,6 +30,14 @@ bittype::operator==(const jive::type & other) const noexcept
 	return type != nullptr && this->nbits() == type->nbits();
 }
 
+size_t
+bittype::hash() const noexcept
+{
+	auto seed = typeid(bittype).hash_code();
+	detail::hash_combine(seed, nbits_);
+	return seed;
+}
+
 std::unique_ptr<jive::type>
 bittype::copy() const
 {
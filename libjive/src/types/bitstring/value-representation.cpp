@@ -5,70 +5,422 @@
  */
 
 #include <jive/types/bitstring/value-representation.hpp>
+#include <jive/util/hash.hpp>
 
 #include <stdexcept>
 
 namespace jive {
 
+/*
+	Computes the full 128-bit product of a and b. Returns the low word and
+	stores the high word in high.
+*/
+static inline uint64_t
+mul64(uint64_t a, uint64_t b, uint64_t & high) noexcept
+{
+	uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+	uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+
+	uint64_t p00 = a0 * b0;
+	uint64_t p01 = a0 * b1;
+	uint64_t p10 = a1 * b0;
+	uint64_t p11 = a1 * b1;
+
+	uint64_t middle = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+	high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	return (middle << 32) | (p00 & 0xffffffff);
+}
+
+bitvalue_repr
+bitvalue_repr::concat(const bitvalue_repr & other) const
+{
+	bitvalue_repr result(nbits() + other.nbits(), 0);
+	auto limbs = result.data();
+
+	for (size_t n = 0; n < nlimbs(); n++)
+		limbs[n] = data()[n];
+
+	/* The bits beyond nbits() are zero in both representations, so we can simply merge the limbs of other. */
+	size_t shift = nbits() % 64;
+	for (size_t n = 0; n < other.nlimbs(); n++) {
+		auto & l = other.data()[n];
+		size_t index = nbits() / 64 + n;
+		limbs[index].value |= l.value << shift;
+		limbs[index].mask |= l.mask << shift;
+		if (shift != 0 && index + 1 < result.nlimbs()) {
+			limbs[index+1].value |= l.value >> (64 - shift);
+			limbs[index+1].mask |= l.mask >> (64 - shift);
+		}
+	}
+
+	return result;
+}
+
+bitvalue_repr
+bitvalue_repr::slice(size_t low, size_t high) const
+{
+	if (high <= low || high > nbits()) {
+		throw compiler_error("Slice is out of bound.");
+	}
+
+	bitvalue_repr result(high - low, 0);
+	size_t shift = low % 64;
+	for (size_t n = 0; n < result.nlimbs(); n++) {
+		size_t index = low / 64 + n;
+		auto & l = data()[index];
+		limb r = {l.value >> shift, l.mask >> shift};
+		if (shift != 0 && index + 1 < nlimbs()) {
+			r.value |= data()[index+1].value << (64 - shift);
+			r.mask |= data()[index+1].mask << (64 - shift);
+		}
+		result.data()[n] = r;
+	}
+	result.normalize();
+
+	return result;
+}
+
+std::string
+bitvalue_repr::str() const
+{
+	std::string s(nbits(), '0');
+	for (size_t n = 0; n < nbits(); n++)
+		s[n] = get_bit(n);
+
+	return s;
+}
+
+size_t
+bitvalue_repr::hash() const noexcept
+{
+	size_t seed = std::hash<size_t>()(nbits());
+	for (size_t n = 0; n < nlimbs(); n++) {
+		detail::hash_combine(seed, data()[n].value);
+		detail::hash_combine(seed, data()[n].mask);
+	}
+
+	return seed;
+}
+
 uint64_t
 bitvalue_repr::to_uint() const
 {
-	size_t limit = std::min(nbits(), size_t(64));
 	/* bits beyond 64 must be zero, else value is not representable as uint64_t */
-	for (size_t n = limit; n < nbits(); ++n) {
-		if (data_[n] != '0')
+	for (size_t n = 1; n < nlimbs(); n++) {
+		if (data()[n].value != 0 || data()[n].mask != 0)
 			throw std::range_error("Bit constant value exceeds uint64 range");
 	}
 
-	uint64_t result = 0;
-	uint64_t pos_value = 1;
-	for (size_t n = 0; n < limit; ++n) {
-		switch (data_[n]) {
-			case '0': {
-				break;
-			}
-			case '1': {
-				result |= pos_value;
-				break;
-			}
-			default: {
-				throw std::range_error("Undetermined bit constant");
-			}
-		}
-		pos_value = pos_value << 1;
-	}
-	return result;
+	if (data()[0].mask != 0)
+		throw std::range_error("Undetermined bit constant");
+
+	return data()[0].value;
 }
 
 int64_t
 bitvalue_repr::to_int() const
 {
 	/* all bits from 63 on must be identical, else value is not representable as int64_t */
-	char sign_bit = data_[nbits()-1];
-	size_t limit = std::min(nbits(), size_t(63));
-	for (size_t n = limit; n < nbits(); ++n) {
-		if (data_[n] != sign_bit)
+	char sign_bit = sign();
+	for (size_t n = 63; n < nbits(); ++n) {
+		if (get_bit(n) != sign_bit)
 			throw std::range_error("Bit constant value exceeds int64 range");
 	}
 
-	int64_t result = 0;
-	uint64_t pos_value = 1;
-	for (size_t n = 0; n < 64; ++n) {
-		switch (n < nbits() ? data_[n] : sign_bit) {
-			case '0': {
-				break;
-			}
-			case '1': {
-				result |= pos_value;
-				break;
-			}
-			default: {
-				throw std::range_error("Undetermined bit constant");
+	if (data()[0].mask != 0 || (sign_bit != '0' && sign_bit != '1'))
+		throw std::range_error("Undetermined bit constant");
+
+	if (nbits() <= 64)
+		return sext_value();
+
+	return data()[0].value;
+}
+
+/* word-parallel kernels */
+
+bool
+bitvalue_repr::known_ult(const bitvalue_repr & other) const noexcept
+{
+	JIVE_DEBUG_ASSERT(is_known() && other.is_known());
+
+	for (size_t n = nlimbs(); n > 0; n--) {
+		auto a = data()[n-1].value;
+		auto b = other.data()[n-1].value;
+		if (a != b)
+			return a < b;
+	}
+
+	return false;
+}
+
+bool
+bitvalue_repr::known_slt(const bitvalue_repr & other) const noexcept
+{
+	JIVE_DEBUG_ASSERT(is_known() && other.is_known());
+
+	bool negative1 = is_negative();
+	bool negative2 = other.is_negative();
+	if (negative1 != negative2)
+		return negative1;
+
+	return known_ult(other);
+}
+
+bitvalue_repr
+bitvalue_repr::known_add(const bitvalue_repr & other) const
+{
+	JIVE_DEBUG_ASSERT(is_known() && other.is_known());
+
+	bitvalue_repr sum(nbits(), 0);
+	uint64_t carry = 0;
+	for (size_t n = 0; n < nlimbs(); n++) {
+		uint64_t a = data()[n].value;
+		uint64_t s = a + other.data()[n].value;
+		uint64_t c = s < a;
+		s += carry;
+		c |= s < carry;
+		sum.data()[n].value = s;
+		carry = c;
+	}
+	sum.normalize();
+
+	return sum;
+}
+
+bitvalue_repr
+bitvalue_repr::known_neg() const
+{
+	JIVE_DEBUG_ASSERT(is_known());
+
+	bitvalue_repr result(nbits(), 0);
+	uint64_t carry = 1;
+	for (size_t n = 0; n < nlimbs(); n++) {
+		uint64_t s = ~data()[n].value + carry;
+		carry = carry && s == 0;
+		result.data()[n].value = s;
+	}
+	result.normalize();
+
+	return result;
+}
+
+bitvalue_repr
+bitvalue_repr::known_mul(const bitvalue_repr & other) const
+{
+	JIVE_DEBUG_ASSERT(is_known() && other.is_known());
+
+	bitvalue_repr product(nbits(), 0);
+	auto limbs = product.data();
+	for (size_t i = 0; i < nlimbs(); i++) {
+		uint64_t carry = 0;
+		for (size_t j = 0; i + j < nlimbs(); j++) {
+			uint64_t high;
+			uint64_t low = mul64(data()[i].value, other.data()[j].value, high);
+
+			uint64_t s = limbs[i+j].value + low;
+			high += s < low;
+			s += carry;
+			high += s < carry;
+
+			limbs[i+j].value = s;
+			carry = high;
+		}
+	}
+	product.normalize();
+
+	return product;
+}
+
+void
+bitvalue_repr::known_udiv(
+	const bitvalue_repr & divisor,
+	bitvalue_repr & quotient,
+	bitvalue_repr & remainder) const
+{
+	JIVE_DEBUG_ASSERT(is_known() && divisor.is_known());
+
+	/*
+		FIXME: Division by zero is not detected. In accordance with the bit-serial
+		evaluation, the quotient is all ones and the remainder the dividend.
+	*/
+	if (nbits() <= 64) {
+		uint64_t a = inline_limb_.value;
+		uint64_t b = divisor.inline_limb_.value;
+		quotient.inline_limb_.value = b == 0 ? ~uint64_t(0) : a / b;
+		remainder.inline_limb_.value = b == 0 ? a : a % b;
+		quotient.normalize();
+		return;
+	}
+
+	auto q = quotient.data();
+	auto r = remainder.data();
+	auto d = divisor.data();
+	for (size_t n = nbits(); n > 0; n--) {
+		/* remainder = (remainder << 1) | bit n-1 of the dividend */
+		for (size_t i = nlimbs() - 1; i > 0; i--)
+			r[i].value = (r[i].value << 1) | (r[i-1].value >> 63);
+		r[0].value = (r[0].value << 1) | ((data()[(n-1) / 64].value >> ((n-1) % 64)) & 1);
+
+		if (!remainder.known_ult(divisor)) {
+			uint64_t borrow = 0;
+			for (size_t i = 0; i < nlimbs(); i++) {
+				uint64_t a = r[i].value;
+				uint64_t s = a - d[i].value - borrow;
+				borrow = (a < d[i].value) || (a - d[i].value < borrow);
+				r[i].value = s;
 			}
+			q[(n-1) / 64].value |= uint64_t(1) << ((n-1) % 64);
 		}
-		pos_value = pos_value << 1;
 	}
+	remainder.normalize();
+}
+
+/* bit-serial kernels */
+
+char
+bitvalue_repr::serial_ult(const bitvalue_repr & other) const
+{
+	char v = land(lnot(get_bit(0)), other[0]);
+	for (size_t n = 1; n < nbits(); n++)
+		v = land(lor(lnot(get_bit(n)), other[n]), lor(land(lnot(get_bit(n)), other[n]), v));
+
+	return v;
+}
+
+char
+bitvalue_repr::serial_ule(const bitvalue_repr & other) const
+{
+	char v = '1';
+	for (size_t n = 0; n < nbits(); n++)
+		v = land(land(lor(lnot(get_bit(n)), other[n]), lor(lnot(get_bit(n)), v)), lor(v, other[n]));
+
+	return v;
+}
+
+char
+bitvalue_repr::serial_ne(const bitvalue_repr & other) const
+{
+	char v = '0';
+	for (size_t n = 0; n < nbits(); n++)
+		v = lor(v, lxor(get_bit(n), other[n]));
+
+	return v;
+}
+
+bitvalue_repr
+bitvalue_repr::serial_add(const bitvalue_repr & other) const
+{
+	char c = '0';
+	bitvalue_repr sum = repeat(nbits(), 'X');
+	for (size_t n = 0; n < nbits(); n++) {
+		sum[n] = add(get_bit(n), other[n], c);
+		c = carry(get_bit(n), other[n], c);
+	}
+
+	return sum;
+}
+
+bitvalue_repr
+bitvalue_repr::serial_neg() const
+{
+	char c = '1';
+	bitvalue_repr result = repeat(nbits(), 'X');
+	for (size_t n = 0; n < nbits(); n++) {
+		char tmp = lxor(get_bit(n), '1');
+		result[n] = add(tmp, '0', c);
+		c = carry(tmp, '0', c);
+	}
+
 	return result;
 }
 
+void
+bitvalue_repr::serial_udiv(
+	const bitvalue_repr & divisor,
+	bitvalue_repr & quotient,
+	bitvalue_repr & remainder) const
+{
+	for (size_t n = 0; n < nbits(); n++) {
+		remainder = remainder.shl(1);
+		remainder[0] = get_bit(nbits()-n-1);
+		if (remainder.uge(divisor) == '1') {
+			remainder = remainder.sub(divisor);
+			quotient[nbits()-n-1] = '1';
+		}
+	}
+}
+
+void
+bitvalue_repr::serial_mul(
+	const bitvalue_repr & factor1,
+	const bitvalue_repr & factor2,
+	bitvalue_repr & product)
+{
+	JIVE_DEBUG_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
+
+	for (size_t i = 0; i < factor1.nbits(); i++) {
+		char c = '0';
+		for (size_t j = 0; j < factor2.nbits(); j++) {
+			char s = product.land(factor1[i], factor2[j]);
+			char p = product[i+j];
+			char nc = product.carry(s, p, c);
+			product[i+j] = product.add(s, p, c);
+			c = nc;
+		}
+	}
+}
+
+bitvalue_repr
+bitvalue_repr::umulh(const bitvalue_repr & other) const
+{
+	check_nbits(other);
+
+	if (is_known() && other.is_known()) {
+		if (nbits() <= 64) {
+			uint64_t high;
+			uint64_t low = mul64(inline_limb_.value, other.inline_limb_.value, high);
+			return high_product(low, high);
+		}
+
+		return zext(nbits()).known_mul(other.zext(nbits())).slice(nbits(), 2*nbits());
+	}
+
+	bitvalue_repr product(4*nbits(), 0);
+	bitvalue_repr factor1 = this->zext(nbits());
+	bitvalue_repr factor2 = other.zext(nbits());
+	serial_mul(factor1, factor2, product);
+	return product.slice(nbits(), 2*nbits());
+}
+
+bitvalue_repr
+bitvalue_repr::smulh(const bitvalue_repr & other) const
+{
+	check_nbits(other);
+
+	if (is_known() && other.is_known()) {
+		if (nbits() <= 64) {
+			uint64_t a = sext_value();
+			uint64_t b = other.sext_value();
+
+			/* Turn the unsigned product of the sign-extended words into the signed product. */
+			uint64_t high;
+			uint64_t low = mul64(a, b, high);
+			if (int64_t(a) < 0)
+				high -= b;
+			if (int64_t(b) < 0)
+				high -= a;
+
+			return high_product(low, high);
+		}
+
+		return sext(nbits()).known_mul(other.sext(nbits())).slice(nbits(), 2*nbits());
+	}
+
+	bitvalue_repr product(4*nbits(), 0);
+	bitvalue_repr factor1 = this->sext(nbits());
+	bitvalue_repr factor2 = other.sext(nbits());
+	serial_mul(factor1, factor2, product);
+	return product.slice(nbits(), 2*nbits());
+}
+
 }
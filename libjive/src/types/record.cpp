@@ -5,6 +5,7 @@
  */
 
 #include <jive/types/record.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jive {
 
@@ -27,6 +28,14 @@ rcdtype::operator==(const jive::type & other) const noexcept
 	    && declaration() == type->declaration();
 }
 
+size_t
+rcdtype::hash() const noexcept
+{
+	auto seed = typeid(rcdtype).hash_code();
+	detail::hash_combine(seed, declaration());
+	return seed;
+}
+
 std::unique_ptr<jive::type>
 rcdtype::copy() const
 {
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/common.hpp>
+#include <jive/util/arena.hpp>
+
+#include <atomic>
+
+namespace jive {
+namespace detail {
+
+/* arena */
+
+arena::~arena() noexcept
+{
+	for (auto chunk : chunks_)
+		::operator delete(chunk);
+}
+
+arena::arena() noexcept
+: synchronized_(false)
+, nchunks_(0)
+, nbytes_reserved_(0)
+{}
+
+arena::statistics
+arena::stats() const noexcept
+{
+	auto stats = shard_.stats;
+	shards_.for_each([&](const shard & s)
+	{
+		stats.nallocations += s.stats.nallocations;
+		stats.ndeallocations += s.stats.ndeallocations;
+		stats.nreused += s.stats.nreused;
+		stats.nlarge_allocations += s.stats.nlarge_allocations;
+	});
+	stats.nchunks = nchunks_;
+	stats.nbytes_reserved = nbytes_reserved_;
+
+	return stats;
+}
+
+void
+arena::set_synchronized(bool synchronized) noexcept
+{
+	synchronized_ = synchronized;
+	if (synchronized)
+		return;
+
+	/*
+		The shards keep their chunks for the next synchronized phase, but
+		their free blocks are handed back such that they can be reused.
+	*/
+	shards_.for_each([&](shard & s)
+	{
+		for (size_t sc = 0; sc < s.free_lists.size(); sc++) {
+			while (auto block = s.free_lists[sc]) {
+				s.free_lists[sc] = block->next;
+				block->next = shard_.free_lists[sc];
+				shard_.free_lists[sc] = block;
+			}
+		}
+	});
+}
+
+void *
+arena::allocate_chunk(size_t size)
+{
+	std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+	if (synchronized_)
+		lock.lock();
+
+	auto chunk = ::operator new(size);
+	chunks_.push_back(chunk);
+	nchunks_++;
+	nbytes_reserved_ += size;
+	return chunk;
+}
+
+void *
+arena::allocate(size_t size)
+{
+	return allocate(synchronized_ ? shards_.local() : shard_, size);
+}
+
+void *
+arena::allocate(shard & s, size_t size)
+{
+	s.stats.nallocations++;
+
+	if (size > max_size_class) {
+		s.stats.nlarge_allocations++;
+		return ::operator new(size);
+	}
+
+	auto sc = size_class(size);
+	if (auto block = s.free_lists[sc]) {
+		s.free_lists[sc] = block->next;
+		s.stats.nreused++;
+		return block;
+	}
+
+	size_t nbytes = sc * granularity;
+	if (s.current == nullptr || static_cast<size_t>(s.end - s.current) < nbytes) {
+		s.current = static_cast<char*>(allocate_chunk(chunk_size));
+		s.end = s.current + chunk_size;
+	}
+
+	auto p = s.current;
+	s.current += nbytes;
+	return p;
+}
+
+void
+arena::deallocate(void * p, size_t size) noexcept
+{
+	/*
+		The block is put on the free list of the calling thread, which is
+		not necessarily the thread that allocated it.
+	*/
+	deallocate(synchronized_ ? shards_.local() : shard_, p, size);
+}
+
+void
+arena::deallocate(shard & s, void * p, size_t size) noexcept
+{
+	s.stats.ndeallocations++;
+
+	if (size > max_size_class) {
+		::operator delete(p);
+		return;
+	}
+
+	auto sc = size_class(size);
+	auto block = static_cast<free_block*>(p);
+	block->next = s.free_lists[sc];
+	s.free_lists[sc] = block;
+}
+
+/* arena allocated */
+
+static std::atomic<size_t> nheap_allocations(0);
+static std::atomic<size_t> nheap_deallocations(0);
+
+void *
+arena_allocated::operator new(size_t size)
+{
+	nheap_allocations.fetch_add(1, std::memory_order_relaxed);
+
+	auto p = static_cast<char*>(::operator new(header_size + size));
+	new (p) header({nullptr, size});
+	return p + header_size;
+}
+
+void *
+arena_allocated::operator new(size_t size, detail::arena & arena)
+{
+	auto p = static_cast<char*>(arena.allocate(header_size + size));
+	new (p) header({&arena, size});
+	return p + header_size;
+}
+
+void
+arena_allocated::operator delete(void * p, size_t size) noexcept
+{
+	if (p == nullptr)
+		return;
+
+	auto block = static_cast<char*>(p) - header_size;
+	auto h = reinterpret_cast<header*>(block);
+	JIVE_DEBUG_ASSERT(h->size == size);
+
+	if (h->arena) {
+		h->arena->deallocate(block, header_size + h->size);
+		return;
+	}
+
+	nheap_deallocations.fetch_add(1, std::memory_order_relaxed);
+	::operator delete(block);
+}
+
+void
+arena_allocated::operator delete(void * p, detail::arena &) noexcept
+{
+	auto h = reinterpret_cast<header*>(static_cast<char*>(p) - header_size);
+	operator delete(p, h->size);
+}
+
+arena_allocated::statistics
+arena_allocated::heap_stats() noexcept
+{
+	statistics stats;
+	stats.nheap_allocations = nheap_allocations.load(std::memory_order_relaxed);
+	stats.nheap_deallocations = nheap_deallocations.load(std::memory_order_relaxed);
+	return stats;
+}
+
+}
+}
@@ -11,6 +11,9 @@
 #include <jive/rvsdg/theta.hpp>
 #include <jive/view.hpp>
 
+#include <cinttypes>
+#include <cstring>
+
 namespace jive {
 
 static std::string
@@ -194,212 +197,237 @@ region_tree(const jive::region * region, FILE * out)
 
 /* xml */
 
-static inline std::string
-xml_header()
-{
-	return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
-	       "<rvsdg>\n";
-}
-
-static inline std::string
-xml_footer()
-{
-	return "</rvsdg>\n";
-}
-
-static inline std::string
-id(const jive::output * port)
-{
-	return detail::strfmt("o", (intptr_t)port);
-}
-
-static inline std::string
-id(const jive::input * port)
-{
-	return detail::strfmt("i", (intptr_t)port);
-}
-
-static inline std::string
-id(const jive::node * node)
-{
-	return detail::strfmt("n", (intptr_t)node);
-}
-
-static inline std::string
-id(const jive::region * region)
-{
-	return detail::strfmt("r", (intptr_t)region);
-}
-
-static inline std::string
-argument_tag(const std::string & id)
-{
-	return "<argument id=\"" + id + "\"/>\n";
-}
-
-static inline std::string
-result_tag(const std::string & id)
-{
-	return "<result id=\"" + id + "\"/>\n";
-}
-
-static inline std::string
-input_tag(const std::string & id)
-{
-	return "<input id=\"" + id + "\"/>\n";
-}
-
-static inline std::string
-output_tag(const std::string & id)
-{
-	return "<output id=\"" + id + "\"/>\n";
-}
-
-static inline std::string
-node_starttag(const std::string & id, const std::string & name, const std::string & type)
-{
-	return "<node id=\"" + id + "\" name=\"" + name + "\" type=\"" + type + "\">\n";
-}
+xml_sink::~xml_sink()
+{}
+
+namespace {
+
+/** \brief Streaming XML writer
+*
+* The writer emits the tags of a region while traversing it and passes them in chunks of at most
+* buffer_size bytes to a sink. Its memory consumption is therefore bounded by the nesting depth
+* of the regions instead of the size of the document.
+*/
+class xml_writer final {
+public:
+	explicit
+	xml_writer(xml_sink & sink)
+	: sink_(sink)
+	{
+		buffer_.reserve(buffer_size);
+	}
 
-static inline std::string
-node_endtag()
-{
-	return "</node>\n";
-}
+	/*
+	* The remaining buffer is flushed by write_document(). The destructor does not flush, as
+	* the sink might throw.
+	*/
+	void
+	write_document(const jive::region * region)
+	{
+		put("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+		    "<rvsdg>\n");
+		write_region(region);
+		put("</rvsdg>\n");
+		flush();
+	}
 
-static inline std::string
-region_starttag(const std::string & id)
-{
-	return "<region id=\"" + id + "\">\n";
-}
+private:
+	static constexpr size_t buffer_size = 64 * 1024;
 
-static inline std::string
-region_endtag(const std::string & id)
-{
-	return "</region>\n";
-}
+	void
+	flush()
+	{
+		if (!buffer_.empty()) {
+			sink_.write(buffer_.data(), buffer_.size());
+			buffer_.clear();
+		}
+	}
 
-static inline std::string
-edge_tag(const std::string & srcid, const std::string & dstid)
-{
-	return "<edge source=\"" + srcid + "\" target=\"" + dstid + "\"/>\n";
-}
+	void
+	put(const char * data, size_t size)
+	{
+		if (buffer_.size() + size > buffer_size)
+			flush();
 
-static inline std::string
-type(const jive::node * n)
-{
-	if (dynamic_cast<const jive::gamma_op*>(&n->operation()))
-		return "gamma";
+		buffer_.append(data, size);
+	}
 
-	if (dynamic_cast<const jive::theta_op*>(&n->operation()))
-		return "theta";
+	void
+	put(const char * s)
+	{
+		put(s, strlen(s));
+	}
 
-	return "";
-}
+	void
+	put(const std::string & s)
+	{
+		put(s.data(), s.size());
+	}
 
-static std::string
-convert_region(const jive::region * region);
+	void
+	put_id(char prefix, const void * p)
+	{
+		char id[32];
+		auto size = snprintf(id, sizeof(id), "%c%" PRIdPTR, prefix, (intptr_t)p);
+		put(id, size);
+	}
 
-static inline std::string
-convert_simple_node(const jive::simple_node * node)
-{
-	std::string s;
+	void
+	put_port_tag(const char * tag, char prefix, const void * port)
+	{
+		put("<");
+		put(tag);
+		put(" id=\"");
+		put_id(prefix, port);
+		put("\"/>\n");
+	}
 
-	s += node_starttag(id(node), node->operation().debug_string(), "");
-	for (size_t n = 0; n < node->ninputs(); n++)
-		s += input_tag(id(node->input(n)));
-	for (size_t n = 0; n < node->noutputs(); n++)
-		s += output_tag(id(node->output(n)));
-	s += node_endtag();
+	void
+	put_edges(const jive::output * output)
+	{
+		for (const auto & user : *output) {
+			put("<edge source=\"");
+			put_id('o', output);
+			put("\" target=\"");
+			put_id('i', user);
+			put("\"/>\n");
+		}
+	}
 
-	for (size_t n = 0; n < node->noutputs(); n++) {
-		auto output = node->output(n);
-		for (const auto & user : *output)
-			s += edge_tag(id(output), id(user));
+	void
+	put_node_starttag(const jive::node * node, const std::string & name, const char * type)
+	{
+		put("<node id=\"");
+		put_id('n', node);
+		put("\" name=\"");
+		put(name);
+		put("\" type=\"");
+		put(type);
+		put("\">\n");
 	}
 
-	return s;
-}
+	static const char *
+	type(const jive::node * n)
+	{
+		if (dynamic_cast<const jive::gamma_op*>(&n->operation()))
+			return "gamma";
 
-static inline std::string
-convert_structural_node(const jive::structural_node * node)
-{
-	std::string s;
-	s += node_starttag(id(node), "", type(node));
+		if (dynamic_cast<const jive::theta_op*>(&n->operation()))
+			return "theta";
 
-	for (size_t n = 0; n < node->ninputs(); n++)
-		s += input_tag(id(node->input(n)));
-	for (size_t n = 0; n < node->noutputs(); n++)
-		s += output_tag(id(node->output(n)));
+		return "";
+	}
 
-	for (size_t n = 0; n < node->nsubregions(); n++)
-		s += convert_region(node->subregion(n));
-	s += node_endtag();
+	void
+	write_node(const jive::node * node)
+	{
+		auto structural = dynamic_cast<const structural_node*>(node);
+		JIVE_ASSERT(structural || dynamic_cast<const simple_node*>(node));
+
+		if (structural)
+			put_node_starttag(node, "", type(node));
+		else
+			put_node_starttag(node, node->operation().debug_string(), "");
+
+		for (size_t n = 0; n < node->ninputs(); n++)
+			put_port_tag("input", 'i', node->input(n));
+		for (size_t n = 0; n < node->noutputs(); n++)
+			put_port_tag("output", 'o', node->output(n));
+
+		if (structural) {
+			for (size_t n = 0; n < structural->nsubregions(); n++)
+				write_region(structural->subregion(n));
+		}
+		put("</node>\n");
 
-	for (size_t n = 0; n < node->noutputs(); n++) {
-		auto output = node->output(n);
-		for (const auto & user : *output)
-			s += edge_tag(id(output), id(user));
+		for (size_t n = 0; n < node->noutputs(); n++)
+			put_edges(node->output(n));
 	}
 
-	return s;
-}
+	void
+	write_region(const jive::region * region)
+	{
+		put("<region id=\"");
+		put_id('r', region);
+		put("\">\n");
 
-static inline std::string
-convert_node(const jive::node * node)
-{
-	if (auto n = dynamic_cast<const simple_node*>(node))
-		return convert_simple_node(n);
+		for (size_t n = 0; n < region->narguments(); n++)
+			put_port_tag("argument", 'o', region->argument(n));
 
-	if (auto n = dynamic_cast<const structural_node*>(node))
-		return convert_structural_node(n);
+		for (const auto & node : region->nodes)
+			write_node(&node);
 
-	JIVE_ASSERT(0);
-	return "";
-}
+		for (size_t n = 0; n < region->nresults(); n++)
+			put_port_tag("result", 'i', region->result(n));
 
-static inline std::string
-convert_region(const jive::region * region)
-{
-	std::string s;
-	s += region_starttag(id(region));
-
-	for (size_t n = 0; n < region->narguments(); n++)
-		s += argument_tag(id(region->argument(n)));
+		for (size_t n = 0; n < region->narguments(); n++)
+			put_edges(region->argument(n));
 
-	for (const auto & node : region->nodes)
-		s += convert_node(&node);
+		put("</region>\n");
+	}
 
-	for (size_t n = 0; n < region->nresults(); n++)
-		s += result_tag(id(region->result(n)));
+	xml_sink & sink_;
+	std::string buffer_;
+};
+
+class string_sink final : public xml_sink {
+public:
+	explicit
+	string_sink(std::string & s)
+	: s_(s)
+	{}
+
+	virtual void
+	write(const char * data, size_t size) override
+	{
+		s_.append(data, size);
+	}
 
-	for (size_t n = 0; n < region->narguments(); n++) {
-		auto argument = region->argument(n);
-		for (const auto & user : *argument)
-			s += edge_tag(id(argument), id(user));
+private:
+	std::string & s_;
+};
+
+class file_sink final : public xml_sink {
+public:
+	explicit
+	file_sink(FILE * out)
+	: out_(out)
+	{}
+
+	virtual void
+	write(const char * data, size_t size) override
+	{
+		fwrite(data, 1, size, out_);
 	}
 
-	s += region_endtag(id(region));
+private:
+	FILE * out_;
+};
 
-	return s;
 }
 
 std::string
 to_xml(const jive::region * region)
 {
 	std::string s;
-	s += xml_header();
-
-	s += convert_region(region);
+	string_sink sink(s);
+	view_xml(region, sink);
 
-	s += xml_footer();
 	return s;
 }
 
+void
+view_xml(const jive::region * region, xml_sink & sink)
+{
+	xml_writer writer(sink);
+	writer.write_document(region);
+}
+
 void
 view_xml(const jive::region * region, FILE * out)
 {
-	fputs(to_xml(region).c_str(), out);
+	file_sink sink(out);
+	view_xml(region, sink);
 	fflush(out);
 }
 
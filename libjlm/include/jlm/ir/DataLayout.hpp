@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_IR_DATALAYOUT_HPP
+#define JLM_IR_DATALAYOUT_HPP
+
+#include <jive/rvsdg/type.hpp>
+
+#include <map>
+#include <string>
+
+namespace jlm {
+
+class StructType;
+
+/** \brief Memory layout of types
+ *
+ * The layout of a module is described by its LLVM data layout string, which is kept in RvsdgModule::DataLayout().
+ * This class interprets the integer (i), floating point (f), vector (v), aggregate (a), and pointer (p) alignment
+ * specifications of such a string. Specifications that are not given fall back to LLVM's defaults, e.g., i64 values
+ * are only four byte aligned if the string does not specify otherwise. All other specifications are ignored.
+ *
+ * An integer type without an alignment specification of its exact width uses the alignment of the next larger
+ * specified width, or of the largest specified width if there is none. This means that an i128 is eight byte aligned
+ * on x86-64.
+ */
+class DataLayout final {
+public:
+  /**
+   * Creates the layout of a data layout string.
+   *
+   * @param specification The LLVM data layout string. An empty string yields LLVM's default layout.
+   * @throws jlm::error if \p specification is malformed.
+   */
+  explicit
+  DataLayout(const std::string & specification);
+
+  /**
+   * Determines the number of bytes that are written by a store of a value of type \p type.
+   *
+   * @throws jlm::error if \p type has no statically known size, e.g., a scalable vector type.
+   */
+  [[nodiscard]] size_t
+  GetTypeStoreSize(const jive::valuetype & type) const;
+
+  /**
+   * Determines the number of bytes that are allocated in memory for a value of type \p type, including any tail
+   * padding. This is the offset between consecutive elements of an array of \p type.
+   *
+   * @throws jlm::error if \p type has no statically known size, e.g., a scalable vector type.
+   */
+  [[nodiscard]] size_t
+  GetTypeAllocSize(const jive::valuetype & type) const;
+
+  /**
+   * Determines the ABI alignment of a value of type \p type in bytes.
+   *
+   * @throws jlm::error if \p type has no statically known size, e.g., a scalable vector type.
+   */
+  [[nodiscard]] size_t
+  GetTypeAlignment(const jive::valuetype & type) const;
+
+  /**
+   * Determines the byte offset of the element with index \p index of \p structType. The elements of a packed struct
+   * are laid out without any padding, while the elements of all other structs are aligned to their ABI alignment.
+   *
+   * @throws jlm::error if an element has no statically known size.
+   */
+  [[nodiscard]] size_t
+  GetElementOffset(const StructType & structType, size_t index) const;
+
+  [[nodiscard]] size_t
+  GetPointerSize() const noexcept
+  {
+    return PointerSize_;
+  }
+
+private:
+  [[nodiscard]] size_t
+  GetTypeSizeInBits(const jive::valuetype & type) const;
+
+  [[nodiscard]] size_t
+  GetIntegerAlignment(size_t numBits) const;
+
+  void
+  ParseSpecification(const std::string & specification);
+
+  /*
+   * The alignments are in bytes and indexed by the bit width of the type.
+   */
+  std::map<size_t, size_t> IntegerAlignments_;
+  std::map<size_t, size_t> FloatingPointAlignments_;
+  std::map<size_t, size_t> VectorAlignments_;
+
+  size_t AggregateAlignment_;
+  size_t PointerSize_;
+  size_t PointerAlignment_;
+};
+
+}
+
+#endif
@@ -7,6 +7,7 @@
 #define JLM_IR_RVSDGMODULE_HPP
 
 #include <jive/rvsdg/graph.hpp>
+#include <jive/types/record.hpp>
 
 #include <jlm/ir/linkage.hpp>
 #include <jlm/util/file.hpp>
@@ -65,7 +66,7 @@ is_import(const jive::output * output)
 {
 	auto graph = output->region()->graph();
 
-	auto argument = dynamic_cast<const jive::argument*>(output);
+	auto argument = jive::dyn_cast<jive::argument>(output);
 	return argument && argument->region() == graph->root();
 }
 
@@ -74,7 +75,7 @@ is_export(const jive::input * input)
 {
 	auto graph = input->region()->graph();
 
-	auto result = dynamic_cast<const jive::result*>(input);
+	auto result = jive::dyn_cast<jive::result>(input);
 	return result && result->region() == graph->root();
 }
 
@@ -132,6 +133,19 @@ public:
 		return DataLayout_;
 	}
 
+	/**
+	 * Transfers the ownership of \p declaration to the module. The declaration must be used by the struct types of
+	 * the module's RVSDG, and is kept alive for as long as the module exists.
+	 *
+	 * @return The added declaration.
+	 */
+	const jive::rcddeclaration &
+	AddStructTypeDeclaration(std::unique_ptr<jive::rcddeclaration> declaration)
+	{
+		StructTypeDeclarations_.push_back(std::move(declaration));
+		return *StructTypeDeclarations_.back();
+	}
+
 	static std::unique_ptr<RvsdgModule>
 	Create(
 		const jlm::filepath & sourceFileName,
@@ -142,6 +156,7 @@ public:
 	}
 
 private:
+	std::vector<std::unique_ptr<jive::rcddeclaration>> StructTypeDeclarations_;
 	jive::graph Rvsdg_;
 	std::string DataLayout_;
 	std::string TargetTriple_;
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_IR_RVSDGSERIALIZATION_HPP
+#define JLM_IR_RVSDGSERIALIZATION_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace jlm {
+
+class RvsdgModule;
+
+/**
+ * Version of the binary RVSDG format. It must be incremented whenever the encoding of the format changes.
+ */
+static constexpr uint64_t RvsdgFormatVersion = 1;
+
+/**
+ * Serializes \p rvsdgModule into the binary RVSDG format.
+ *
+ * The format starts with the magic string "JLMRVSDG" followed by the format version. All integers are encoded as
+ * unsigned LEB128 varints and all strings are prefixed with their length. The header is followed by:
+ *
+ * 1. The source file name, target triple, and data layout of the module.
+ * 2. A table of all types used in the module. Every type is stored exactly once and referred to by its index in
+ *    the table. The table is ordered such that the types a type is composed of precede it.
+ * 3. The elements of all struct and record type declarations. They are stored after the type table as struct types
+ *    can be recursive.
+ * 4. The imports, the nodes of the root region, and the exports. The nodes of a region are stored in topological
+ *    order and refer to their operands by the region-local index of the respective output. The arguments of a
+ *    region are numbered first, followed by the outputs of the nodes in the order they are stored.
+ *    Structural nodes store their subregions inline.
+ *
+ * @param rvsdgModule The module to serialize.
+ * @return The serialized module.
+ *
+ * @throws jlm::error if the module contains an operation or type that is not supported by the format.
+ */
+std::vector<uint8_t>
+SerializeRvsdgModule(const RvsdgModule & rvsdgModule);
+
+/**
+ * Reconstructs an RVSDG module from \p size bytes at \p data that were produced by SerializeRvsdgModule().
+ *
+ * @throws jlm::error if the data is not a valid serialized module.
+ */
+std::unique_ptr<RvsdgModule>
+DeserializeRvsdgModule(const uint8_t * data, size_t size);
+
+/**
+ * Serializes \p rvsdgModule and writes it to \p file.
+ *
+ * @see SerializeRvsdgModule()
+ */
+void
+WriteRvsdgModule(
+  const RvsdgModule & rvsdgModule,
+  const filepath & file);
+
+/**
+ * Reads an RVSDG module from \p file. The file is mapped into memory instead of being copied into a buffer.
+ *
+ * @see DeserializeRvsdgModule()
+ */
+std::unique_ptr<RvsdgModule>
+ReadRvsdgModule(const filepath & file);
+
+}
+
+#endif
@@ -815,7 +815,7 @@ is_phi_cv(const jive::output * output)
 {
   using namespace jive;
 
-  auto a = dynamic_cast<const jive::argument*>(output);
+  auto a = jive::dyn_cast<jive::argument>(output);
   return a
          && is<phi::operation>(a->region()->node())
          && a->input() != nullptr;
@@ -826,7 +826,7 @@ is_phi_recvar_argument(const jive::output * output)
 {
   using namespace jive;
 
-  auto a = dynamic_cast<const jive::argument*>(output);
+  auto a = jive::dyn_cast<jive::argument>(output);
   return a
          && is<phi::operation>(a->region()->node())
          && a->input() == nullptr;
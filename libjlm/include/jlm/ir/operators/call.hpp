@@ -360,7 +360,7 @@ public:
     std::vector<jive::output*> operands({function});
     operands.insert(operands.end(), arguments.begin(), arguments.end());
 
-    return jive::outputs(new CallNode(
+    return jive::outputs(new (function->region()->graph()->arena()) CallNode(
       *function->region(),
       callOperation,
       operands));
@@ -374,7 +374,7 @@ public:
   {
     CheckFunctionType(callOperation.GetFunctionType());
 
-    return jive::outputs(new CallNode(
+    return jive::outputs(new (region.graph()->arena()) CallNode(
       region,
       callOperation,
       operands));
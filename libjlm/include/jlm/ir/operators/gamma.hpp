@@ -18,7 +18,7 @@ is_gamma_argument(const jive::output * output)
 {
 	using namespace jive;
 
-	auto a = dynamic_cast<const jive::argument*>(output);
+	auto a = jive::dyn_cast<jive::argument>(output);
 	if (a && is<gamma_op>(a->region()->node()))
 		return a;
 
@@ -31,7 +31,7 @@ is_gamma_argument(const jive::output * output)
 static inline const jive::gamma_output *
 is_gamma_output(const jive::output * output)
 {
-	return dynamic_cast<const jive::gamma_output*>(output);
+	return jive::dyn_cast<jive::gamma_output>(output);
 }
 
 /*
@@ -42,7 +42,7 @@ is_gamma_result(const jive::input * input)
 {
 	using namespace jive;
 
-	auto r = dynamic_cast<const result*>(input);
+	auto r = jive::dyn_cast<result>(input);
 	if (r && is<gamma_op>(r->region()->node()))
 		return r;
 
@@ -57,14 +57,14 @@ is_gamma_result(const jive::input * input)
 static inline jive::output *
 is_invariant(const jive::gamma_output * output)
 {
-	auto argument = dynamic_cast<const jive::argument*>(output->result(0)->origin());
+	auto argument = jive::dyn_cast<jive::argument>(output->result(0)->origin());
 	if (!argument)
 		return nullptr;
 
 	size_t n;
 	auto origin = argument->input()->origin();
 	for (n = 1; n < output->nresults(); n++) {
-		auto argument = dynamic_cast<const jive::argument*>(output->result(n)->origin());
+		auto argument = jive::dyn_cast<jive::argument>(output->result(n)->origin());
 		if (argument == nullptr || argument->input()->origin() != origin)
 			break;
 	}
@@ -151,6 +151,9 @@ public:
   bool
   operator==(const operation & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -347,7 +350,7 @@ public:
     operands.insert(operands.end(), states.begin(), states.end());
 
     LoadOperation loadOperation(loadedType, states.size(), alignment);
-    return jive::outputs(new LoadNode(
+    return jive::outputs(new (address->region()->graph()->arena()) LoadNode(
       *address->region(),
       loadOperation,
       operands));
@@ -359,7 +362,7 @@ public:
     const LoadOperation & loadOperation,
     const std::vector<jive::output*> & operands)
   {
-    return jive::outputs(new LoadNode(
+    return jive::outputs(new (region.graph()->arena()) LoadNode(
       region,
       loadOperation,
       operands));
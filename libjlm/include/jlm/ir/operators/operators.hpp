@@ -704,6 +704,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -778,6 +781,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -836,6 +842,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -892,6 +901,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -1100,6 +1112,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
@@ -1576,6 +1591,9 @@ public:
 	virtual bool
 	operator==(const operation & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::string
 	debug_string() const override;
 
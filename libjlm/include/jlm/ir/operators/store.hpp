@@ -100,6 +100,9 @@ public:
   bool
   operator==(const operation & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   [[nodiscard]] std::string
   debug_string() const override;
 
@@ -292,7 +295,7 @@ public:
     operands.insert(operands.end(), states.begin(), states.end());
 
     StoreOperation storeOperation(storedType, states.size(), alignment);
-    return jive::outputs(new StoreNode(
+    return jive::outputs(new (address->region()->graph()->arena()) StoreNode(
       *address->region(),
       storeOperation,
       operands));
@@ -304,7 +307,7 @@ public:
     const StoreOperation & storeOperation,
     const std::vector<jive::output*> & operands)
   {
-    return jive::outputs(new StoreNode(
+    return jive::outputs(new (region.graph()->arena()) StoreNode(
       region,
       storeOperation,
       operands));
@@ -18,7 +18,7 @@ is_theta_argument(const jive::output * output)
 {
 	using namespace jive;
 
-	auto a = dynamic_cast<const jive::argument*>(output);
+	auto a = jive::dyn_cast<jive::argument>(output);
 	if (a && is<theta_op>(a->region()->node()))
 		return a;
 
@@ -30,7 +30,7 @@ is_theta_result(const jive::input * input)
 {
 	using namespace jive;
 
-	auto r = dynamic_cast<const jive::result*>(input);
+	auto r = jive::dyn_cast<jive::result>(input);
 	if (r && is<theta_op>(r->region()->node()))
 		return r;
 
@@ -43,7 +43,7 @@ is_theta_result(const jive::input * input)
 static inline const jive::theta_output *
 is_theta_output(const jive::output * output)
 {
-	return dynamic_cast<const jive::theta_output*>(output);
+	return jive::dyn_cast<jive::theta_output>(output);
 }
 
 }
@@ -149,6 +149,9 @@ public:
   bool
   operator==(const jive::type & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   std::unique_ptr<jive::type>
   copy() const override;
 
@@ -193,6 +196,9 @@ public:
   bool
   operator==(const jive::type & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   [[nodiscard]] std::unique_ptr<jive::type>
   copy() const override;
 
@@ -262,6 +268,9 @@ public:
 	virtual bool
 	operator==(const jive::type & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::unique_ptr<jive::type>
 	copy() const override;
 
@@ -312,6 +321,9 @@ public:
 	virtual bool
 	operator==(const jive::type & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	virtual std::unique_ptr<jive::type>
 	copy() const override;
 
@@ -422,6 +434,9 @@ public:
   bool
   operator==(const jive::type & other) const noexcept override;
 
+  [[nodiscard]] size_t
+  hash() const noexcept override;
+
   [[nodiscard]] std::unique_ptr<jive::type>
   copy() const override;
 
@@ -499,6 +514,9 @@ public:
 	virtual bool
 	operator==(const jive::type & other) const noexcept override;
 
+	virtual size_t
+	hash() const noexcept override;
+
 	size_t
 	size() const noexcept
 	{
@@ -8,6 +8,8 @@
 
 #include <jlm/opt/optimization.hpp>
 
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/id-map.hpp>
 #include <jive/rvsdg/simple-node.hpp>
 #include <jive/rvsdg/structural-node.hpp>
 
@@ -41,6 +43,10 @@ class RvsdgModule;
  * marks all nodes, inputs, and outputs that it finds as alive, while the sweep phase removes then all nodes, inputs,
  * and outputs that were not discovered by the mark phase, i.e., all dead nodes, inputs, and outputs.
  *
+ * The mark phase uses an explicit worklist instead of recursion, which permits arbitrarily long dependency chains.
+ * The subregions of live lambda nodes are independent of each other and are swept in parallel if the optimization is
+ * configured with more than one thread.
+ *
  * Please see TestDeadNodeElimination.cpp for Dead Node Elimination examples.
  */
 class DeadNodeElimination final : public optimization {
@@ -63,31 +69,34 @@ class DeadNodeElimination final : public optimization {
    */
   class Context final {
   public:
-    void
+    /**
+     * Marks \p output as alive.
+     *
+     * @return True if \p output was not already alive, otherwise false.
+     */
+    bool
     MarkAlive(const jive::output & output)
     {
-      if (auto simpleOutput = dynamic_cast<const jive::simple_output*>(&output)) {
-          simpleNodes_.insert(simpleOutput->node());
-          return;
-      }
+      if (auto simpleOutput = jive::dyn_cast<jive::simple_output>(&output))
+        return simpleNodes_.insert(*simpleOutput->node());
 
-      outputs_.insert(&output);
+      return outputs_.insert(output);
     }
 
     bool
     IsAlive(const jive::output & output) const noexcept
     {
-      if (auto simpleOutput = dynamic_cast<const jive::simple_output*>(&output))
-        return simpleNodes_.find(simpleOutput->node()) != simpleNodes_.end();
+      if (auto simpleOutput = jive::dyn_cast<jive::simple_output>(&output))
+        return simpleNodes_.contains(*simpleOutput->node());
 
-      return outputs_.find(&output) != outputs_.end();
+      return outputs_.contains(output);
     }
 
     bool
     IsAlive(const jive::node & node) const noexcept
     {
-      if (auto simpleNode = dynamic_cast<const jive::simple_node*>(&node))
-        return simpleNodes_.find(simpleNode) != simpleNodes_.end();
+      if (auto simpleNode = jive::dyn_cast<jive::simple_node>(&node))
+        return simpleNodes_.contains(*simpleNode);
 
       for (size_t n = 0; n < node.noutputs(); n++) {
         if (IsAlive(*node.output(n)))
@@ -97,16 +106,21 @@ class DeadNodeElimination final : public optimization {
       return false;
     }
 
+    /**
+     * Clears the context and preallocates it for all nodes and outputs of \p graph.
+     */
     void
-    Clear()
+    Reset(const jive::graph & graph)
     {
       simpleNodes_.clear();
       outputs_.clear();
+      simpleNodes_.reserve(graph.node_id_bound());
+      outputs_.reserve(graph.output_id_bound());
     }
 
   private:
-    std::unordered_set<const jive::simple_node*> simpleNodes_;
-    std::unordered_set<const jive::output*> outputs_;
+    jive::node_set simpleNodes_;
+    jive::output_set outputs_;
   };
 
   class Statistics;
@@ -114,6 +128,22 @@ class DeadNodeElimination final : public optimization {
 public:
 	~DeadNodeElimination() override;
 
+  /**
+   * @param numThreads The number of threads used for sweeping the subregions of lambda nodes.
+   */
+  explicit
+  DeadNodeElimination(size_t numThreads = 1)
+    : numThreads_(numThreads)
+    , peakWorklistSize_(0)
+    , lambdaSubregionsSwept_(false)
+  {}
+
+  void
+  SetNumThreads(size_t numThreads) noexcept
+  {
+    numThreads_ = numThreads;
+  }
+
 	void
 	run(jive::region & region);
 
@@ -124,16 +154,28 @@ public:
 
 private:
   void
-  ResetState();
+  ResetState(const jive::graph & graph);
 
   void
   Mark(const jive::region & region);
 
+  /**
+   * Marks \p output as alive and adds it to the worklist if it was not already alive.
+   */
   void
   Mark(const jive::output & output);
 
+  /**
+   * Marks all outputs that the live output \p output depends on.
+   */
+  void
+  MarkDependencies(const jive::output & output);
+
+  void
+  Sweep(jive::graph & graph);
+
   void
-  Sweep(jive::graph & graph) const;
+  SweepLambdaSubregions(jive::graph & graph) const;
 
   void
   Sweep(jive::region & region) const;
@@ -156,7 +198,11 @@ private:
   void
   SweepDelta(delta::node & deltaNode) const;
 
+  size_t numThreads_;
   Context context_;
+  std::vector<const jive::output*> worklist_;
+  size_t peakWorklistSize_;
+  bool lambdaSubregionsSwept_;
 };
 
 }
@@ -41,6 +41,13 @@ public:
     RvsdgModule & rvsdgModule,
     StatisticsCollector & statisticsCollector) override;
 
+  /**
+   * The optimization only diverts users and neither creates nor removes any nodes. The points-to graph therefore
+   * remains valid.
+   */
+  HashSet<AnalysisId>
+  PreservedAnalyses() const override;
+
 private:
   static void
   RedirectInvariantValues(jive::region & region);
@@ -0,0 +1,256 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_PASSMANAGER_HPP
+#define JLM_OPT_PASSMANAGER_HPP
+
+#include <jlm/opt/optimization.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace jlm {
+
+class ThreadPool;
+
+/**
+ * Caches the results of analyses across optimization passes.
+ *
+ * A cached result is associated with the RVSDG module it was computed for and with the mutation count of the module's
+ * graph at the time of its computation. A result is only handed out as long as the graph did not change since, or
+ * as long as all passes that changed the graph preserved the analysis.
+ *
+ * @see jive::graph::mutation_count()
+ */
+class AnalysisManager final
+{
+public:
+  AnalysisManager() = default;
+
+  AnalysisManager(const AnalysisManager &) = delete;
+
+  AnalysisManager &
+  operator=(const AnalysisManager &) = delete;
+
+  /**
+   * Retrieves the cached result of analysis \p analysisId for \p rvsdgModule. The result is computed with \p compute
+   * if no valid result is cached.
+   *
+   * @tparam T The type of the analysis result.
+   * @param analysisId The analysis.
+   * @param rvsdgModule The RVSDG module the analysis is performed on.
+   * @param compute A callable that computes the analysis and returns a std::unique_ptr<T>.
+   *
+   * @return The result of the analysis. It stays valid until the next pass that changes \p rvsdgModule finishes.
+   */
+  template<class T, class Compute> T &
+  GetOrCompute(
+    AnalysisId analysisId,
+    const RvsdgModule & rvsdgModule,
+    Compute compute)
+  {
+    if (auto result = Lookup(analysisId, rvsdgModule))
+      return *static_cast<T*>(result);
+
+    std::unique_ptr<T> result = compute();
+    auto & entry = Insert(analysisId, rvsdgModule, std::shared_ptr<void>(std::move(result)));
+    return *static_cast<T*>(entry.Result.get());
+  }
+
+  /**
+   * @return True if a valid result of analysis \p analysisId is cached for \p rvsdgModule, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsCached(AnalysisId analysisId, const RvsdgModule & rvsdgModule) const noexcept;
+
+  /**
+   * Updates the cache after a pass changed \p rvsdgModule. The results of the analyses in \p preservedAnalyses that
+   * were valid before the pass remain valid, while all other results computed before the pass are discarded.
+   *
+   * @param rvsdgModule The RVSDG module the pass was performed on.
+   * @param mutationCount The mutation count of the module's graph before the pass.
+   * @param preservedAnalyses The analyses preserved by the pass.
+   */
+  void
+  Update(
+    const RvsdgModule & rvsdgModule,
+    size_t mutationCount,
+    const HashSet<AnalysisId> & preservedAnalyses);
+
+  /**
+   * Discards all cached results.
+   */
+  void
+  Clear() noexcept
+  {
+    Entries_.clear();
+  }
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<void> Result;
+    const RvsdgModule * Module;
+    size_t MutationCount;
+  };
+
+  [[nodiscard]] void *
+  Lookup(AnalysisId analysisId, const RvsdgModule & rvsdgModule) const noexcept;
+
+  Entry &
+  Insert(
+    AnalysisId analysisId,
+    const RvsdgModule & rvsdgModule,
+    std::shared_ptr<void> result);
+
+  std::unordered_map<AnalysisId, Entry> Entries_;
+};
+
+/**
+ * Performs sequences of optimization passes and caches analyses across them.
+ *
+ * The pass manager observes the mutation count of the graph to determine whether a pass changed the module. A change
+ * discards all cached analyses that the pass does not preserve, see optimization::PreservedAnalyses().
+ *
+ * With more than one thread, consecutive region-local optimizations are grouped and applied to all lambda nodes of the
+ * module in parallel, such that every lambda node is processed by the entire group in a single task. All other
+ * optimizations are performed sequentially on the entire module. Grouped optimizations produce their statistics per
+ * lambda node. Every worker thread collects them separately, and they are merged into the statistics collector of the
+ * pass manager once the group finished.
+ */
+class PassManager final
+{
+public:
+  ~PassManager() noexcept;
+
+  explicit
+  PassManager(size_t numThreads = 1);
+
+  PassManager(const PassManager &) = delete;
+
+  PassManager &
+  operator=(const PassManager &) = delete;
+
+  /**
+   * Performs \p passes on \p rvsdgModule in order.
+   *
+   * @return True if any of the passes changed the module, otherwise false.
+   */
+  bool
+  Run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    const std::vector<optimization*> & passes);
+
+  [[nodiscard]] AnalysisManager &
+  GetAnalysisManager() noexcept
+  {
+    return AnalysisManager_;
+  }
+
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
+  /**
+   * @return The thread pool of the pass manager, or nullptr if it runs with a single thread. Passes can use the pool
+   * for their own parallel work, but must wait for their tasks before they return.
+   */
+  [[nodiscard]] ThreadPool *
+  GetThreadPool() const noexcept
+  {
+    return ThreadPool_.get();
+  }
+
+private:
+  bool
+  RunPass(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    optimization & pass);
+
+  bool
+  RunOnLambdas(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    const std::vector<RegionLocalOptimization*> & passes);
+
+  size_t NumThreads_;
+  std::unique_ptr<ThreadPool> ThreadPool_;
+  AnalysisManager AnalysisManager_;
+};
+
+/**
+ * A group of optimization passes that is repeated until none of the passes changes the module anymore, or until a
+ * maximum number of iterations is reached.
+ *
+ * Any mutation of the graph counts as a change, see jive::graph::mutation_count(). Groups with passes that change the
+ * graph on every invocation, e.g., node push out, therefore never converge and perform all iterations. Every
+ * invocation reports its number of iterations and whether it converged with a Statistics::Id::FixpointGroup statistic.
+ */
+class FixpointGroup final : public optimization
+{
+public:
+  ~FixpointGroup() noexcept override;
+
+  explicit
+  FixpointGroup(
+    std::vector<optimization*> passes,
+    size_t maxIterations = 16);
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector) override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    PassManager & passManager) override;
+
+  /**
+   * @return The analyses preserved by all passes of the group.
+   */
+  HashSet<AnalysisId>
+  PreservedAnalyses() const override;
+
+  [[nodiscard]] const std::vector<optimization*> &
+  Passes() const noexcept
+  {
+    return Passes_;
+  }
+
+  /**
+   * @return The number of iterations performed by the last invocation of run().
+   */
+  [[nodiscard]] size_t
+  NumIterations() const noexcept
+  {
+    return NumIterations_;
+  }
+
+  /**
+   * @return True if the last invocation of run() reached a fixpoint, false if it stopped at the maximum number of
+   * iterations.
+   */
+  [[nodiscard]] bool
+  Converged() const noexcept
+  {
+    return Converged_;
+  }
+
+private:
+  std::vector<optimization*> Passes_;
+  size_t MaxIterations_;
+  size_t NumIterations_;
+  bool Converged_;
+};
+
+}
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_SCALAREVOLUTION_HPP
+#define JLM_OPT_SCALAREVOLUTION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace jive {
+  class output;
+  class theta_node;
+}
+
+namespace jlm {
+
+/**
+ * A closed-form description of the values of a bitstring output.
+ *
+ * Expressions are created and owned by ScalarEvolution and are immutable.
+ */
+class ScevExpression
+{
+public:
+  enum class Kind
+  {
+    /**
+     * A constant value, see ScevConstant.
+     */
+    Constant,
+
+    /**
+     * A value without a closed form, see ScevUnknown.
+     */
+    Unknown,
+
+    /**
+     * A polynomial recurrence of a theta node, see ScevAddRecurrence.
+     */
+    AddRecurrence,
+
+    /**
+     * A geometric recurrence of a theta node, see ScevMulRecurrence.
+     */
+    MulRecurrence
+  };
+
+  virtual
+  ~ScevExpression() noexcept;
+
+protected:
+  ScevExpression(Kind kind, size_t numBits)
+    : Kind_(kind)
+    , NumBits_(numBits)
+  {}
+
+public:
+  ScevExpression(const ScevExpression &) = delete;
+
+  ScevExpression &
+  operator=(const ScevExpression &) = delete;
+
+  [[nodiscard]] Kind
+  GetKind() const noexcept
+  {
+    return Kind_;
+  }
+
+  [[nodiscard]] size_t
+  NumBits() const noexcept
+  {
+    return NumBits_;
+  }
+
+  [[nodiscard]] virtual std::string
+  DebugString() const = 0;
+
+private:
+  Kind Kind_;
+  size_t NumBits_;
+};
+
+/**
+ * A constant value. The value is sign-extended from NumBits() bits.
+ */
+class ScevConstant final : public ScevExpression
+{
+public:
+  ~ScevConstant() noexcept override;
+
+  ScevConstant(size_t numBits, int64_t value)
+    : ScevExpression(Kind::Constant, numBits)
+    , Value_(value)
+  {}
+
+  [[nodiscard]] int64_t
+  Value() const noexcept
+  {
+    return Value_;
+  }
+
+  [[nodiscard]] std::string
+  DebugString() const override;
+
+private:
+  int64_t Value_;
+};
+
+/**
+ * A value without a closed form. It stands for the value of its output, which is loop-invariant in all theta nodes
+ * that do not contain the output.
+ */
+class ScevUnknown final : public ScevExpression
+{
+public:
+  ~ScevUnknown() noexcept override;
+
+  ScevUnknown(size_t numBits, const jive::output & output)
+    : ScevExpression(Kind::Unknown, numBits)
+    , Output_(&output)
+  {}
+
+  [[nodiscard]] const jive::output &
+  Output() const noexcept
+  {
+    return *Output_;
+  }
+
+  [[nodiscard]] std::string
+  DebugString() const override;
+
+private:
+  const jive::output * Output_;
+};
+
+/**
+ * A chain of recurrences {o_0, +, o_1, +, ..., +, o_n} of a theta node. Its value in iteration k of the theta node is
+ * the sum of o_i * binomial(k, i), where the operands are loop-invariant in the theta node. A recurrence with two
+ * operands is affine, and a recurrence with more operands is polynomial. The operands can be recurrences of enclosing
+ * theta nodes, which describes the values of nested loops.
+ */
+class ScevAddRecurrence final : public ScevExpression
+{
+public:
+  ~ScevAddRecurrence() noexcept override;
+
+  ScevAddRecurrence(
+    const jive::theta_node & thetaNode,
+    std::vector<const ScevExpression*> operands);
+
+  [[nodiscard]] const jive::theta_node &
+  ThetaNode() const noexcept
+  {
+    return *ThetaNode_;
+  }
+
+  [[nodiscard]] const std::vector<const ScevExpression*> &
+  Operands() const noexcept
+  {
+    return Operands_;
+  }
+
+  [[nodiscard]] const ScevExpression &
+  Operand(size_t index) const noexcept
+  {
+    return *Operands_[index];
+  }
+
+  /**
+   * @return The degree of the polynomial described by the recurrence.
+   */
+  [[nodiscard]] size_t
+  Degree() const noexcept
+  {
+    return Operands_.size() - 1;
+  }
+
+  [[nodiscard]] bool
+  IsAffine() const noexcept
+  {
+    return Degree() == 1;
+  }
+
+  [[nodiscard]] std::string
+  DebugString() const override;
+
+private:
+  const jive::theta_node * ThetaNode_;
+  std::vector<const ScevExpression*> Operands_;
+};
+
+/**
+ * A geometric recurrence {start, *, ratio} of a theta node. Its value in iteration k of the theta node is
+ * start * ratio^k, where start and ratio are loop-invariant in the theta node.
+ */
+class ScevMulRecurrence final : public ScevExpression
+{
+public:
+  ~ScevMulRecurrence() noexcept override;
+
+  ScevMulRecurrence(
+    const jive::theta_node & thetaNode,
+    const ScevExpression & start,
+    const ScevExpression & ratio);
+
+  [[nodiscard]] const jive::theta_node &
+  ThetaNode() const noexcept
+  {
+    return *ThetaNode_;
+  }
+
+  [[nodiscard]] const ScevExpression &
+  Start() const noexcept
+  {
+    return *Start_;
+  }
+
+  [[nodiscard]] const ScevExpression &
+  Ratio() const noexcept
+  {
+    return *Ratio_;
+  }
+
+  [[nodiscard]] std::string
+  DebugString() const override;
+
+private:
+  const jive::theta_node * ThetaNode_;
+  const ScevExpression * Start_;
+  const ScevExpression * Ratio_;
+};
+
+/**
+ * Scalar evolution analysis
+ *
+ * Computes closed forms for the bitstring values of theta nodes. The loop variables of a theta node are described as
+ * recurrences over the iterations of the node, see ScevAddRecurrence and ScevMulRecurrence. A loop variable is
+ * recognized if its value in the next iteration is its current value plus or times a step that is loop-invariant or
+ * itself a recurrence of the same theta node. The values of theta outputs are constants if the trip count of the node
+ * and the closed form of the respective loop variable are known.
+ *
+ * Values are computed with 64-bit arithmetic. Outputs of bitstrings wider than 64 bits are therefore always described
+ * by a ScevUnknown expression.
+ *
+ * The analysis is demand-driven. Expressions are only computed for the outputs that are queried and the outputs they
+ * depend on, and are cached afterwards. A ScalarEvolution instance must be discarded after the graph changed.
+ */
+class ScalarEvolution final
+{
+public:
+  ~ScalarEvolution() noexcept;
+
+  ScalarEvolution();
+
+  ScalarEvolution(const ScalarEvolution &) = delete;
+
+  ScalarEvolution &
+  operator=(const ScalarEvolution &) = delete;
+
+  /**
+   * @return The closed form of the value of \p output, which must be of bitstring type.
+   */
+  const ScevExpression &
+  GetExpression(const jive::output & output);
+
+  /**
+   * Computes the number of times the body of \p thetaNode is executed. The trip count is only known if the predicate
+   * of \p thetaNode matches the comparison of an affine recurrence with constant operands and a constant.
+   *
+   * @return The trip count of \p thetaNode if it is known, otherwise std::nullopt.
+   */
+  std::optional<uint64_t>
+  GetTripCount(const jive::theta_node & thetaNode);
+
+  /**
+   * Computes the smallest and the largest value of \p output over all iterations of the theta nodes it is
+   * contained in. The range is only known for constants, and for recurrences with constant operands that are
+   * monotonic and whose theta node has a known trip count. The range is unknown if any of the values wraps around at
+   * the bit width of \p output.
+   *
+   * @return The signed range of the values of \p output if it is known, otherwise std::nullopt.
+   */
+  std::optional<std::pair<int64_t, int64_t>>
+  GetRange(const jive::output & output);
+
+  /**
+   * Evaluates \p expression in iteration \p iteration of its theta node.
+   *
+   * @return The value of \p expression if it is a constant or a recurrence with constant operands, otherwise
+   * std::nullopt.
+   */
+  static std::optional<int64_t>
+  Evaluate(const ScevExpression & expression, uint64_t iteration);
+
+  /**
+   * @return True if the value of \p expression does not change over the iterations of \p thetaNode, otherwise false.
+   */
+  static bool
+  IsInvariant(const ScevExpression & expression, const jive::theta_node & thetaNode);
+
+private:
+  const ScevExpression *
+  ComputeExpression(const jive::output & output);
+
+  const ScevExpression *
+  ComputeLoopVariable(const jive::output & argument);
+
+  const ScevExpression *
+  ComputeExitValue(const jive::output & output);
+
+  const ScevExpression *
+  DecomposeAdditiveUpdate(const jive::output & update, const jive::output & argument);
+
+  const ScevExpression *
+  DecomposeMultiplicativeUpdate(const jive::output & update, const jive::output & argument);
+
+  const ScevExpression *
+  Add(const ScevExpression & lhs, const ScevExpression & rhs);
+
+  const ScevExpression *
+  Multiply(const ScevExpression & lhs, const ScevExpression & rhs);
+
+  const ScevExpression &
+  CreateConstant(size_t numBits, int64_t value);
+
+  const ScevExpression &
+  CreateUnknown(const jive::output & output);
+
+  const ScevExpression &
+  CreateAddRecurrence(const jive::theta_node & thetaNode, std::vector<const ScevExpression*> operands);
+
+  const ScevExpression &
+  CreateMulRecurrence(
+    const jive::theta_node & thetaNode,
+    const ScevExpression & start,
+    const ScevExpression & ratio);
+
+  std::vector<std::unique_ptr<ScevExpression>> Expressions_;
+  std::unordered_map<const jive::output*, const ScevExpression*> Cache_;
+  std::unordered_map<const jive::theta_node*, std::optional<uint64_t>> TripCounts_;
+  std::unordered_set<const jive::output*> InProgress_;
+};
+
+}
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_OPT_ALIAS_ANALYSES_ANDERSEN_HPP
+#define JLM_OPT_ALIAS_ANALYSES_ANDERSEN_HPP
+
+#include <jlm/opt/alias-analyses/AliasAnalysis.hpp>
+
+#include <memory>
+
+namespace jive {
+  class gamma_node;
+  class graph;
+  class region;
+  class simple_node;
+  class structural_node;
+  class theta_node;
+}
+
+namespace jlm {
+
+namespace delta { class node; }
+namespace lambda { class node; }
+namespace phi { class node; }
+
+class CallNode;
+class LoadNode;
+class StoreNode;
+
+namespace aa {
+
+class ConstraintSet;
+
+/** \brief Andersen alias analysis
+ *
+ * This class implements an Andersen alias analysis. Like Steensgaard, the analysis is inter-procedural,
+ * field-insensitive, context-insensitive, flow-insensitive, and uses a static heap model. In contrast to Steensgaard,
+ * it is inclusion-based, i.e., an assignment p = q only requires the points-to set of p to contain the one of q
+ * instead of unifying both. This results in considerably smaller points-to sets.
+ *
+ * The analysis first collects base, copy, load, and store constraints from the RVSDG and then solves them with a
+ * worklist algorithm. The points-to sets are sparse bit vectors, and only the difference of a points-to set since its
+ * last visit is propagated. Cycles in the constraint graph are detected online with lazy cycle detection and collapsed
+ * into a single node. See Hardekopf and Lin - The Ant and the Grasshopper: Fast and Accurate Pointer Analysis for
+ * Millions of Lines of Code.
+ *
+ * Memory that is not part of the module is modeled by a single external memory object. All pointers that escape the
+ * module are stored in it, and all pointers that enter the module are loaded from it. Memory nodes that are reachable
+ * from the external memory object are marked as escaping the module.
+ */
+class Andersen final : public AliasAnalysis {
+public:
+  ~Andersen() noexcept override;
+
+  Andersen();
+
+  Andersen(const Andersen &) = delete;
+
+  Andersen(Andersen &&) = delete;
+
+  Andersen &
+  operator=(const Andersen &) = delete;
+
+  Andersen &
+  operator=(Andersen &&) = delete;
+
+  std::unique_ptr<PointsToGraph>
+  Analyze(
+    const RvsdgModule & module,
+    StatisticsCollector & statisticsCollector) override;
+
+private:
+  void
+  AnalyzeImports(const jive::graph & graph);
+
+  void
+  AnalyzeExports(const jive::graph & graph);
+
+  void
+  AnalyzeRegion(jive::region & region);
+
+  void
+  AnalyzeLambda(const lambda::node & lambda);
+
+  void
+  AnalyzeDelta(const delta::node & delta);
+
+  void
+  AnalyzePhi(const phi::node & phi);
+
+  void
+  AnalyzeGamma(const jive::gamma_node & gamma);
+
+  void
+  AnalyzeTheta(const jive::theta_node & theta);
+
+  void
+  AnalyzeSimpleNode(const jive::simple_node & node);
+
+  void
+  AnalyzeStructuralNode(const jive::structural_node & node);
+
+  void
+  AnalyzeAlloca(const jive::simple_node & node);
+
+  void
+  AnalyzeMalloc(const jive::simple_node & node);
+
+  void
+  AnalyzeLoad(const LoadNode & loadNode);
+
+  void
+  AnalyzeStore(const StoreNode & storeNode);
+
+  void
+  AnalyzeCall(const CallNode & callNode);
+
+  void
+  AnalyzeMemcpy(const jive::simple_node & node);
+
+  void
+  AnalyzeAggregate(const jive::simple_node & node);
+
+  std::unique_ptr<ConstraintSet> Constraints_;
+};
+
+}}
+
+#endif
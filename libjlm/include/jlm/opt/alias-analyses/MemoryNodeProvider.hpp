@@ -7,7 +7,6 @@
 #define JLM_OPT_ALIAS_ANALYSES_MEMORYNODEPROVIDER_HPP
 
 #include <jlm/opt/alias-analyses/PointsToGraph.hpp>
-#include <jlm/util/HashSet.hpp>
 
 #include <vector>
 
@@ -29,34 +28,34 @@ public:
   [[nodiscard]] virtual const PointsToGraph &
   GetPointsToGraph() const noexcept = 0;
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetRegionEntryNodes(const jive::region & region) const = 0;
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetRegionExitNodes(const jive::region & region) const = 0;
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const = 0;
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const = 0;
 
-  [[nodiscard]] virtual HashSet<const PointsToGraph::MemoryNode*>
+  [[nodiscard]] virtual PointsToGraph::MemoryNodeSet
   GetOutputNodes(const jive::output & output) const = 0;
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetLambdaEntryNodes(const lambda::node & lambdaNode) const
   {
     return GetRegionEntryNodes(*lambdaNode.subregion());
   }
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetLambdaExitNodes(const lambda::node & lambdaNode) const
   {
     return GetRegionExitNodes(*lambdaNode.subregion());
   }
 
-  [[nodiscard]] virtual const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] virtual const PointsToGraph::MemoryNodeSet &
   GetThetaEntryExitNodes(const jive::theta_node & thetaNode) const
   {
     auto & entryNodes = GetRegionEntryNodes(*thetaNode.subregion());
@@ -65,10 +64,10 @@ public:
     return entryNodes;
   }
 
-  [[nodiscard]] virtual HashSet<const PointsToGraph::MemoryNode*>
+  [[nodiscard]] virtual PointsToGraph::MemoryNodeSet
   GetGammaEntryNodes(const jive::gamma_node & gammaNode) const
   {
-    HashSet<const PointsToGraph::MemoryNode*> allMemoryNodes;
+    PointsToGraph::MemoryNodeSet allMemoryNodes;
     for (size_t n = 0; n < gammaNode.nsubregions(); n++) {
       auto & subregion = *gammaNode.subregion(n);
       auto & memoryNodes = GetRegionEntryNodes(subregion);
@@ -78,10 +77,10 @@ public:
     return allMemoryNodes;
   }
 
-  [[nodiscard]] virtual HashSet<const PointsToGraph::MemoryNode*>
+  [[nodiscard]] virtual PointsToGraph::MemoryNodeSet
   GetGammaExitNodes(const jive::gamma_node & gammaNode) const
   {
-    HashSet<const PointsToGraph::MemoryNode*> allMemoryNodes;
+    PointsToGraph::MemoryNodeSet allMemoryNodes;
     for (size_t n = 0; n < gammaNode.nsubregions(); n++) {
       auto & subregion = *gammaNode.subregion(n);
       auto & memoryNodes = GetRegionExitNodes(subregion);
@@ -11,6 +11,10 @@
 namespace jlm::aa {
 
 /** \brief Steensgaard alias analysis with agnostic memory state encoding
+ *
+ * The points-to graph is requested from the analysis cache of the pass manager. The memory state encoding rewrites
+ * the graph and invalidates the points-to graph, such that a cached points-to graph is only found if the preceding
+ * passes merely requested it or preserved it.
  *
  * @see Steensgaard
  * @see AgnosticMemoryNodeProvider
@@ -23,9 +27,19 @@ public:
   run(
     RvsdgModule & rvsdgModule,
     StatisticsCollector & statisticsCollector) override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    PassManager & passManager) override;
 };
 
 /** \brief Steensgaard alias analysis with region-aware memory state encoding
+ *
+ * The points-to graph is requested from the analysis cache of the pass manager, see SteensgaardAgnostic. The
+ * field-sensitive points-to graph is cached independently of the field limit that it was computed with. The memory
+ * nodes are provisioned with the threads of the pass manager.
  *
  * @see Steensgaard
  * @see RegionAwareMemoryNodeProvider
@@ -34,10 +48,58 @@ class SteensgaardRegionAware final : public optimization {
 public:
   ~SteensgaardRegionAware() noexcept override;
 
+  /**
+   * @param maxFields The maximal number of fields of a memory location in the field-sensitive analysis, or zero for
+   * the field-insensitive analysis.
+   */
+  explicit
+  SteensgaardRegionAware(size_t maxFields = 0)
+    : MaxFields_(maxFields)
+  {}
+
+  [[nodiscard]] bool
+  IsFieldSensitive() const noexcept
+  {
+    return MaxFields_ != 0;
+  }
+
   void
   run(
     RvsdgModule & rvsdgModule,
     StatisticsCollector & statisticsCollector) override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    PassManager & passManager) override;
+
+private:
+  size_t MaxFields_;
+};
+
+/** \brief Andersen alias analysis with region-aware memory state encoding
+ *
+ * The points-to graph is requested from the analysis cache of the pass manager, see SteensgaardAgnostic. The memory
+ * nodes are provisioned with the threads of the pass manager.
+ *
+ * @see Andersen
+ * @see RegionAwareMemoryNodeProvider
+ */
+class AndersenRegionAware final : public optimization {
+public:
+  ~AndersenRegionAware() noexcept override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector) override;
+
+  void
+  run(
+    RvsdgModule & rvsdgModule,
+    StatisticsCollector & statisticsCollector,
+    PassManager & passManager) override;
 };
 
 }
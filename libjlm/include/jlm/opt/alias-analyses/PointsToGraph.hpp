@@ -9,15 +9,16 @@
 #include <jlm/common.hpp>
 #include <jlm/ir/operators.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
-#include <jlm/util/HashSet.hpp>
 #include <jlm/util/iterator_range.hpp>
+#include <jlm/util/SparseBitVector.hpp>
 
 #include <jive/rvsdg/node.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 namespace jive {
 	class argument;
@@ -44,10 +45,12 @@ class PointsToGraph final {
 public:
   class AllocaNode;
   class DeltaNode;
+  class FieldNode;
   class ImportNode;
   class LambdaNode;
   class MallocNode;
   class MemoryNode;
+  class MemoryNodeSet;
   class Node;
   class RegisterNode;
   class UnknownMemoryNode;
@@ -55,6 +58,9 @@ public:
 
   using AllocaNodeMap = std::unordered_map<const jive::node*, std::unique_ptr<PointsToGraph::AllocaNode>>;
   using DeltaNodeMap = std::unordered_map<const delta::node*, std::unique_ptr<PointsToGraph::DeltaNode>>;
+  using FieldNodeMap = std::map<
+    std::pair<const PointsToGraph::MemoryNode*, size_t>,
+    std::unique_ptr<PointsToGraph::FieldNode>>;
   using ImportNodeMap = std::unordered_map<const jive::argument*, std::unique_ptr<PointsToGraph::ImportNode>>;
   using LambdaNodeMap = std::unordered_map<const lambda::node*, std::unique_ptr<PointsToGraph::LambdaNode>>;
   using MallocNodeMap = std::unordered_map<const jive::node*, std::unique_ptr<PointsToGraph::MallocNode>>;
@@ -70,6 +76,11 @@ public:
   using DeltaNodeRange = iterator_range<DeltaNodeIterator>;
   using DeltaNodeConstRange = iterator_range<DeltaNodeConstIterator>;
 
+  using FieldNodeIterator = NodeIterator<FieldNode, FieldNodeMap::iterator>;
+  using FieldNodeConstIterator = NodeConstIterator<FieldNode, FieldNodeMap::const_iterator>;
+  using FieldNodeRange = iterator_range<FieldNodeIterator>;
+  using FieldNodeConstRange = iterator_range<FieldNodeConstIterator>;
+
   using ImportNodeIterator = NodeIterator<ImportNode, ImportNodeMap::iterator>;
   using ImportNodeConstIterator = NodeConstIterator<ImportNode, ImportNodeMap::const_iterator>;
   using ImportNodeRange = iterator_range<ImportNodeIterator>;
@@ -116,6 +127,12 @@ public:
   DeltaNodeConstRange
   DeltaNodes() const;
 
+  FieldNodeRange
+  FieldNodes();
+
+  FieldNodeConstRange
+  FieldNodes() const;
+
   ImportNodeRange
   ImportNodes();
 
@@ -152,6 +169,12 @@ public:
     return DeltaNodes_.size();
   }
 
+  size_t
+  NumFieldNodes() const noexcept
+  {
+    return FieldNodes_.size();
+  }
+
   size_t
   NumImportNodes() const noexcept
   {
@@ -181,6 +204,7 @@ public:
   {
     return NumAllocaNodes()
            + NumDeltaNodes()
+           + NumFieldNodes()
            + NumImportNodes()
            + NumLambdaNodes()
            + NumMallocNodes()
@@ -225,6 +249,24 @@ public:
     return *it->second;
   }
 
+  const PointsToGraph::FieldNode &
+  GetFieldNode(
+    const PointsToGraph::MemoryNode & memoryNode,
+    size_t offset) const
+  {
+    auto it = FieldNodes_.find({&memoryNode, offset});
+    if (it == FieldNodes_.end())
+      throw error("Cannot find field node in points-to graph.");
+
+    return *it->second;
+  }
+
+  /**
+   * @return The field nodes of \p memoryNode ordered by their offset.
+   */
+  std::vector<const PointsToGraph::FieldNode*>
+  GetFieldNodes(const PointsToGraph::MemoryNode & memoryNode) const;
+
   const PointsToGraph::ImportNode &
   GetImportNode(const jive::argument & argument) const
   {
@@ -272,11 +314,8 @@ public:
    *
    * @see PointsToGraph::MemoryNode::MarkAsModuleEscaping()
    */
-  const HashSet<const PointsToGraph::MemoryNode*> &
-  GetEscapedMemoryNodes() const noexcept
-  {
-    return EscapedMemoryNodes_;
-  }
+  [[nodiscard]] PointsToGraph::MemoryNodeSet
+  GetEscapedMemoryNodes() const;
 
   PointsToGraph::AllocaNode &
   AddAllocaNode(std::unique_ptr<PointsToGraph::AllocaNode> node);
@@ -284,6 +323,9 @@ public:
   PointsToGraph::DeltaNode &
   AddDeltaNode(std::unique_ptr<PointsToGraph::DeltaNode> node);
 
+  PointsToGraph::FieldNode &
+  AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node);
+
   PointsToGraph::LambdaNode &
   AddLambdaNode(std::unique_ptr<PointsToGraph::LambdaNode> node);
 
@@ -310,12 +352,20 @@ private:
   AddEscapedMemoryNode(PointsToGraph::MemoryNode & memoryNode);
 
   /**
-   * All memory nodes that escape from the module.
+   * The memory node indices of all memory nodes that escape from the module.
    */
-  HashSet<const PointsToGraph::MemoryNode*> EscapedMemoryNodes_;
+  SparseBitVector EscapedMemoryNodes_;
+
+  /**
+   * All nodes and memory nodes of the graph, indexed by PointsToGraph::Node::GetIndex() and
+   * PointsToGraph::MemoryNode::GetMemoryNodeIndex(), respectively.
+   */
+  std::vector<PointsToGraph::Node*> Nodes_;
+  std::vector<PointsToGraph::MemoryNode*> MemoryNodes_;
 
   AllocaNodeMap AllocaNodes_;
   DeltaNodeMap DeltaNodes_;
+  FieldNodeMap FieldNodes_;
   ImportNodeMap ImportNodes_;
   LambdaNodeMap LambdaNodes_;
   MallocNodeMap MallocNodes_;
@@ -326,6 +376,8 @@ private:
 
 /** \brief PointsTo graph node
 *
+* Every node has a dense index that is unique within its points-to graph. The targets of a node are stored as a
+* SparseBitVector of memory node indices, and its sources as a SparseBitVector of node indices.
 */
 class PointsToGraph::Node {
   template<class NODETYPE> class ConstIterator;
@@ -350,7 +402,10 @@ public:
   explicit
   Node(PointsToGraph & pointsToGraph)
     : PointsToGraph_(&pointsToGraph)
-  {}
+    , Index_(pointsToGraph.Nodes_.size())
+  {
+    pointsToGraph.Nodes_.push_back(this);
+  }
 
   Node(const Node&) = delete;
 
@@ -374,22 +429,37 @@ public:
   SourceConstRange
   Sources() const;
 
+  /**
+   * @return The targets of the node as a set of memory nodes.
+   */
+  [[nodiscard]] PointsToGraph::MemoryNodeSet
+  GetTargetSet() const;
+
   PointsToGraph&
   Graph() const noexcept
   {
     return *PointsToGraph_;
   }
 
+  /**
+   * @return The index of the node. The indices of all nodes of a points-to graph are dense and start at zero.
+   */
+  [[nodiscard]] size_t
+  GetIndex() const noexcept
+  {
+    return Index_;
+  }
+
   size_t
   NumTargets() const noexcept
   {
-    return Targets_.size();
+    return Targets_.Size();
   }
 
   size_t
   NumSources() const noexcept
   {
-    return Sources_.size();
+    return Sources_.Size();
   }
 
   virtual std::string
@@ -403,8 +473,9 @@ public:
 
 private:
   PointsToGraph * PointsToGraph_;
-  std::unordered_set<PointsToGraph::MemoryNode*> Targets_;
-  std::unordered_set<PointsToGraph::Node*> Sources_;
+  size_t Index_;
+  SparseBitVector Targets_;
+  SparseBitVector Sources_;
 };
 
 /** \brief PointsTo graph register node
@@ -461,11 +532,27 @@ public:
     Graph().AddEscapedMemoryNode(*this);
   }
 
+  /**
+   * @return The index of the memory node. The indices of all memory nodes of a points-to graph are dense and start
+   * at zero. They are independent of the indices returned by GetIndex().
+   */
+  [[nodiscard]] size_t
+  GetMemoryNodeIndex() const noexcept
+  {
+    return MemoryNodeIndex_;
+  }
+
 protected:
   explicit
   MemoryNode(PointsToGraph & pointsToGraph)
     : Node(pointsToGraph)
-  {}
+    , MemoryNodeIndex_(pointsToGraph.MemoryNodes_.size())
+  {
+    pointsToGraph.MemoryNodes_.push_back(this);
+  }
+
+private:
+  size_t MemoryNodeIndex_;
 };
 
 /** \brief PointsTo graph alloca node
@@ -588,6 +675,65 @@ private:
   const jive::node * MallocNode_;
 };
 
+/** \brief PointsTo graph field node
+ *
+ * A field node represents the memory at a constant, non-zero byte offset within the memory of another memory node,
+ * e.g., a member of a struct. The memory node itself represents the memory at offset zero. Field nodes are only
+ * created by field-sensitive analyses.
+ */
+class PointsToGraph::FieldNode final : public PointsToGraph::MemoryNode {
+public:
+  ~FieldNode() noexcept override;
+
+private:
+  FieldNode(
+    PointsToGraph & pointsToGraph,
+    const PointsToGraph::MemoryNode & memoryNode,
+    size_t offset)
+    : MemoryNode(pointsToGraph)
+    , MemoryNode_(&memoryNode)
+    , Offset_(offset)
+  {
+    JLM_ASSERT(offset != 0);
+  }
+
+public:
+  /**
+   * @return The memory node this field belongs to.
+   */
+  [[nodiscard]] const PointsToGraph::MemoryNode &
+  GetMemoryNode() const noexcept
+  {
+    return *MemoryNode_;
+  }
+
+  /**
+   * @return The byte offset of the field within the memory of GetMemoryNode().
+   */
+  [[nodiscard]] size_t
+  GetOffset() const noexcept
+  {
+    return Offset_;
+  }
+
+  std::string
+  DebugString() const override;
+
+  static PointsToGraph::FieldNode &
+  Create(
+    PointsToGraph & pointsToGraph,
+    const PointsToGraph::MemoryNode & memoryNode,
+    size_t offset)
+  {
+    auto n = std::unique_ptr<PointsToGraph::FieldNode>(new FieldNode(pointsToGraph, memoryNode, offset));
+    return pointsToGraph.AddFieldNode(std::move(n));
+  }
+
+private:
+  const PointsToGraph::MemoryNode * MemoryNode_;
+  size_t Offset_;
+};
+
 /** \brief PointsTo graph malloc node
  *
  */
@@ -718,6 +864,208 @@ private:
   DebugString() const override;
 };
 
+/** \brief Set of points-to graph memory nodes
+ *
+ * Represents a set of memory nodes from a single points-to graph as a SparseBitVector of their memory node indices.
+ * Unions and subset tests of two sets therefore process 64 memory nodes at a time. The items of the set are iterated
+ * in the order of their memory node indices.
+ *
+ * @see PointsToGraph::MemoryNode::GetMemoryNodeIndex()
+ */
+class PointsToGraph::MemoryNodeSet final
+{
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const PointsToGraph::MemoryNode*;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PointsToGraph::MemoryNode**;
+    using reference = const PointsToGraph::MemoryNode*&;
+
+  private:
+    friend MemoryNodeSet;
+
+    ItemConstIterator(
+      const std::vector<PointsToGraph::MemoryNode*> * memoryNodes,
+      const SparseBitVector::ItemConstIterator & it)
+      : MemoryNodes_(memoryNodes)
+      , It_(it)
+      , MemoryNode_(nullptr)
+    {}
+
+  public:
+    const PointsToGraph::MemoryNode * const &
+    operator*() const
+    {
+      MemoryNode_ = (*MemoryNodes_)[*It_];
+      return MemoryNode_;
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      ++It_;
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      return It_ == other.It_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    const std::vector<PointsToGraph::MemoryNode*> * MemoryNodes_;
+    SparseBitVector::ItemConstIterator It_;
+    mutable const PointsToGraph::MemoryNode * MemoryNode_;
+  };
+
+public:
+  MemoryNodeSet()
+    : PointsToGraph_(nullptr)
+  {}
+
+  MemoryNodeSet(std::initializer_list<const PointsToGraph::MemoryNode*> memoryNodes)
+    : PointsToGraph_(nullptr)
+  {
+    for (auto & memoryNode : memoryNodes)
+      Insert(memoryNode);
+  }
+
+  MemoryNodeSet(
+    const PointsToGraph & pointsToGraph,
+    SparseBitVector memoryNodeIndices)
+    : PointsToGraph_(&pointsToGraph)
+    , MemoryNodeIndices_(std::move(memoryNodeIndices))
+  {}
+
+  [[nodiscard]] iterator_range<ItemConstIterator>
+  Items() const noexcept
+  {
+    auto memoryNodes = PointsToGraph_ ? &PointsToGraph_->MemoryNodes_ : nullptr;
+    auto items = MemoryNodeIndices_.Items();
+    return {ItemConstIterator(memoryNodes, items.begin()), ItemConstIterator(memoryNodes, items.end())};
+  }
+
+  /**
+   * @return The memory node indices of the items of the set.
+   */
+  [[nodiscard]] const SparseBitVector &
+  GetMemoryNodeIndices() const noexcept
+  {
+    return MemoryNodeIndices_;
+  }
+
+  [[nodiscard]] bool
+  Contains(const PointsToGraph::MemoryNode * memoryNode) const noexcept
+  {
+    JLM_ASSERT(PointsToGraph_ == nullptr || PointsToGraph_ == &memoryNode->Graph());
+    return MemoryNodeIndices_.Contains(memoryNode->GetMemoryNodeIndex());
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return MemoryNodeIndices_.Size();
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return MemoryNodeIndices_.IsEmpty();
+  }
+
+  /**
+   * Inserts \p memoryNode into the set.
+   *
+   * @return True if \p memoryNode was not already part of the set, otherwise false.
+   */
+  bool
+  Insert(const PointsToGraph::MemoryNode * memoryNode)
+  {
+    AdoptGraph(&memoryNode->Graph());
+    return MemoryNodeIndices_.Insert(memoryNode->GetMemoryNodeIndex());
+  }
+
+  /**
+   * Removes \p memoryNode from the set.
+   *
+   * @return True if \p memoryNode was part of the set, otherwise false.
+   */
+  bool
+  Remove(const PointsToGraph::MemoryNode * memoryNode)
+  {
+    JLM_ASSERT(PointsToGraph_ == nullptr || PointsToGraph_ == &memoryNode->Graph());
+    return MemoryNodeIndices_.Remove(memoryNode->GetMemoryNodeIndex());
+  }
+
+  /**
+   * Adds all memory nodes of \p other to the set.
+   *
+   * @return True if the set changed, otherwise false.
+   */
+  bool
+  UnionWith(const MemoryNodeSet & other)
+  {
+    AdoptGraph(other.PointsToGraph_);
+    return MemoryNodeIndices_.UnionWith(other.MemoryNodeIndices_);
+  }
+
+  /**
+   * @return True if all memory nodes of the set are also part of \p other, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const MemoryNodeSet & other) const noexcept
+  {
+    return MemoryNodeIndices_.IsSubsetOf(other.MemoryNodeIndices_);
+  }
+
+  void
+  Clear() noexcept
+  {
+    MemoryNodeIndices_.Clear();
+  }
+
+  bool
+  operator==(const MemoryNodeSet & other) const noexcept
+  {
+    return MemoryNodeIndices_ == other.MemoryNodeIndices_;
+  }
+
+  bool
+  operator!=(const MemoryNodeSet & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  void
+  AdoptGraph(const PointsToGraph * pointsToGraph) noexcept
+  {
+    JLM_ASSERT(PointsToGraph_ == nullptr || pointsToGraph == nullptr || PointsToGraph_ == pointsToGraph);
+    if (PointsToGraph_ == nullptr)
+      PointsToGraph_ = pointsToGraph;
+  }
+
+  const PointsToGraph * PointsToGraph_;
+  SparseBitVector MemoryNodeIndices_;
+};
+
 /** \brief Points-to graph node iterator
 */
 template<class DATATYPE, class ITERATORTYPE>
@@ -875,16 +1223,18 @@ public:
 private:
   friend PointsToGraph::Node;
 
-  explicit
-  Iterator(const typename std::unordered_set<NODETYPE*>::iterator & it)
-    : It_(it)
+  Iterator(
+    const std::vector<NODETYPE*> & nodes,
+    const SparseBitVector::ItemConstIterator & it)
+    : Nodes_(&nodes)
+    , It_(it)
   {}
 
 public:
   [[nodiscard]] NODETYPE *
   GetNode() const noexcept
   {
-    return *It_;
+    return (*Nodes_)[*It_];
   }
 
   NODETYPE &
@@ -928,7 +1278,8 @@ public:
   }
 
 private:
-  typename std::unordered_set<NODETYPE*>::iterator It_;
+  const std::vector<NODETYPE*> * Nodes_;
+  SparseBitVector::ItemConstIterator It_;
 };
 
 /** \brief Points-to graph edge const iterator
@@ -944,18 +1295,20 @@ public:
   using reference = const NODETYPE*&;
 
 private:
-  friend PointsToGraph;
+  friend PointsToGraph::Node;
 
-  explicit
-  ConstIterator(const typename std::unordered_set<NODETYPE*>::const_iterator & it)
-    : It_(it)
+  ConstIterator(
+    const std::vector<NODETYPE*> & nodes,
+    const SparseBitVector::ItemConstIterator & it)
+    : Nodes_(&nodes)
+    , It_(it)
   {}
 
 public:
   [[nodiscard]] const NODETYPE *
   GetNode() const noexcept
   {
-    return *It_;
+    return (*Nodes_)[*It_];
   }
 
   const NODETYPE &
@@ -999,7 +1352,8 @@ public:
   }
 
 private:
-  typename std::unordered_set<NODETYPE*>::const_iterator It_;
+  const std::vector<NODETYPE*> * Nodes_;
+  SparseBitVector::ItemConstIterator It_;
 };
 
 }}
@@ -11,6 +11,12 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+namespace jlm {
+
+class ThreadPool;
+
+}
+
 namespace jlm::aa {
 
 class RegionAwareMemoryNodeProvisioning;
@@ -36,6 +42,11 @@ class RegionAwareMemoryNodeProvisioning;
  * 4. Propagation: The memory locations are propagated through the graph again. After this phase, a fix-point is reached
  * and all regions are annotated with the required memory locations.
  *
+ * Every lambda and phi node in the RVSDG root region forms a strongly connected component of the call graph, and the
+ * region summaries of such a node only depend on the region summaries of the nodes it depends on. All phases can
+ * therefore be performed with multiple threads by processing the nodes of the root region bottom-up over the call
+ * graph, where independent nodes are processed concurrently. The result is independent of the number of threads.
+ *
  * @see MemoryNodeProvider
  * @see MemoryStateEncoder
  */
@@ -46,7 +57,12 @@ public:
 
   ~RegionAwareMemoryNodeProvider() noexcept override;
 
-  RegionAwareMemoryNodeProvider() = default;
+  /**
+   * @param threadPool The thread pool used for the provisioning, or nullptr for a sequential provisioning. The pool
+   * must not execute other tasks until ProvisionMemoryNodes() returned.
+   */
+  explicit
+  RegionAwareMemoryNodeProvider(ThreadPool * threadPool = nullptr);
 
   RegionAwareMemoryNodeProvider(const RegionAwareMemoryNodeProvider &) = delete;
 
@@ -70,6 +86,7 @@ public:
    * @param rvsdgModule The RVSDG module on which the provision should be performed.
    * @param pointsToGraph The PointsToGraph corresponding to the RVSDG module.
    * @param statisticsCollector The statistics collector for collecting pass statistics.
+   * @param threadPool The thread pool used for the provisioning, or nullptr for a sequential provisioning.
    *
    * @return A new instance of MemoryNodeProvisioning.
    */
@@ -77,7 +94,8 @@ public:
   Create(
     const RvsdgModule & rvsdgModule,
     const PointsToGraph & pointsToGraph,
-    StatisticsCollector & statisticsCollector);
+    StatisticsCollector & statisticsCollector,
+    ThreadPool * threadPool = nullptr);
 
   /**
    * Creates a RegionAwareMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
@@ -93,13 +111,22 @@ public:
     const PointsToGraph & pointsToGraph);
 
 private:
+  /**
+   * Creates the region summaries of \p region and all its subregions. The summaries are created upfront such that the
+   * annotation of independent nodes can be performed concurrently without modifying the provisioning.
+   *
+   * @param region The region for which to create the summaries.
+   */
+  void
+  CreateRegionSummaries(const jive::region & region);
+
   /**
    * Annotates a region with the memory locations utilized by the contained simple RVSDG nodes, e.g., load, store, etc.
    * nodes, the contained function calls, and the simple RVSDG nodes that reference unknown memory locations.
    *
-   * The annotation phase starts at the RVSDG root region and simply iterates through all the nodes within a region and
-   * performs the appropriate action for a node. It recursively traverses the subregions of structural nodes until all
-   * nodes within all regions of the graph have been visited.
+   * The annotation phase starts at the nodes of the RVSDG root region and simply iterates through all the nodes within
+   * a region and performs the appropriate action for a node. It recursively traverses the subregions of structural
+   * nodes until all nodes within all regions of the graph have been visited.
    *
    * @param region The to be annotated region.
    */
@@ -148,12 +175,21 @@ private:
    *  node of a phi node is handled, the union of the memory locations as well as the union of the simple
    *  RVSDG nodes of all lambdas in the phi node are computed, and associated with each lambda in the phi node.
    *
-   * @param rvsdgModule The RVSDG module on which the propagation is performed.
+   * The nodes of a call graph level are propagated concurrently if a thread pool is given.
+   *
+   * @param callGraphLevels The call graph levels of the RVSDG root region.
+   * @param threadPool The thread pool used for the propagation, or nullptr.
    *
    * @see ExtractLambdaNodes()
+   * @see ExtractCallGraphLevels()
    */
   void
-  Propagate(const RvsdgModule & rvsdgModule);
+  Propagate(
+    const std::vector<std::vector<const jive::node*>> & callGraphLevels,
+    ThreadPool * threadPool);
+
+  void
+  PropagateNode(const jive::node & node);
 
   void
   PropagateRegion(const jive::region & region);
@@ -171,12 +207,19 @@ private:
    * simple RVSDG node. By adding these memory locations to the respective region of the simple RVSDG nodes, we ensure
    * that all memory locations from before and after these nodes are available for encoding.
    *
+   * The tail nodes are resolved concurrently if a thread pool is given. Each tail node collects the memory locations
+   * for the regions locally, and the collected memory locations are added to the regions in the order of the tail
+   * nodes afterwards.
+   *
    * @param rvsdgModule The RVSDG module for which to resolve the unknown memory location references.
+   * @param threadPool The thread pool used for the resolution, or nullptr.
    *
    * @see ExtractRvsdgTailNodes()
    */
   void
-  ResolveUnknownMemoryNodeReferences(const RvsdgModule & rvsdgModule);
+  ResolveUnknownMemoryNodeReferences(
+    const RvsdgModule & rvsdgModule,
+    ThreadPool * threadPool);
 
   /**
    * Extracts all lambda nodes from a phi node.
@@ -201,6 +244,20 @@ private:
   static std::vector<const jive::node*>
   ExtractRvsdgTailNodes(const RvsdgModule & rvsdgModule);
 
+  /**
+   * Partitions the nodes of the RVSDG root region into call graph levels.
+   *
+   * A node is placed one level above the highest level of the nodes it depends on. The nodes of a level therefore
+   * neither call each other nor any node of a higher level, and can be processed independently once all lower levels
+   * have been processed.
+   *
+   * @param rvsdgModule The RVSDG module from which to extract the call graph levels.
+   * @return A vector of call graph levels, ordered from the lowest to the highest level.
+   */
+  static std::vector<std::vector<const jive::node*>>
+  ExtractCallGraphLevels(const RvsdgModule & rvsdgModule);
+
+  ThreadPool * ThreadPool_;
   std::unique_ptr<RegionAwareMemoryNodeProvisioning> Provisioning_;
 };
 
@@ -6,10 +6,19 @@
 #ifndef JLM_OPT_ALIAS_ANALYSES_STEENSGAARD_HPP
 #define JLM_OPT_ALIAS_ANALYSES_STEENSGAARD_HPP
 
+#include <jlm/common.hpp>
+#include <jlm/ir/DataLayout.hpp>
 #include <jlm/opt/alias-analyses/AliasAnalysis.hpp>
-#include <jlm/util/disjointset.hpp>
 
+#include <jive/rvsdg/id-map.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace jive {
 	class argument;
@@ -21,6 +30,7 @@ namespace jive {
 	class simple_node;
 	class structural_node;
 	class theta_node;
+	class type;
 }
 
 namespace jlm {
@@ -29,14 +39,13 @@ namespace delta { class node; }
 namespace lambda { class node; }
 namespace phi { class node; }
 
+class CallNode;
 class LoadNode;
 class StoreNode;
 
 namespace aa {
 
-class Location;
 class PointsToGraph;
-class RegisterLocation;
 
 enum class PointsToFlags {
   PointsToNone           = 1 << 0,
@@ -59,128 +68,353 @@ operator&(PointsToFlags lhs, PointsToFlags rhs)
   return static_cast<PointsToFlags>(static_cast<underlyingType>(lhs) & static_cast<underlyingType>(rhs));
 }
 
+/**
+ * Dense index of a location in a LocationSet.
+ */
+using LocationIndex = uint32_t;
+
 /** \brief LocationSet class
-*/
+ *
+ * Stores the abstract locations of the Steensgaard analysis and partitions them into disjoint sets. Locations are
+ * identified by dense indices, and their attributes are kept in arrays that are indexed by them. The partition is a
+ * flat union-find with union by rank and path halving. The register locations are looked up by the dense identifiers
+ * of their outputs.
+ *
+ * The points-to flags and the points-to location of a disjoint set are the ones of its root location.
+ *
+ * For field-sensitive analyses, a disjoint set can additionally represent a field of another set, i.e., the memory at
+ * a constant byte offset from the memory the other set represents. The field base and offset of a disjoint set as well
+ * as the fields of a set are the ones of its root location. They are not updated by Merge().
+ */
 class LocationSet final
 {
 public:
-	using DisjointLocationSet = typename jlm::disjointset<Location*>;
+  enum class Kind : uint8_t
+  {
+    Register,
+    Alloca,
+    Malloc,
+    Lambda,
+    Delta,
+    Import,
 
-	using const_iterator = std::unordered_map<
-	  const jive::output*
-	, Location*
-	>::const_iterator;
+    /**
+     * A location without an equivalent in the RVSDG, which only exists for structural purposes.
+     */
+    Dummy,
 
-	~LocationSet();
+    /**
+     * A location that represents a field of another set. Like dummy locations, it has no equivalent in the RVSDG.
+     */
+    Field
+  };
 
-	LocationSet();
+  static constexpr LocationIndex NoLocation = std::numeric_limits<LocationIndex>::max();
 
-	LocationSet(const LocationSet &) = delete;
+  ~LocationSet();
 
-	LocationSet(LocationSet &&) = delete;
+  LocationSet();
 
-	LocationSet &
-	operator=(const LocationSet &) = delete;
+  LocationSet(const LocationSet &) = delete;
 
-	LocationSet &
-	operator=(LocationSet &&) = delete;
+  LocationSet(LocationSet &&) = delete;
 
-	DisjointLocationSet::set_iterator
-	begin() const
-	{
-		return DisjointLocationSet_.begin();
-	}
+  LocationSet &
+  operator=(const LocationSet &) = delete;
 
-	DisjointLocationSet::set_iterator
-	end() const
-	{
-		return DisjointLocationSet_.end();
-	}
+  LocationSet &
+  operator=(LocationSet &&) = delete;
 
-  Location &
+  LocationIndex
   InsertAllocaLocation(const jive::node & node);
 
-  Location &
+  LocationIndex
   InsertMallocLocation(const jive::node & node);
 
-  Location &
+  LocationIndex
   InsertLambdaLocation(const lambda::node & lambda);
 
-  Location &
+  LocationIndex
   InsertDeltaLocation(const delta::node & delta);
 
-	Location &
-	InsertImportLocation(const jive::argument & argument);
+  LocationIndex
+  InsertImportLocation(const jive::argument & argument);
+
+  LocationIndex
+  InsertDummyLocation();
+
+  /**
+   * Inserts a field location that represents the memory at byte offset \p offset from the memory of \p base. The
+   * field is registered as field of \p base.
+   *
+   * @return The inserted field location.
+   */
+  LocationIndex
+  InsertFieldLocation(
+    LocationIndex base,
+    size_t offset);
+
+  bool
+  Contains(const jive::output & output) const noexcept;
+
+  /**
+   * @return The root location of the register location of \p output. The register location is inserted with
+   * \p pointsToFlags if it does not exist yet.
+   */
+  LocationIndex
+  FindOrInsertRegisterLocation(
+    const jive::output & output,
+    PointsToFlags pointsToFlags);
 
-	Location &
-	InsertDummyLocation();
+  /**
+   * @return The register location of \p output, which must exist.
+   */
+  LocationIndex
+  GetRegisterLocation(const jive::output & output) const;
+
+  /**
+   * @return The root location of the register location of \p output, which must exist.
+   */
+  LocationIndex
+  Find(const jive::output & output);
+
+  LocationIndex
+  GetRootLocation(LocationIndex location) noexcept;
+
+  /**
+   * Unifies the disjoint sets of \p location1 and \p location2. The points-to flags of the resulting set are the
+   * union of the points-to flags of both sets, and the resulting set is collapsed if one of the sets was collapsed.
+   *
+   * @return The root location of the resulting set.
+   */
+  LocationIndex
+  Merge(LocationIndex location1, LocationIndex location2);
+
+  [[nodiscard]] Kind
+  GetKind(LocationIndex location) const noexcept
+  {
+    return Kinds_[location];
+  }
 
-	bool
-	Contains(const jive::output & output) const noexcept;
+  /**
+   * @return The output of a register or import location, or the output of the node of a memory location.
+   */
+  [[nodiscard]] const jive::output &
+  GetOutput(LocationIndex location) const noexcept
+  {
+    JLM_ASSERT(Kinds_[location] != Kind::Dummy && Kinds_[location] != Kind::Field);
+    return *Outputs_[location];
+  }
 
-	Location &
-	FindOrInsertRegisterLocation(
-    const jive::output & output,
-    PointsToFlags pointsToFlags);
+  [[nodiscard]] PointsToFlags
+  GetPointsToFlags(LocationIndex location) const noexcept
+  {
+    return PointsToFlags_[location];
+  }
 
-	const DisjointLocationSet::set &
-	GetSet(Location & location) const
-	{
-		return *DisjointLocationSet_.find(&location);
-	}
+  void
+  SetPointsToFlags(LocationIndex location, PointsToFlags pointsToFlags) noexcept
+  {
+    PointsToFlags_[location] = pointsToFlags;
+  }
+
+  [[nodiscard]] bool
+  HasPointsToFlag(LocationIndex location, PointsToFlags pointsToFlag) const noexcept
+  {
+    return (PointsToFlags_[location] & pointsToFlag) == pointsToFlag;
+  }
+
+  /**
+   * @return The location \p location points to, or NoLocation.
+   */
+  [[nodiscard]] LocationIndex
+  GetPointsTo(LocationIndex location) const noexcept
+  {
+    return PointsTo_[location];
+  }
+
+  void
+  SetPointsTo(LocationIndex location, LocationIndex pointsTo) noexcept
+  {
+    PointsTo_[location] = pointsTo;
+  }
+
+  /** Determines whether the location escapes the module.
+   *
+   * @return True, if the location escapes the module, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsEscapingModule(LocationIndex location) const noexcept
+  {
+    return IsEscapingModule_[location];
+  }
+
+  void
+  MarkAsEscapingModule(LocationIndex location) noexcept
+  {
+    IsEscapingModule_[location] = true;
+  }
+
+  /**
+   * @return The location of the set \p location is a field of, or NoLocation if it is no field.
+   */
+  [[nodiscard]] LocationIndex
+  GetFieldBase(LocationIndex location) const noexcept
+  {
+    return FieldBases_[location];
+  }
+
+  /**
+   * @return The byte offset of the field \p location from its base.
+   */
+  [[nodiscard]] size_t
+  GetFieldOffset(LocationIndex location) const noexcept
+  {
+    JLM_ASSERT(FieldBases_[location] != NoLocation);
+    return FieldOffsets_[location];
+  }
+
+  void
+  SetFieldBase(
+    LocationIndex location,
+    LocationIndex base,
+    size_t offset) noexcept
+  {
+    FieldBases_[location] = base;
+    FieldOffsets_[location] = offset;
+  }
+
+  void
+  ClearFieldBase(LocationIndex location) noexcept
+  {
+    FieldBases_[location] = NoLocation;
+    FieldOffsets_[location] = 0;
+  }
+
+  /**
+   * @return The fields of \p location indexed by their byte offset.
+   */
+  [[nodiscard]] const std::map<size_t, LocationIndex> &
+  GetFields(LocationIndex location) const noexcept;
+
+  /**
+   * Removes all fields from \p location.
+   *
+   * @return The removed fields indexed by their byte offset.
+   */
+  std::map<size_t, LocationIndex>
+  ExtractFields(LocationIndex location);
+
+  void
+  InsertField(
+    LocationIndex location,
+    size_t offset,
+    LocationIndex field);
+
+  /**
+   * Determines whether the set of \p location was collapsed, i.e., all its fields were unified with it.
+   */
+  [[nodiscard]] bool
+  IsCollapsed(LocationIndex location) const noexcept
+  {
+    return IsCollapsed_[location];
+  }
+
+  void
+  MarkAsCollapsed(LocationIndex location) noexcept
+  {
+    IsCollapsed_[location] = true;
+  }
 
   size_t
   NumDisjointSets() const noexcept
   {
-    return DisjointLocationSet_.nsets();
+    return NumDisjointSets_;
   }
 
   size_t
   NumLocations() const noexcept
   {
-    return DisjointLocationSet_.nvalues();
+    return Kinds_.size();
   }
 
-	Location &
-	GetRootLocation(Location & location) const;
-
-	Location &
-	Find(const jive::output & output);
+  std::string
+  DebugString(LocationIndex location) const;
 
-  RegisterLocation *
-  LookupRegisterLocation(const jive::output & output);
+  std::string
+  ToDot();
 
-	Location &
-	Merge(Location & location1, Location & location2);
-
-	std::string
-	ToDot() const;
-
-	void
-	Clear();
+  void
+  Clear();
 
 private:
-	RegisterLocation &
-	InsertRegisterLocation(
-    const jive::output & output,
+  LocationIndex
+  InsertLocation(
+    Kind kind,
+    const jive::output * output,
     PointsToFlags pointsToFlags);
 
-	DisjointLocationSet DisjointLocationSet_;
-	std::vector<std::unique_ptr<Location>> Locations_;
-	std::unordered_map<const jive::output*, RegisterLocation*> LocationMap_;
+  std::vector<Kind> Kinds_;
+  std::vector<const jive::output*> Outputs_;
+  std::vector<PointsToFlags> PointsToFlags_;
+  std::vector<LocationIndex> PointsTo_;
+  std::vector<bool> IsEscapingModule_;
+  std::vector<LocationIndex> FieldBases_;
+  std::vector<size_t> FieldOffsets_;
+  std::vector<bool> IsCollapsed_;
+  std::unordered_map<LocationIndex, std::map<size_t, LocationIndex>> Fields_;
+
+  std::vector<LocationIndex> Parents_;
+  std::vector<uint8_t> Ranks_;
+  size_t NumDisjointSets_;
+
+  jive::output_map<LocationIndex> RegisterLocations_;
 };
 
 /** \brief Steensgaard alias analysis
  *
- * This class implements a Steensgaard alias analysis. The analysis is inter-procedural, field-insensitive,
- * context-insensitive, flow-insensitive, and uses a static heap model. It is an implementation corresponding to the
- * algorithm presented in Bjarne Steensgaard - Points-to Analysis in Almost Linear Time.
+ * This class implements a Steensgaard alias analysis. The analysis is inter-procedural, context-insensitive,
+ * flow-insensitive, and uses a static heap model. It is an implementation corresponding to the algorithm presented in
+ * Bjarne Steensgaard - Points-to Analysis in Almost Linear Time.
+ *
+ * The analysis is field-insensitive by default. In its field-sensitive mode, a getelementptr with constant indices
+ * yields a pointer to a field of the memory its base points to, i.e., to a set that represents the memory at the
+ * constant byte offset of the getelementptr. The byte offsets are computed with the DataLayout of the module, such
+ * that a getelementptr on a struct and a getelementptr on an i8 pointer that address the same field agree. Fields at
+ * distinct offsets are kept apart and result in distinct PointsToGraph::FieldNode%s. A set is collapsed, i.e., all its
+ * fields are unified with it, if
+ *
+ * 1. it has more fields than permitted,
+ * 2. it is accessed with a non-constant or negative offset, or an offset that cannot be determined because the data
+ *    layout of the module is malformed,
+ * 3. it is unified with a set at a different offset,
+ * 4. it is the source or destination of a memcpy, or
+ * 5. it is accessed with a type that can hold pointers and overlaps with other fields.
+ *
+ * Accesses that overlap with other fields, but cannot hold pointers, as well as frees, do not collapse a set. Their
+ * address instead also points to all fields the access overlaps with.
  */
 class Steensgaard final : public AliasAnalysis {
 public:
 	~Steensgaard() override;
 
-	Steensgaard() = default;
+	/**
+	 * Creates a field-insensitive analysis.
+	 */
+	Steensgaard();
+
+	/**
+	 * Creates a field-sensitive analysis.
+	 *
+	 * @param maxFields The maximal number of fields of a set before it is collapsed. Must be greater than zero.
+	 */
+	explicit
+	Steensgaard(size_t maxFields);
+
+	/**
+	 * The maximal number of fields of a set that the field-sensitive passes use.
+	 */
+	static constexpr size_t DefaultMaxFields = 32;
 
 	Steensgaard(const Steensgaard &) = delete;
 
@@ -198,6 +432,30 @@ public:
     StatisticsCollector & statisticsCollector) override;
 
 private:
+	/**
+	 * A load, store, or free that is recorded by the field-sensitive analysis.
+	 */
+	struct MemoryAccess
+	{
+		const jive::output * Address;
+
+		/**
+		 * The number of accessed bytes.
+		 */
+		size_t Size;
+
+		/**
+		 * Determines whether the accessed value can hold pointers.
+		 */
+		bool MayContainPointers;
+	};
+
+	[[nodiscard]] bool
+	IsFieldSensitive() const noexcept
+	{
+		return MaxFields_ != 0;
+	}
+
 	void
 	ResetState();
 
@@ -261,6 +519,9 @@ private:
 	void
 	AnalyzeMemcpy(const jive::simple_node & node);
 
+	void
+	AnalyzeFree(const jive::simple_node & node);
+
 	void
 	AnalyzeConstantArray(const jive::simple_node & node);
 
@@ -273,15 +534,86 @@ private:
 	void
 	AnalyzeExtractValue(const jive::simple_node & node);
 
-	static std::unique_ptr<PointsToGraph>
-	ConstructPointsToGraph(const LocationSet & locationSets);
+	std::unique_ptr<PointsToGraph>
+	ConstructPointsToGraph();
 
 	/** \brief Perform a recursive union of Location \p x and \p y.
+	*
+	* Joins that are requested while a join is in progress are only performed before the outermost join returns.
 	*/
 	void
-	join(Location & x, Location & y);
+	join(LocationIndex x, LocationIndex y);
+
+	/**
+	 * Unifies the sets \p root1 and \p root2 and the sets they point to.
+	 *
+	 * @return The root location of the resulting set.
+	 */
+	LocationIndex
+	MergeSets(LocationIndex root1, LocationIndex root2);
+
+	/**
+	 * Unifies the sets \p root1 and \p root2 as well as their fields.
+	 */
+	void
+	MergeFieldSets(LocationIndex root1, LocationIndex root2);
+
+	/**
+	 * Determines the set whose memory the set of \p location is part of, and the byte offset of the set's memory within
+	 * it. The offset is always zero for collapsed sets.
+	 */
+	std::pair<LocationIndex, size_t>
+	ResolveField(LocationIndex location);
+
+	/**
+	 * @return The root location of the set that represents the memory at byte offset \p offset from the memory of
+	 * \p location.
+	 */
+	LocationIndex
+	GetFieldLocation(LocationIndex location, int64_t offset);
+
+	/**
+	 * Collapses the set whose memory the set of \p location is part of.
+	 */
+	void
+	Collapse(LocationIndex location);
+
+	/**
+	 * Collapses all sets that are accessed with a type that can hold pointers and overlaps with their fields.
+	 */
+	void
+	CollapseOverlappingAccesses();
+
+	/**
+	 * Propagates the points-to flags of the base of a field pointer to the field pointer.
+	 */
+	void
+	PropagateFieldPointerFlags();
+
+	/**
+	 * @return The root location of the set the register location of \p address points to. A dummy location is
+	 * inserted if it does not point to anything yet.
+	 */
+	LocationIndex
+	GetOrInsertPointsTo(const jive::output & address);
+
+	void
+	RecordMemoryAccess(
+		const jive::output & address,
+		const jive::type & type);
 
 	LocationSet LocationSet_;
+
+	size_t MaxFields_;
+	bool IsJoining_;
+	std::vector<std::pair<LocationIndex, LocationIndex>> PendingJoins_;
+	std::vector<MemoryAccess> MemoryAccesses_;
+	std::vector<std::pair<const jive::output*, const jive::output*>> FieldPointers_;
+
+	/**
+	 * The layout of the analyzed module, or nothing if its data layout string is malformed.
+	 */
+	std::optional<jlm::DataLayout> DataLayout_;
 };
 
 }}
@@ -15,7 +15,7 @@ class RvsdgModule;
 /**
 * \brief Common Node Elimination
 */
-class cne final : public optimization {
+class cne final : public RegionLocalOptimization {
 public:
 	virtual
 	~cne();
@@ -24,6 +24,19 @@ public:
 	run(
     RvsdgModule & module,
     StatisticsCollector & statisticsCollector) override;
+
+	virtual void
+	RunOnLambda(
+    lambda::node & lambdaNode,
+    StatisticsCollector & statisticsCollector) override;
+
+	/**
+	* Congruent outputs point to the same memory locations, and nodes whose
+	* users were diverted are only removed by a later dead node elimination.
+	* The points-to graph therefore remains valid.
+	*/
+	virtual HashSet<AnalysisId>
+	PreservedAnalyses() const override;
 };
 
 }
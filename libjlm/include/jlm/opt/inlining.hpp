@@ -13,18 +13,72 @@ namespace jlm {
 
 class RvsdgModule;
 
+/**
+ * Parameters of the cost model used by fctinline.
+ *
+ * The cost of inlining a call is the number of nodes of the callee, reduced by ConstantArgumentBonus for every
+ * constant argument that is used by the callee. A call is inlined if its cost does not exceed Threshold, increased by
+ * LoopDepthBonus for every loop the call is nested in, and if the resulting growth fits into the budgets.
+ */
+class InliningConfiguration final {
+public:
+  /**
+   * The maximal cost of a call that is inlined outside of loops.
+   */
+  size_t Threshold = 40;
+
+  /**
+   * The reduction of the cost for every constant argument of a call.
+   */
+  size_t ConstantArgumentBonus = 10;
+
+  /**
+   * The increase of the threshold for every loop a call is nested in.
+   */
+  size_t LoopDepthBonus = 20;
+
+  /**
+   * The maximal number of nodes by which a single function may grow through inlining.
+   */
+  size_t CallerGrowthBudget = 400;
+
+  /**
+   * The maximal growth of the entire module through inlining in percent of its initial number of nodes.
+   */
+  size_t GlobalGrowthBudget = 100;
+};
+
 /**
 * \brief Function Inlining
+*
+* Processes the strongly connected components of the call graph bottom-up, such that callees are optimized before
+* their callers. Direct calls to functions of other components are inlined according to the cost model and budgets of
+* an InliningConfiguration, while calls within a component, i.e., recursive calls, are never inlined. A function that is
+* only used by a single direct call is always inlined.
 */
 class fctinline final : public optimization {
 public:
 	virtual
 	~fctinline();
 
+	explicit
+	fctinline(InliningConfiguration configuration = InliningConfiguration())
+	: Configuration_(std::move(configuration))
+	{}
+
 	virtual void
 	run(
     RvsdgModule & module,
     StatisticsCollector & statisticsCollector) override;
+
+	[[nodiscard]] const InliningConfiguration &
+	Configuration() const noexcept
+	{
+		return Configuration_;
+	}
+
+private:
+	InliningConfiguration Configuration_;
 };
 
 jive::output *
@@ -15,7 +15,7 @@ class RvsdgModule;
 /**
 * \brief Theta-Gamma Inversion
 */
-class tginversion final : public optimization {
+class tginversion final : public RegionLocalOptimization {
 public:
 	virtual
 	~tginversion();
@@ -23,6 +23,11 @@ public:
 	virtual void
 	run(
     RvsdgModule & module,
+    StatisticsCollector & statisticsCollector) override;
+
+	virtual void
+	RunOnLambda(
+    lambda::node & lambdaNode,
     StatisticsCollector & statisticsCollector) override;
 };
 
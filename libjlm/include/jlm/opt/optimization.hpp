@@ -6,13 +6,38 @@
 #ifndef JLM_OPT_OPTIMIZATION_HPP
 #define JLM_OPT_OPTIMIZATION_HPP
 
+#include <jlm/util/HashSet.hpp>
+
+#include <cstddef>
 #include <vector>
 
 namespace jlm {
 
+class PassManager;
 class RvsdgModule;
 class StatisticsCollector;
 
+namespace lambda {
+class node;
+}
+
+/**
+* \brief Analyses that are cached across optimization passes
+*
+* The points-to graphs are invalidated by the alias analysis passes
+* themselves, as they encode memory states and thereby rewrite the graph.
+* A cached points-to graph is therefore only reused by passes that request it
+* without changing the module, or across passes that preserve it, e.g., cne
+* and InvariantValueRedirection.
+*
+* @see AnalysisManager
+*/
+enum class AnalysisId {
+  AndersenPointsToGraph,
+  SteensgaardFieldSensitivePointsToGraph,
+  SteensgaardPointsToGraph
+};
+
 /**
 * \brief Optimization pass interface
 */
@@ -34,17 +59,90 @@ public:
 	virtual void
 	run(
     RvsdgModule & module,
+    StatisticsCollector & statisticsCollector) = 0;
+
+	/**
+	* \brief Perform optimization with the analyses cached by \p passManager
+	*
+	* The default implementation does not use any cached analyses and invokes
+	* run(RvsdgModule&, StatisticsCollector&).
+	*
+	* \param module RVSDG module the optimization is performed on.
+	* \param statisticsCollector Statistics collector for collecting optimization statistics.
+	* \param passManager Pass manager that performs the optimization.
+	*/
+	virtual void
+	run(
+    RvsdgModule & module,
+    StatisticsCollector & statisticsCollector,
+    PassManager & passManager);
+
+	/**
+	* \brief Analyses that remain valid if the optimization changes the module
+	*
+	* The default implementation preserves no analyses.
+	*/
+	virtual HashSet<AnalysisId>
+	PreservedAnalyses() const;
+};
+
+/**
+* \brief Interface for region-local optimization passes
+*
+* A region-local optimization only modifies the nodes within the subregion
+* of a lambda node, i.e., it neither modifies the lambda node itself nor any
+* node outside of it. This permits the optimization of different lambda
+* nodes in parallel.
+*/
+class RegionLocalOptimization : public optimization {
+public:
+	virtual
+	~RegionLocalOptimization();
+
+	/**
+	* \brief Perform optimization on a single lambda node
+	*
+	* The method might be invoked concurrently for different lambda nodes
+	* of the same RVSDG. An implementation is therefore not permitted to
+	* keep any state in the optimization object.
+	*
+	* \param lambdaNode Lambda node whose subregion is optimized.
+	* \param statisticsCollector Statistics collector for the statistics of
+	* this lambda node. It is not shared with other concurrent invocations.
+	*/
+	virtual void
+	RunOnLambda(
+    lambda::node & lambdaNode,
     StatisticsCollector & statisticsCollector) = 0;
 };
 
-/*
-	FIXME: This function should be removed.
+/**
+* \brief Perform optimizations sequentially
+*
+* @see PassManager
 */
 void
 optimize(RvsdgModule & rm,
          StatisticsCollector & statisticsCollector,
          const std::vector<optimization*> & opts);
 
+/**
+* \brief Perform optimizations with \p numThreads threads
+*
+* The optimizations are performed by a PassManager, which caches analyses
+* across the optimizations.
+*
+* \param numThreads Number of threads. A value smaller than two performs
+* all optimizations sequentially.
+*
+* @see PassManager
+*/
+void
+optimize(RvsdgModule & rm,
+         StatisticsCollector & statisticsCollector,
+         const std::vector<optimization*> & opts,
+         size_t numThreads);
+
 }
 
 #endif
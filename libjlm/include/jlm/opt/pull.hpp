@@ -22,7 +22,7 @@ class RvsdgModule;
 /**
 * \brief Node Pull-In Optimization
 */
-class pullin final : public optimization {
+class pullin final : public RegionLocalOptimization {
 public:
 	virtual
 	~pullin();
@@ -30,6 +30,11 @@ public:
 	virtual void
 	run(
     RvsdgModule & module,
+    StatisticsCollector & statisticsCollector) override;
+
+	virtual void
+	RunOnLambda(
+    lambda::node & lambdaNode,
     StatisticsCollector & statisticsCollector) override;
 };
 
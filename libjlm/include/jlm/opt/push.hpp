@@ -22,7 +22,7 @@ class RvsdgModule;
 /**
 * \brief Node Push-Out Optimization
 */
-class pushout final : public optimization {
+class pushout final : public RegionLocalOptimization {
 public:
 	virtual
 	~pushout();
@@ -30,6 +30,11 @@ public:
 	virtual void
 	run(
     RvsdgModule & module,
+    StatisticsCollector & statisticsCollector) override;
+
+	virtual void
+	RunOnLambda(
+    lambda::node & lambdaNode,
     StatisticsCollector & statisticsCollector) override;
 };
 
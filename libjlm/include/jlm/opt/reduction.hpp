@@ -7,6 +7,14 @@
 #define JLM_OPT_REDUCTION_HPP
 
 #include <jlm/opt/optimization.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+#include <array>
+
+namespace jive {
+class graph;
+}
 
 namespace jlm {
 
@@ -14,9 +22,30 @@ class rvsdg;
 
 /**
 * \brief Node Reduction Optimization
+*
+* The reductions are applied by a worklist driver. Every node of the graph is normalized once, and only the nodes
+* whose operands changed due to a reduction, as well as the nodes created by a reduction, are normalized again. The
+* driver terminates once the worklist is empty.
 */
 class nodereduction final : public optimization {
 public:
+  class Statistics;
+
+  /**
+   * The reductions that are counted by the Statistics. Each reduction comprises all the normalizations of the
+   * respective operation class.
+   */
+  enum class Reduction {
+    Mux,
+    Store,
+    Load,
+    Gamma,
+    Unary,
+    Binary,
+    CommonNodeElimination,
+    LastEnumValue /* Must always be the last enum value, used for iteration */
+  };
+
 	virtual
 	~nodereduction();
 
@@ -26,6 +55,77 @@ public:
     StatisticsCollector & statisticsCollector) override;
 };
 
+/** \brief Node reduction statistics
+ *
+ * The statistics collected when running the node reduction, including the number of times every reduction fired.
+ *
+ * @see nodereduction
+ */
+class nodereduction::Statistics final : public jlm::Statistics {
+public:
+  ~Statistics() override = default;
+
+  Statistics()
+    : jlm::Statistics(Statistics::Id::ReduceNodes)
+    , NumNodesBefore_(0), NumNodesAfter_(0)
+    , NumInputsBefore_(0), NumInputsAfter_(0)
+    , NumVisitedNodes_(0)
+    , NumReductions_({})
+  {}
+
+  void
+  Start(const jive::graph & graph) noexcept;
+
+  void
+  End(const jive::graph & graph) noexcept;
+
+  void
+  AddVisitedNode() noexcept
+  {
+    NumVisitedNodes_++;
+  }
+
+  void
+  AddReduction(Reduction reduction) noexcept
+  {
+    NumReductions_[static_cast<size_t>(reduction)]++;
+  }
+
+  /**
+   * @return The number of nodes that were normalized. A node is counted every time it is taken from the worklist.
+   */
+  [[nodiscard]] size_t
+  NumVisitedNodes() const noexcept
+  {
+    return NumVisitedNodes_;
+  }
+
+  /**
+   * @return The number of times \p reduction changed the graph.
+   */
+  [[nodiscard]] size_t
+  NumReductions(Reduction reduction) const noexcept
+  {
+    return NumReductions_[static_cast<size_t>(reduction)];
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override;
+
+  static std::unique_ptr<Statistics>
+  Create()
+  {
+    return std::make_unique<Statistics>();
+  }
+
+private:
+  size_t NumNodesBefore_, NumNodesAfter_;
+  size_t NumInputsBefore_, NumInputsAfter_;
+  size_t NumVisitedNodes_;
+  std::array<size_t, static_cast<size_t>(Reduction::LastEnumValue)> NumReductions_;
+  jlm::timer Timer_;
+};
+
 }
 
 #endif
@@ -20,6 +20,38 @@ namespace jlm {
 
 class RvsdgModule;
 
+/**
+* \brief Parameters for the selection of unroll factors.
+*
+* A loop with a known trip count of at most FullUnrollTripCount is unrolled completely if its body
+* multiplied by the trip count does not exceed FullUnrollBudget nodes. All other loops are unrolled
+* by the largest factor up to MaxFactor for which the unrolled body does not exceed BodyBudget nodes,
+* preferring factors that divide a known trip count. Loops for which no factor of at least two fits
+* into the budget are not unrolled.
+*/
+class UnrollHeuristic final {
+public:
+	/**
+	* The maximal known trip count of a loop that is unrolled completely.
+	*/
+	size_t FullUnrollTripCount = 8;
+
+	/**
+	* The maximal number of nodes that a completely unrolled loop may produce.
+	*/
+	size_t FullUnrollBudget = 256;
+
+	/**
+	* The maximal unroll factor.
+	*/
+	size_t MaxFactor = 8;
+
+	/**
+	* The maximal number of nodes of an unrolled loop body.
+	*/
+	size_t BodyBudget = 128;
+};
+
 /**
 * \brief Optimization that attempts to unroll loops (thetas).
 */
@@ -28,9 +60,24 @@ public:
 	virtual
 	~loopunroll();
 
+	/**
+	* Unrolls all inner most loops by \p factor.
+	*/
 	constexpr
 	loopunroll(size_t factor)
 	: factor_(factor)
+	, auto_(false)
+	{}
+
+	/**
+	* Unrolls every inner most loop by a factor that is selected with \p heuristic from the loop's
+	* trip count and body size.
+	*/
+	constexpr
+	loopunroll(const UnrollHeuristic & heuristic)
+	: factor_(0)
+	, auto_(true)
+	, heuristic_(heuristic)
 	{}
 
 	/**
@@ -48,6 +95,8 @@ public:
 
 private:
 	size_t factor_;
+	bool auto_;
+	UnrollHeuristic heuristic_;
 };
 
 
@@ -251,6 +300,18 @@ private:
 void
 unroll(jive::theta_node * node, size_t factor);
 
+/**
+* Selects the unroll factor of a loop with \p heuristic.
+*
+* \param ui The unroll information of the loop.
+* \param heuristic The parameters for the selection.
+*
+* \return The selected unroll factor, or zero if the loop should not be unrolled. A factor that
+* is larger than or equal to the known trip count of the loop unrolls it completely.
+*/
+size_t
+select_unroll_factor(const unrollinfo & ui, const UnrollHeuristic & heuristic);
+
 }
 
 #endif
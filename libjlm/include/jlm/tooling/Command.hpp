@@ -338,13 +338,16 @@ private:
 class JlmOptCommand final : public Command {
 public:
   enum class Optimization {
+    AAAndersenRegionAware,
     AASteensgaardAgnostic,
+    AASteensgaardFieldSensitiveRegionAware,
     AASteensgaardRegionAware,
     CommonNodeElimination,
     DeadNodeElimination,
     FunctionInlining,
     InvariantValueRedirection,
     LoopUnrolling,
+    LoopUnrollingAuto,
     NodePullIn,
     NodePushOut,
     NodeReduction,
@@ -9,6 +9,7 @@
 #include <jlm/util/file.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace jlm
@@ -188,6 +189,7 @@ private:
   const std::string Mt_;
 };
 
+class FixpointGroup;
 class optimization;
 
 /**
@@ -195,15 +197,24 @@ class optimization;
  */
 class JlmOptCommandLineOptions final : public CommandLineOptions {
 public:
+  enum class InputFormat {
+    Llvm,
+    Rvsdg
+  };
+
   enum class OutputFormat {
     Llvm,
-    Xml
+    Rvsdg,
+    Xml,
+    XmlGzip
   };
 
   JlmOptCommandLineOptions()
     : InputFile_("")
     , OutputFile_("")
+    , InputFormat_(InputFormat::Llvm)
     , OutputFormat_(OutputFormat::Llvm)
+    , NumThreads_(1)
   {}
 
   void
@@ -211,9 +222,11 @@ public:
 
   filepath InputFile_;
   filepath OutputFile_;
+  InputFormat InputFormat_;
   OutputFormat OutputFormat_;
   StatisticsCollectorSettings StatisticsCollectorSettings_;
   std::vector<optimization*> Optimizations_;
+  size_t NumThreads_;
 };
 
 /**
@@ -457,7 +470,9 @@ private:
 class JlmOptCommandLineParser final : public CommandLineParser {
 public:
   enum class OptimizationId {
+    AAAndersenRegionAware,
     AASteensgaardAgnostic,
+    AASteensgaardFieldSensitiveRegionAware,
     AASteensgaardRegionAware,
     cne,
     dne,
@@ -467,6 +482,7 @@ public:
     red,
     ivt,
     url,
+    urlAuto,
     pll,
   };
 
@@ -478,11 +494,36 @@ public:
   static const JlmOptCommandLineOptions &
   Parse(int argc, char ** argv);
 
+  /**
+   * Parses a pipeline description of the form
+   *
+   *   pipeline := element (',' element)*
+   *   element  := name | '(' pipeline ')' '*'
+   *
+   * where name is the command line name of an optimization, e.g., cne, and a parenthesized pipeline followed by a
+   * star is a FixpointGroup. The fixpoint groups are owned by the parser.
+   *
+   * @param pipeline The pipeline description, e.g., "iln,(red,cne,dne)*".
+   *
+   * @return The optimizations of the pipeline in order.
+   *
+   * @throws jlm::error if \p pipeline is malformed or contains an unknown optimization.
+   */
+  std::vector<optimization*>
+  ParsePipeline(const std::string & pipeline);
+
 private:
+  std::vector<optimization*>
+  ParsePipeline(const std::string & pipeline, size_t & position);
+
   static optimization *
   GetOptimization(enum OptimizationId optimizationId);
 
+  static OptimizationId
+  GetOptimizationId(const std::string & name);
+
   JlmOptCommandLineOptions CommandLineOptions_;
+  std::vector<std::unique_ptr<FixpointGroup>> FixpointGroups_;
 };
 
 /**
@@ -0,0 +1,369 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SPARSEBITVECTOR_HPP
+#define JLM_UTIL_SPARSEBITVECTOR_HPP
+
+#include <jlm/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace jlm
+{
+
+/**
+ * Represents a set of unsigned integers as a sparse bit vector. The set is stored as a sorted sequence of 64-bit
+ * words, and words without set bits are omitted. Set operations process a complete word at a time, which makes them
+ * fast for dense clusters of indices, while the memory consumption of sparse sets stays small.
+ */
+class SparseBitVector final
+{
+  struct Word
+  {
+    size_t Index;
+    uint64_t Bits;
+
+    bool
+    operator==(const Word & other) const noexcept
+    {
+      return Index == other.Index && Bits == other.Bits;
+    }
+  };
+
+  static constexpr size_t NumWordBits = 64;
+
+public:
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = size_t*;
+    using reference = size_t&;
+
+  private:
+    friend SparseBitVector;
+
+    ItemConstIterator(const std::vector<Word> & words, size_t wordIndex)
+      : Words_(&words)
+      , WordIndex_(wordIndex)
+      , Bits_(wordIndex < words.size() ? words[wordIndex].Bits : 0)
+    {}
+
+  public:
+    size_t
+    operator*() const noexcept
+    {
+      return (*Words_)[WordIndex_].Index * NumWordBits + __builtin_ctzll(Bits_);
+    }
+
+    ItemConstIterator &
+    operator++() noexcept
+    {
+      Bits_ &= Bits_ - 1;
+      if (Bits_ == 0)
+      {
+        WordIndex_++;
+        Bits_ = WordIndex_ < Words_->size() ? (*Words_)[WordIndex_].Bits : 0;
+      }
+
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int) noexcept
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const noexcept
+    {
+      return WordIndex_ == other.WordIndex_ && Bits_ == other.Bits_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    const std::vector<Word> * Words_;
+    size_t WordIndex_;
+    uint64_t Bits_;
+  };
+
+  SparseBitVector() = default;
+
+  SparseBitVector(std::initializer_list<size_t> items)
+  {
+    for (auto & item : items)
+      Insert(item);
+  }
+
+  [[nodiscard]] iterator_range<ItemConstIterator>
+  Items() const noexcept
+  {
+    return {ItemConstIterator(Words_, 0), ItemConstIterator(Words_, Words_.size())};
+  }
+
+  /**
+   * Inserts \p item into the set.
+   *
+   * @return True if \p item was not already part of the set, otherwise false.
+   */
+  bool
+  Insert(size_t item)
+  {
+    auto it = LowerBound(item / NumWordBits);
+    auto mask = uint64_t(1) << (item % NumWordBits);
+
+    if (it == Words_.end() || it->Index != item / NumWordBits)
+    {
+      Words_.insert(it, {item / NumWordBits, mask});
+      return true;
+    }
+
+    if (it->Bits & mask)
+      return false;
+
+    it->Bits |= mask;
+    return true;
+  }
+
+  /**
+   * Removes \p item from the set.
+   *
+   * @return True if \p item was part of the set, otherwise false.
+   */
+  bool
+  Remove(size_t item)
+  {
+    auto it = LowerBound(item / NumWordBits);
+    auto mask = uint64_t(1) << (item % NumWordBits);
+
+    if (it == Words_.end() || it->Index != item / NumWordBits || !(it->Bits & mask))
+      return false;
+
+    it->Bits &= ~mask;
+    if (it->Bits == 0)
+      Words_.erase(it);
+
+    return true;
+  }
+
+  [[nodiscard]] bool
+  Contains(size_t item) const noexcept
+  {
+    auto it = LowerBound(item / NumWordBits);
+    return it != Words_.end()
+        && it->Index == item / NumWordBits
+        && (it->Bits & (uint64_t(1) << (item % NumWordBits)));
+  }
+
+  /**
+   * @return The number of items in the set.
+   */
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    size_t size = 0;
+    for (auto & word : Words_)
+      size += __builtin_popcountll(word.Bits);
+
+    return size;
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Words_.empty();
+  }
+
+  /**
+   * @return The number of bytes the set occupies on the heap.
+   */
+  [[nodiscard]] size_t
+  NumBytes() const noexcept
+  {
+    return Words_.capacity() * sizeof(Word);
+  }
+
+  /**
+   * Adds all items of \p other to the set.
+   *
+   * @return True if the set changed, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other)
+  {
+    if (other.IsEmpty())
+      return false;
+
+    if (IsEmpty())
+    {
+      Words_ = other.Words_;
+      return true;
+    }
+
+    std::vector<Word> words;
+    words.reserve(Words_.size() + other.Words_.size());
+
+    bool changed = false;
+    auto it = Words_.begin();
+    auto otherIt = other.Words_.begin();
+    while (it != Words_.end() || otherIt != other.Words_.end())
+    {
+      if (otherIt == other.Words_.end() || (it != Words_.end() && it->Index < otherIt->Index))
+      {
+        words.push_back(*it++);
+      }
+      else if (it == Words_.end() || otherIt->Index < it->Index)
+      {
+        words.push_back(*otherIt++);
+        changed = true;
+      }
+      else
+      {
+        auto bits = it->Bits | otherIt->Bits;
+        changed |= bits != it->Bits;
+        words.push_back({it->Index, bits});
+        it++;
+        otherIt++;
+      }
+    }
+
+    if (changed)
+      Words_ = std::move(words);
+
+    return changed;
+  }
+
+  /**
+   * Removes all items from the set that are not part of \p other.
+   *
+   * @return True if the set changed, otherwise false.
+   */
+  bool
+  IntersectWith(const SparseBitVector & other)
+  {
+    bool changed = false;
+    size_t size = 0;
+    auto otherIt = other.Words_.begin();
+    for (auto & word : Words_)
+    {
+      while (otherIt != other.Words_.end() && otherIt->Index < word.Index)
+        otherIt++;
+
+      uint64_t bits = 0;
+      if (otherIt != other.Words_.end() && otherIt->Index == word.Index)
+        bits = word.Bits & otherIt->Bits;
+
+      changed |= bits != word.Bits;
+      if (bits)
+        Words_[size++] = {word.Index, bits};
+    }
+
+    Words_.resize(size);
+    return changed;
+  }
+
+  /**
+   * @return True if all items of the set are also part of \p other, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const SparseBitVector & other) const noexcept
+  {
+    auto otherIt = other.Words_.begin();
+    for (auto & word : Words_)
+    {
+      while (otherIt != other.Words_.end() && otherIt->Index < word.Index)
+        otherIt++;
+
+      if (otherIt == other.Words_.end() || otherIt->Index != word.Index || (word.Bits & ~otherIt->Bits))
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @return The items of \p lhs that are not part of \p rhs.
+   */
+  [[nodiscard]] static SparseBitVector
+  Difference(const SparseBitVector & lhs, const SparseBitVector & rhs)
+  {
+    SparseBitVector difference;
+
+    auto rhsIt = rhs.Words_.begin();
+    for (auto & word : lhs.Words_)
+    {
+      while (rhsIt != rhs.Words_.end() && rhsIt->Index < word.Index)
+        rhsIt++;
+
+      auto bits = word.Bits;
+      if (rhsIt != rhs.Words_.end() && rhsIt->Index == word.Index)
+        bits &= ~rhsIt->Bits;
+
+      if (bits)
+        difference.Words_.push_back({word.Index, bits});
+    }
+
+    return difference;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Words_.clear();
+  }
+
+  bool
+  operator==(const SparseBitVector & other) const noexcept
+  {
+    return Words_ == other.Words_;
+  }
+
+  bool
+  operator!=(const SparseBitVector & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  [[nodiscard]] std::vector<Word>::iterator
+  LowerBound(size_t wordIndex)
+  {
+    return std::lower_bound(
+      Words_.begin(),
+      Words_.end(),
+      wordIndex,
+      [](const Word & word, size_t index) { return word.Index < index; });
+  }
+
+  [[nodiscard]] std::vector<Word>::const_iterator
+  LowerBound(size_t wordIndex) const
+  {
+    return std::lower_bound(
+      Words_.begin(),
+      Words_.end(),
+      wordIndex,
+      [](const Word & word, size_t index) { return word.Index < index; });
+  }
+
+  std::vector<Word> Words_;
+};
+
+}
+
+#endif
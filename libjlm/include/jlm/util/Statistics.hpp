@@ -20,12 +20,14 @@ class Statistics {
 public:
   enum class Id {
     Aggregation,
+    AndersenAnalysis,
     Annotation,
     BasicEncoderEncoding,
     CommonNodeElimination,
     ControlFlowRecovery,
     DataNodeToDelta,
     DeadNodeElimination,
+    FixpointGroup,
     FunctionInlining,
     InvariantValueRedirection,
     JlmToRvsdgConversion,
@@ -241,6 +243,19 @@ public:
       CollectedStatistics_.emplace_back(std::move(statistics));
   }
 
+  /**
+   * Appends the statistics collected by \p other to the collected statistics, and clears \p other.
+   *
+   * @param other The collector whose statistics are moved.
+   */
+  void
+  Merge(StatisticsCollector && other)
+  {
+    for (auto & statistics : other.CollectedStatistics_)
+      CollectedStatistics_.emplace_back(std::move(statistics));
+    other.CollectedStatistics_.clear();
+  }
+
   /** \brief Print collected statistics to file.
    *
    * @see StatisticsCollectorSettings::GetFilePath()
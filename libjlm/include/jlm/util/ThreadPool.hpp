@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_THREADPOOL_HPP
+#define JLM_UTIL_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jlm
+{
+
+/**
+ * A fixed-size pool of worker threads that executes submitted tasks with work stealing. Every worker owns a task
+ * queue. Submitted tasks are distributed round-robin over the queues. A worker executes the tasks of its own queue
+ * in last-in first-out order, and steals tasks in first-in first-out order from the queues of other workers once its
+ * own queue is empty.
+ *
+ * Tasks must not throw exceptions. The destructor blocks until all submitted tasks have been executed.
+ */
+class ThreadPool final
+{
+  class Worker;
+
+public:
+  ~ThreadPool() noexcept;
+
+  /**
+   * Creates a thread pool with \p numThreads worker threads.
+   */
+  explicit
+  ThreadPool(size_t numThreads);
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  ThreadPool(ThreadPool &&) = delete;
+
+  ThreadPool &
+  operator=(const ThreadPool &) = delete;
+
+  ThreadPool &
+  operator=(ThreadPool &&) = delete;
+
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return Workers_.size();
+  }
+
+  /**
+   * @return The index of the calling worker thread in the range [0, NumThreads()) of its pool, or SIZE_MAX if the
+   * calling thread is not a worker thread.
+   */
+  [[nodiscard]] static size_t
+  CurrentWorkerIndex() noexcept;
+
+  /**
+   * Submits \p task for execution by one of the worker threads.
+   */
+  void
+  Submit(std::function<void()> task);
+
+  /**
+   * Blocks until all submitted tasks have been executed.
+   */
+  void
+  Wait();
+
+private:
+  bool
+  TryPop(size_t workerIndex, std::function<void()> & task);
+
+  void
+  Run(size_t workerIndex);
+
+  bool Done_;
+  size_t NumPending_;
+  size_t NumQueued_;
+  size_t NextWorker_;
+
+  std::mutex Mutex_;
+  std::condition_variable TaskAvailable_;
+  std::condition_variable AllTasksDone_;
+
+  std::vector<std::unique_ptr<Worker>> Workers_;
+  std::vector<std::thread> Threads_;
+};
+
+}
+
+#endif
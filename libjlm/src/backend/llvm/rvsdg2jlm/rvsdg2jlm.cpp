@@ -103,7 +103,7 @@ create_initialization(const delta::node * delta, context & ctx)
 
 
 	tacsvector_t tacs;
-	for (const auto & node : jive::topdown_traverser(delta->subregion())) {
+	for (const auto & node : jive::topdown_const_traverser(delta->subregion())) {
 		JLM_ASSERT(node->noutputs() == 1);
 		auto output = node->output(0);
 
@@ -131,7 +131,7 @@ convert_region(jive::region & region, context & ctx)
 	ctx.lpbb()->add_outedge(entry);
 	ctx.set_lpbb(entry);
 
-	for (const auto & node : jive::topdown_traverser(&region))
+	for (const auto & node : jive::topdown_const_traverser(&region))
 		convert_node(*node, ctx);
 
 	auto exit = basic_block::create(*ctx.cfg());
@@ -532,7 +532,7 @@ convert_node(const jive::node & node, context & ctx)
 static void
 convert_nodes(const jive::graph & graph, context & ctx)
 {
-	for (const auto & node : jive::topdown_traverser(graph.root()))
+	for (const auto & node : jive::topdown_const_traverser(graph.root()))
 		convert_node(*node, ctx);
 }
 
@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/common.hpp>
+#include <jlm/ir/DataLayout.hpp>
+#include <jlm/ir/types.hpp>
+
+#include <jive/types/bitstring/type.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace jlm {
+
+static size_t
+RoundUpToMultiple(size_t value, size_t multiple)
+{
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+static size_t
+RoundUpToPowerOfTwo(size_t value)
+{
+  size_t powerOfTwo = 1;
+  while (powerOfTwo < value)
+    powerOfTwo *= 2;
+
+  return powerOfTwo;
+}
+
+static std::vector<std::string>
+Split(const std::string & string, char delimiter)
+{
+  std::vector<std::string> tokens;
+
+  size_t start = 0;
+  while (true) {
+    auto end = string.find(delimiter, start);
+    tokens.push_back(string.substr(start, end - start));
+    if (end == std::string::npos)
+      break;
+
+    start = end + 1;
+  }
+
+  return tokens;
+}
+
+static size_t
+ParseNumber(const std::string & number, const std::string & specification)
+{
+  if (number.empty() || !std::all_of(number.begin(), number.end(), [](char c){ return c >= '0' && c <= '9'; }))
+    throw error("Malformed data layout specification: " + specification);
+
+  return std::stoul(number);
+}
+
+/**
+ * Converts the alignment \p numBits of a specification into bytes.
+ */
+static size_t
+ParseAlignment(const std::string & numBits, const std::string & specification)
+{
+  auto alignment = ParseNumber(numBits, specification);
+  if (alignment % 8 != 0 || RoundUpToPowerOfTwo(alignment) != alignment)
+    throw error("Invalid alignment in data layout specification: " + specification);
+
+  return std::max(alignment / 8, size_t(1));
+}
+
+DataLayout::DataLayout(const std::string & specification)
+: IntegerAlignments_({{1, 1}, {8, 1}, {16, 2}, {32, 4}, {64, 4}})
+, FloatingPointAlignments_({{16, 2}, {32, 4}, {64, 8}, {128, 16}})
+, VectorAlignments_({{64, 8}, {128, 16}})
+, AggregateAlignment_(1)
+, PointerSize_(8)
+, PointerAlignment_(8)
+{
+  ParseSpecification(specification);
+}
+
+void
+DataLayout::ParseSpecification(const std::string & specification)
+{
+  if (specification.empty())
+    return;
+
+  for (auto & item : Split(specification, '-')) {
+    auto fields = Split(item, ':');
+    auto & kind = fields[0];
+    if (kind.empty())
+      throw error("Malformed data layout specification: " + item);
+
+    switch (kind[0]) {
+      case 'i':
+      case 'f':
+      case 'v':
+      {
+        if (fields.size() < 2)
+          throw error("Malformed data layout specification: " + item);
+
+        auto numBits = ParseNumber(kind.substr(1), item);
+        auto alignment = ParseAlignment(fields[1], item);
+        auto & alignments = kind[0] == 'i'
+                            ? IntegerAlignments_
+                            : (kind[0] == 'f' ? FloatingPointAlignments_ : VectorAlignments_);
+        alignments[numBits] = alignment;
+        break;
+      }
+      case 'a':
+      {
+        if (fields.size() < 2)
+          throw error("Malformed data layout specification: " + item);
+
+        AggregateAlignment_ = fields[1] == "0" ? 1 : ParseAlignment(fields[1], item);
+        break;
+      }
+      case 'p':
+      {
+        if (fields.size() < 3)
+          throw error("Malformed data layout specification: " + item);
+
+        /*
+         * Only the default address space is of interest.
+         */
+        auto addressSpace = kind.size() == 1 ? 0 : ParseNumber(kind.substr(1), item);
+        if (addressSpace != 0)
+          break;
+
+        auto numBits = ParseNumber(fields[1], item);
+        if (numBits == 0 || numBits % 8 != 0)
+          throw error("Invalid pointer size in data layout specification: " + item);
+
+        PointerSize_ = numBits / 8;
+        PointerAlignment_ = ParseAlignment(fields[2], item);
+        break;
+      }
+      default:
+        /*
+         * Endianness, mangling, native integer widths, stack, program, alloca, and global address spaces, function
+         * pointer alignment, and non-integral pointers do not affect the layout of types.
+         */
+        break;
+    }
+  }
+}
+
+size_t
+DataLayout::GetIntegerAlignment(size_t numBits) const
+{
+  auto it = IntegerAlignments_.lower_bound(numBits);
+  if (it != IntegerAlignments_.end())
+    return it->second;
+
+  return IntegerAlignments_.rbegin()->second;
+}
+
+size_t
+DataLayout::GetTypeSizeInBits(const jive::valuetype & type) const
+{
+  if (auto bitType = dynamic_cast<const jive::bittype*>(&type))
+    return bitType->nbits();
+
+  if (jive::is<PointerType>(type))
+    return PointerSize_ * 8;
+
+  if (auto floatingPointType = dynamic_cast<const fptype*>(&type)) {
+    switch (floatingPointType->size()) {
+      case fpsize::half:
+        return 16;
+      case fpsize::flt:
+        return 32;
+      case fpsize::dbl:
+        return 64;
+      case fpsize::x86fp80:
+        return 80;
+    }
+
+    JLM_UNREACHABLE("Unhandled floating point size.");
+  }
+
+  if (auto vectorType = dynamic_cast<const fixedvectortype*>(&type))
+    return vectorType->size() * GetTypeSizeInBits(vectorType->type());
+
+  if (jive::is<arraytype>(type) || jive::is<StructType>(type))
+    return GetTypeAllocSize(type) * 8;
+
+  throw error("Cannot determine size of type " + type.debug_string() + ".");
+}
+
+size_t
+DataLayout::GetTypeStoreSize(const jive::valuetype & type) const
+{
+  if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    return arrayType->nelements() * GetTypeAllocSize(arrayType->element_type());
+
+  if (auto structType = dynamic_cast<const StructType*>(&type)) {
+    auto & declaration = structType->GetDeclaration();
+    if (declaration.nelements() == 0)
+      return 0;
+
+    auto lastElement = declaration.nelements() - 1;
+    auto size = GetElementOffset(*structType, lastElement) + GetTypeAllocSize(declaration.element(lastElement));
+
+    /*
+     * The tail padding of a struct only depends on the alignment of its elements.
+     */
+    if (structType->IsPacked())
+      return size;
+
+    size_t alignment = 1;
+    for (size_t n = 0; n < declaration.nelements(); n++)
+      alignment = std::max(alignment, GetTypeAlignment(declaration.element(n)));
+
+    return RoundUpToMultiple(size, alignment);
+  }
+
+  return (GetTypeSizeInBits(type) + 7) / 8;
+}
+
+size_t
+DataLayout::GetTypeAllocSize(const jive::valuetype & type) const
+{
+  return RoundUpToMultiple(GetTypeStoreSize(type), GetTypeAlignment(type));
+}
+
+size_t
+DataLayout::GetTypeAlignment(const jive::valuetype & type) const
+{
+  if (auto bitType = dynamic_cast<const jive::bittype*>(&type))
+    return GetIntegerAlignment(bitType->nbits());
+
+  if (jive::is<PointerType>(type))
+    return PointerAlignment_;
+
+  if (jive::is<fptype>(type)) {
+    auto numBits = GetTypeSizeInBits(type);
+    if (auto it = FloatingPointAlignments_.find(numBits); it != FloatingPointAlignments_.end())
+      return it->second;
+
+    return RoundUpToPowerOfTwo(GetTypeStoreSize(type));
+  }
+
+  if (auto vectorType = dynamic_cast<const fixedvectortype*>(&type)) {
+    auto numBits = GetTypeSizeInBits(type);
+    if (auto it = VectorAlignments_.find(numBits); it != VectorAlignments_.end())
+      return it->second;
+
+    /*
+     * Vectors without a specification are naturally aligned.
+     */
+    return RoundUpToPowerOfTwo(vectorType->size() * GetTypeAllocSize(vectorType->type()));
+  }
+
+  if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    return GetTypeAlignment(arrayType->element_type());
+
+  if (auto structType = dynamic_cast<const StructType*>(&type)) {
+    if (structType->IsPacked())
+      return 1;
+
+    auto alignment = AggregateAlignment_;
+    auto & declaration = structType->GetDeclaration();
+    for (size_t n = 0; n < declaration.nelements(); n++)
+      alignment = std::max(alignment, GetTypeAlignment(declaration.element(n)));
+
+    return alignment;
+  }
+
+  throw error("Cannot determine alignment of type " + type.debug_string() + ".");
+}
+
+size_t
+DataLayout::GetElementOffset(const StructType & structType, size_t index) const
+{
+  auto & declaration = structType.GetDeclaration();
+  JLM_ASSERT(index < declaration.nelements());
+
+  size_t offset = 0;
+  for (size_t n = 0; n <= index; n++) {
+    auto & elementType = declaration.element(n);
+    if (!structType.IsPacked())
+      offset = RoundUpToMultiple(offset, GetTypeAlignment(elementType));
+
+    if (n != index)
+      offset += GetTypeAllocSize(elementType);
+  }
+
+  return offset;
+}
+
+}
@@ -0,0 +1,1882 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/RvsdgSerialization.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <jive/common.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/id-map.hpp>
+#include <jive/rvsdg/statemux.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/rvsdg/traverser.hpp>
+#include <jive/types/bitstring.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <typeindex>
+#include <unordered_map>
+
+namespace jlm {
+
+static const char RvsdgFormatMagic[] = {'J', 'L', 'M', 'R', 'V', 'S', 'D', 'G'};
+
+enum class RvsdgTypeTag : uint64_t {
+  Bit,
+  Control,
+  Function,
+  Pointer,
+  Array,
+  FloatingPoint,
+  Vararg,
+  Struct,
+  FixedVector,
+  ScalableVector,
+  LoopState,
+  IoState,
+  MemoryState,
+  Record
+};
+
+enum class RvsdgNodeTag : uint64_t {
+  Simple,
+  Gamma,
+  Theta,
+  Lambda,
+  Delta,
+  Phi
+};
+
+enum class RvsdgPhiArgumentTag : uint64_t {
+  ContextVariable,
+  RecursionVariable
+};
+
+enum class RvsdgAttributeTag : uint64_t {
+  String,
+  Enum,
+  Int,
+  Type
+};
+
+#define JLM_RVSDG_BITUNARY_OPERATIONS(X) \
+  X(BitNeg, jive::bitneg_op) \
+  X(BitNot, jive::bitnot_op)
+
+#define JLM_RVSDG_BITBINARY_OPERATIONS(X) \
+  X(BitAdd, jive::bitadd_op) \
+  X(BitAnd, jive::bitand_op) \
+  X(BitAshr, jive::bitashr_op) \
+  X(BitMul, jive::bitmul_op) \
+  X(BitOr, jive::bitor_op) \
+  X(BitSdiv, jive::bitsdiv_op) \
+  X(BitShl, jive::bitshl_op) \
+  X(BitShr, jive::bitshr_op) \
+  X(BitSmod, jive::bitsmod_op) \
+  X(BitSmulh, jive::bitsmulh_op) \
+  X(BitSub, jive::bitsub_op) \
+  X(BitUdiv, jive::bitudiv_op) \
+  X(BitUmod, jive::bitumod_op) \
+  X(BitUmulh, jive::bitumulh_op) \
+  X(BitXor, jive::bitxor_op) \
+  X(BitEq, jive::biteq_op) \
+  X(BitNe, jive::bitne_op) \
+  X(BitSge, jive::bitsge_op) \
+  X(BitSgt, jive::bitsgt_op) \
+  X(BitSle, jive::bitsle_op) \
+  X(BitSlt, jive::bitslt_op) \
+  X(BitUge, jive::bituge_op) \
+  X(BitUgt, jive::bitugt_op) \
+  X(BitUle, jive::bitule_op) \
+  X(BitUlt, jive::bitult_op)
+
+#define JLM_RVSDG_CONVERSION_OPERATIONS(X) \
+  X(Bits2Ptr, bits2ptr_op) \
+  X(Ptr2Bits, ptr2bits_op) \
+  X(Zext, zext_op) \
+  X(Sext, sext_op) \
+  X(Trunc, trunc_op) \
+  X(FpExt, fpext_op) \
+  X(FpTrunc, fptrunc_op) \
+  X(UiToFp, uitofp_op) \
+  X(SiToFp, sitofp_op) \
+  X(FpToUi, fp2ui_op) \
+  X(FpToSi, fp2si_op) \
+  X(Bitcast, bitcast_op)
+
+#define JLM_RVSDG_TAG(NAME, OPERATION) NAME,
+
+/**
+ * Tags that identify the operations of simple nodes in the binary RVSDG format. New tags must only be appended, as
+ * the numbering is part of the format.
+ */
+enum class RvsdgOperationTag : uint64_t {
+  JLM_RVSDG_BITUNARY_OPERATIONS(JLM_RVSDG_TAG)
+  JLM_RVSDG_BITBINARY_OPERATIONS(JLM_RVSDG_TAG)
+  JLM_RVSDG_CONVERSION_OPERATIONS(JLM_RVSDG_TAG)
+  BitConstant,
+  BitSlice,
+  BitConcat,
+  Match,
+  ControlConstant,
+  Mux,
+  FlattenedBinary,
+  Select,
+  Ctl2Bits,
+  ConstantPointerNull,
+  ConstantDataArray,
+  ConstantArray,
+  PtrCmp,
+  ConstantFP,
+  FpCmp,
+  FpBin,
+  FpNeg,
+  Undef,
+  Poison,
+  Valist,
+  ConstantStruct,
+  ConstantAggregateZero,
+  ExtractElement,
+  ShuffleVector,
+  ConstantVector,
+  InsertElement,
+  VectorUnary,
+  VectorBinary,
+  ExtractValue,
+  LoopStateMux,
+  MemStateMerge,
+  MemStateSplit,
+  Malloc,
+  Free,
+  Memcpy,
+  Alloca,
+  GetElementPtr,
+  Load,
+  Store,
+  Call
+};
+
+#undef JLM_RVSDG_TAG
+
+static const llvm::fltSemantics &
+GetFltSemantics(const fpsize & size)
+{
+  switch (size)
+  {
+    case fpsize::half:
+      return llvm::APFloat::IEEEhalf();
+    case fpsize::flt:
+      return llvm::APFloat::IEEEsingle();
+    case fpsize::dbl:
+      return llvm::APFloat::IEEEdouble();
+    case fpsize::x86fp80:
+      return llvm::APFloat::x87DoubleExtended();
+  }
+
+  throw error("Unknown floating point size in RVSDG file.");
+}
+
+/** \brief Encoder of the primitive values of the binary RVSDG format
+ */
+class RvsdgEncoder final {
+public:
+  void
+  WriteUInt(uint64_t value)
+  {
+    do
+    {
+      uint8_t byte = value & 0x7f;
+      value >>= 7;
+      if (value != 0)
+        byte |= 0x80;
+      Bytes_.push_back(byte);
+    } while (value != 0);
+  }
+
+  void
+  WriteInt(int64_t value)
+  {
+    WriteUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+
+  void
+  WriteBool(bool value)
+  {
+    WriteUInt(value ? 1 : 0);
+  }
+
+  template<typename T> void
+  WriteEnum(T value)
+  {
+    WriteUInt(static_cast<uint64_t>(value));
+  }
+
+  void
+  WriteString(const std::string & value)
+  {
+    WriteUInt(value.size());
+    Bytes_.insert(Bytes_.end(), value.begin(), value.end());
+  }
+
+  void
+  WriteBytes(const void * data, size_t size)
+  {
+    auto bytes = static_cast<const uint8_t*>(data);
+    Bytes_.insert(Bytes_.end(), bytes, bytes + size);
+  }
+
+  std::vector<uint8_t> &
+  Bytes() noexcept
+  {
+    return Bytes_;
+  }
+
+private:
+  std::vector<uint8_t> Bytes_;
+};
+
+/** \brief Decoder of the primitive values of the binary RVSDG format
+ */
+class RvsdgDecoder final {
+public:
+  RvsdgDecoder(const uint8_t * data, size_t size)
+    : Current_(data)
+    , End_(data + size)
+  {}
+
+  uint64_t
+  ReadUInt()
+  {
+    uint64_t value = 0;
+    for (size_t shift = 0; shift < 64; shift += 7)
+    {
+      CheckAvailable(1);
+      auto byte = *Current_++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return value;
+    }
+
+    throw error("Malformed integer in RVSDG file.");
+  }
+
+  int64_t
+  ReadInt()
+  {
+    auto value = ReadUInt();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  bool
+  ReadBool()
+  {
+    return ReadUInt() != 0;
+  }
+
+  template<typename T> T
+  ReadEnum(T last)
+  {
+    auto value = ReadUInt();
+    if (value > static_cast<uint64_t>(last))
+      throw error("Invalid enumerator in RVSDG file.");
+
+    return static_cast<T>(value);
+  }
+
+  std::string
+  ReadString()
+  {
+    auto size = ReadUInt();
+    CheckAvailable(size);
+
+    std::string value(reinterpret_cast<const char*>(Current_), size);
+    Current_ += size;
+    return value;
+  }
+
+  const uint8_t *
+  ReadBytes(size_t size)
+  {
+    CheckAvailable(size);
+
+    auto bytes = Current_;
+    Current_ += size;
+    return bytes;
+  }
+
+  [[nodiscard]] bool
+  AtEnd() const noexcept
+  {
+    return Current_ == End_;
+  }
+
+private:
+  void
+  CheckAvailable(size_t size) const
+  {
+    if (static_cast<size_t>(End_ - Current_) < size)
+      throw error("Unexpected end of RVSDG file.");
+  }
+
+  const uint8_t * Current_;
+  const uint8_t * End_;
+};
+
+/** \brief Serializer of RVSDG modules
+ *
+ * The serializer writes the regions of a module into a separate body encoder while it registers all encountered
+ * types in the type table. The type table is only complete once all regions are written, and is therefore prepended
+ * to the body at the very end.
+ */
+class RvsdgSerializer final {
+public:
+  std::vector<uint8_t>
+  Serialize(const RvsdgModule & rvsdgModule)
+  {
+    auto & root = *rvsdgModule.Rvsdg().root();
+
+    Body_.WriteUInt(root.narguments());
+    for (size_t n = 0; n < root.narguments(); n++)
+    {
+      auto & port = root.argument(n)->port();
+      auto import = dynamic_cast<const jive::impport*>(&port);
+      if (!import)
+        throw error("Expected import port.");
+
+      auto jlmImport = dynamic_cast<const jlm::impport*>(import);
+      WriteType(import->type(), Body_);
+      Body_.WriteString(import->name());
+      Body_.WriteEnum(jlmImport ? jlmImport->linkage() : linkage::external_linkage);
+    }
+
+    WriteRegion(root);
+
+    Body_.WriteUInt(root.nresults());
+    for (size_t n = 0; n < root.nresults(); n++)
+    {
+      auto result = root.result(n);
+      auto export_ = dynamic_cast<const jive::expport*>(&result->port());
+      if (!export_)
+        throw error("Expected export port.");
+
+      WriteOrigin(*result);
+      Body_.WriteString(export_->name());
+    }
+
+    /*
+     * The element types of a declaration can introduce new declarations, which is why the number of declarations
+     * can grow while the elements are registered.
+     */
+    std::vector<std::vector<size_t>> declarationElements;
+    for (size_t n = 0; n < Declarations_.size(); n++)
+    {
+      std::vector<size_t> elements;
+      for (size_t i = 0; i < Declarations_[n]->nelements(); i++)
+        elements.push_back(GetTypeIndex(Declarations_[n]->element(i)));
+      declarationElements.push_back(std::move(elements));
+    }
+
+    RvsdgEncoder module;
+    module.WriteBytes(RvsdgFormatMagic, sizeof(RvsdgFormatMagic));
+    module.WriteUInt(RvsdgFormatVersion);
+    module.WriteString(rvsdgModule.SourceFileName().to_str());
+    module.WriteString(rvsdgModule.TargetTriple());
+    module.WriteString(rvsdgModule.DataLayout());
+
+    module.WriteUInt(Declarations_.size());
+    module.WriteUInt(TypeTable_.size());
+    module.WriteBytes(Types_.Bytes().data(), Types_.Bytes().size());
+    for (auto & elements : declarationElements)
+    {
+      module.WriteUInt(elements.size());
+      for (auto & element : elements)
+        module.WriteUInt(element);
+    }
+
+    module.WriteBytes(Body_.Bytes().data(), Body_.Bytes().size());
+    return std::move(module.Bytes());
+  }
+
+private:
+  size_t
+  GetDeclarationIndex(const jive::rcddeclaration & declaration)
+  {
+    auto it = DeclarationIndices_.find(&declaration);
+    if (it != DeclarationIndices_.end())
+      return it->second;
+
+    auto index = Declarations_.size();
+    Declarations_.push_back(&declaration);
+    DeclarationIndices_[&declaration] = index;
+    return index;
+  }
+
+  size_t
+  GetTypeIndex(const jive::type & type)
+  {
+    auto & bucket = TypeBuckets_[type.debug_string()];
+    for (auto & index : bucket)
+    {
+      if (*TypeTable_[index] == type)
+        return index;
+    }
+
+    /*
+     * The types a type is composed of are registered first, such that they precede it in the type table.
+     */
+    RvsdgEncoder entry;
+    if (auto bitType = dynamic_cast<const jive::bittype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Bit);
+      entry.WriteUInt(bitType->nbits());
+    }
+    else if (auto controlType = dynamic_cast<const jive::ctltype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Control);
+      entry.WriteUInt(controlType->nalternatives());
+    }
+    else if (auto functionType = dynamic_cast<const FunctionType*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Function);
+      entry.WriteUInt(functionType->NumArguments());
+      for (size_t n = 0; n < functionType->NumArguments(); n++)
+        WriteType(functionType->ArgumentType(n), entry);
+      entry.WriteUInt(functionType->NumResults());
+      for (size_t n = 0; n < functionType->NumResults(); n++)
+        WriteType(functionType->ResultType(n), entry);
+    }
+    else if (auto pointerType = dynamic_cast<const PointerType*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Pointer);
+      WriteType(pointerType->GetElementType(), entry);
+    }
+    else if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Array);
+      WriteType(arrayType->element_type(), entry);
+      entry.WriteUInt(arrayType->nelements());
+    }
+    else if (auto floatingPointType = dynamic_cast<const fptype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::FloatingPoint);
+      entry.WriteEnum(floatingPointType->size());
+    }
+    else if (dynamic_cast<const varargtype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Vararg);
+    }
+    else if (auto structType = dynamic_cast<const StructType*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Struct);
+      entry.WriteString(structType->GetName());
+      entry.WriteBool(structType->IsPacked());
+      entry.WriteUInt(GetDeclarationIndex(structType->GetDeclaration()));
+    }
+    else if (auto vectorType = dynamic_cast<const vectortype*>(&type))
+    {
+      entry.WriteEnum(dynamic_cast<const fixedvectortype*>(&type)
+                      ? RvsdgTypeTag::FixedVector
+                      : RvsdgTypeTag::ScalableVector);
+      WriteType(vectorType->type(), entry);
+      entry.WriteUInt(vectorType->size());
+    }
+    else if (dynamic_cast<const loopstatetype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::LoopState);
+    }
+    else if (dynamic_cast<const iostatetype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::IoState);
+    }
+    else if (dynamic_cast<const MemoryStateType*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::MemoryState);
+    }
+    else if (auto recordType = dynamic_cast<const jive::rcdtype*>(&type))
+    {
+      entry.WriteEnum(RvsdgTypeTag::Record);
+      entry.WriteUInt(GetDeclarationIndex(*recordType->declaration()));
+    }
+    else
+    {
+      throw error(strfmt("Type ", type.debug_string(), " is not supported by the RVSDG format."));
+    }
+
+    auto index = TypeTable_.size();
+    Types_.WriteBytes(entry.Bytes().data(), entry.Bytes().size());
+    TypeTable_.push_back(type.copy());
+    /*
+     * The bucket reference might have been invalidated by the registration of the nested types.
+     */
+    TypeBuckets_[type.debug_string()].push_back(index);
+    return index;
+  }
+
+  void
+  WriteType(const jive::type & type, RvsdgEncoder & encoder)
+  {
+    encoder.WriteUInt(GetTypeIndex(type));
+  }
+
+  void
+  WriteOrigin(const jive::input & input)
+  {
+    auto index = OutputIndices_.lookup(*input.origin());
+    JLM_ASSERT(index != nullptr);
+    Body_.WriteUInt(*index);
+  }
+
+  void
+  WriteRegion(const jive::region & region)
+  {
+    Body_.WriteUInt(region.narguments());
+    for (size_t n = 0; n < region.narguments(); n++)
+      OutputIndices_.insert(*region.argument(n), n);
+
+    size_t index = region.narguments();
+    Body_.WriteUInt(region.nnodes());
+    for (auto & node : jive::topdown_const_traverser(&region))
+    {
+      WriteNode(*node);
+      for (size_t n = 0; n < node->noutputs(); n++)
+        OutputIndices_.insert(*node->output(n), index++);
+    }
+  }
+
+  void
+  WriteNode(const jive::node & node)
+  {
+    if (auto simpleNode = dynamic_cast<const jive::simple_node*>(&node))
+      WriteSimpleNode(*simpleNode);
+    else if (auto gammaNode = dynamic_cast<const jive::gamma_node*>(&node))
+      WriteGammaNode(*gammaNode);
+    else if (auto thetaNode = dynamic_cast<const jive::theta_node*>(&node))
+      WriteThetaNode(*thetaNode);
+    else if (auto lambdaNode = dynamic_cast<const lambda::node*>(&node))
+      WriteLambdaNode(*lambdaNode);
+    else if (auto deltaNode = dynamic_cast<const delta::node*>(&node))
+      WriteDeltaNode(*deltaNode);
+    else if (auto phiNode = dynamic_cast<const phi::node*>(&node))
+      WritePhiNode(*phiNode);
+    else
+      throw error(strfmt("Node ", node.operation().debug_string(), " is not supported by the RVSDG format."));
+  }
+
+  void
+  WriteSimpleNode(const jive::simple_node & node)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Simple);
+    WriteOperation(*static_cast<const jive::simple_op*>(&node.operation()));
+
+    Body_.WriteUInt(node.ninputs());
+    for (size_t n = 0; n < node.ninputs(); n++)
+      WriteOrigin(*node.input(n));
+  }
+
+  void
+  WriteGammaNode(const jive::gamma_node & gammaNode)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Gamma);
+    WriteOrigin(*gammaNode.predicate());
+    Body_.WriteUInt(gammaNode.nsubregions());
+
+    Body_.WriteUInt(gammaNode.nentryvars());
+    for (size_t n = 0; n < gammaNode.nentryvars(); n++)
+      WriteOrigin(*gammaNode.entryvar(n));
+
+    for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+      WriteRegion(*gammaNode.subregion(r));
+
+    Body_.WriteUInt(gammaNode.nexitvars());
+    for (size_t n = 0; n < gammaNode.nexitvars(); n++)
+    {
+      for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+        WriteOrigin(*gammaNode.subregion(r)->result(n));
+    }
+  }
+
+  void
+  WriteThetaNode(const jive::theta_node & thetaNode)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Theta);
+
+    Body_.WriteUInt(thetaNode.nloopvars());
+    for (size_t n = 0; n < thetaNode.nloopvars(); n++)
+      WriteOrigin(*thetaNode.input(n));
+
+    WriteRegion(*thetaNode.subregion());
+
+    WriteOrigin(*thetaNode.predicate());
+    for (size_t n = 0; n < thetaNode.nloopvars(); n++)
+      WriteOrigin(*thetaNode.output(n)->result());
+  }
+
+  void
+  WriteLambdaNode(const lambda::node & lambdaNode)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Lambda);
+    WriteType(lambdaNode.type(), Body_);
+    Body_.WriteString(lambdaNode.name());
+    Body_.WriteEnum(lambdaNode.linkage());
+    WriteAttributes(lambdaNode.attributes());
+    for (size_t n = 0; n < lambdaNode.nfctarguments(); n++)
+      WriteAttributes(lambdaNode.fctargument(n)->attributes());
+
+    Body_.WriteUInt(lambdaNode.ninputs());
+    for (size_t n = 0; n < lambdaNode.ninputs(); n++)
+      WriteOrigin(*lambdaNode.input(n));
+
+    auto & subregion = *lambdaNode.subregion();
+    WriteRegion(subregion);
+
+    Body_.WriteUInt(subregion.nresults());
+    for (size_t n = 0; n < subregion.nresults(); n++)
+      WriteOrigin(*subregion.result(n));
+  }
+
+  void
+  WriteDeltaNode(const delta::node & deltaNode)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Delta);
+    WriteType(deltaNode.type(), Body_);
+    Body_.WriteString(deltaNode.name());
+    Body_.WriteEnum(deltaNode.linkage());
+    Body_.WriteString(deltaNode.Section());
+    Body_.WriteBool(deltaNode.constant());
+
+    Body_.WriteUInt(deltaNode.ninputs());
+    for (size_t n = 0; n < deltaNode.ninputs(); n++)
+      WriteOrigin(*deltaNode.input(n));
+
+    WriteRegion(*deltaNode.subregion());
+    WriteOrigin(*deltaNode.subregion()->result(0));
+  }
+
+  void
+  WritePhiNode(const phi::node & phiNode)
+  {
+    Body_.WriteEnum(RvsdgNodeTag::Phi);
+
+    auto & subregion = *phiNode.subregion();
+    Body_.WriteUInt(subregion.narguments());
+    for (size_t n = 0; n < subregion.narguments(); n++)
+    {
+      auto argument = subregion.argument(n);
+      if (auto contextVariable = dynamic_cast<const phi::cvargument*>(argument))
+      {
+        Body_.WriteEnum(RvsdgPhiArgumentTag::ContextVariable);
+        WriteOrigin(*contextVariable->input());
+      }
+      else
+      {
+        Body_.WriteEnum(RvsdgPhiArgumentTag::RecursionVariable);
+        WriteType(argument->type(), Body_);
+      }
+    }
+
+    WriteRegion(subregion);
+
+    Body_.WriteUInt(subregion.nresults());
+    for (size_t n = 0; n < subregion.nresults(); n++)
+      WriteOrigin(*subregion.result(n));
+  }
+
+  void
+  WriteAttributes(const attributeset & attributes)
+  {
+    size_t numAttributes = 0;
+    for (auto it = attributes.begin(); it != attributes.end(); it++)
+      numAttributes++;
+
+    Body_.WriteUInt(numAttributes);
+    for (auto & attribute : attributes)
+    {
+      if (auto typeAttribute = dynamic_cast<const type_attribute*>(&attribute))
+      {
+        Body_.WriteEnum(RvsdgAttributeTag::Type);
+        Body_.WriteEnum(typeAttribute->kind());
+        WriteType(typeAttribute->type(), Body_);
+      }
+      else if (auto intAttribute = dynamic_cast<const int_attribute*>(&attribute))
+      {
+        Body_.WriteEnum(RvsdgAttributeTag::Int);
+        Body_.WriteEnum(intAttribute->kind());
+        Body_.WriteUInt(intAttribute->value());
+      }
+      else if (auto enumAttribute = dynamic_cast<const enum_attribute*>(&attribute))
+      {
+        Body_.WriteEnum(RvsdgAttributeTag::Enum);
+        Body_.WriteEnum(enumAttribute->kind());
+      }
+      else
+      {
+        auto & stringAttribute = *AssertedCast<const string_attribute>(&attribute);
+        Body_.WriteEnum(RvsdgAttributeTag::String);
+        Body_.WriteString(stringAttribute.kind());
+        Body_.WriteString(stringAttribute.value());
+      }
+    }
+  }
+
+  static const std::unordered_map<std::type_index, RvsdgOperationTag> &
+  GetOperationTags()
+  {
+#define JLM_RVSDG_TAG(NAME, OPERATION) {typeid(OPERATION), RvsdgOperationTag::NAME},
+    static const std::unordered_map<std::type_index, RvsdgOperationTag> tags({
+      JLM_RVSDG_BITUNARY_OPERATIONS(JLM_RVSDG_TAG)
+      JLM_RVSDG_BITBINARY_OPERATIONS(JLM_RVSDG_TAG)
+      JLM_RVSDG_CONVERSION_OPERATIONS(JLM_RVSDG_TAG)
+      {typeid(jive::bitconstant_op), RvsdgOperationTag::BitConstant},
+      {typeid(jive::bitslice_op), RvsdgOperationTag::BitSlice},
+      {typeid(jive::bitconcat_op), RvsdgOperationTag::BitConcat},
+      {typeid(jive::match_op), RvsdgOperationTag::Match},
+      {typeid(jive::ctlconstant_op), RvsdgOperationTag::ControlConstant},
+      {typeid(jive::mux_op), RvsdgOperationTag::Mux},
+      {typeid(jive::flattened_binary_op), RvsdgOperationTag::FlattenedBinary},
+      {typeid(select_op), RvsdgOperationTag::Select},
+      {typeid(ctl2bits_op), RvsdgOperationTag::Ctl2Bits},
+      {typeid(ConstantPointerNullOperation), RvsdgOperationTag::ConstantPointerNull},
+      {typeid(ConstantDataArray), RvsdgOperationTag::ConstantDataArray},
+      {typeid(ConstantArray), RvsdgOperationTag::ConstantArray},
+      {typeid(ptrcmp_op), RvsdgOperationTag::PtrCmp},
+      {typeid(ConstantFP), RvsdgOperationTag::ConstantFP},
+      {typeid(fpcmp_op), RvsdgOperationTag::FpCmp},
+      {typeid(fpbin_op), RvsdgOperationTag::FpBin},
+      {typeid(fpneg_op), RvsdgOperationTag::FpNeg},
+      {typeid(UndefValueOperation), RvsdgOperationTag::Undef},
+      {typeid(PoisonValueOperation), RvsdgOperationTag::Poison},
+      {typeid(valist_op), RvsdgOperationTag::Valist},
+      {typeid(ConstantStruct), RvsdgOperationTag::ConstantStruct},
+      {typeid(ConstantAggregateZero), RvsdgOperationTag::ConstantAggregateZero},
+      {typeid(extractelement_op), RvsdgOperationTag::ExtractElement},
+      {typeid(shufflevector_op), RvsdgOperationTag::ShuffleVector},
+      {typeid(constantvector_op), RvsdgOperationTag::ConstantVector},
+      {typeid(insertelement_op), RvsdgOperationTag::InsertElement},
+      {typeid(vectorunary_op), RvsdgOperationTag::VectorUnary},
+      {typeid(vectorbinary_op), RvsdgOperationTag::VectorBinary},
+      {typeid(ExtractValue), RvsdgOperationTag::ExtractValue},
+      {typeid(loopstatemux_op), RvsdgOperationTag::LoopStateMux},
+      {typeid(MemStateMergeOperator), RvsdgOperationTag::MemStateMerge},
+      {typeid(MemStateSplitOperator), RvsdgOperationTag::MemStateSplit},
+      {typeid(malloc_op), RvsdgOperationTag::Malloc},
+      {typeid(free_op), RvsdgOperationTag::Free},
+      {typeid(Memcpy), RvsdgOperationTag::Memcpy},
+      {typeid(alloca_op), RvsdgOperationTag::Alloca},
+      {typeid(getelementptr_op), RvsdgOperationTag::GetElementPtr},
+      {typeid(LoadOperation), RvsdgOperationTag::Load},
+      {typeid(StoreOperation), RvsdgOperationTag::Store},
+      {typeid(CallOperation), RvsdgOperationTag::Call}
+    });
+#undef JLM_RVSDG_TAG
+
+    return tags;
+  }
+
+  void
+  WriteOperation(const jive::simple_op & operation)
+  {
+    auto & tags = GetOperationTags();
+    auto it = tags.find(typeid(operation));
+    if (it == tags.end())
+      throw error(strfmt("Operation ", operation.debug_string(), " is not supported by the RVSDG format."));
+
+    auto tag = it->second;
+    Body_.WriteEnum(tag);
+    switch (tag)
+    {
+#define JLM_RVSDG_BIT_CASE(NAME, OPERATION) case RvsdgOperationTag::NAME:
+      JLM_RVSDG_BITUNARY_OPERATIONS(JLM_RVSDG_BIT_CASE)
+      JLM_RVSDG_BITBINARY_OPERATIONS(JLM_RVSDG_BIT_CASE)
+#undef JLM_RVSDG_BIT_CASE
+        Body_.WriteUInt(static_cast<const jive::bittype*>(&operation.argument(0).type())->nbits());
+        break;
+
+#define JLM_RVSDG_CONVERSION_CASE(NAME, OPERATION) case RvsdgOperationTag::NAME:
+      JLM_RVSDG_CONVERSION_OPERATIONS(JLM_RVSDG_CONVERSION_CASE)
+#undef JLM_RVSDG_CONVERSION_CASE
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::BitConstant:
+        Body_.WriteString(static_cast<const jive::bitconstant_op*>(&operation)->value().str());
+        break;
+
+      case RvsdgOperationTag::BitSlice:
+      {
+        auto & slice = *static_cast<const jive::bitslice_op*>(&operation);
+        Body_.WriteUInt(static_cast<const jive::bittype*>(&slice.argument(0).type())->nbits());
+        Body_.WriteUInt(slice.low());
+        Body_.WriteUInt(slice.high());
+        break;
+      }
+
+      case RvsdgOperationTag::BitConcat:
+        Body_.WriteUInt(operation.narguments());
+        for (size_t n = 0; n < operation.narguments(); n++)
+          Body_.WriteUInt(static_cast<const jive::bittype*>(&operation.argument(n).type())->nbits());
+        break;
+
+      case RvsdgOperationTag::Match:
+      {
+        auto & match = *static_cast<const jive::match_op*>(&operation);
+        std::vector<std::pair<uint64_t, uint64_t>> mapping(match.begin(), match.end());
+        std::sort(mapping.begin(), mapping.end());
+
+        Body_.WriteUInt(match.nbits());
+        Body_.WriteUInt(match.default_alternative());
+        Body_.WriteUInt(match.nalternatives());
+        Body_.WriteUInt(mapping.size());
+        for (auto & [value, alternative] : mapping)
+        {
+          Body_.WriteUInt(value);
+          Body_.WriteUInt(alternative);
+        }
+        break;
+      }
+
+      case RvsdgOperationTag::ControlConstant:
+      {
+        auto & value = static_cast<const jive::ctlconstant_op*>(&operation)->value();
+        Body_.WriteUInt(value.alternative());
+        Body_.WriteUInt(value.nalternatives());
+        break;
+      }
+
+      case RvsdgOperationTag::Mux:
+        WriteType(operation.argument(0).type(), Body_);
+        Body_.WriteUInt(operation.narguments());
+        Body_.WriteUInt(operation.nresults());
+        break;
+
+      case RvsdgOperationTag::FlattenedBinary:
+        WriteOperation(static_cast<const jive::flattened_binary_op*>(&operation)->bin_operation());
+        Body_.WriteUInt(operation.narguments());
+        break;
+
+      case RvsdgOperationTag::Select:
+      case RvsdgOperationTag::ConstantPointerNull:
+      case RvsdgOperationTag::FpNeg:
+      case RvsdgOperationTag::Undef:
+      case RvsdgOperationTag::Poison:
+      case RvsdgOperationTag::ConstantStruct:
+      case RvsdgOperationTag::ConstantAggregateZero:
+      case RvsdgOperationTag::ConstantVector:
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::Ctl2Bits:
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::ExtractElement:
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.argument(1).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::ConstantDataArray:
+      case RvsdgOperationTag::ConstantArray:
+      {
+        auto & arrayType = *static_cast<const arraytype*>(&operation.result(0).type());
+        WriteType(arrayType.element_type(), Body_);
+        Body_.WriteUInt(arrayType.nelements());
+        break;
+      }
+
+      case RvsdgOperationTag::PtrCmp:
+        WriteType(operation.argument(0).type(), Body_);
+        Body_.WriteEnum(static_cast<const ptrcmp_op*>(&operation)->cmp());
+        break;
+
+      case RvsdgOperationTag::ConstantFP:
+      {
+        auto & constant = *static_cast<const ConstantFP*>(&operation);
+        auto bits = constant.constant().bitcastToAPInt();
+        Body_.WriteEnum(constant.size());
+        Body_.WriteUInt(bits.getBitWidth());
+        Body_.WriteUInt(bits.getNumWords());
+        for (size_t n = 0; n < bits.getNumWords(); n++)
+          Body_.WriteUInt(bits.getRawData()[n]);
+        break;
+      }
+
+      case RvsdgOperationTag::FpCmp:
+      {
+        auto & compare = *static_cast<const fpcmp_op*>(&operation);
+        Body_.WriteEnum(compare.cmp());
+        Body_.WriteEnum(compare.size());
+        break;
+      }
+
+      case RvsdgOperationTag::FpBin:
+      {
+        auto & binary = *static_cast<const fpbin_op*>(&operation);
+        Body_.WriteEnum(binary.fpop());
+        Body_.WriteEnum(binary.size());
+        break;
+      }
+
+      case RvsdgOperationTag::Valist:
+        Body_.WriteUInt(operation.narguments());
+        for (size_t n = 0; n < operation.narguments(); n++)
+          WriteType(operation.argument(n).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::ShuffleVector:
+      {
+        auto mask = static_cast<const shufflevector_op*>(&operation)->Mask();
+        WriteType(operation.argument(0).type(), Body_);
+        Body_.WriteUInt(mask.size());
+        for (auto & element : mask)
+          Body_.WriteInt(element);
+        break;
+      }
+
+      case RvsdgOperationTag::InsertElement:
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.argument(1).type(), Body_);
+        WriteType(operation.argument(2).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::VectorUnary:
+        WriteOperation(static_cast<const vectorunary_op*>(&operation)->operation());
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::VectorBinary:
+        WriteOperation(static_cast<const vectorbinary_op*>(&operation)->operation());
+        WriteType(operation.argument(0).type(), Body_);
+        WriteType(operation.argument(1).type(), Body_);
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::ExtractValue:
+      {
+        auto & extractValue = *static_cast<const ExtractValue*>(&operation);
+        WriteType(operation.argument(0).type(), Body_);
+        Body_.WriteUInt(std::distance(extractValue.begin(), extractValue.end()));
+        for (auto it = extractValue.begin(); it != extractValue.end(); it++)
+          Body_.WriteUInt(*it);
+        break;
+      }
+
+      case RvsdgOperationTag::LoopStateMux:
+        Body_.WriteUInt(operation.narguments());
+        Body_.WriteUInt(operation.nresults());
+        break;
+
+      case RvsdgOperationTag::MemStateMerge:
+        Body_.WriteUInt(operation.narguments());
+        break;
+
+      case RvsdgOperationTag::MemStateSplit:
+        Body_.WriteUInt(operation.nresults());
+        break;
+
+      case RvsdgOperationTag::Malloc:
+        WriteType(operation.argument(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::Free:
+        Body_.WriteUInt(operation.nresults() - 1);
+        break;
+
+      case RvsdgOperationTag::Memcpy:
+        Body_.WriteUInt(operation.narguments());
+        for (size_t n = 0; n < operation.narguments(); n++)
+          WriteType(operation.argument(n).type(), Body_);
+        Body_.WriteUInt(operation.nresults());
+        for (size_t n = 0; n < operation.nresults(); n++)
+          WriteType(operation.result(n).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::Alloca:
+      {
+        auto & alloca = *static_cast<const alloca_op*>(&operation);
+        WriteType(alloca.value_type(), Body_);
+        WriteType(alloca.size_type(), Body_);
+        Body_.WriteUInt(alloca.alignment());
+        break;
+      }
+
+      case RvsdgOperationTag::GetElementPtr:
+        WriteType(operation.argument(0).type(), Body_);
+        Body_.WriteUInt(operation.narguments() - 1);
+        for (size_t n = 1; n < operation.narguments(); n++)
+          WriteType(operation.argument(n).type(), Body_);
+        WriteType(operation.result(0).type(), Body_);
+        break;
+
+      case RvsdgOperationTag::Load:
+      {
+        auto & load = *static_cast<const LoadOperation*>(&operation);
+        WriteType(load.GetLoadedType(), Body_);
+        Body_.WriteUInt(load.NumStates());
+        Body_.WriteUInt(load.GetAlignment());
+        break;
+      }
+
+      case RvsdgOperationTag::Store:
+      {
+        auto & store = *static_cast<const StoreOperation*>(&operation);
+        WriteType(store.GetStoredType(), Body_);
+        Body_.WriteUInt(store.NumStates());
+        Body_.WriteUInt(store.GetAlignment());
+        break;
+      }
+
+      case RvsdgOperationTag::Call:
+        WriteType(static_cast<const CallOperation*>(&operation)->GetFunctionType(), Body_);
+        break;
+    }
+  }
+
+  RvsdgEncoder Types_;
+  RvsdgEncoder Body_;
+
+  std::vector<std::unique_ptr<jive::type>> TypeTable_;
+  std::unordered_map<std::string, std::vector<size_t>> TypeBuckets_;
+
+  std::vector<const jive::rcddeclaration*> Declarations_;
+  std::unordered_map<const jive::rcddeclaration*, size_t> DeclarationIndices_;
+
+  jive::output_map<size_t> OutputIndices_;
+};
+
+/** \brief Deserializer of RVSDG modules
+ */
+class RvsdgDeserializer final {
+public:
+  RvsdgDeserializer(const uint8_t * data, size_t size)
+    : Decoder_(data, size)
+  {}
+
+  std::unique_ptr<RvsdgModule>
+  Deserialize()
+  {
+    auto magic = Decoder_.ReadBytes(sizeof(RvsdgFormatMagic));
+    if (memcmp(magic, RvsdgFormatMagic, sizeof(RvsdgFormatMagic)) != 0)
+      throw error("Not an RVSDG file.");
+
+    auto version = Decoder_.ReadUInt();
+    if (version != RvsdgFormatVersion)
+      throw error(strfmt("Unsupported RVSDG format version ", version, "."));
+
+    auto sourceFileName = Decoder_.ReadString();
+    auto targetTriple = Decoder_.ReadString();
+    auto dataLayout = Decoder_.ReadString();
+    auto rvsdgModule = RvsdgModule::Create(filepath(sourceFileName), targetTriple, dataLayout);
+
+    auto numDeclarations = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numDeclarations; n++)
+    {
+      auto declaration = jive::rcddeclaration::create();
+      Declarations_.push_back(declaration.get());
+      rvsdgModule->AddStructTypeDeclaration(std::move(declaration));
+    }
+
+    auto numTypes = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numTypes; n++)
+      TypeTable_.push_back(ReadTypeEntry());
+
+    for (auto & declaration : Declarations_)
+    {
+      auto numElements = Decoder_.ReadUInt();
+      for (size_t n = 0; n < numElements; n++)
+        declaration->append(ReadTypeAs<jive::valuetype>());
+    }
+
+    auto & graph = rvsdgModule->Rvsdg();
+    auto numImports = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numImports; n++)
+    {
+      auto & type = ReadType();
+      auto name = Decoder_.ReadString();
+      auto importLinkage = Decoder_.ReadEnum(linkage::common_linkage);
+      graph.add_import(impport(type, name, importLinkage));
+    }
+
+    auto outputs = ReadRegion(*graph.root());
+
+    auto numExports = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numExports; n++)
+    {
+      auto origin = ReadOrigin(outputs);
+      auto name = Decoder_.ReadString();
+      graph.add_export(origin, {origin->type(), name});
+    }
+
+    if (!Decoder_.AtEnd())
+      throw error("Trailing data in RVSDG file.");
+
+    return rvsdgModule;
+  }
+
+private:
+  const jive::type &
+  ReadType()
+  {
+    auto index = Decoder_.ReadUInt();
+    if (index >= TypeTable_.size())
+      throw error("Invalid type index in RVSDG file.");
+
+    return *TypeTable_[index];
+  }
+
+  template<class T> const T &
+  ReadTypeAs()
+  {
+    auto type = dynamic_cast<const T*>(&ReadType());
+    if (!type)
+      throw error("Unexpected type in RVSDG file.");
+
+    return *type;
+  }
+
+  const jive::rcddeclaration &
+  ReadDeclaration()
+  {
+    auto index = Decoder_.ReadUInt();
+    if (index >= Declarations_.size())
+      throw error("Invalid declaration index in RVSDG file.");
+
+    return *Declarations_[index];
+  }
+
+  std::unique_ptr<jive::type>
+  ReadTypeEntry()
+  {
+    auto tag = Decoder_.ReadEnum(RvsdgTypeTag::Record);
+    switch (tag)
+    {
+      case RvsdgTypeTag::Bit:
+        return std::make_unique<jive::bittype>(Decoder_.ReadUInt());
+
+      case RvsdgTypeTag::Control:
+        return std::make_unique<jive::ctltype>(Decoder_.ReadUInt());
+
+      case RvsdgTypeTag::Function:
+      {
+        std::vector<const jive::type*> argumentTypes, resultTypes;
+        auto numArguments = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numArguments; n++)
+          argumentTypes.push_back(&ReadType());
+        auto numResults = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numResults; n++)
+          resultTypes.push_back(&ReadType());
+
+        return std::make_unique<FunctionType>(argumentTypes, resultTypes);
+      }
+
+      case RvsdgTypeTag::Pointer:
+        return std::make_unique<PointerType>(ReadTypeAs<jive::valuetype>());
+
+      case RvsdgTypeTag::Array:
+      {
+        auto & elementType = ReadTypeAs<jive::valuetype>();
+        return std::make_unique<arraytype>(elementType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgTypeTag::FloatingPoint:
+        return std::make_unique<fptype>(Decoder_.ReadEnum(fpsize::x86fp80));
+
+      case RvsdgTypeTag::Vararg:
+        return std::make_unique<varargtype>();
+
+      case RvsdgTypeTag::Struct:
+      {
+        auto name = Decoder_.ReadString();
+        auto isPacked = Decoder_.ReadBool();
+        return StructType::Create(name, isPacked, ReadDeclaration());
+      }
+
+      case RvsdgTypeTag::FixedVector:
+      {
+        auto & elementType = ReadTypeAs<jive::valuetype>();
+        return std::make_unique<fixedvectortype>(elementType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgTypeTag::ScalableVector:
+      {
+        auto & elementType = ReadTypeAs<jive::valuetype>();
+        return std::make_unique<scalablevectortype>(elementType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgTypeTag::LoopState:
+        return std::make_unique<loopstatetype>();
+
+      case RvsdgTypeTag::IoState:
+        return std::make_unique<iostatetype>();
+
+      case RvsdgTypeTag::MemoryState:
+        return std::make_unique<MemoryStateType>();
+
+      case RvsdgTypeTag::Record:
+        return std::make_unique<jive::rcdtype>(&ReadDeclaration());
+    }
+
+    JLM_UNREACHABLE("Unhandled type tag.");
+  }
+
+  jive::output *
+  ReadOrigin(const std::vector<jive::output*> & outputs)
+  {
+    auto index = Decoder_.ReadUInt();
+    if (index >= outputs.size())
+      throw error("Invalid output index in RVSDG file.");
+
+    return outputs[index];
+  }
+
+  std::vector<jive::output*>
+  ReadOrigins(const std::vector<jive::output*> & outputs)
+  {
+    std::vector<jive::output*> origins;
+    auto numOrigins = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numOrigins; n++)
+      origins.push_back(ReadOrigin(outputs));
+
+    return origins;
+  }
+
+  /**
+   * Reads the nodes of \p region.
+   *
+   * @return The outputs of the region in the order they are referred to by the file, i.e., the region arguments
+   * followed by the outputs of the region's nodes.
+   */
+  std::vector<jive::output*>
+  ReadRegion(jive::region & region)
+  {
+    auto numArguments = Decoder_.ReadUInt();
+    if (numArguments != region.narguments())
+      throw error("Mismatching number of region arguments in RVSDG file.");
+
+    std::vector<jive::output*> outputs;
+    for (size_t n = 0; n < region.narguments(); n++)
+      outputs.push_back(region.argument(n));
+
+    auto numNodes = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numNodes; n++)
+    {
+      auto nodeOutputs = ReadNode(region, outputs);
+      outputs.insert(outputs.end(), nodeOutputs.begin(), nodeOutputs.end());
+    }
+
+    return outputs;
+  }
+
+  /**
+   * Reads a node and creates it in \p region. The operands of the node are looked up in \p outputs.
+   *
+   * @return The outputs of the created node.
+   */
+  std::vector<jive::output*>
+  ReadNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    auto tag = Decoder_.ReadEnum(RvsdgNodeTag::Phi);
+    switch (tag)
+    {
+      case RvsdgNodeTag::Simple:
+        return ReadSimpleNode(region, outputs);
+      case RvsdgNodeTag::Gamma:
+        return jive::outputs(ReadGammaNode(outputs));
+      case RvsdgNodeTag::Theta:
+        return jive::outputs(ReadThetaNode(region, outputs));
+      case RvsdgNodeTag::Lambda:
+        return jive::outputs(ReadLambdaNode(region, outputs));
+      case RvsdgNodeTag::Delta:
+        return jive::outputs(ReadDeltaNode(region, outputs));
+      case RvsdgNodeTag::Phi:
+        return jive::outputs(ReadPhiNode(region, outputs));
+    }
+
+    JLM_UNREACHABLE("Unhandled node tag.");
+  }
+
+  std::vector<jive::output*>
+  ReadSimpleNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    auto operation = ReadOperation();
+    auto operands = ReadOrigins(outputs);
+    if (operands.size() != operation->narguments())
+      throw error("Mismatching number of operands in RVSDG file.");
+
+    /*
+     * Load, store, and call operations are represented by dedicated node classes.
+     */
+    if (auto load = dynamic_cast<const LoadOperation*>(operation.get()))
+      return LoadNode::Create(region, *load, operands);
+
+    if (auto store = dynamic_cast<const StoreOperation*>(operation.get()))
+      return StoreNode::Create(region, *store, operands);
+
+    if (auto call = dynamic_cast<const CallOperation*>(operation.get()))
+      return CallNode::Create(region, *call, operands);
+
+    return jive::outputs(jive::simple_node::create(&region, *operation, operands));
+  }
+
+  jive::node *
+  ReadGammaNode(const std::vector<jive::output*> & outputs)
+  {
+    auto predicate = ReadOrigin(outputs);
+    auto numSubregions = Decoder_.ReadUInt();
+    auto gammaNode = jive::gamma_node::create(predicate, numSubregions);
+
+    for (auto & origin : ReadOrigins(outputs))
+      gammaNode->add_entryvar(origin);
+
+    std::vector<std::vector<jive::output*>> subregionOutputs;
+    for (size_t r = 0; r < gammaNode->nsubregions(); r++)
+      subregionOutputs.push_back(ReadRegion(*gammaNode->subregion(r)));
+
+    auto numExitVariables = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numExitVariables; n++)
+    {
+      std::vector<jive::output*> values;
+      for (size_t r = 0; r < gammaNode->nsubregions(); r++)
+        values.push_back(ReadOrigin(subregionOutputs[r]));
+      gammaNode->add_exitvar(values);
+    }
+
+    return gammaNode;
+  }
+
+  jive::node *
+  ReadThetaNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    auto thetaNode = jive::theta_node::create(&region);
+
+    std::vector<jive::theta_output*> loopVariables;
+    for (auto & origin : ReadOrigins(outputs))
+      loopVariables.push_back(thetaNode->add_loopvar(origin));
+
+    auto subregionOutputs = ReadRegion(*thetaNode->subregion());
+
+    thetaNode->set_predicate(ReadOrigin(subregionOutputs));
+    for (auto & loopVariable : loopVariables)
+      loopVariable->result()->divert_to(ReadOrigin(subregionOutputs));
+
+    return thetaNode;
+  }
+
+  jive::node *
+  ReadLambdaNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    auto & type = ReadTypeAs<FunctionType>();
+    auto name = Decoder_.ReadString();
+    auto lambdaLinkage = Decoder_.ReadEnum(linkage::common_linkage);
+    auto attributes = ReadAttributes();
+
+    auto lambdaNode = lambda::node::create(&region, type, name, lambdaLinkage, attributes);
+    for (size_t n = 0; n < lambdaNode->nfctarguments(); n++)
+      lambdaNode->fctargument(n)->set_attributes(ReadAttributes());
+
+    for (auto & origin : ReadOrigins(outputs))
+      lambdaNode->add_ctxvar(origin);
+
+    auto subregionOutputs = ReadRegion(*lambdaNode->subregion());
+    lambdaNode->finalize(ReadOrigins(subregionOutputs));
+
+    return lambdaNode;
+  }
+
+  jive::node *
+  ReadDeltaNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    auto & type = ReadTypeAs<PointerType>();
+    auto name = Decoder_.ReadString();
+    auto deltaLinkage = Decoder_.ReadEnum(linkage::common_linkage);
+    auto section = Decoder_.ReadString();
+    auto constant = Decoder_.ReadBool();
+
+    auto deltaNode = delta::node::Create(&region, type, name, deltaLinkage, std::move(section), constant);
+    for (auto & origin : ReadOrigins(outputs))
+      deltaNode->add_ctxvar(origin);
+
+    auto subregionOutputs = ReadRegion(*deltaNode->subregion());
+    deltaNode->finalize(ReadOrigin(subregionOutputs));
+
+    return deltaNode;
+  }
+
+  jive::node *
+  ReadPhiNode(jive::region & region, const std::vector<jive::output*> & outputs)
+  {
+    phi::builder phiBuilder;
+    phiBuilder.begin(&region);
+
+    std::vector<phi::rvoutput*> recursionVariables;
+    auto numArguments = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numArguments; n++)
+    {
+      auto tag = Decoder_.ReadEnum(RvsdgPhiArgumentTag::RecursionVariable);
+      if (tag == RvsdgPhiArgumentTag::ContextVariable)
+        phiBuilder.add_ctxvar(ReadOrigin(outputs));
+      else
+        recursionVariables.push_back(phiBuilder.add_recvar(ReadType()));
+    }
+
+    auto subregionOutputs = ReadRegion(*phiBuilder.subregion());
+
+    auto results = ReadOrigins(subregionOutputs);
+    if (results.size() != recursionVariables.size())
+      throw error("Mismatching number of recursion variables in RVSDG file.");
+
+    for (size_t n = 0; n < results.size(); n++)
+      recursionVariables[n]->set_rvorigin(results[n]);
+
+    return phiBuilder.end();
+  }
+
+  attributeset
+  ReadAttributes()
+  {
+    attributeset attributes;
+    auto numAttributes = Decoder_.ReadUInt();
+    for (size_t n = 0; n < numAttributes; n++)
+    {
+      auto tag = Decoder_.ReadEnum(RvsdgAttributeTag::Type);
+      switch (tag)
+      {
+        case RvsdgAttributeTag::String:
+        {
+          auto kind = Decoder_.ReadString();
+          auto value = Decoder_.ReadString();
+          attributes.insert(string_attribute::create(kind, value));
+          break;
+        }
+
+        case RvsdgAttributeTag::Enum:
+          attributes.insert(enum_attribute::create(Decoder_.ReadEnum(attribute::kind::EndAttrKinds)));
+          break;
+
+        case RvsdgAttributeTag::Int:
+        {
+          auto kind = Decoder_.ReadEnum(attribute::kind::EndAttrKinds);
+          attributes.insert(int_attribute::create(kind, Decoder_.ReadUInt()));
+          break;
+        }
+
+        case RvsdgAttributeTag::Type:
+        {
+          auto kind = Decoder_.ReadEnum(attribute::kind::EndAttrKinds);
+          auto type = std::unique_ptr<jive::valuetype>(
+            static_cast<jive::valuetype*>(ReadTypeAs<jive::valuetype>().copy().release()));
+
+          if (kind == attribute::kind::by_val)
+            attributes.insert(type_attribute::create_byval(std::move(type)));
+          else if (kind == attribute::kind::struct_ret)
+            attributes.insert(type_attribute::CreateStructRetAttribute(std::move(type)));
+          else
+            throw error("Unsupported type attribute in RVSDG file.");
+          break;
+        }
+      }
+    }
+
+    return attributes;
+  }
+
+  template<class T> std::unique_ptr<jive::simple_op>
+  ReadConversion()
+  {
+    auto operandType = ReadType().copy();
+    auto resultType = ReadType().copy();
+    return std::make_unique<T>(std::move(operandType), std::move(resultType));
+  }
+
+  std::unique_ptr<jive::simple_op>
+  ReadOperation()
+  {
+    auto tag = Decoder_.ReadEnum(RvsdgOperationTag::Call);
+    switch (tag)
+    {
+#define JLM_RVSDG_BIT_CASE(NAME, OPERATION) \
+      case RvsdgOperationTag::NAME: \
+        return std::make_unique<OPERATION>(jive::bittype(Decoder_.ReadUInt()));
+      JLM_RVSDG_BITUNARY_OPERATIONS(JLM_RVSDG_BIT_CASE)
+      JLM_RVSDG_BITBINARY_OPERATIONS(JLM_RVSDG_BIT_CASE)
+#undef JLM_RVSDG_BIT_CASE
+
+#define JLM_RVSDG_CONVERSION_CASE(NAME, OPERATION) \
+      case RvsdgOperationTag::NAME: \
+        return ReadConversion<OPERATION>();
+      JLM_RVSDG_CONVERSION_OPERATIONS(JLM_RVSDG_CONVERSION_CASE)
+#undef JLM_RVSDG_CONVERSION_CASE
+
+      case RvsdgOperationTag::BitConstant:
+        return std::make_unique<jive::bitconstant_op>(jive::bitvalue_repr(Decoder_.ReadString().c_str()));
+
+      case RvsdgOperationTag::BitSlice:
+      {
+        auto nbits = Decoder_.ReadUInt();
+        auto low = Decoder_.ReadUInt();
+        auto high = Decoder_.ReadUInt();
+        if (low >= high || high > nbits)
+          throw error("Invalid bit slice in RVSDG file.");
+
+        return std::make_unique<jive::bitslice_op>(jive::bittype(nbits), low, high);
+      }
+
+      case RvsdgOperationTag::BitConcat:
+      {
+        std::vector<jive::bittype> types;
+        auto numArguments = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numArguments; n++)
+          types.emplace_back(Decoder_.ReadUInt());
+
+        return std::make_unique<jive::bitconcat_op>(types);
+      }
+
+      case RvsdgOperationTag::Match:
+      {
+        auto nbits = Decoder_.ReadUInt();
+        auto defaultAlternative = Decoder_.ReadUInt();
+        auto numAlternatives = Decoder_.ReadUInt();
+
+        std::unordered_map<uint64_t, uint64_t> mapping;
+        auto numMappings = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numMappings; n++)
+        {
+          auto value = Decoder_.ReadUInt();
+          mapping[value] = Decoder_.ReadUInt();
+        }
+
+        return std::make_unique<jive::match_op>(nbits, mapping, defaultAlternative, numAlternatives);
+      }
+
+      case RvsdgOperationTag::ControlConstant:
+      {
+        auto alternative = Decoder_.ReadUInt();
+        auto numAlternatives = Decoder_.ReadUInt();
+        return std::make_unique<jive::ctlconstant_op>(jive::ctlvalue_repr(alternative, numAlternatives));
+      }
+
+      case RvsdgOperationTag::Mux:
+      {
+        auto & type = ReadTypeAs<jive::statetype>();
+        auto numArguments = Decoder_.ReadUInt();
+        auto numResults = Decoder_.ReadUInt();
+        return std::make_unique<jive::mux_op>(type, numArguments, numResults);
+      }
+
+      case RvsdgOperationTag::FlattenedBinary:
+      {
+        auto operation = ReadOperation();
+        auto binaryOperation = dynamic_cast<const jive::binary_op*>(operation.get());
+        if (!binaryOperation || !binaryOperation->is_associative())
+          throw error("Expected associative binary operation in RVSDG file.");
+
+        return std::make_unique<jive::flattened_binary_op>(*binaryOperation, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::Select:
+        return std::make_unique<select_op>(ReadType());
+
+      case RvsdgOperationTag::Ctl2Bits:
+      {
+        auto & controlType = ReadTypeAs<jive::ctltype>();
+        auto & bitType = ReadTypeAs<jive::bittype>();
+        return std::make_unique<ctl2bits_op>(controlType, bitType);
+      }
+
+      case RvsdgOperationTag::ConstantPointerNull:
+        return std::make_unique<ConstantPointerNullOperation>(ReadTypeAs<PointerType>());
+
+      case RvsdgOperationTag::ConstantDataArray:
+      {
+        auto & elementType = ReadTypeAs<jive::valuetype>();
+        return std::make_unique<ConstantDataArray>(elementType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::ConstantArray:
+      {
+        auto & elementType = ReadTypeAs<jive::valuetype>();
+        return std::make_unique<ConstantArray>(elementType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::PtrCmp:
+      {
+        auto & pointerType = ReadTypeAs<PointerType>();
+        return std::make_unique<ptrcmp_op>(pointerType, Decoder_.ReadEnum(cmp::le));
+      }
+
+      case RvsdgOperationTag::ConstantFP:
+      {
+        auto size = Decoder_.ReadEnum(fpsize::x86fp80);
+        auto bitWidth = Decoder_.ReadUInt();
+        std::vector<uint64_t> words;
+        auto numWords = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numWords; n++)
+          words.push_back(Decoder_.ReadUInt());
+
+        llvm::APFloat constant(GetFltSemantics(size), llvm::APInt(bitWidth, words));
+        return std::make_unique<ConstantFP>(size, constant);
+      }
+
+      case RvsdgOperationTag::FpCmp:
+      {
+        auto compare = Decoder_.ReadEnum(fpcmp::uno);
+        return std::make_unique<fpcmp_op>(compare, Decoder_.ReadEnum(fpsize::x86fp80));
+      }
+
+      case RvsdgOperationTag::FpBin:
+      {
+        auto operation = Decoder_.ReadEnum(fpop::mod);
+        return std::make_unique<fpbin_op>(operation, Decoder_.ReadEnum(fpsize::x86fp80));
+      }
+
+      case RvsdgOperationTag::FpNeg:
+        return std::make_unique<fpneg_op>(ReadType());
+
+      case RvsdgOperationTag::Undef:
+        return std::make_unique<UndefValueOperation>(ReadType());
+
+      case RvsdgOperationTag::Poison:
+        return std::make_unique<PoisonValueOperation>(ReadTypeAs<jive::valuetype>());
+
+      case RvsdgOperationTag::Valist:
+      {
+        std::vector<std::unique_ptr<jive::type>> types;
+        auto numArguments = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numArguments; n++)
+          types.push_back(ReadType().copy());
+
+        return std::make_unique<valist_op>(std::move(types));
+      }
+
+      case RvsdgOperationTag::ConstantStruct:
+        return std::make_unique<ConstantStruct>(ReadTypeAs<StructType>());
+
+      case RvsdgOperationTag::ConstantAggregateZero:
+        return std::make_unique<ConstantAggregateZero>(ReadType());
+
+      case RvsdgOperationTag::ExtractElement:
+      {
+        auto & vectorType = ReadTypeAs<vectortype>();
+        auto & indexType = ReadTypeAs<jive::bittype>();
+        return std::make_unique<extractelement_op>(vectorType, indexType);
+      }
+
+      case RvsdgOperationTag::ShuffleVector:
+      {
+        auto & vectorType = ReadTypeAs<vectortype>();
+        std::vector<int> mask;
+        auto numElements = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numElements; n++)
+          mask.push_back(Decoder_.ReadInt());
+
+        if (auto fixedVectorType = dynamic_cast<const fixedvectortype*>(&vectorType))
+          return std::make_unique<shufflevector_op>(*fixedVectorType, mask);
+
+        return std::make_unique<shufflevector_op>(*AssertedCast<const scalablevectortype>(&vectorType), mask);
+      }
+
+      case RvsdgOperationTag::ConstantVector:
+        return std::make_unique<constantvector_op>(ReadTypeAs<vectortype>());
+
+      case RvsdgOperationTag::InsertElement:
+      {
+        auto & vectorType = ReadTypeAs<vectortype>();
+        auto & valueType = ReadTypeAs<jive::valuetype>();
+        auto & indexType = ReadTypeAs<jive::bittype>();
+        return std::make_unique<insertelement_op>(vectorType, valueType, indexType);
+      }
+
+      case RvsdgOperationTag::VectorUnary:
+      {
+        auto operation = ReadOperation();
+        auto unaryOperation = dynamic_cast<const jive::unary_op*>(operation.get());
+        if (!unaryOperation)
+          throw error("Expected unary operation in RVSDG file.");
+
+        auto & operandType = ReadTypeAs<vectortype>();
+        auto & resultType = ReadTypeAs<vectortype>();
+        return std::make_unique<vectorunary_op>(*unaryOperation, operandType, resultType);
+      }
+
+      case RvsdgOperationTag::VectorBinary:
+      {
+        auto operation = ReadOperation();
+        auto binaryOperation = dynamic_cast<const jive::binary_op*>(operation.get());
+        if (!binaryOperation)
+          throw error("Expected binary operation in RVSDG file.");
+
+        auto & operand1Type = ReadTypeAs<vectortype>();
+        auto & operand2Type = ReadTypeAs<vectortype>();
+        auto & resultType = ReadTypeAs<vectortype>();
+        return std::make_unique<vectorbinary_op>(*binaryOperation, operand1Type, operand2Type, resultType);
+      }
+
+      case RvsdgOperationTag::ExtractValue:
+      {
+        auto & aggregateType = ReadType();
+        std::vector<unsigned> indices;
+        auto numIndices = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numIndices; n++)
+          indices.push_back(Decoder_.ReadUInt());
+
+        return std::make_unique<ExtractValue>(aggregateType, indices);
+      }
+
+      case RvsdgOperationTag::LoopStateMux:
+      {
+        auto numOperands = Decoder_.ReadUInt();
+        return std::make_unique<loopstatemux_op>(numOperands, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::MemStateMerge:
+        return std::make_unique<MemStateMergeOperator>(Decoder_.ReadUInt());
+
+      case RvsdgOperationTag::MemStateSplit:
+        return std::make_unique<MemStateSplitOperator>(Decoder_.ReadUInt());
+
+      case RvsdgOperationTag::Malloc:
+        return std::make_unique<malloc_op>(ReadTypeAs<jive::bittype>());
+
+      case RvsdgOperationTag::Free:
+        return std::make_unique<free_op>(Decoder_.ReadUInt());
+
+      case RvsdgOperationTag::Memcpy:
+      {
+        std::vector<jive::port> operandPorts, resultPorts;
+        auto numOperands = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numOperands; n++)
+          operandPorts.emplace_back(ReadType());
+        auto numResults = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numResults; n++)
+          resultPorts.emplace_back(ReadType());
+
+        return std::make_unique<Memcpy>(operandPorts, resultPorts);
+      }
+
+      case RvsdgOperationTag::Alloca:
+      {
+        auto & allocatedType = ReadTypeAs<jive::valuetype>();
+        auto & sizeType = ReadTypeAs<jive::bittype>();
+        return std::make_unique<alloca_op>(allocatedType, sizeType, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::GetElementPtr:
+      {
+        auto & pointerType = ReadTypeAs<PointerType>();
+        std::vector<jive::bittype> indexTypes;
+        auto numIndices = Decoder_.ReadUInt();
+        for (size_t n = 0; n < numIndices; n++)
+          indexTypes.push_back(ReadTypeAs<jive::bittype>());
+        auto & resultType = ReadTypeAs<PointerType>();
+
+        return std::make_unique<getelementptr_op>(pointerType, indexTypes, resultType);
+      }
+
+      case RvsdgOperationTag::Load:
+      {
+        auto & loadedType = ReadTypeAs<jive::valuetype>();
+        auto numStates = Decoder_.ReadUInt();
+        return std::make_unique<LoadOperation>(loadedType, numStates, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::Store:
+      {
+        auto & storedType = ReadTypeAs<jive::valuetype>();
+        auto numStates = Decoder_.ReadUInt();
+        return std::make_unique<StoreOperation>(storedType, numStates, Decoder_.ReadUInt());
+      }
+
+      case RvsdgOperationTag::Call:
+        return std::make_unique<CallOperation>(ReadTypeAs<FunctionType>());
+    }
+
+    JLM_UNREACHABLE("Unhandled operation tag.");
+  }
+
+  RvsdgDecoder Decoder_;
+  std::vector<std::unique_ptr<jive::type>> TypeTable_;
+  std::vector<jive::rcddeclaration*> Declarations_;
+};
+
+std::vector<uint8_t>
+SerializeRvsdgModule(const RvsdgModule & rvsdgModule)
+{
+  RvsdgSerializer serializer;
+  return serializer.Serialize(rvsdgModule);
+}
+
+std::unique_ptr<RvsdgModule>
+DeserializeRvsdgModule(const uint8_t * data, size_t size)
+{
+  RvsdgDeserializer deserializer(data, size);
+  try
+  {
+    return deserializer.Deserialize();
+  }
+  catch (const jive::type_error & e)
+  {
+    /*
+     * The operand types are only checked by the node constructors.
+     */
+    throw error(strfmt("Malformed RVSDG file: ", e.what()));
+  }
+}
+
+void
+WriteRvsdgModule(
+  const RvsdgModule & rvsdgModule,
+  const filepath & file)
+{
+  auto bytes = SerializeRvsdgModule(rvsdgModule);
+
+  std::ofstream stream(file.to_str(), std::ios::binary | std::ios::trunc);
+  stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  if (!stream)
+    throw error(strfmt("Cannot write RVSDG file ", file.to_str(), "."));
+}
+
+std::unique_ptr<RvsdgModule>
+ReadRvsdgModule(const filepath & file)
+{
+  auto fd = open(file.to_str().c_str(), O_RDONLY);
+  if (fd < 0)
+    throw error(strfmt("Cannot open RVSDG file ", file.to_str(), "."));
+
+  struct stat status = {};
+  if (fstat(fd, &status) != 0 || status.st_size == 0)
+  {
+    close(fd);
+    throw error(strfmt("Cannot read RVSDG file ", file.to_str(), "."));
+  }
+
+  auto size = static_cast<size_t>(status.st_size);
+  auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    throw error(strfmt("Cannot map RVSDG file ", file.to_str(), "."));
+
+  try
+  {
+    auto rvsdgModule = DeserializeRvsdgModule(static_cast<const uint8_t*>(data), size);
+    munmap(data, size);
+    return rvsdgModule;
+  }
+  catch (...)
+  {
+    munmap(data, size);
+    throw;
+  }
+}
+
+}
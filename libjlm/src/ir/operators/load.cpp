@@ -9,6 +9,7 @@
 #include <jlm/ir/operators/load.hpp>
 #include <jlm/ir/operators/operators.hpp>
 #include <jlm/ir/operators/store.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jlm {
 
@@ -25,6 +26,15 @@ LoadOperation::operator==(const operation & other) const noexcept
       && op->GetAlignment() == GetAlignment();
 }
 
+size_t
+LoadOperation::hash() const noexcept
+{
+  auto seed = typeid(*this).hash_code();
+  jive::detail::hash_combine(seed, narguments());
+  jive::detail::hash_combine(seed, GetAlignment());
+  return seed;
+}
+
 std::string
 LoadOperation::debug_string() const
 {
@@ -6,6 +6,7 @@
 #include <jlm/ir/operators/operators.hpp>
 
 #include <jive/types/bitstring/constant.hpp>
+#include <jive/util/hash.hpp>
 
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/Support/raw_ostream.h>
@@ -385,6 +386,14 @@ ptrcmp_op::operator==(const operation & other) const noexcept
 	return op && op->argument(0) == argument(0) && op->cmp_ == cmp_;
 }
 
+size_t
+ptrcmp_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, static_cast<int>(cmp_));
+	return seed;
+}
+
 std::string
 ptrcmp_op::debug_string() const
 {
@@ -434,6 +443,15 @@ zext_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+zext_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, nsrcbits());
+	jive::detail::hash_combine(seed, ndstbits());
+	return seed;
+}
+
 std::string
 zext_op::debug_string() const
 {
@@ -483,6 +501,15 @@ ConstantFP::operator==(const operation & other) const noexcept
 	    && constant().bitwiseIsEqual(op->constant());
 }
 
+size_t
+ConstantFP::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, static_cast<int>(size()));
+	jive::detail::hash_combine(seed, static_cast<size_t>(llvm::hash_value(constant())));
+	return seed;
+}
+
 std::string
 ConstantFP::debug_string() const
 {
@@ -517,6 +544,14 @@ fpcmp_op::operator==(const operation & other) const noexcept
 	    && op->cmp_ == cmp_;
 }
 
+size_t
+fpcmp_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, static_cast<int>(cmp_));
+	return seed;
+}
+
 std::string
 fpcmp_op::debug_string() const
 {
@@ -612,6 +647,15 @@ fpbin_op::operator==(const operation & other) const noexcept
 	return op && op->fpop() == fpop() && op->size() == size();
 }
 
+size_t
+fpbin_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, static_cast<int>(fpop()));
+	jive::detail::hash_combine(seed, static_cast<int>(size()));
+	return seed;
+}
+
 std::string
 fpbin_op::debug_string() const
 {
@@ -873,6 +917,15 @@ trunc_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+trunc_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, nsrcbits());
+	jive::detail::hash_combine(seed, ndstbits());
+	return seed;
+}
+
 std::string
 trunc_op::debug_string() const
 {
@@ -5,6 +5,7 @@
 
 #include <jlm/ir/operators/operators.hpp>
 #include <jlm/ir/operators/sext.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jlm {
 
@@ -82,6 +83,15 @@ sext_op::operator==(const operation & other) const noexcept
 	    && op->result(0) == result(0);
 }
 
+size_t
+sext_op::hash() const noexcept
+{
+	auto seed = typeid(*this).hash_code();
+	jive::detail::hash_combine(seed, nsrcbits());
+	jive::detail::hash_combine(seed, ndstbits());
+	return seed;
+}
+
 std::string
 sext_op::debug_string() const
 {
@@ -9,6 +9,7 @@
 #include <jlm/ir/operators/alloca.hpp>
 #include <jlm/ir/operators/operators.hpp>
 #include <jlm/ir/operators/store.hpp>
+#include <jive/util/hash.hpp>
 
 namespace jlm {
 
@@ -25,6 +26,15 @@ StoreOperation::operator==(const operation & other) const noexcept
       && op->GetAlignment() == GetAlignment();
 }
 
+size_t
+StoreOperation::hash() const noexcept
+{
+  auto seed = typeid(*this).hash_code();
+  jive::detail::hash_combine(seed, NumStates());
+  jive::detail::hash_combine(seed, GetAlignment());
+  return seed;
+}
+
 std::string
 StoreOperation::debug_string() const
 {
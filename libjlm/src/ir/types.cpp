@@ -7,6 +7,8 @@
 #include <jlm/ir/types.hpp>
 #include <jlm/util/strfmt.hpp>
 
+#include <jive/util/hash.hpp>
+
 #include <unordered_map>
 
 namespace jlm {
@@ -97,6 +99,18 @@ FunctionType::operator==(const jive::type & _other) const noexcept
   return true;
 }
 
+size_t
+FunctionType::hash() const noexcept
+{
+  auto seed = typeid(FunctionType).hash_code();
+  for (auto & type : ResultTypes_)
+    jive::detail::hash_combine(seed, type->hash());
+  jive::detail::hash_combine(seed, ResultTypes_.size());
+  for (auto & type : ArgumentTypes_)
+    jive::detail::hash_combine(seed, type->hash());
+  return seed;
+}
+
 std::unique_ptr<jive::type>
 FunctionType::copy() const
 {
@@ -143,6 +157,14 @@ PointerType::operator==(const jive::type & other) const noexcept
          && type->GetElementType() == GetElementType();
 }
 
+size_t
+PointerType::hash() const noexcept
+{
+  auto seed = typeid(PointerType).hash_code();
+  jive::detail::hash_combine(seed, ElementType_->hash());
+  return seed;
+}
+
 std::unique_ptr<jive::type>
 PointerType::copy() const
 {
@@ -167,6 +189,15 @@ arraytype::operator==(const jive::type & other) const noexcept
 	return type && type->element_type() == element_type() && type->nelements() == nelements();
 }
 
+size_t
+arraytype::hash() const noexcept
+{
+	auto seed = typeid(arraytype).hash_code();
+	jive::detail::hash_combine(seed, type_->hash());
+	jive::detail::hash_combine(seed, nelements_);
+	return seed;
+}
+
 std::unique_ptr<jive::type>
 arraytype::copy() const
 {
@@ -199,6 +230,14 @@ fptype::operator==(const jive::type & other) const noexcept
 	return type && type->size() == size();
 }
 
+size_t
+fptype::hash() const noexcept
+{
+	auto seed = typeid(fptype).hash_code();
+	jive::detail::hash_combine(seed, size_);
+	return seed;
+}
+
 std::unique_ptr<jive::type>
 fptype::copy() const
 {
@@ -241,6 +280,16 @@ StructType::operator==(const jive::type & other) const noexcept
          && &type->Declaration_ == &Declaration_;
 }
 
+size_t
+StructType::hash() const noexcept
+{
+  auto seed = typeid(StructType).hash_code();
+  jive::detail::hash_combine(seed, IsPacked_);
+  jive::detail::hash_combine(seed, Name_);
+  jive::detail::hash_combine(seed, &Declaration_);
+  return seed;
+}
+
 std::string
 StructType::debug_string() const
 {
@@ -264,6 +313,19 @@ vectortype::operator==(const jive::type & other) const noexcept
 	    && *type->type_ == *type_;
 }
 
+/*
+	Fixed and scalable vector types of the same size and element type compare
+	equal, so the hash must not depend on the class of the vector type.
+*/
+size_t
+vectortype::hash() const noexcept
+{
+	auto seed = typeid(vectortype).hash_code();
+	jive::detail::hash_combine(seed, type_->hash());
+	jive::detail::hash_combine(seed, size_);
+	return seed;
+}
+
 /* fixedvectortype */
 
 fixedvectortype::~fixedvectortype()
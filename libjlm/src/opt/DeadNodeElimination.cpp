@@ -8,14 +8,17 @@
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/opt/DeadNodeElimination.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/ThreadPool.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+
 namespace jlm {
 
 static bool
 is_phi_argument(const jive::output * output)
 {
-  auto argument = dynamic_cast<const jive::argument*>(output);
+  auto argument = jive::dyn_cast<jive::argument>(output);
   return argument
          && argument->region()->node()
          && is<phi::operation>(argument->region()->node());
@@ -32,6 +35,7 @@ public:
 	: jlm::Statistics(Statistics::Id::DeadNodeElimination)
   , numNodesBefore_(0), numNodesAfter_(0)
 	, numInputsBefore_(0), numInputsAfter_(0)
+  , peakWorklistSize_(0)
 	{}
 
 	void
@@ -43,9 +47,10 @@ public:
 	}
 
 	void
-	StopMarkStatistics() noexcept
+	StopMarkStatistics(size_t peakWorklistSize) noexcept
 	{
 		markTimer_.stop();
+    peakWorklistSize_ = peakWorklistSize;
 	}
 
 	void
@@ -70,6 +75,7 @@ public:
                   "#RvsdgNodesAfterDNE:", numNodesAfter_, " ",
                   "#RvsdgInputsBeforeDNE:", numInputsBefore_, " ",
                   "#RvsdgInputsAfterDNE:", numInputsAfter_, " ",
+                  "#PeakMarkWorklistSize:", peakWorklistSize_, " ",
                   "MarkTime[ns]:", markTimer_.ns(), " ",
                   "SweepTime[ns]:", sweepTimer_.ns()
 		);
@@ -86,6 +92,7 @@ private:
   size_t numNodesAfter_;
 	size_t numInputsBefore_;
   size_t numInputsAfter_;
+  size_t peakWorklistSize_;
 	jlm::timer markTimer_;
   jlm::timer sweepTimer_;
 };
@@ -96,7 +103,7 @@ DeadNodeElimination::~DeadNodeElimination()
 void
 DeadNodeElimination::run(jive::region & region)
 {
-  ResetState();
+  ResetState(*region.graph());
 	Mark(region);
 	Sweep(region);
 }
@@ -108,12 +115,12 @@ DeadNodeElimination::run(
 {
   auto & graph = module.Rvsdg();
 
-  ResetState();
+  ResetState(graph);
 
   auto statistics = Statistics::Create();
   statistics->StartMarkStatistics(graph);
   Mark(*graph.root());
-  statistics->StopMarkStatistics();
+  statistics->StopMarkStatistics(peakWorklistSize_);
 
   statistics->StartSweepStatistics();
   Sweep(graph);
@@ -123,9 +130,12 @@ DeadNodeElimination::run(
 }
 
 void
-DeadNodeElimination::ResetState()
+DeadNodeElimination::ResetState(const jive::graph & graph)
 {
-  context_.Clear();
+  context_.Reset(graph);
+  worklist_.clear();
+  peakWorklistSize_ = 0;
+  lambdaSubregionsSwept_ = false;
 }
 
 void
@@ -133,16 +143,27 @@ DeadNodeElimination::Mark(const jive::region & region)
 {
   for (size_t n = 0; n < region.nresults(); n++)
     Mark(*region.result(n)->origin());
+
+  while (!worklist_.empty()) {
+    auto output = worklist_.back();
+    worklist_.pop_back();
+    MarkDependencies(*output);
+  }
 }
 
 void
 DeadNodeElimination::Mark(const jive::output & output)
 {
-  if (context_.IsAlive(output))
+  if (!context_.MarkAlive(output))
     return;
 
-  context_.MarkAlive(output);
+  worklist_.push_back(&output);
+  peakWorklistSize_ = std::max(peakWorklistSize_, worklist_.size());
+}
 
+void
+DeadNodeElimination::MarkDependencies(const jive::output & output)
+{
   if (is_import(&output))
     return;
 
@@ -172,7 +193,7 @@ DeadNodeElimination::Mark(const jive::output & output)
     return;
   }
 
-  if (auto o = dynamic_cast<const lambda::output*>(&output)) {
+  if (auto o = jive::dyn_cast<lambda::output>(&output)) {
     for (auto & result : o->node()->fctresults())
       Mark(*result.origin());
     return;
@@ -181,7 +202,7 @@ DeadNodeElimination::Mark(const jive::output & output)
   if (is<lambda::fctargument>(&output))
     return;
 
-  if (auto cv = dynamic_cast<const lambda::cvargument*>(&output)) {
+  if (auto cv = jive::dyn_cast<lambda::cvargument>(&output)) {
     Mark(*cv->input()->origin());
     return;
   }
@@ -199,17 +220,17 @@ DeadNodeElimination::Mark(const jive::output & output)
     return;
   }
 
-  if (auto deltaOutput = dynamic_cast<const delta::output*>(&output)) {
+  if (auto deltaOutput = jive::dyn_cast<delta::output>(&output)) {
     Mark(*deltaOutput->node()->subregion()->result(0)->origin());
     return;
   }
 
-  if (auto deltaCvArgument = dynamic_cast<const delta::cvargument*>(&output)) {
+  if (auto deltaCvArgument = jive::dyn_cast<delta::cvargument>(&output)) {
     Mark(*deltaCvArgument->input()->origin());
     return;
   }
 
-  if (auto simpleOutput = dynamic_cast<const jive::simple_output*>(&output)) {
+  if (auto simpleOutput = jive::dyn_cast<jive::simple_output>(&output)) {
     auto node = simpleOutput->node();
     for (size_t n = 0; n < node->ninputs(); n++)
       Mark(*node->input(n)->origin());
@@ -220,9 +241,15 @@ DeadNodeElimination::Mark(const jive::output & output)
 }
 
 void
-DeadNodeElimination::Sweep(jive::graph & graph) const
+DeadNodeElimination::Sweep(jive::graph & graph)
 {
+  if (numThreads_ > 1) {
+    SweepLambdaSubregions(graph);
+    lambdaSubregionsSwept_ = true;
+  }
+
   Sweep(*graph.root());
+  lambdaSubregionsSwept_ = false;
 
   /**
    * Remove dead imports
@@ -233,6 +260,49 @@ DeadNodeElimination::Sweep(jive::graph & graph) const
   }
 }
 
+static void
+CollectLambdaNodes(jive::region & region, std::vector<lambda::node*> & lambdaNodes)
+{
+  for (auto & node : region.nodes) {
+    if (auto lambdaNode = jive::dyn_cast<lambda::node>(&node))
+      lambdaNodes.push_back(lambdaNode);
+    else if (auto phiNode = jive::dyn_cast<phi::node>(&node))
+      CollectLambdaNodes(*phiNode->subregion(), lambdaNodes);
+  }
+}
+
+void
+DeadNodeElimination::SweepLambdaSubregions(jive::graph & graph) const
+{
+  std::vector<lambda::node*> lambdaNodes;
+  CollectLambdaNodes(*graph.root(), lambdaNodes);
+
+  /**
+   * Dead lambda nodes are removed entirely by the sequential sweep.
+   */
+  auto isDead = [&](const lambda::node * lambdaNode) { return !context_.IsAlive(*lambdaNode); };
+  lambdaNodes.erase(std::remove_if(lambdaNodes.begin(), lambdaNodes.end(), isDead), lambdaNodes.end());
+
+  if (lambdaNodes.size() < 2) {
+    for (auto lambdaNode : lambdaNodes)
+      Sweep(*lambdaNode->subregion());
+    return;
+  }
+
+  /**
+   * A lambda subregion only refers to nodes outside of the lambda node through the lambda's arguments. Sweeping it
+   * therefore neither reads nor modifies anything that another lambda subregion touches.
+   */
+  graph.set_concurrent(true);
+  {
+    ThreadPool threadPool(std::min(numThreads_, lambdaNodes.size()));
+    for (auto lambdaNode : lambdaNodes)
+      threadPool.Submit([this, lambdaNode]() { Sweep(*lambdaNode->subregion()); });
+    threadPool.Wait();
+  }
+  graph.set_concurrent(false);
+}
+
 void
 DeadNodeElimination::Sweep(jive::region & region) const
 {
@@ -249,7 +319,7 @@ DeadNodeElimination::Sweep(jive::region & region) const
         continue;
       }
 
-      if (auto structuralNode = dynamic_cast<jive::structural_node*>(node))
+      if (auto structuralNode = jive::dyn_cast<jive::structural_node>(node))
         Sweep(*structuralNode);
     }
   }
@@ -360,7 +430,8 @@ DeadNodeElimination::SweepTheta(jive::theta_node & thetaNode) const
 void
 DeadNodeElimination::SweepLambda(lambda::node & lambdaNode) const
 {
-  Sweep(*lambdaNode.subregion());
+  if (!lambdaSubregionsSwept_)
+    Sweep(*lambdaNode.subregion());
 
   /**
    * Remove dead arguments and inputs
@@ -74,6 +74,15 @@ InvariantValueRedirection::run(
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+HashSet<AnalysisId>
+InvariantValueRedirection::PreservedAnalyses() const
+{
+  return {
+    AnalysisId::AndersenPointsToGraph,
+    AnalysisId::SteensgaardFieldSensitivePointsToGraph,
+    AnalysisId::SteensgaardPointsToGraph};
+}
+
 void
 InvariantValueRedirection::RedirectInvariantValues(jive::region & region)
 {
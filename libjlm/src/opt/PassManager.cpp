@@ -0,0 +1,333 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/operators/Phi.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/PassManager.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/ThreadPool.hpp>
+#include <jlm/util/time.hpp>
+
+namespace jlm {
+
+/* AnalysisManager class */
+
+bool
+AnalysisManager::IsCached(AnalysisId analysisId, const RvsdgModule & rvsdgModule) const noexcept
+{
+  return Lookup(analysisId, rvsdgModule) != nullptr;
+}
+
+void *
+AnalysisManager::Lookup(AnalysisId analysisId, const RvsdgModule & rvsdgModule) const noexcept
+{
+  auto it = Entries_.find(analysisId);
+  if (it == Entries_.end())
+    return nullptr;
+
+  auto & entry = it->second;
+  if (entry.Module != &rvsdgModule
+      || entry.MutationCount != rvsdgModule.Rvsdg().mutation_count())
+    return nullptr;
+
+  return entry.Result.get();
+}
+
+AnalysisManager::Entry &
+AnalysisManager::Insert(
+  AnalysisId analysisId,
+  const RvsdgModule & rvsdgModule,
+  std::shared_ptr<void> result)
+{
+  auto & entry = Entries_[analysisId];
+  entry.Result = std::move(result);
+  entry.Module = &rvsdgModule;
+  entry.MutationCount = rvsdgModule.Rvsdg().mutation_count();
+
+  return entry;
+}
+
+void
+AnalysisManager::Update(
+  const RvsdgModule & rvsdgModule,
+  size_t mutationCount,
+  const HashSet<AnalysisId> & preservedAnalyses)
+{
+  auto currentMutationCount = rvsdgModule.Rvsdg().mutation_count();
+
+  auto it = Entries_.begin();
+  while (it != Entries_.end())
+  {
+    auto & entry = it->second;
+    if (entry.Module != &rvsdgModule || entry.MutationCount == currentMutationCount)
+    {
+      it++;
+      continue;
+    }
+
+    if (entry.MutationCount == mutationCount && preservedAnalyses.Contains(it->first))
+    {
+      entry.MutationCount = currentMutationCount;
+      it++;
+      continue;
+    }
+
+    it = Entries_.erase(it);
+  }
+}
+
+/* PassManager class */
+
+/**
+ * @return The analyses preserved by all of \p passes.
+ */
+template<class T> static HashSet<AnalysisId>
+IntersectPreservedAnalyses(const std::vector<T*> & passes)
+{
+  if (passes.empty())
+    return {};
+
+  auto preservedAnalyses = passes[0]->PreservedAnalyses();
+  for (auto & pass : passes)
+  {
+    auto analyses = pass->PreservedAnalyses();
+    preservedAnalyses.RemoveWhere([&](AnalysisId analysisId)
+    {
+      return !analyses.Contains(analysisId);
+    });
+  }
+
+  return preservedAnalyses;
+}
+
+PassManager::~PassManager() noexcept
+= default;
+
+PassManager::PassManager(size_t numThreads)
+  : NumThreads_(numThreads)
+{
+  if (NumThreads_ > 1)
+    ThreadPool_ = std::make_unique<ThreadPool>(NumThreads_);
+}
+
+bool
+PassManager::RunPass(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  optimization & pass)
+{
+  auto mutationCount = rvsdgModule.Rvsdg().mutation_count();
+  pass.run(rvsdgModule, statisticsCollector, *this);
+
+  if (rvsdgModule.Rvsdg().mutation_count() == mutationCount)
+    return false;
+
+  AnalysisManager_.Update(rvsdgModule, mutationCount, pass.PreservedAnalyses());
+  return true;
+}
+
+static void
+CollectLambdaNodes(jive::region & region, std::vector<lambda::node*> & lambdaNodes)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto lambdaNode = dynamic_cast<lambda::node*>(&node))
+      lambdaNodes.push_back(lambdaNode);
+    else if (auto phiNode = dynamic_cast<phi::node*>(&node))
+      CollectLambdaNodes(*phiNode->subregion(), lambdaNodes);
+  }
+}
+
+bool
+PassManager::RunOnLambdas(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  const std::vector<RegionLocalOptimization*> & passes)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto mutationCount = rvsdg.mutation_count();
+
+  std::vector<lambda::node*> lambdaNodes;
+  CollectLambdaNodes(*rvsdg.root(), lambdaNodes);
+
+  /*
+   * Every worker thread collects the statistics of its lambda nodes without synchronization. They are merged once
+   * all lambda nodes are processed.
+   */
+  std::vector<std::unique_ptr<StatisticsCollector>> statisticsCollectors;
+  for (size_t n = 0; n < ThreadPool_->NumThreads(); n++)
+    statisticsCollectors.push_back(std::make_unique<StatisticsCollector>(statisticsCollector.GetSettings()));
+
+  rvsdg.set_concurrent(true);
+  for (auto lambdaNode : lambdaNodes)
+  {
+    ThreadPool_->Submit([lambdaNode, &passes, &statisticsCollectors]()
+    {
+      auto & collector = *statisticsCollectors[ThreadPool::CurrentWorkerIndex()];
+      for (auto & pass : passes)
+        pass->RunOnLambda(*lambdaNode, collector);
+    });
+  }
+  ThreadPool_->Wait();
+  rvsdg.set_concurrent(false);
+
+  for (auto & collector : statisticsCollectors)
+    statisticsCollector.Merge(std::move(*collector));
+
+  if (rvsdg.mutation_count() == mutationCount)
+    return false;
+
+  AnalysisManager_.Update(rvsdgModule, mutationCount, IntersectPreservedAnalyses(passes));
+  return true;
+}
+
+bool
+PassManager::Run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  const std::vector<optimization*> & passes)
+{
+  bool changed = false;
+  if (!ThreadPool_)
+  {
+    for (auto & pass : passes)
+      changed |= RunPass(rvsdgModule, statisticsCollector, *pass);
+
+    return changed;
+  }
+
+  std::vector<RegionLocalOptimization*> group;
+  for (auto & pass : passes)
+  {
+    if (auto regionLocalPass = dynamic_cast<RegionLocalOptimization*>(pass))
+    {
+      group.push_back(regionLocalPass);
+      continue;
+    }
+
+    if (!group.empty())
+    {
+      changed |= RunOnLambdas(rvsdgModule, statisticsCollector, group);
+      group.clear();
+    }
+    changed |= RunPass(rvsdgModule, statisticsCollector, *pass);
+  }
+
+  if (!group.empty())
+    changed |= RunOnLambdas(rvsdgModule, statisticsCollector, group);
+
+  return changed;
+}
+
+/* FixpointGroup class */
+
+class FixpointGroupStatistics final : public Statistics {
+public:
+  ~FixpointGroupStatistics() override
+  = default;
+
+  FixpointGroupStatistics(size_t numPasses, size_t maxIterations)
+    : Statistics(Statistics::Id::FixpointGroup)
+    , NumPasses_(numPasses)
+    , MaxIterations_(maxIterations)
+    , NumIterations_(0)
+    , Converged_(false)
+  {}
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop(size_t numIterations, bool converged) noexcept
+  {
+    NumIterations_ = numIterations;
+    Converged_ = converged;
+    Timer_.stop();
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("FixpointGroup ",
+                  "#Passes:", NumPasses_, " ",
+                  "#Iterations:", NumIterations_, " ",
+                  "#MaxIterations:", MaxIterations_, " ",
+                  "Converged:", Converged_ ? "yes" : "no", " ",
+                  "Time[ns]:", Timer_.ns()
+    );
+  }
+
+  static std::unique_ptr<FixpointGroupStatistics>
+  Create(size_t numPasses, size_t maxIterations)
+  {
+    return std::make_unique<FixpointGroupStatistics>(numPasses, maxIterations);
+  }
+
+private:
+  size_t NumPasses_;
+  size_t MaxIterations_;
+  size_t NumIterations_;
+  bool Converged_;
+  jlm::timer Timer_;
+};
+
+FixpointGroup::~FixpointGroup() noexcept
+= default;
+
+FixpointGroup::FixpointGroup(
+  std::vector<optimization*> passes,
+  size_t maxIterations)
+  : Passes_(std::move(passes))
+  , MaxIterations_(maxIterations)
+  , NumIterations_(0)
+  , Converged_(false)
+{}
+
+void
+FixpointGroup::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector)
+{
+  PassManager passManager;
+  run(rvsdgModule, statisticsCollector, passManager);
+}
+
+void
+FixpointGroup::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  PassManager & passManager)
+{
+  auto statistics = FixpointGroupStatistics::Create(Passes_.size(), MaxIterations_);
+  statistics->Start();
+
+  NumIterations_ = 0;
+  Converged_ = false;
+  while (NumIterations_ < MaxIterations_)
+  {
+    NumIterations_++;
+    if (!passManager.Run(rvsdgModule, statisticsCollector, Passes_))
+    {
+      Converged_ = true;
+      break;
+    }
+  }
+
+  statistics->Stop(NumIterations_, Converged_);
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+HashSet<AnalysisId>
+FixpointGroup::PreservedAnalyses() const
+{
+  return IntersectPreservedAnalyses(Passes_);
+}
+
+}
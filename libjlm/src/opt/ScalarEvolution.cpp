@@ -0,0 +1,1091 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/common.hpp>
+#include <jlm/ir/operators/gamma.hpp>
+#include <jlm/ir/operators/theta.hpp>
+#include <jlm/opt/ScalarEvolution.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace jlm {
+
+/**
+ * The maximal number of bits of the bitstrings whose values are computed by the analysis. The values of wider
+ * bitstrings do not fit into the 64-bit arithmetic of the analysis.
+ */
+static const size_t MaxNumBits = 64;
+
+/**
+ * @return The lower \p numBits bits of \p value, sign-extended to 64 bits.
+ */
+static int64_t
+SignExtend(uint64_t value, size_t numBits)
+{
+  JLM_ASSERT(numBits <= MaxNumBits);
+  if (numBits == MaxNumBits)
+    return static_cast<int64_t>(value);
+
+  auto mask = (uint64_t(1) << numBits) - 1;
+  auto signBit = uint64_t(1) << (numBits - 1);
+  value &= mask;
+  return static_cast<int64_t>((value ^ signBit) - signBit);
+}
+
+static size_t
+NumBits(const jive::output & output)
+{
+  auto bitType = dynamic_cast<const jive::bittype*>(&output.type());
+  return bitType != nullptr ? bitType->nbits() : 0;
+}
+
+/**
+ * @return True if \p region is \p ancestor or nested in \p ancestor, otherwise false.
+ */
+static bool
+IsContained(const jive::region * region, const jive::region * ancestor)
+{
+  while (region != ancestor)
+  {
+    if (region->node() == nullptr)
+      return false;
+    region = region->node()->region();
+  }
+
+  return true;
+}
+
+/**
+ * @return The origin of \p output if it is the output of a loop-invariant theta loop variable, otherwise \p output.
+ */
+static const jive::output &
+SkipInvariantThetaOutputs(const jive::output & output)
+{
+  auto origin = &output;
+  while (auto thetaOutput = is_theta_output(origin))
+  {
+    if (!jive::is_invariant(thetaOutput))
+      break;
+    origin = thetaOutput->input()->origin();
+  }
+
+  return *origin;
+}
+
+/**
+ * Computes binomial(n, k) modulo 2^64. The odd parts of numerator and denominator are divided with the multiplicative
+ * inverse of the denominator, while the factors of two are counted separately.
+ */
+static uint64_t
+Binomial(uint64_t n, uint64_t k)
+{
+  if (k > n)
+    return 0;
+
+  size_t numTwos = 0;
+  uint64_t numerator = 1;
+  uint64_t denominator = 1;
+  for (uint64_t i = 0; i < k; i++)
+  {
+    auto factor = n - i;
+    while ((factor & 1) == 0)
+    {
+      factor >>= 1;
+      numTwos++;
+    }
+    numerator *= factor;
+
+    factor = i + 1;
+    while ((factor & 1) == 0)
+    {
+      factor >>= 1;
+      numTwos--;
+    }
+    denominator *= factor;
+  }
+
+  /*
+   * Newton's iteration doubles the number of correct bits of the inverse in every step.
+   */
+  uint64_t inverse = denominator;
+  for (size_t i = 0; i < 5; i++)
+    inverse *= 2 - denominator * inverse;
+
+  return numTwos >= 64 ? 0 : (numerator * inverse) << numTwos;
+}
+
+static uint64_t
+Power(uint64_t base, uint64_t exponent)
+{
+  uint64_t result = 1;
+  while (exponent != 0)
+  {
+    if (exponent & 1)
+      result *= base;
+    base *= base;
+    exponent >>= 1;
+  }
+
+  return result;
+}
+
+/**
+ * @return The smallest and the largest value of a signed integer with \p numBits bits.
+ */
+static std::pair<int64_t, int64_t>
+GetSignedBounds(size_t numBits)
+{
+  if (numBits >= 64)
+    return std::make_pair(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+
+  return std::make_pair(-(int64_t(1) << (numBits - 1)), (int64_t(1) << (numBits - 1)) - 1);
+}
+
+/**
+ * Computes the binomial coefficient of \p n and \p k without wrapping around.
+ *
+ * @return The binomial coefficient, or std::nullopt if the computation does not fit into 64 bits.
+ */
+static std::optional<int64_t>
+CheckedBinomial(uint64_t n, uint64_t k)
+{
+  if (k > n)
+    return 0;
+
+  /*
+   * C(n, i) * (n - i) = C(n, i + 1) * (i + 1), so the division is always exact.
+   */
+  int64_t result = 1;
+  for (uint64_t i = 0; i < k; i++)
+  {
+    if (n - i > uint64_t(std::numeric_limits<int64_t>::max())
+        || __builtin_mul_overflow(result, int64_t(n - i), &result))
+      return std::nullopt;
+    result /= int64_t(i + 1);
+  }
+
+  return result;
+}
+
+/**
+ * Computes \p base to the power of \p exponent without wrapping around.
+ *
+ * @return The power, or std::nullopt if the computation does not fit into 64 bits.
+ */
+static std::optional<int64_t>
+CheckedPower(int64_t base, uint64_t exponent)
+{
+  int64_t result = 1;
+  while (exponent != 0)
+  {
+    if ((exponent & 1) && __builtin_mul_overflow(result, base, &result))
+      return std::nullopt;
+
+    exponent >>= 1;
+    if (exponent != 0 && __builtin_mul_overflow(base, base, &base))
+      return std::nullopt;
+  }
+
+  return result;
+}
+
+/**
+ * Evaluates \p expression in iteration \p iteration without wrapping around at the bit width of \p expression.
+ *
+ * @return The exact value of \p expression, or std::nullopt if it is unknown or the computation does not fit into
+ * 64 bits.
+ */
+static std::optional<int64_t>
+EvaluateExact(const ScevExpression & expression, uint64_t iteration)
+{
+  if (auto constant = dynamic_cast<const ScevConstant*>(&expression))
+    return constant->Value();
+
+  if (auto recurrence = dynamic_cast<const ScevAddRecurrence*>(&expression))
+  {
+    int64_t value = 0;
+    for (size_t n = 0; n < recurrence->Operands().size(); n++)
+    {
+      auto operand = dynamic_cast<const ScevConstant*>(&recurrence->Operand(n));
+      auto binomial = CheckedBinomial(iteration, n);
+      int64_t term = 0;
+      if (operand == nullptr || !binomial
+          || __builtin_mul_overflow(operand->Value(), *binomial, &term)
+          || __builtin_add_overflow(value, term, &value))
+        return std::nullopt;
+    }
+
+    return value;
+  }
+
+  if (auto recurrence = dynamic_cast<const ScevMulRecurrence*>(&expression))
+  {
+    auto start = dynamic_cast<const ScevConstant*>(&recurrence->Start());
+    auto ratio = dynamic_cast<const ScevConstant*>(&recurrence->Ratio());
+    if (start == nullptr || ratio == nullptr)
+      return std::nullopt;
+
+    auto power = CheckedPower(ratio->Value(), iteration);
+    int64_t value = 0;
+    if (!power || __builtin_mul_overflow(start->Value(), *power, &value))
+      return std::nullopt;
+
+    return value;
+  }
+
+  return std::nullopt;
+}
+
+/* ScevExpression classes */
+
+ScevExpression::~ScevExpression() noexcept
+= default;
+
+ScevConstant::~ScevConstant() noexcept
+= default;
+
+std::string
+ScevConstant::DebugString() const
+{
+  return std::to_string(Value());
+}
+
+ScevUnknown::~ScevUnknown() noexcept
+= default;
+
+std::string
+ScevUnknown::DebugString() const
+{
+  return strfmt("unknown(", static_cast<const void*>(&Output()), ")");
+}
+
+ScevAddRecurrence::~ScevAddRecurrence() noexcept
+= default;
+
+ScevAddRecurrence::ScevAddRecurrence(
+  const jive::theta_node & thetaNode,
+  std::vector<const ScevExpression*> operands)
+  : ScevExpression(Kind::AddRecurrence, operands[0]->NumBits())
+  , ThetaNode_(&thetaNode)
+  , Operands_(std::move(operands))
+{
+  JLM_ASSERT(Operands_.size() >= 2);
+}
+
+std::string
+ScevAddRecurrence::DebugString() const
+{
+  std::string str("{");
+  for (size_t n = 0; n < Operands_.size(); n++)
+    str += (n != 0 ? ",+," : "") + Operand(n).DebugString();
+
+  return str + "}";
+}
+
+ScevMulRecurrence::~ScevMulRecurrence() noexcept
+= default;
+
+ScevMulRecurrence::ScevMulRecurrence(
+  const jive::theta_node & thetaNode,
+  const ScevExpression & start,
+  const ScevExpression & ratio)
+  : ScevExpression(Kind::MulRecurrence, start.NumBits())
+  , ThetaNode_(&thetaNode)
+  , Start_(&start)
+  , Ratio_(&ratio)
+{}
+
+std::string
+ScevMulRecurrence::DebugString() const
+{
+  return strfmt("{", Start().DebugString(), ",*,", Ratio().DebugString(), "}");
+}
+
+/* ScalarEvolution class */
+
+ScalarEvolution::~ScalarEvolution() noexcept
+= default;
+
+ScalarEvolution::ScalarEvolution()
+= default;
+
+const ScevExpression &
+ScalarEvolution::GetExpression(const jive::output & output)
+{
+  auto it = Cache_.find(&output);
+  if (it != Cache_.end())
+    return *it->second;
+
+  /*
+   * The output depends on itself. This is the case for loop variables whose updates depend on the variable in a way
+   * that is not recognized.
+   */
+  if (InProgress_.find(&output) != InProgress_.end())
+    return CreateUnknown(output);
+
+  InProgress_.insert(&output);
+  auto expression = ComputeExpression(output);
+  InProgress_.erase(&output);
+
+  if (expression == nullptr)
+    expression = &CreateUnknown(output);
+
+  Cache_[&output] = expression;
+  return *expression;
+}
+
+const ScevExpression *
+ScalarEvolution::ComputeExpression(const jive::output & output)
+{
+  auto numBits = NumBits(output);
+  if (numBits == 0 || numBits > MaxNumBits)
+    return nullptr;
+
+  if (is_theta_argument(&output))
+    return ComputeLoopVariable(output);
+
+  if (is_theta_output(&output))
+    return ComputeExitValue(output);
+
+  if (auto argument = is_gamma_argument(&output))
+    return &GetExpression(*argument->input()->origin());
+
+  auto node = jive::node_output::node(&output);
+  if (!jive::is<jive::simple_op>(node))
+    return nullptr;
+
+  if (auto constant = dynamic_cast<const jive::bitconstant_op*>(&node->operation()))
+  {
+    if (!constant->value().is_known())
+      return nullptr;
+
+    return &CreateConstant(numBits, constant->value().to_int());
+  }
+
+  if (node->ninputs() == 1 && jive::is<jive::bitneg_op>(node))
+  {
+    auto & operand = GetExpression(*node->input(0)->origin());
+    return Multiply(operand, CreateConstant(numBits, -1));
+  }
+
+  if (node->ninputs() != 2)
+    return nullptr;
+
+  auto & lhs = GetExpression(*node->input(0)->origin());
+  auto & rhs = GetExpression(*node->input(1)->origin());
+
+  if (jive::is<jive::bitadd_op>(node))
+    return Add(lhs, rhs);
+
+  if (jive::is<jive::bitsub_op>(node))
+  {
+    auto negatedRhs = Multiply(rhs, CreateConstant(numBits, -1));
+    return negatedRhs != nullptr ? Add(lhs, *negatedRhs) : nullptr;
+  }
+
+  if (jive::is<jive::bitmul_op>(node))
+    return Multiply(lhs, rhs);
+
+  if (jive::is<jive::bitshl_op>(node))
+  {
+    auto shift = dynamic_cast<const ScevConstant*>(&rhs);
+    if (shift == nullptr || shift->Value() < 0 || static_cast<size_t>(shift->Value()) >= numBits)
+      return nullptr;
+
+    return Multiply(lhs, CreateConstant(numBits, SignExtend(uint64_t(1) << shift->Value(), numBits)));
+  }
+
+  return nullptr;
+}
+
+const ScevExpression *
+ScalarEvolution::ComputeLoopVariable(const jive::output & argument)
+{
+  auto thetaInput = static_cast<const jive::theta_input*>(static_cast<const jive::argument*>(&argument)->input());
+  auto & thetaNode = *static_cast<const jive::theta_node*>(argument.region()->node());
+  auto update = thetaInput->result()->origin();
+
+  auto & init = GetExpression(*thetaInput->origin());
+  if (update == &argument)
+    return &init;
+
+  if (auto step = DecomposeAdditiveUpdate(*update, argument))
+  {
+    if (IsInvariant(*step, thetaNode))
+      return &CreateAddRecurrence(thetaNode, {&init, step});
+
+    /*
+     * The step is a recurrence of the same theta node, which results in a polynomial of a higher degree.
+     */
+    auto stepRecurrence = dynamic_cast<const ScevAddRecurrence*>(step);
+    if (stepRecurrence && &stepRecurrence->ThetaNode() == &thetaNode)
+    {
+      std::vector<const ScevExpression*> operands({&init});
+      operands.insert(operands.end(), stepRecurrence->Operands().begin(), stepRecurrence->Operands().end());
+      return &CreateAddRecurrence(thetaNode, std::move(operands));
+    }
+
+    return nullptr;
+  }
+
+  if (auto ratio = DecomposeMultiplicativeUpdate(*update, argument))
+  {
+    if (IsInvariant(*ratio, thetaNode))
+      return &CreateMulRecurrence(thetaNode, init, *ratio);
+  }
+
+  return nullptr;
+}
+
+const ScevExpression *
+ScalarEvolution::ComputeExitValue(const jive::output & output)
+{
+  auto thetaOutput = static_cast<const jive::theta_output*>(&output);
+  auto & thetaNode = *static_cast<const jive::theta_node*>(thetaOutput->node());
+
+  auto & value = GetExpression(*thetaOutput->result()->origin());
+  if (IsInvariant(value, thetaNode))
+    return &value;
+
+  auto tripCount = GetTripCount(thetaNode);
+  if (!tripCount)
+    return nullptr;
+
+  auto exitValue = Evaluate(value, *tripCount - 1);
+  if (!exitValue)
+    return nullptr;
+
+  return &CreateConstant(value.NumBits(), *exitValue);
+}
+
+/**
+ * Determines the step S of a loop variable update of the form \p update = \p argument + S.
+ *
+ * @return The step, or null if \p update is not of this form.
+ */
+const ScevExpression *
+ScalarEvolution::DecomposeAdditiveUpdate(const jive::output & update, const jive::output & argument)
+{
+  auto & output = SkipInvariantThetaOutputs(update);
+  if (&output == &argument)
+    return &CreateConstant(NumBits(output), 0);
+
+  auto node = jive::node_output::node(&output);
+  if (node == nullptr || node->ninputs() != 2)
+    return nullptr;
+
+  if (jive::is<jive::bitadd_op>(node))
+  {
+    for (size_t n = 0; n < 2; n++)
+    {
+      if (auto step = DecomposeAdditiveUpdate(*node->input(n)->origin(), argument))
+        return Add(*step, GetExpression(*node->input(1-n)->origin()));
+    }
+  }
+
+  if (jive::is<jive::bitsub_op>(node))
+  {
+    if (auto step = DecomposeAdditiveUpdate(*node->input(0)->origin(), argument))
+    {
+      auto & subtrahend = GetExpression(*node->input(1)->origin());
+      auto negatedSubtrahend = Multiply(subtrahend, CreateConstant(NumBits(output), -1));
+      return negatedSubtrahend != nullptr ? Add(*step, *negatedSubtrahend) : nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+/**
+ * Determines the ratio R of a loop variable update of the form \p update = \p argument * R.
+ *
+ * @return The ratio, or null if \p update is not of this form.
+ */
+const ScevExpression *
+ScalarEvolution::DecomposeMultiplicativeUpdate(const jive::output & update, const jive::output & argument)
+{
+  auto & output = SkipInvariantThetaOutputs(update);
+  auto numBits = NumBits(output);
+  if (&output == &argument)
+    return &CreateConstant(numBits, 1);
+
+  auto node = jive::node_output::node(&output);
+  if (node == nullptr || node->ninputs() != 2)
+    return nullptr;
+
+  if (jive::is<jive::bitmul_op>(node))
+  {
+    for (size_t n = 0; n < 2; n++)
+    {
+      if (auto ratio = DecomposeMultiplicativeUpdate(*node->input(n)->origin(), argument))
+        return Multiply(*ratio, GetExpression(*node->input(1-n)->origin()));
+    }
+  }
+
+  if (jive::is<jive::bitshl_op>(node))
+  {
+    auto ratio = DecomposeMultiplicativeUpdate(*node->input(0)->origin(), argument);
+    auto shift = dynamic_cast<const ScevConstant*>(&GetExpression(*node->input(1)->origin()));
+    if (ratio == nullptr || shift == nullptr || shift->Value() < 0 || static_cast<size_t>(shift->Value()) >= numBits)
+      return nullptr;
+
+    return Multiply(*ratio, CreateConstant(numBits, SignExtend(uint64_t(1) << shift->Value(), numBits)));
+  }
+
+  return nullptr;
+}
+
+/**
+ * Folds the sum of \p lhs and \p rhs.
+ *
+ * @return The sum, or null if it cannot be expressed.
+ */
+const ScevExpression *
+ScalarEvolution::Add(const ScevExpression & lhs, const ScevExpression & rhs)
+{
+  auto lhsConstant = dynamic_cast<const ScevConstant*>(&lhs);
+  auto rhsConstant = dynamic_cast<const ScevConstant*>(&rhs);
+  if (lhsConstant && rhsConstant)
+    return &CreateConstant(lhs.NumBits(), SignExtend(uint64_t(lhsConstant->Value()) + rhsConstant->Value(), lhs.NumBits()));
+
+  if (lhsConstant && lhsConstant->Value() == 0)
+    return &rhs;
+
+  if (rhsConstant && rhsConstant->Value() == 0)
+    return &lhs;
+
+  auto lhsRecurrence = dynamic_cast<const ScevAddRecurrence*>(&lhs);
+  auto rhsRecurrence = dynamic_cast<const ScevAddRecurrence*>(&rhs);
+  if (lhsRecurrence && rhsRecurrence && &lhsRecurrence->ThetaNode() == &rhsRecurrence->ThetaNode())
+  {
+    auto numOperands = std::max(lhsRecurrence->Operands().size(), rhsRecurrence->Operands().size());
+    auto & zero = CreateConstant(lhs.NumBits(), 0);
+
+    std::vector<const ScevExpression*> operands;
+    for (size_t n = 0; n < numOperands; n++)
+    {
+      auto & lhsOperand = n < lhsRecurrence->Operands().size() ? lhsRecurrence->Operand(n) : zero;
+      auto & rhsOperand = n < rhsRecurrence->Operands().size() ? rhsRecurrence->Operand(n) : zero;
+      auto operand = Add(lhsOperand, rhsOperand);
+      if (operand == nullptr)
+        return nullptr;
+      operands.push_back(operand);
+    }
+
+    /*
+     * Drop trailing zero operands, e.g., {a,+,1} + {b,+,-1} = {a+b}.
+     */
+    while (operands.size() > 1)
+    {
+      auto constant = dynamic_cast<const ScevConstant*>(operands.back());
+      if (constant == nullptr || constant->Value() != 0)
+        break;
+      operands.pop_back();
+    }
+
+    if (operands.size() == 1)
+      return operands[0];
+
+    return &CreateAddRecurrence(lhsRecurrence->ThetaNode(), std::move(operands));
+  }
+
+  auto AddToStart = [&](const ScevAddRecurrence & recurrence, const ScevExpression & invariant)
+    -> const ScevExpression *
+  {
+    auto start = Add(recurrence.Operand(0), invariant);
+    if (start == nullptr)
+      return nullptr;
+
+    auto operands = recurrence.Operands();
+    operands[0] = start;
+    return &CreateAddRecurrence(recurrence.ThetaNode(), std::move(operands));
+  };
+
+  if (lhsRecurrence && IsInvariant(rhs, lhsRecurrence->ThetaNode()))
+    return AddToStart(*lhsRecurrence, rhs);
+
+  if (rhsRecurrence && IsInvariant(lhs, rhsRecurrence->ThetaNode()))
+    return AddToStart(*rhsRecurrence, lhs);
+
+  return nullptr;
+}
+
+/**
+ * Folds the product of \p lhs and \p rhs.
+ *
+ * @return The product, or null if it cannot be expressed.
+ */
+const ScevExpression *
+ScalarEvolution::Multiply(const ScevExpression & lhs, const ScevExpression & rhs)
+{
+  auto lhsConstant = dynamic_cast<const ScevConstant*>(&lhs);
+  auto rhsConstant = dynamic_cast<const ScevConstant*>(&rhs);
+  if (lhsConstant && rhsConstant)
+    return &CreateConstant(lhs.NumBits(), SignExtend(uint64_t(lhsConstant->Value()) * rhsConstant->Value(), lhs.NumBits()));
+
+  auto constant = lhsConstant ? lhsConstant : rhsConstant;
+  auto & other = lhsConstant ? rhs : lhs;
+  if (constant && constant->Value() == 0)
+    return constant;
+  if (constant && constant->Value() == 1)
+    return &other;
+
+  auto MultiplyRecurrence = [&](const ScevExpression & recurrence, const ScevExpression & invariant)
+    -> const ScevExpression *
+  {
+    if (auto addRecurrence = dynamic_cast<const ScevAddRecurrence*>(&recurrence))
+    {
+      std::vector<const ScevExpression*> operands;
+      for (auto & operand : addRecurrence->Operands())
+      {
+        auto product = Multiply(*operand, invariant);
+        if (product == nullptr)
+          return nullptr;
+        operands.push_back(product);
+      }
+
+      return &CreateAddRecurrence(addRecurrence->ThetaNode(), std::move(operands));
+    }
+
+    auto & mulRecurrence = *static_cast<const ScevMulRecurrence*>(&recurrence);
+    auto start = Multiply(mulRecurrence.Start(), invariant);
+    if (start == nullptr)
+      return nullptr;
+
+    return &CreateMulRecurrence(mulRecurrence.ThetaNode(), *start, mulRecurrence.Ratio());
+  };
+
+  auto ThetaNode = [](const ScevExpression & expression) -> const jive::theta_node *
+  {
+    if (auto addRecurrence = dynamic_cast<const ScevAddRecurrence*>(&expression))
+      return &addRecurrence->ThetaNode();
+
+    if (auto mulRecurrence = dynamic_cast<const ScevMulRecurrence*>(&expression))
+      return &mulRecurrence->ThetaNode();
+
+    return nullptr;
+  };
+
+  auto lhsThetaNode = ThetaNode(lhs);
+  if (lhsThetaNode && IsInvariant(rhs, *lhsThetaNode))
+    return MultiplyRecurrence(lhs, rhs);
+
+  auto rhsThetaNode = ThetaNode(rhs);
+  if (rhsThetaNode && IsInvariant(lhs, *rhsThetaNode))
+    return MultiplyRecurrence(rhs, lhs);
+
+  return nullptr;
+}
+
+bool
+ScalarEvolution::IsInvariant(const ScevExpression & expression, const jive::theta_node & thetaNode)
+{
+  switch (expression.GetKind())
+  {
+    case ScevExpression::Kind::Constant:
+      return true;
+
+    case ScevExpression::Kind::Unknown:
+    {
+      auto & unknown = *static_cast<const ScevUnknown*>(&expression);
+      return !IsContained(unknown.Output().region(), thetaNode.subregion());
+    }
+
+    case ScevExpression::Kind::AddRecurrence:
+    {
+      /*
+       * A recurrence of an enclosing theta node does not change within an iteration of the enclosing node.
+       */
+      auto & recurrence = static_cast<const ScevAddRecurrence&>(expression).ThetaNode();
+      return &recurrence != &thetaNode && IsContained(thetaNode.region(), recurrence.subregion());
+    }
+
+    case ScevExpression::Kind::MulRecurrence:
+    {
+      auto & recurrence = static_cast<const ScevMulRecurrence&>(expression).ThetaNode();
+      return &recurrence != &thetaNode && IsContained(thetaNode.region(), recurrence.subregion());
+    }
+  }
+
+  JLM_UNREACHABLE("Unhandled scalar evolution expression kind.");
+}
+
+std::optional<int64_t>
+ScalarEvolution::Evaluate(const ScevExpression & expression, uint64_t iteration)
+{
+  auto numBits = expression.NumBits();
+
+  if (auto constant = dynamic_cast<const ScevConstant*>(&expression))
+    return constant->Value();
+
+  if (auto recurrence = dynamic_cast<const ScevAddRecurrence*>(&expression))
+  {
+    uint64_t value = 0;
+    for (size_t n = 0; n < recurrence->Operands().size(); n++)
+    {
+      auto operand = dynamic_cast<const ScevConstant*>(&recurrence->Operand(n));
+      if (operand == nullptr)
+        return std::nullopt;
+
+      value += uint64_t(operand->Value()) * Binomial(iteration, n);
+    }
+
+    return SignExtend(value, numBits);
+  }
+
+  if (auto recurrence = dynamic_cast<const ScevMulRecurrence*>(&expression))
+  {
+    auto start = dynamic_cast<const ScevConstant*>(&recurrence->Start());
+    auto ratio = dynamic_cast<const ScevConstant*>(&recurrence->Ratio());
+    if (start == nullptr || ratio == nullptr)
+      return std::nullopt;
+
+    return SignExtend(uint64_t(start->Value()) * Power(ratio->Value(), iteration), numBits);
+  }
+
+  return std::nullopt;
+}
+
+/**
+ * The relation of a value to a bound under which a theta node repeats its body.
+ */
+enum class Relation
+{
+  LessThan,
+  LessEqual,
+  GreaterThan,
+  GreaterEqual,
+  Equal,
+  NotEqual
+};
+
+static Relation
+Swap(Relation relation)
+{
+  switch (relation)
+  {
+    case Relation::LessThan: return Relation::GreaterThan;
+    case Relation::LessEqual: return Relation::GreaterEqual;
+    case Relation::GreaterThan: return Relation::LessThan;
+    case Relation::GreaterEqual: return Relation::LessEqual;
+    default: return relation;
+  }
+}
+
+static Relation
+Negate(Relation relation)
+{
+  switch (relation)
+  {
+    case Relation::LessThan: return Relation::GreaterEqual;
+    case Relation::LessEqual: return Relation::GreaterThan;
+    case Relation::GreaterThan: return Relation::LessEqual;
+    case Relation::GreaterEqual: return Relation::LessThan;
+    case Relation::Equal: return Relation::NotEqual;
+    case Relation::NotEqual: return Relation::Equal;
+  }
+
+  JLM_UNREACHABLE("Unhandled relation.");
+}
+
+/**
+ * @return The relation and signedness of a bitstring comparison, or std::nullopt if \p operation is none.
+ */
+static std::optional<std::pair<Relation, bool>>
+GetRelation(const jive::operation & operation)
+{
+  if (dynamic_cast<const jive::bitslt_op*>(&operation)) return std::make_pair(Relation::LessThan, true);
+  if (dynamic_cast<const jive::bitsle_op*>(&operation)) return std::make_pair(Relation::LessEqual, true);
+  if (dynamic_cast<const jive::bitsgt_op*>(&operation)) return std::make_pair(Relation::GreaterThan, true);
+  if (dynamic_cast<const jive::bitsge_op*>(&operation)) return std::make_pair(Relation::GreaterEqual, true);
+  if (dynamic_cast<const jive::bitult_op*>(&operation)) return std::make_pair(Relation::LessThan, false);
+  if (dynamic_cast<const jive::bitule_op*>(&operation)) return std::make_pair(Relation::LessEqual, false);
+  if (dynamic_cast<const jive::bitugt_op*>(&operation)) return std::make_pair(Relation::GreaterThan, false);
+  if (dynamic_cast<const jive::bituge_op*>(&operation)) return std::make_pair(Relation::GreaterEqual, false);
+  if (dynamic_cast<const jive::biteq_op*>(&operation)) return std::make_pair(Relation::Equal, false);
+  if (dynamic_cast<const jive::bitne_op*>(&operation)) return std::make_pair(Relation::NotEqual, false);
+
+  return std::nullopt;
+}
+
+/**
+ * Computes the first iteration k >= 0 in which start + step * k does not stand in \p relation to \p bound.
+ *
+ * @return The iteration, or std::nullopt if there is no such iteration.
+ */
+static std::optional<int64_t>
+FindExitIteration(Relation relation, int64_t start, int64_t step, int64_t bound)
+{
+  /*
+   * Both operands are positive.
+   */
+  auto CeilDiv = [](int64_t dividend, int64_t divisor)
+  {
+    return dividend / divisor + (dividend % divisor != 0 ? 1 : 0);
+  };
+
+  /*
+   * The distances between start and bound, as well as the negated step, might not be representable.
+   */
+  int64_t distance = 0;
+
+  switch (relation)
+  {
+    case Relation::LessEqual:
+      if (bound == std::numeric_limits<int64_t>::max())
+        return std::nullopt;
+      bound++;
+      [[fallthrough]];
+    case Relation::LessThan:
+      if (start >= bound)
+        return 0;
+      if (step <= 0 || __builtin_sub_overflow(bound, start, &distance))
+        return std::nullopt;
+      return CeilDiv(distance, step);
+
+    case Relation::GreaterEqual:
+      if (bound == std::numeric_limits<int64_t>::min())
+        return std::nullopt;
+      bound--;
+      [[fallthrough]];
+    case Relation::GreaterThan:
+      if (start <= bound)
+        return 0;
+      if (step >= 0 || step == std::numeric_limits<int64_t>::min()
+          || __builtin_sub_overflow(start, bound, &distance))
+        return std::nullopt;
+      return CeilDiv(distance, -step);
+
+    case Relation::Equal:
+      if (start != bound)
+        return 0;
+      if (step == 0)
+        return std::nullopt;
+      return 1;
+
+    case Relation::NotEqual:
+      if (start == bound)
+        return 0;
+      if (step == 0 || __builtin_sub_overflow(bound, start, &distance)
+          || (step == -1 && distance == std::numeric_limits<int64_t>::min())
+          || distance % step != 0 || distance / step < 0)
+        return std::nullopt;
+      return distance / step;
+  }
+
+  JLM_UNREACHABLE("Unhandled relation.");
+}
+
+std::optional<uint64_t>
+ScalarEvolution::GetTripCount(const jive::theta_node & thetaNode)
+{
+  auto it = TripCounts_.find(&thetaNode);
+  if (it != TripCounts_.end())
+    return it->second;
+
+  /*
+   * Insert a placeholder first, as the computation might query the trip count of the same theta node again.
+   */
+  TripCounts_[&thetaNode] = std::nullopt;
+
+  auto ComputeTripCount = [&]() -> std::optional<uint64_t>
+  {
+    auto matchNode = jive::node_output::node(thetaNode.predicate()->origin());
+    auto matchOperation = matchNode ? dynamic_cast<const jive::match_op*>(&matchNode->operation()) : nullptr;
+    if (matchOperation == nullptr || matchOperation->nalternatives() != 2)
+      return std::nullopt;
+
+    auto continueOnTrue = matchOperation->alternative(1) == 1;
+    auto continueOnFalse = matchOperation->alternative(0) == 1;
+    if (!continueOnTrue && !continueOnFalse)
+      return 1;
+    if (continueOnTrue && continueOnFalse)
+      return std::nullopt;
+
+    auto compareNode = jive::node_output::node(matchNode->input(0)->origin());
+    auto relation = compareNode ? GetRelation(compareNode->operation()) : std::nullopt;
+    if (!relation)
+      return std::nullopt;
+
+    auto & lhs = GetExpression(*compareNode->input(0)->origin());
+    auto & rhs = GetExpression(*compareNode->input(1)->origin());
+
+    auto recurrence = dynamic_cast<const ScevAddRecurrence*>(&lhs);
+    auto bound = dynamic_cast<const ScevConstant*>(&rhs);
+    auto [rel, isSigned] = *relation;
+    if (recurrence == nullptr)
+    {
+      recurrence = dynamic_cast<const ScevAddRecurrence*>(&rhs);
+      bound = dynamic_cast<const ScevConstant*>(&lhs);
+      rel = Swap(rel);
+    }
+
+    if (recurrence == nullptr || bound == nullptr
+        || &recurrence->ThetaNode() != &thetaNode || !recurrence->IsAffine())
+      return std::nullopt;
+
+    auto start = dynamic_cast<const ScevConstant*>(&recurrence->Operand(0));
+    auto step = dynamic_cast<const ScevConstant*>(&recurrence->Operand(1));
+    if (start == nullptr || step == nullptr)
+      return std::nullopt;
+
+    if (!continueOnTrue)
+      rel = Negate(rel);
+
+    auto exitIteration = FindExitIteration(rel, start->Value(), step->Value(), bound->Value());
+    if (!exitIteration)
+      return std::nullopt;
+
+    /*
+     * The closed form is only valid if the value does not wrap around before the exit. As the value is monotonic, it
+     * suffices to check the first and the last value. Unsigned comparisons further require non-negative values.
+     */
+    auto [minValue, maxValue] = GetSignedBounds(recurrence->NumBits());
+    if (!isSigned)
+      minValue = 0;
+
+    auto last = static_cast<long double>(start->Value())
+              + static_cast<long double>(step->Value()) * static_cast<long double>(*exitIteration);
+    if (start->Value() < minValue || start->Value() > maxValue
+        || bound->Value() < minValue
+        || last < static_cast<long double>(minValue) || last > static_cast<long double>(maxValue))
+      return std::nullopt;
+
+    return static_cast<uint64_t>(*exitIteration) + 1;
+  };
+
+  auto tripCount = ComputeTripCount();
+  TripCounts_[&thetaNode] = tripCount;
+  return tripCount;
+}
+
+std::optional<std::pair<int64_t, int64_t>>
+ScalarEvolution::GetRange(const jive::output & output)
+{
+  auto & expression = GetExpression(output);
+  if (auto constant = dynamic_cast<const ScevConstant*>(&expression))
+    return std::make_pair(constant->Value(), constant->Value());
+
+  const jive::theta_node * thetaNode = nullptr;
+  bool isMonotonic = false;
+  if (auto recurrence = dynamic_cast<const ScevAddRecurrence*>(&expression))
+  {
+    thetaNode = &recurrence->ThetaNode();
+
+    /*
+     * A recurrence is monotonic if all of its steps have the same sign.
+     */
+    bool isNonNegative = true, isNonPositive = true;
+    for (size_t n = 1; n < recurrence->Operands().size(); n++)
+    {
+      auto operand = dynamic_cast<const ScevConstant*>(&recurrence->Operand(n));
+      if (operand == nullptr)
+        return std::nullopt;
+
+      isNonNegative &= operand->Value() >= 0;
+      isNonPositive &= operand->Value() <= 0;
+    }
+    isMonotonic = isNonNegative || isNonPositive;
+  }
+  else if (auto recurrence = dynamic_cast<const ScevMulRecurrence*>(&expression))
+  {
+    thetaNode = &recurrence->ThetaNode();
+
+    auto ratio = dynamic_cast<const ScevConstant*>(&recurrence->Ratio());
+    isMonotonic = ratio != nullptr && ratio->Value() >= 0;
+  }
+  else
+  {
+    return std::nullopt;
+  }
+
+  auto tripCount = GetTripCount(*thetaNode);
+  if (!tripCount)
+    return std::nullopt;
+
+  /*
+   * The values are computed without wrapping around, and the range is only known if none of them leaves the range of
+   * the bit width of the expression.
+   */
+  auto [minValue, maxValue] = GetSignedBounds(expression.NumBits());
+  auto IsRepresentable = [&, minValue = minValue, maxValue = maxValue](const std::optional<int64_t> & value)
+  {
+    return value && *value >= minValue && *value <= maxValue;
+  };
+
+  auto first = EvaluateExact(expression, 0);
+  auto last = EvaluateExact(expression, *tripCount - 1);
+  if (!IsRepresentable(first) || !IsRepresentable(last))
+    return std::nullopt;
+
+  /*
+   * The exact values of a monotonic recurrence lie between its first and its last value, so they are representable as
+   * well.
+   */
+  if (isMonotonic)
+    return std::make_pair(std::min(*first, *last), std::max(*first, *last));
+
+  /*
+   * Enumerate the values of short loops with non-monotonic recurrences.
+   */
+  static const uint64_t maxEnumeratedIterations = 1024;
+  if (*tripCount > maxEnumeratedIterations)
+    return std::nullopt;
+
+  auto range = std::make_pair(*first, *first);
+  for (uint64_t iteration = 1; iteration < *tripCount; iteration++)
+  {
+    auto value = EvaluateExact(expression, iteration);
+    if (!IsRepresentable(value))
+      return std::nullopt;
+
+    range.first = std::min(range.first, *value);
+    range.second = std::max(range.second, *value);
+  }
+
+  return range;
+}
+
+const ScevExpression &
+ScalarEvolution::CreateConstant(size_t numBits, int64_t value)
+{
+  Expressions_.push_back(std::make_unique<ScevConstant>(numBits, SignExtend(value, numBits)));
+  return *Expressions_.back();
+}
+
+const ScevExpression &
+ScalarEvolution::CreateUnknown(const jive::output & output)
+{
+  Expressions_.push_back(std::make_unique<ScevUnknown>(NumBits(output), output));
+  return *Expressions_.back();
+}
+
+const ScevExpression &
+ScalarEvolution::CreateAddRecurrence(
+  const jive::theta_node & thetaNode,
+  std::vector<const ScevExpression*> operands)
+{
+  Expressions_.push_back(std::make_unique<ScevAddRecurrence>(thetaNode, std::move(operands)));
+  return *Expressions_.back();
+}
+
+const ScevExpression &
+ScalarEvolution::CreateMulRecurrence(
+  const jive::theta_node & thetaNode,
+  const ScevExpression & start,
+  const ScevExpression & ratio)
+{
+  Expressions_.push_back(std::make_unique<ScevMulRecurrence>(thetaNode, start, ratio));
+  return *Expressions_.back();
+}
+
+}
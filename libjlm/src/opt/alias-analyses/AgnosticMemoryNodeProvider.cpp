@@ -19,7 +19,7 @@ public:
 private:
   AgnosticMemoryNodeProvisioning(
     const PointsToGraph & pointsToGraph,
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes)
+    PointsToGraph::MemoryNodeSet memoryNodes)
     : PointsToGraph_(pointsToGraph)
     , MemoryNodes_(std::move(memoryNodes))
   {}
@@ -41,47 +41,42 @@ public:
     return PointsToGraph_;
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetRegionEntryNodes(const jive::region & region) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetRegionExitNodes(const jive::region & region) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] HashSet<const PointsToGraph::MemoryNode*>
+  [[nodiscard]] PointsToGraph::MemoryNodeSet
   GetOutputNodes(const jive::output & output) const override
   {
     JLM_ASSERT(is<PointerType>(output.type()));
     auto & registerNode = PointsToGraph_.GetRegisterNode(output);
-
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes;
-    for (auto & memoryNode : registerNode.Targets())
-      memoryNodes.Insert(&memoryNode);
-
-    return memoryNodes;
+    return registerNode.GetTargetSet();
   }
 
   static std::unique_ptr<AgnosticMemoryNodeProvisioning>
   Create(
     const PointsToGraph & pointsToGraph,
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes)
+    PointsToGraph::MemoryNodeSet memoryNodes)
   {
     return std::unique_ptr<AgnosticMemoryNodeProvisioning>(new AgnosticMemoryNodeProvisioning(
       pointsToGraph,
@@ -90,7 +85,7 @@ public:
 
 private:
   const PointsToGraph & PointsToGraph_;
-  HashSet<const PointsToGraph::MemoryNode*> MemoryNodes_;
+  PointsToGraph::MemoryNodeSet MemoryNodes_;
 };
 
 AgnosticMemoryNodeProvider::~AgnosticMemoryNodeProvider()
@@ -105,13 +100,16 @@ AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
   auto statistics = Statistics::Create(statisticsCollector, pointsToGraph);
   statistics->StartCollecting();
 
-  HashSet<const PointsToGraph::MemoryNode*> memoryNodes;
+  PointsToGraph::MemoryNodeSet memoryNodes;
   for (auto & allocaNode : pointsToGraph.AllocaNodes())
     memoryNodes.Insert(&allocaNode);
 
   for (auto & deltaNode : pointsToGraph.DeltaNodes())
     memoryNodes.Insert(&deltaNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    memoryNodes.Insert(&fieldNode);
+
   for (auto & lambdaNode : pointsToGraph.LambdaNodes())
     memoryNodes.Insert(&lambdaNode);
 
@@ -0,0 +1,1275 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/structural-node.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/rvsdg/traverser.hpp>
+
+#include <jlm/ir/operators.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/types.hpp>
+#include <jlm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/util/SparseBitVector.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
+#include <jlm/util/time.hpp>
+
+#include <functional>
+#include <typeindex>
+#include <unordered_set>
+
+namespace jlm::aa {
+
+/** \brief Constraint set of the Andersen analysis
+ *
+ * A constraint variable stands for a points-to set, which is either the one of a register or the one of the content of
+ * an abstract memory object. Every object has exactly one content variable. The constraints are:
+ *
+ * - Base: p ⊇ {o}
+ * - Copy: p ⊇ q
+ * - Load: p ⊇ *q, i.e., p ⊇ content(o) for all objects o in the points-to set of q
+ * - Store: *p ⊇ q, i.e., content(o) ⊇ q for all objects o in the points-to set of p
+ *
+ * Copy constraints are the edges of the constraint graph. Load and store constraints add further edges while the
+ * constraints are solved.
+ */
+class ConstraintSet final {
+public:
+  using Variable = uint32_t;
+  using Object = uint32_t;
+
+  enum class ObjectKind : uint8_t {
+    Alloca,
+    Malloc,
+    Lambda,
+    Delta,
+    Import,
+    External,
+    Unknown
+  };
+
+  ConstraintSet()
+    : NumBaseConstraints_(0)
+    , NumCopyConstraints_(0)
+    , NumLoadConstraints_(0)
+    , NumStoreConstraints_(0)
+    , NumCollapsedVariables_(0)
+    , NumVisitedVariables_(0)
+  {
+    /*
+     * External memory contains pointers to external memory. External code can load every pointer that is stored in
+     * external memory, and can store every such pointer into every memory object it can reach.
+     */
+    ExternalObject_ = CreateObject(ObjectKind::External, nullptr);
+    auto externalContent = GetContentVariable(ExternalObject_);
+    AddBase(externalContent, ExternalObject_);
+    AddLoad(externalContent, externalContent);
+    AddStore(externalContent, externalContent);
+
+    UnknownObject_ = CreateObject(ObjectKind::Unknown, nullptr);
+    AddBase(GetContentVariable(UnknownObject_), UnknownObject_);
+  }
+
+  ConstraintSet(const ConstraintSet &) = delete;
+
+  ConstraintSet &
+  operator=(const ConstraintSet &) = delete;
+
+  [[nodiscard]] size_t
+  NumVariables() const noexcept
+  {
+    return Parents_.size();
+  }
+
+  [[nodiscard]] size_t
+  NumObjects() const noexcept
+  {
+    return ObjectKinds_.size();
+  }
+
+  [[nodiscard]] Object
+  GetExternalObject() const noexcept
+  {
+    return ExternalObject_;
+  }
+
+  [[nodiscard]] Object
+  GetUnknownObject() const noexcept
+  {
+    return UnknownObject_;
+  }
+
+  [[nodiscard]] ObjectKind
+  GetObjectKind(Object object) const noexcept
+  {
+    return ObjectKinds_[object];
+  }
+
+  [[nodiscard]] const jive::output &
+  GetObjectOutput(Object object) const noexcept
+  {
+    return *ObjectOutputs_[object];
+  }
+
+  [[nodiscard]] Variable
+  GetContentVariable(Object object) const noexcept
+  {
+    return ObjectContents_[object];
+  }
+
+  [[nodiscard]] Variable
+  GetExternalContent() const noexcept
+  {
+    return GetContentVariable(ExternalObject_);
+  }
+
+  [[nodiscard]] const std::vector<std::pair<const jive::output*, Variable>> &
+  GetRegisterVariables() const noexcept
+  {
+    return RegisterVariables_;
+  }
+
+  Variable
+  CreateVariable()
+  {
+    auto variable = static_cast<Variable>(NumVariables());
+    Parents_.push_back(variable);
+    Ranks_.push_back(0);
+    PointsToSets_.emplace_back();
+    PropagatedSets_.emplace_back();
+    Successors_.emplace_back();
+    Loads_.emplace_back();
+    Stores_.emplace_back();
+
+    return variable;
+  }
+
+  /**
+   * @return The variable of register \p output. The variable is created if it does not exist yet.
+   */
+  Variable
+  GetOrCreateRegisterVariable(const jive::output & output)
+  {
+    if (auto it = RegisterMap_.find(&output); it != RegisterMap_.end())
+      return it->second;
+
+    auto variable = CreateVariable();
+    RegisterMap_[&output] = variable;
+    RegisterVariables_.emplace_back(&output, variable);
+
+    return variable;
+  }
+
+  [[nodiscard]] bool
+  HasRegisterVariable(const jive::output & output) const noexcept
+  {
+    return RegisterMap_.find(&output) != RegisterMap_.end();
+  }
+
+  Object
+  CreateObject(ObjectKind kind, const jive::output * output)
+  {
+    auto object = static_cast<Object>(NumObjects());
+    ObjectKinds_.push_back(kind);
+    ObjectOutputs_.push_back(output);
+    ObjectContents_.push_back(CreateVariable());
+
+    return object;
+  }
+
+  void
+  AddBase(Variable variable, Object object)
+  {
+    NumBaseConstraints_++;
+    PointsToSets_[variable].Insert(object);
+  }
+
+  /**
+   * Adds the constraint \p destination ⊇ \p source.
+   */
+  void
+  AddCopy(Variable destination, Variable source)
+  {
+    NumCopyConstraints_++;
+    Successors_[source].Insert(destination);
+  }
+
+  /**
+   * Adds the constraint \p destination ⊇ *\p address.
+   */
+  void
+  AddLoad(Variable destination, Variable address)
+  {
+    NumLoadConstraints_++;
+    Loads_[address].push_back(destination);
+  }
+
+  /**
+   * Adds the constraint *\p address ⊇ \p source.
+   */
+  void
+  AddStore(Variable address, Variable source)
+  {
+    NumStoreConstraints_++;
+    Stores_[address].push_back(source);
+  }
+
+  /**
+   * Adds the constraint that \p variable escapes the module, i.e., that it is stored in external memory.
+   */
+  void
+  AddEscape(Variable variable)
+  {
+    AddCopy(GetExternalContent(), variable);
+  }
+
+  /**
+   * Adds the constraint that \p variable enters the module, i.e., that it is loaded from external memory.
+   */
+  void
+  AddEntry(Variable variable)
+  {
+    AddCopy(variable, GetExternalContent());
+  }
+
+  [[nodiscard]] const SparseBitVector &
+  GetPointsToSet(Variable variable) noexcept
+  {
+    return PointsToSets_[Find(variable)];
+  }
+
+  void
+  Solve();
+
+  [[nodiscard]] size_t
+  NumBaseConstraints() const noexcept
+  {
+    return NumBaseConstraints_;
+  }
+
+  [[nodiscard]] size_t
+  NumCopyConstraints() const noexcept
+  {
+    return NumCopyConstraints_;
+  }
+
+  [[nodiscard]] size_t
+  NumLoadConstraints() const noexcept
+  {
+    return NumLoadConstraints_;
+  }
+
+  [[nodiscard]] size_t
+  NumStoreConstraints() const noexcept
+  {
+    return NumStoreConstraints_;
+  }
+
+  /**
+   * @return The number of variables that were collapsed into other variables by cycle detection.
+   */
+  [[nodiscard]] size_t
+  NumCollapsedVariables() const noexcept
+  {
+    return NumCollapsedVariables_;
+  }
+
+  /**
+   * @return The number of times a variable was taken from the worklist and its points-to set propagated.
+   */
+  [[nodiscard]] size_t
+  NumVisitedVariables() const noexcept
+  {
+    return NumVisitedVariables_;
+  }
+
+private:
+  Variable
+  Find(Variable variable) noexcept
+  {
+    while (Parents_[variable] != variable) {
+      Parents_[variable] = Parents_[Parents_[variable]];
+      variable = Parents_[variable];
+    }
+
+    return variable;
+  }
+
+  void
+  Push(Variable variable)
+  {
+    if (OnWorklist_[variable])
+      return;
+
+    OnWorklist_[variable] = true;
+    Worklist_.push_back(variable);
+  }
+
+  /**
+   * Adds the edge \p source -> \p destination to the constraint graph and propagates the points-to set of \p source
+   * along it. Both variables must be representatives.
+   */
+  void
+  AddEdge(Variable source, Variable destination)
+  {
+    if (source == destination || !Successors_[source].Insert(destination))
+      return;
+
+    if (PointsToSets_[destination].UnionWith(PointsToSets_[source]))
+      Push(destination);
+  }
+
+  /**
+   * Collapses \p variable1 and \p variable2, which must be representatives, into a single variable.
+   *
+   * @return The representative of the collapsed variable.
+   */
+  Variable
+  Unify(Variable variable1, Variable variable2);
+
+  /**
+   * Detects all cycles of copy edges that are reachable from \p variable and collapses them.
+   */
+  void
+  CollapseCycles(Variable variable);
+
+  std::vector<Variable> Parents_;
+  std::vector<uint8_t> Ranks_;
+  std::vector<SparseBitVector> PointsToSets_;
+
+  /**
+   * The part of the points-to set of a variable that was already propagated to its successors and processed for its
+   * load and store constraints.
+   */
+  std::vector<SparseBitVector> PropagatedSets_;
+
+  std::vector<SparseBitVector> Successors_;
+  std::vector<std::vector<Variable>> Loads_;
+  std::vector<std::vector<Variable>> Stores_;
+
+  std::vector<ObjectKind> ObjectKinds_;
+  std::vector<const jive::output*> ObjectOutputs_;
+  std::vector<Variable> ObjectContents_;
+  Object ExternalObject_;
+  Object UnknownObject_;
+
+  std::unordered_map<const jive::output*, Variable> RegisterMap_;
+  std::vector<std::pair<const jive::output*, Variable>> RegisterVariables_;
+
+  std::vector<Variable> Worklist_;
+  std::vector<bool> OnWorklist_;
+
+  /**
+   * The edges that already triggered a cycle detection.
+   */
+  std::unordered_set<uint64_t> CheckedEdges_;
+
+  size_t NumBaseConstraints_;
+  size_t NumCopyConstraints_;
+  size_t NumLoadConstraints_;
+  size_t NumStoreConstraints_;
+  size_t NumCollapsedVariables_;
+  size_t NumVisitedVariables_;
+};
+
+ConstraintSet::Variable
+ConstraintSet::Unify(Variable variable1, Variable variable2)
+{
+  JLM_ASSERT(Find(variable1) == variable1 && Find(variable2) == variable2);
+  if (variable1 == variable2)
+    return variable1;
+
+  if (Ranks_[variable1] < Ranks_[variable2])
+    std::swap(variable1, variable2);
+
+  Parents_[variable2] = variable1;
+  if (Ranks_[variable1] == Ranks_[variable2])
+    Ranks_[variable1]++;
+
+  /*
+   * An object was only propagated by the collapsed variable if it was propagated by both variables.
+   */
+  PointsToSets_[variable1].UnionWith(PointsToSets_[variable2]);
+  PropagatedSets_[variable1].IntersectWith(PropagatedSets_[variable2]);
+  Successors_[variable1].UnionWith(Successors_[variable2]);
+
+  auto & loads = Loads_[variable1];
+  loads.insert(loads.end(), Loads_[variable2].begin(), Loads_[variable2].end());
+  auto & stores = Stores_[variable1];
+  stores.insert(stores.end(), Stores_[variable2].begin(), Stores_[variable2].end());
+
+  PointsToSets_[variable2] = {};
+  PropagatedSets_[variable2] = {};
+  Successors_[variable2] = {};
+  Loads_[variable2] = {};
+  Stores_[variable2] = {};
+
+  NumCollapsedVariables_++;
+  Push(variable1);
+
+  return variable1;
+}
+
+void
+ConstraintSet::CollapseCycles(Variable root)
+{
+  /*
+   * Iterative version of Tarjan's strongly connected component algorithm over the copy edges between representatives.
+   */
+  struct Frame {
+    Variable Node;
+    std::vector<Variable> Successors;
+    size_t Position;
+  };
+
+  std::unordered_map<Variable, size_t> indices;
+  std::unordered_map<Variable, size_t> lowLinks;
+  std::unordered_set<Variable> onStack;
+  std::vector<Variable> stack;
+  std::vector<std::vector<Variable>> components;
+
+  auto Visit = [&](Variable variable, std::vector<Frame> & frames)
+  {
+    auto index = indices.size();
+    indices[variable] = index;
+    lowLinks[variable] = index;
+    stack.push_back(variable);
+    onStack.insert(variable);
+
+    std::vector<Variable> successors;
+    for (auto successor : Successors_[variable].Items()) {
+      auto representative = Find(successor);
+      if (representative != variable)
+        successors.push_back(representative);
+    }
+
+    frames.push_back({variable, std::move(successors), 0});
+  };
+
+  std::vector<Frame> frames;
+  Visit(root, frames);
+  while (!frames.empty()) {
+    auto & frame = frames.back();
+    if (frame.Position < frame.Successors.size()) {
+      auto successor = frame.Successors[frame.Position++];
+      if (indices.find(successor) == indices.end()) {
+        Visit(successor, frames);
+      } else if (onStack.find(successor) != onStack.end()) {
+        lowLinks[frame.Node] = std::min(lowLinks[frame.Node], indices[successor]);
+      }
+      continue;
+    }
+
+    auto node = frame.Node;
+    frames.pop_back();
+    if (!frames.empty())
+      lowLinks[frames.back().Node] = std::min(lowLinks[frames.back().Node], lowLinks[node]);
+
+    if (lowLinks[node] != indices[node])
+      continue;
+
+    std::vector<Variable> component;
+    Variable member;
+    do {
+      member = stack.back();
+      stack.pop_back();
+      onStack.erase(member);
+      component.push_back(member);
+    } while (member != node);
+
+    if (component.size() > 1)
+      components.push_back(std::move(component));
+  }
+
+  for (auto & component : components) {
+    auto representative = component[0];
+    for (size_t n = 1; n < component.size(); n++)
+      representative = Unify(representative, component[n]);
+  }
+}
+
+void
+ConstraintSet::Solve()
+{
+  OnWorklist_.assign(NumVariables(), false);
+  for (Variable variable = 0; variable < NumVariables(); variable++) {
+    if (Find(variable) == variable && !PointsToSets_[variable].IsEmpty())
+      Push(variable);
+  }
+
+  while (!Worklist_.empty()) {
+    auto variable = Worklist_.back();
+    Worklist_.pop_back();
+    OnWorklist_[variable] = false;
+
+    /*
+     * The variable might have been collapsed into another variable after it was pushed.
+     */
+    if (Find(variable) != variable)
+      continue;
+
+    auto difference = SparseBitVector::Difference(PointsToSets_[variable], PropagatedSets_[variable]);
+    if (difference.IsEmpty())
+      continue;
+
+    NumVisitedVariables_++;
+    PropagatedSets_[variable] = PointsToSets_[variable];
+
+    for (auto object : difference.Items()) {
+      /*
+       * Functions have no content that could be loaded or stored.
+       */
+      if (ObjectKinds_[object] == ObjectKind::Lambda)
+        continue;
+
+      auto content = Find(ObjectContents_[object]);
+
+      for (auto destination : Loads_[variable])
+        AddEdge(content, Find(destination));
+
+      for (auto source : Stores_[variable])
+        AddEdge(Find(source), content);
+    }
+
+    /*
+     * Lazy cycle detection: A successor with the same points-to set after propagation hints at a cycle.
+     */
+    bool detectCycles = false;
+    for (auto successor : Successors_[variable].Items()) {
+      auto representative = Find(successor);
+      if (representative == variable)
+        continue;
+
+      if (PointsToSets_[representative].UnionWith(difference))
+        Push(representative);
+
+      if (PointsToSets_[representative] == PointsToSets_[variable]) {
+        auto edge = (uint64_t(variable) << 32) | representative;
+        detectCycles |= CheckedEdges_.insert(edge).second;
+      }
+    }
+
+    if (detectCycles)
+      CollapseCycles(variable);
+  }
+}
+
+/** \brief Andersen analysis statistics class
+ *
+ */
+class AndersenAnalysisStatistics final : public Statistics {
+public:
+  ~AndersenAnalysisStatistics() override = default;
+
+  explicit
+  AndersenAnalysisStatistics(jlm::filepath sourceFile)
+    : Statistics(Statistics::Id::AndersenAnalysis)
+    , SourceFile_(std::move(sourceFile))
+    , NumRvsdgNodes_(0)
+    , NumVariables_(0)
+    , NumObjects_(0)
+    , NumBaseConstraints_(0)
+    , NumCopyConstraints_(0)
+    , NumLoadConstraints_(0)
+    , NumStoreConstraints_(0)
+    , NumCollapsedVariables_(0)
+    , NumVisitedVariables_(0)
+    , NumPointsToSetElements_(0)
+    , MaxPointsToSetSize_(0)
+    , NumPointsToSetBytes_(0)
+    , NumPointsToGraphNodes_(0)
+  {}
+
+  void
+  StartConstraintCollection(const jive::graph & graph) noexcept
+  {
+    NumRvsdgNodes_ = jive::nnodes(graph.root());
+    ConstraintTimer_.start();
+  }
+
+  void
+  StopConstraintCollection(const ConstraintSet & constraints) noexcept
+  {
+    ConstraintTimer_.stop();
+    NumVariables_ = constraints.NumVariables();
+    NumObjects_ = constraints.NumObjects();
+    NumBaseConstraints_ = constraints.NumBaseConstraints();
+    NumCopyConstraints_ = constraints.NumCopyConstraints();
+    NumLoadConstraints_ = constraints.NumLoadConstraints();
+    NumStoreConstraints_ = constraints.NumStoreConstraints();
+  }
+
+  void
+  StartSolving() noexcept
+  {
+    SolveTimer_.start();
+  }
+
+  void
+  StopSolving(ConstraintSet & constraints) noexcept
+  {
+    SolveTimer_.stop();
+    NumCollapsedVariables_ = constraints.NumCollapsedVariables();
+    NumVisitedVariables_ = constraints.NumVisitedVariables();
+
+    for (ConstraintSet::Variable variable = 0; variable < constraints.NumVariables(); variable++) {
+      auto & pointsToSet = constraints.GetPointsToSet(variable);
+      auto size = pointsToSet.Size();
+      NumPointsToSetElements_ += size;
+      MaxPointsToSetSize_ = std::max(MaxPointsToSetSize_, size);
+      NumPointsToSetBytes_ += pointsToSet.NumBytes();
+    }
+  }
+
+  void
+  StartPointsToGraphConstruction() noexcept
+  {
+    PointsToGraphTimer_.start();
+  }
+
+  void
+  StopPointsToGraphConstruction(const PointsToGraph & pointsToGraph) noexcept
+  {
+    PointsToGraphTimer_.stop();
+    NumPointsToGraphNodes_ = pointsToGraph.NumNodes();
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return strfmt("AndersenAnalysis ",
+                  SourceFile_.to_str(), " ",
+                  "#RvsdgNodes:", NumRvsdgNodes_, " ",
+                  "#Variables:", NumVariables_, " ",
+                  "#Objects:", NumObjects_, " ",
+                  "#BaseConstraints:", NumBaseConstraints_, " ",
+                  "#CopyConstraints:", NumCopyConstraints_, " ",
+                  "#LoadConstraints:", NumLoadConstraints_, " ",
+                  "#StoreConstraints:", NumStoreConstraints_, " ",
+                  "#CollapsedVariables:", NumCollapsedVariables_, " ",
+                  "#VisitedVariables:", NumVisitedVariables_, " ",
+                  "#PointsToSetElements:", NumPointsToSetElements_, " ",
+                  "MaxPointsToSetSize:", MaxPointsToSetSize_, " ",
+                  "PointsToSetMemory[b]:", NumPointsToSetBytes_, " ",
+                  "#PointsToGraphNodes:", NumPointsToGraphNodes_, " ",
+                  "ConstraintTime[ns]:", ConstraintTimer_.ns(), " ",
+                  "SolveTime[ns]:", SolveTimer_.ns(), " ",
+                  "PointsToGraphTime[ns]:", PointsToGraphTimer_.ns());
+  }
+
+  static std::unique_ptr<AndersenAnalysisStatistics>
+  Create(const jlm::filepath & sourceFile)
+  {
+    return std::make_unique<AndersenAnalysisStatistics>(sourceFile);
+  }
+
+private:
+  jlm::filepath SourceFile_;
+
+  size_t NumRvsdgNodes_;
+  size_t NumVariables_;
+  size_t NumObjects_;
+  size_t NumBaseConstraints_;
+  size_t NumCopyConstraints_;
+  size_t NumLoadConstraints_;
+  size_t NumStoreConstraints_;
+  size_t NumCollapsedVariables_;
+  size_t NumVisitedVariables_;
+  size_t NumPointsToSetElements_;
+  size_t MaxPointsToSetSize_;
+  size_t NumPointsToSetBytes_;
+  size_t NumPointsToGraphNodes_;
+
+  jlm::timer ConstraintTimer_;
+  jlm::timer SolveTimer_;
+  jlm::timer PointsToGraphTimer_;
+};
+
+static bool
+IsVaListAlloca(const jive::valuetype & type)
+{
+  auto structType = dynamic_cast<const StructType*>(&type);
+
+  if (structType != nullptr
+      && structType->GetName() == "struct.__va_list_tag")
+    return true;
+
+  if (structType != nullptr) {
+    auto & declaration = structType->GetDeclaration();
+
+    for (size_t n = 0; n < declaration.nelements(); n++) {
+      if (IsVaListAlloca(declaration.element(n)))
+        return true;
+    }
+  }
+
+  if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    return IsVaListAlloca(arrayType->element_type());
+
+  return false;
+}
+
+static std::unique_ptr<PointsToGraph>
+ConstructPointsToGraph(ConstraintSet & constraints)
+{
+  using ObjectKind = ConstraintSet::ObjectKind;
+
+  auto pointsToGraph = PointsToGraph::Create();
+
+  std::vector<PointsToGraph::MemoryNode*> memoryNodes(constraints.NumObjects());
+  for (ConstraintSet::Object object = 0; object < constraints.NumObjects(); object++) {
+    switch (constraints.GetObjectKind(object)) {
+      case ObjectKind::Alloca:
+        memoryNodes[object] = &PointsToGraph::AllocaNode::Create(
+          *pointsToGraph,
+          *jive::node_output::node(&constraints.GetObjectOutput(object)));
+        break;
+      case ObjectKind::Malloc:
+        memoryNodes[object] = &PointsToGraph::MallocNode::Create(
+          *pointsToGraph,
+          *jive::node_output::node(&constraints.GetObjectOutput(object)));
+        break;
+      case ObjectKind::Lambda:
+        memoryNodes[object] = &PointsToGraph::LambdaNode::Create(
+          *pointsToGraph,
+          *AssertedCast<const lambda::node>(jive::node_output::node(&constraints.GetObjectOutput(object))));
+        break;
+      case ObjectKind::Delta:
+        memoryNodes[object] = &PointsToGraph::DeltaNode::Create(
+          *pointsToGraph,
+          *AssertedCast<const delta::node>(jive::node_output::node(&constraints.GetObjectOutput(object))));
+        break;
+      case ObjectKind::Import:
+        memoryNodes[object] = &PointsToGraph::ImportNode::Create(
+          *pointsToGraph,
+          *AssertedCast<const jive::argument>(&constraints.GetObjectOutput(object)));
+        break;
+      case ObjectKind::External:
+        memoryNodes[object] = &pointsToGraph->GetExternalMemoryNode();
+        break;
+      case ObjectKind::Unknown:
+        memoryNodes[object] = &pointsToGraph->GetUnknownMemoryNode();
+        break;
+      default:
+        JLM_UNREACHABLE("Unhandled object kind.");
+    }
+  }
+
+  for (auto & [output, variable] : constraints.GetRegisterVariables()) {
+    auto & registerNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, *output);
+    for (auto object : constraints.GetPointsToSet(variable).Items())
+      registerNode.AddEdge(*memoryNodes[object]);
+  }
+
+  auto IsModuleObject = [&](ConstraintSet::Object object)
+  {
+    auto kind = constraints.GetObjectKind(object);
+    return kind != ObjectKind::External && kind != ObjectKind::Unknown;
+  };
+
+  for (ConstraintSet::Object object = 0; object < constraints.NumObjects(); object++) {
+    if (!IsModuleObject(object))
+      continue;
+
+    for (auto target : constraints.GetPointsToSet(constraints.GetContentVariable(object)).Items())
+      memoryNodes[object]->AddEdge(*memoryNodes[target]);
+  }
+
+  for (auto object : constraints.GetPointsToSet(constraints.GetExternalContent()).Items()) {
+    if (IsModuleObject(object))
+      memoryNodes[object]->MarkAsModuleEscaping();
+  }
+
+  return pointsToGraph;
+}
+
+Andersen::~Andersen() noexcept
+= default;
+
+Andersen::Andersen()
+= default;
+
+void
+Andersen::AnalyzeSimpleNode(const jive::simple_node & node)
+{
+  auto AnalyzeCall  = [](auto & a, auto & n) { a.AnalyzeCall(*AssertedCast<const CallNode>(&n)); };
+  auto AnalyzeLoad  = [](auto & a, auto & n) { a.AnalyzeLoad(*AssertedCast<const LoadNode>(&n)); };
+  auto AnalyzeStore = [](auto & a, auto & n) { a.AnalyzeStore(*AssertedCast<const StoreNode>(&n)); };
+
+  auto AnalyzeCopy = [](Andersen & a, const jive::simple_node & n)
+  {
+    auto & constraints = *a.Constraints_;
+    if (!is<PointerType>(n.input(0)->type()))
+      return;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*n.output(0)),
+      constraints.GetOrCreateRegisterVariable(*n.input(0)->origin()));
+  };
+
+  /*
+   * FIXME: Have a look at these operations again to ensure that the points-to sets add up.
+   */
+  auto AnalyzeUnknown = [](Andersen & a, const jive::simple_node & n)
+  {
+    auto & constraints = *a.Constraints_;
+    if (!is<PointerType>(n.output(0)->type()))
+      return;
+
+    auto variable = constraints.GetOrCreateRegisterVariable(*n.output(0));
+    constraints.AddBase(variable, constraints.GetUnknownObject());
+    constraints.AddBase(variable, constraints.GetExternalObject());
+  };
+
+  /*
+   * These operations cannot point to any memory location. We therefore only create a variable for them.
+   */
+  auto AnalyzeNull = [](Andersen & a, const jive::simple_node & n)
+  {
+    if (IsOrContains<PointerType>(n.output(0)->type()))
+      a.Constraints_->GetOrCreateRegisterVariable(*n.output(0));
+  };
+
+  static std::unordered_map<
+    std::type_index
+    , std::function<void(Andersen&, const jive::simple_node&)>> nodes
+    ({
+         {typeid(alloca_op),                    [](auto & a, auto & n){ a.AnalyzeAlloca(n);    }}
+       , {typeid(malloc_op),                    [](auto & a, auto & n){ a.AnalyzeMalloc(n);    }}
+       , {typeid(LoadOperation),                AnalyzeLoad                                     }
+       , {typeid(StoreOperation),               AnalyzeStore                                    }
+       , {typeid(CallOperation),                AnalyzeCall                                     }
+       , {typeid(getelementptr_op),             AnalyzeCopy                                     }
+       , {typeid(bitcast_op),                   AnalyzeCopy                                     }
+       , {typeid(bits2ptr_op),                  AnalyzeUnknown                                  }
+       , {typeid(ExtractValue),                 AnalyzeUnknown                                  }
+       , {typeid(ConstantPointerNullOperation), AnalyzeNull                                     }
+       , {typeid(UndefValueOperation),          AnalyzeNull                                     }
+       , {typeid(ConstantAggregateZero),        AnalyzeNull                                     }
+       , {typeid(Memcpy),                       [](auto & a, auto & n){ a.AnalyzeMemcpy(n);    }}
+       , {typeid(ConstantArray),                [](auto & a, auto & n){ a.AnalyzeAggregate(n); }}
+       , {typeid(ConstantStruct),               [](auto & a, auto & n){ a.AnalyzeAggregate(n); }}
+     });
+
+  auto & op = node.operation();
+  if (auto it = nodes.find(typeid(op)); it != nodes.end()) {
+    it->second(*this, node);
+    return;
+  }
+
+  /*
+    Ensure that we really took care of all pointer-producing instructions
+  */
+  for (size_t n = 0; n < node.noutputs(); n++) {
+    if (jive::is<PointerType>(node.output(n)->type()))
+      JLM_UNREACHABLE("We should have never reached this statement.");
+  }
+}
+
+void
+Andersen::AnalyzeAlloca(const jive::simple_node & node)
+{
+  JLM_ASSERT(is<alloca_op>(&node));
+  auto & constraints = *Constraints_;
+
+  auto object = constraints.CreateObject(ConstraintSet::ObjectKind::Alloca, node.output(0));
+  constraints.AddBase(constraints.GetOrCreateRegisterVariable(*node.output(0)), object);
+
+  /*
+   * FIXME: We should be able to do better than just pointing to unknown.
+   */
+  auto & op = *AssertedCast<const alloca_op>(&node.operation());
+  if (IsVaListAlloca(op.value_type()))
+    constraints.AddBase(constraints.GetContentVariable(object), constraints.GetUnknownObject());
+}
+
+void
+Andersen::AnalyzeMalloc(const jive::simple_node & node)
+{
+  JLM_ASSERT(is<malloc_op>(&node));
+  auto & constraints = *Constraints_;
+
+  auto object = constraints.CreateObject(ConstraintSet::ObjectKind::Malloc, node.output(0));
+  constraints.AddBase(constraints.GetOrCreateRegisterVariable(*node.output(0)), object);
+}
+
+void
+Andersen::AnalyzeLoad(const LoadNode & loadNode)
+{
+  auto & constraints = *Constraints_;
+  if (!is<PointerType>(loadNode.GetValueOutput()->type()))
+    return;
+
+  constraints.AddLoad(
+    constraints.GetOrCreateRegisterVariable(*loadNode.GetValueOutput()),
+    constraints.GetOrCreateRegisterVariable(*loadNode.GetAddressInput()->origin()));
+}
+
+void
+Andersen::AnalyzeStore(const StoreNode & storeNode)
+{
+  auto & constraints = *Constraints_;
+  auto & value = *storeNode.GetValueInput()->origin();
+  if (!is<PointerType>(value.type()))
+    return;
+
+  constraints.AddStore(
+    constraints.GetOrCreateRegisterVariable(*storeNode.GetAddressInput()->origin()),
+    constraints.GetOrCreateRegisterVariable(value));
+}
+
+void
+Andersen::AnalyzeCall(const CallNode & callNode)
+{
+  auto & constraints = *Constraints_;
+
+  auto AnalyzeDirectCall = [&](const lambda::node & lambda)
+  {
+    /*
+      FIXME: What about varargs
+    */
+    JLM_ASSERT(lambda.nfctarguments() == callNode.ninputs() - 1);
+    for (size_t n = 1; n < callNode.ninputs(); n++) {
+      auto & callArgument = *callNode.input(n)->origin();
+      if (!is<PointerType>(callArgument.type()))
+        continue;
+
+      constraints.AddCopy(
+        constraints.GetOrCreateRegisterVariable(*lambda.fctargument(n-1)),
+        constraints.GetOrCreateRegisterVariable(callArgument));
+    }
+
+    auto subregion = lambda.subregion();
+    JLM_ASSERT(subregion->nresults() == callNode.noutputs());
+    for (size_t n = 0; n < callNode.noutputs(); n++) {
+      auto & callResult = *callNode.output(n);
+      if (!is<PointerType>(callResult.type()))
+        continue;
+
+      constraints.AddCopy(
+        constraints.GetOrCreateRegisterVariable(callResult),
+        constraints.GetOrCreateRegisterVariable(*subregion->result(n)->origin()));
+    }
+  };
+
+  /*
+   * The callee of external and indirect calls is unknown. All pointer arguments escape the module and all pointer
+   * results enter the module.
+   */
+  auto AnalyzeUnknownCall = [&]()
+  {
+    for (size_t n = 1; n < callNode.NumArguments(); n++) {
+      auto & callArgument = *callNode.input(n)->origin();
+      if (is<PointerType>(callArgument.type()))
+        constraints.AddEscape(constraints.GetOrCreateRegisterVariable(callArgument));
+    }
+
+    for (size_t n = 0; n < callNode.NumResults(); n++) {
+      auto & callResult = *callNode.Result(n);
+      if (is<PointerType>(callResult.type()))
+        constraints.AddEntry(constraints.GetOrCreateRegisterVariable(callResult));
+    }
+  };
+
+  auto callTypeClassifier = CallNode::ClassifyCall(callNode);
+  switch (callTypeClassifier->GetCallType())
+  {
+    case CallTypeClassifier::CallType::NonRecursiveDirectCall:
+    case CallTypeClassifier::CallType::RecursiveDirectCall:
+      AnalyzeDirectCall(*callTypeClassifier->GetLambdaOutput().node());
+      break;
+    case CallTypeClassifier::CallType::ExternalCall:
+    case CallTypeClassifier::CallType::IndirectCall:
+      AnalyzeUnknownCall();
+      break;
+    default:
+      JLM_UNREACHABLE("Unhandled call type.");
+  }
+}
+
+void
+Andersen::AnalyzeMemcpy(const jive::simple_node & node)
+{
+  JLM_ASSERT(is<Memcpy>(&node));
+  auto & constraints = *Constraints_;
+
+  /*
+   * The content of the destination includes the content of the source: *dst ⊇ *src
+   */
+  auto content = constraints.CreateVariable();
+  constraints.AddLoad(content, constraints.GetOrCreateRegisterVariable(*node.input(1)->origin()));
+  constraints.AddStore(constraints.GetOrCreateRegisterVariable(*node.input(0)->origin()), content);
+}
+
+void
+Andersen::AnalyzeAggregate(const jive::simple_node & node)
+{
+  JLM_ASSERT(is<ConstantArray>(&node) || is<ConstantStruct>(&node));
+  auto & constraints = *Constraints_;
+
+  for (size_t n = 0; n < node.ninputs(); n++) {
+    auto & origin = *node.input(n)->origin();
+    if (!constraints.HasRegisterVariable(origin))
+      continue;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*node.output(0)),
+      constraints.GetOrCreateRegisterVariable(origin));
+  }
+}
+
+void
+Andersen::AnalyzeLambda(const lambda::node & lambda)
+{
+  auto & constraints = *Constraints_;
+
+  for (auto & cv : lambda.ctxvars()) {
+    if (!jive::is<PointerType>(cv.type()))
+      continue;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*cv.argument()),
+      constraints.GetOrCreateRegisterVariable(*cv.origin()));
+  }
+
+  /*
+   * A lambda that is not only called directly can be called from outside the module. Its pointer arguments enter
+   * the module and its pointer results escape it.
+   */
+  auto hasOnlyDirectCalls = lambda.direct_calls();
+  for (auto & argument : lambda.fctarguments()) {
+    if (!jive::is<PointerType>(argument.type()))
+      continue;
+
+    auto variable = constraints.GetOrCreateRegisterVariable(argument);
+    if (!hasOnlyDirectCalls)
+      constraints.AddEntry(variable);
+  }
+
+  AnalyzeRegion(*lambda.subregion());
+
+  for (auto & result : lambda.fctresults()) {
+    if (!jive::is<PointerType>(result.type()))
+      continue;
+
+    auto variable = constraints.GetOrCreateRegisterVariable(*result.origin());
+    if (!hasOnlyDirectCalls)
+      constraints.AddEscape(variable);
+  }
+
+  auto object = constraints.CreateObject(ConstraintSet::ObjectKind::Lambda, lambda.output());
+  constraints.AddBase(constraints.GetOrCreateRegisterVariable(*lambda.output()), object);
+}
+
+void
+Andersen::AnalyzeDelta(const delta::node & delta)
+{
+  auto & constraints = *Constraints_;
+
+  for (auto & input : delta.ctxvars()) {
+    if (!is<PointerType>(input.type()))
+      continue;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*input.arguments.first()),
+      constraints.GetOrCreateRegisterVariable(*input.origin()));
+  }
+
+  AnalyzeRegion(*delta.subregion());
+
+  auto object = constraints.CreateObject(ConstraintSet::ObjectKind::Delta, delta.output());
+  constraints.AddBase(constraints.GetOrCreateRegisterVariable(*delta.output()), object);
+
+  auto & origin = *delta.result()->origin();
+  if (constraints.HasRegisterVariable(origin))
+    constraints.AddCopy(constraints.GetContentVariable(object), constraints.GetOrCreateRegisterVariable(origin));
+}
+
+void
+Andersen::AnalyzePhi(const phi::node & phi)
+{
+  auto & constraints = *Constraints_;
+
+  for (auto cv = phi.begin_cv(); cv != phi.end_cv(); cv++) {
+    if (!is<PointerType>(cv->type()))
+      continue;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*cv->argument()),
+      constraints.GetOrCreateRegisterVariable(*cv->origin()));
+  }
+
+  AnalyzeRegion(*phi.subregion());
+
+  for (auto rv = phi.begin_rv(); rv != phi.end_rv(); rv++) {
+    if (!is<PointerType>(rv->type()))
+      continue;
+
+    auto argument = constraints.GetOrCreateRegisterVariable(*rv->argument());
+    constraints.AddCopy(argument, constraints.GetOrCreateRegisterVariable(*rv->result()->origin()));
+    constraints.AddCopy(constraints.GetOrCreateRegisterVariable(*rv.output()), argument);
+  }
+}
+
+void
+Andersen::AnalyzeGamma(const jive::gamma_node & gamma)
+{
+  auto & constraints = *Constraints_;
+
+  for (auto ev = gamma.begin_entryvar(); ev != gamma.end_entryvar(); ev++) {
+    if (!jive::is<PointerType>(ev->type()))
+      continue;
+
+    auto origin = constraints.GetOrCreateRegisterVariable(*ev->origin());
+    for (auto & argument : *ev)
+      constraints.AddCopy(constraints.GetOrCreateRegisterVariable(argument), origin);
+  }
+
+  for (size_t n = 0; n < gamma.nsubregions(); n++)
+    AnalyzeRegion(*gamma.subregion(n));
+
+  for (auto ex = gamma.begin_exitvar(); ex != gamma.end_exitvar(); ex++) {
+    if (!jive::is<PointerType>(ex->type()))
+      continue;
+
+    auto output = constraints.GetOrCreateRegisterVariable(*ex.output());
+    for (auto & result : *ex)
+      constraints.AddCopy(output, constraints.GetOrCreateRegisterVariable(*result.origin()));
+  }
+}
+
+void
+Andersen::AnalyzeTheta(const jive::theta_node & theta)
+{
+  auto & constraints = *Constraints_;
+
+  for (auto thetaOutput : theta) {
+    if (!jive::is<PointerType>(thetaOutput->type()))
+      continue;
+
+    constraints.AddCopy(
+      constraints.GetOrCreateRegisterVariable(*thetaOutput->argument()),
+      constraints.GetOrCreateRegisterVariable(*thetaOutput->input()->origin()));
+  }
+
+  AnalyzeRegion(*theta.subregion());
+
+  for (auto thetaOutput : theta) {
+    if (!jive::is<PointerType>(thetaOutput->type()))
+      continue;
+
+    auto result = constraints.GetOrCreateRegisterVariable(*thetaOutput->result()->origin());
+    constraints.AddCopy(constraints.GetOrCreateRegisterVariable(*thetaOutput->argument()), result);
+    constraints.AddCopy(constraints.GetOrCreateRegisterVariable(*thetaOutput), result);
+  }
+}
+
+void
+Andersen::AnalyzeStructuralNode(const jive::structural_node & node)
+{
+  if (auto lambdaNode = dynamic_cast<const lambda::node*>(&node)) {
+    AnalyzeLambda(*lambdaNode);
+  } else if (auto deltaNode = dynamic_cast<const delta::node*>(&node)) {
+    AnalyzeDelta(*deltaNode);
+  } else if (auto phiNode = dynamic_cast<const phi::node*>(&node)) {
+    AnalyzePhi(*phiNode);
+  } else if (auto gammaNode = dynamic_cast<const jive::gamma_node*>(&node)) {
+    AnalyzeGamma(*gammaNode);
+  } else if (auto thetaNode = dynamic_cast<const jive::theta_node*>(&node)) {
+    AnalyzeTheta(*thetaNode);
+  } else {
+    JLM_UNREACHABLE("Unhandled structural node.");
+  }
+}
+
+void
+Andersen::AnalyzeRegion(jive::region & region)
+{
+  using namespace jive;
+
+  topdown_const_traverser traverser(&region);
+  for (auto & node : traverser) {
+    if (auto simpleNode = dynamic_cast<const simple_node*>(node)) {
+      AnalyzeSimpleNode(*simpleNode);
+      continue;
+    }
+
+    AnalyzeStructuralNode(*AssertedCast<const structural_node>(node));
+  }
+}
+
+void
+Andersen::AnalyzeImports(const jive::graph & graph)
+{
+  auto & constraints = *Constraints_;
+
+  auto region = graph.root();
+  for (size_t n = 0; n < region->narguments(); n++) {
+    auto & argument = *region->argument(n);
+    if (!jive::is<PointerType>(argument.type()))
+      continue;
+
+    /* FIXME: we should not add function imports */
+    auto object = constraints.CreateObject(ConstraintSet::ObjectKind::Import, &argument);
+    constraints.AddBase(constraints.GetOrCreateRegisterVariable(argument), object);
+
+    /*
+     * The content of an import is external memory.
+     */
+    auto pointerType = AssertedCast<const PointerType>(&argument.type());
+    if (is<PointerType>(pointerType->GetElementType())) {
+      auto content = constraints.GetContentVariable(object);
+      constraints.AddBase(content, constraints.GetUnknownObject());
+      constraints.AddEntry(content);
+      constraints.AddEscape(content);
+    }
+  }
+}
+
+void
+Andersen::AnalyzeExports(const jive::graph & graph)
+{
+  auto & constraints = *Constraints_;
+
+  auto region = graph.root();
+  for (size_t n = 0; n < region->nresults(); n++) {
+    auto & origin = *region->result(n)->origin();
+    if (constraints.HasRegisterVariable(origin))
+      constraints.AddEscape(constraints.GetOrCreateRegisterVariable(origin));
+  }
+}
+
+std::unique_ptr<PointsToGraph>
+Andersen::Analyze(
+  const RvsdgModule & module,
+  StatisticsCollector & statisticsCollector)
+{
+  Constraints_ = std::make_unique<ConstraintSet>();
+  auto statistics = AndersenAnalysisStatistics::Create(module.SourceFileName());
+
+  statistics->StartConstraintCollection(module.Rvsdg());
+  AnalyzeImports(module.Rvsdg());
+  AnalyzeRegion(*module.Rvsdg().root());
+  AnalyzeExports(module.Rvsdg());
+  statistics->StopConstraintCollection(*Constraints_);
+
+  statistics->StartSolving();
+  Constraints_->Solve();
+  statistics->StopSolving(*Constraints_);
+
+  statistics->StartPointsToGraphConstruction();
+  auto pointsToGraph = ConstructPointsToGraph(*Constraints_);
+  statistics->StopPointsToGraphConstruction(*pointsToGraph);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  Constraints_.reset();
+
+  return pointsToGraph;
+}
+
+}
@@ -126,7 +126,7 @@ public:
     return MemoryNodeMap_.find(&output) != MemoryNodeMap_.end();
   }
 
-  HashSet<const PointsToGraph::MemoryNode*>
+  PointsToGraph::MemoryNodeSet
   GetMemoryNodes(const jive::output & output)
   {
     JLM_ASSERT(is<PointerType>(output.type()));
@@ -166,7 +166,7 @@ public:
 
 private:
   const MemoryNodeProvisioning & MemoryNodeProvisioning_;
-  std::unordered_map<const jive::output*, HashSet<const PointsToGraph::MemoryNode*>> MemoryNodeMap_;
+  std::unordered_map<const jive::output*, PointsToGraph::MemoryNodeSet> MemoryNodeMap_;
 };
 
 /** \brief Hash map for mapping points-to graph memory nodes to RVSDG memory states.
@@ -263,7 +263,7 @@ public:
   }
 
   std::vector<MemoryNodeStatePair*>
-  GetStates(const HashSet<const PointsToGraph::MemoryNode*> & memoryNodes)
+  GetStates(const PointsToGraph::MemoryNodeSet & memoryNodes)
   {
     std::vector<MemoryNodeStatePair*> memoryNodeStatePairs;
     for (auto & memoryNode : memoryNodes.Items())
@@ -349,7 +349,7 @@ public:
   std::vector<StateMap::MemoryNodeStatePair*>
   GetStates(
     const jive::region & region,
-    const HashSet<const PointsToGraph::MemoryNode*> & memoryNodes)
+    const PointsToGraph::MemoryNodeSet & memoryNodes)
   {
     return GetStateMap(region).GetStates(memoryNodes);
   }
@@ -362,7 +362,7 @@ public:
     return GetStateMap(region).GetState(memoryNode);
   }
 
-  HashSet<const PointsToGraph::MemoryNode*>
+  PointsToGraph::MemoryNodeSet
   GetMemoryNodes(const jive::output & output)
   {
     auto & memoryNodeCache = GetMemoryNodeCache(*output.region());
@@ -488,7 +488,7 @@ MemoryStateEncoder::EncodeRegion(jive::region & region)
 
   jive::topdown_traverser traverser(&region);
   for (auto & node : traverser) {
-    if (auto simpleNode = dynamic_cast<const simple_node*>(node)) {
+    if (auto simpleNode = dyn_cast<simple_node>(node)) {
       EncodeSimpleNode(*simpleNode);
       continue;
     }
@@ -550,10 +550,8 @@ MemoryStateEncoder::EncodeSimpleNode(const jive::simple_node & be)
      });
 
   auto & operation = be.operation();
-  if (nodes.find(typeid(operation)) == nodes.end())
-    return;
-
-  nodes[typeid(operation)](*this, be);
+  if (auto it = nodes.find(typeid(operation)); it != nodes.end())
+    it->second(*this, be);
 }
 
 void
@@ -562,9 +560,16 @@ MemoryStateEncoder::EncodeAlloca(const jive::simple_node & allocaNode)
   JLM_ASSERT(is<alloca_op>(&allocaNode));
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto & allocaMemoryNode = Context_->GetMemoryNodeProvisioning().GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Context_->GetMemoryNodeProvisioning().GetPointsToGraph();
+  auto & allocaMemoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto memoryNodeStatePair = stateMap.GetState(*allocaNode.region(), allocaMemoryNode);
   memoryNodeStatePair->ReplaceState(*allocaNode.output(1));
+
+  /*
+   * The fields of the alloca are created together with it.
+   */
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(allocaMemoryNode))
+    stateMap.GetState(*allocaNode.region(), *fieldNode)->ReplaceState(*allocaNode.output(1));
 }
 
 void
@@ -573,7 +578,8 @@ MemoryStateEncoder::EncodeMalloc(const jive::simple_node & mallocNode)
   JLM_ASSERT(is<malloc_op>(&mallocNode));
   auto & stateMap = Context_->GetRegionalizedStateMap();
 
-  auto & mallocMemoryNode = Context_->GetMemoryNodeProvisioning().GetPointsToGraph().GetMallocNode(mallocNode);
+  auto & pointsToGraph = Context_->GetMemoryNodeProvisioning().GetPointsToGraph();
+  auto & mallocMemoryNode = pointsToGraph.GetMallocNode(mallocNode);
 
   /**
    * We use a static heap model. This means that multiple invocations of an malloc
@@ -585,6 +591,12 @@ MemoryStateEncoder::EncodeMalloc(const jive::simple_node & mallocNode)
   auto mallocState = mallocNode.output(1);
   auto mergedState = MemStateMergeOperator::Create({mallocState, &memoryNodeStatePair->State()});
   memoryNodeStatePair->ReplaceState(*mergedState);
+
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(mallocMemoryNode)) {
+    auto fieldNodeStatePair = stateMap.GetState(*mallocNode.region(), *fieldNode);
+    auto mergedFieldState = MemStateMergeOperator::Create({mallocState, &fieldNodeStatePair->State()});
+    fieldNodeStatePair->ReplaceState(*mergedFieldState);
+  }
 }
 
 void
@@ -4,10 +4,12 @@
  */
 
 #include <jlm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/opt/alias-analyses/Andersen.hpp>
 #include <jlm/opt/alias-analyses/MemoryStateEncoder.hpp>
 #include <jlm/opt/alias-analyses/Optimization.hpp>
 #include <jlm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/opt/PassManager.hpp>
 
 namespace jlm::aa {
 
@@ -24,6 +26,9 @@ UnlinkUnknownMemoryNode(PointsToGraph & pointsToGraph)
   for (auto & deltaNode : pointsToGraph.DeltaNodes())
     memoryNodes.push_back(&deltaNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    memoryNodes.push_back(&fieldNode);
+
   for (auto & lambdaNode : pointsToGraph.LambdaNodes())
     memoryNodes.push_back(&lambdaNode);
 
@@ -42,6 +47,47 @@ UnlinkUnknownMemoryNode(PointsToGraph & pointsToGraph)
   }
 }
 
+static const PointsToGraph &
+GetSteensgaardPointsToGraph(
+  const RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  AnalysisManager & analysisManager,
+  size_t maxFields = 0)
+{
+  auto analysisId = maxFields != 0
+    ? AnalysisId::SteensgaardFieldSensitivePointsToGraph
+    : AnalysisId::SteensgaardPointsToGraph;
+
+  return analysisManager.GetOrCompute<PointsToGraph>(
+    analysisId,
+    rvsdgModule,
+    [&]()
+    {
+      auto steensgaard = maxFields != 0 ? std::make_unique<Steensgaard>(maxFields) : std::make_unique<Steensgaard>();
+      auto pointsToGraph = steensgaard->Analyze(rvsdgModule, statisticsCollector);
+      UnlinkUnknownMemoryNode(*pointsToGraph);
+      return pointsToGraph;
+    });
+}
+
+static const PointsToGraph &
+GetAndersenPointsToGraph(
+  const RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  AnalysisManager & analysisManager)
+{
+  return analysisManager.GetOrCompute<PointsToGraph>(
+    AnalysisId::AndersenPointsToGraph,
+    rvsdgModule,
+    [&]()
+    {
+      Andersen andersen;
+      auto pointsToGraph = andersen.Analyze(rvsdgModule, statisticsCollector);
+      UnlinkUnknownMemoryNode(*pointsToGraph);
+      return pointsToGraph;
+    });
+}
+
 SteensgaardAgnostic::~SteensgaardAgnostic() noexcept
 = default;
 
@@ -50,11 +96,22 @@ SteensgaardAgnostic::run(
   RvsdgModule & rvsdgModule,
   StatisticsCollector & statisticsCollector)
 {
-  Steensgaard steensgaard;
-  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
-  UnlinkUnknownMemoryNode(*pointsToGraph);
+  PassManager passManager;
+  run(rvsdgModule, statisticsCollector, passManager);
+}
+
+void
+SteensgaardAgnostic::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  PassManager & passManager)
+{
+  auto & pointsToGraph = GetSteensgaardPointsToGraph(
+    rvsdgModule,
+    statisticsCollector,
+    passManager.GetAnalysisManager());
 
-  auto provisioning = AgnosticMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+  auto provisioning = AgnosticMemoryNodeProvider::Create(rvsdgModule, pointsToGraph, statisticsCollector);
 
   MemoryStateEncoder encoder;
   encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
@@ -68,14 +125,63 @@ SteensgaardRegionAware::run(
   RvsdgModule & rvsdgModule,
   StatisticsCollector & statisticsCollector)
 {
-  Steensgaard steensgaard;
-  auto pointsToGraph = steensgaard.Analyze(rvsdgModule, statisticsCollector);
-  UnlinkUnknownMemoryNode(*pointsToGraph);
+  PassManager passManager;
+  run(rvsdgModule, statisticsCollector, passManager);
+}
+
+void
+SteensgaardRegionAware::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  PassManager & passManager)
+{
+  auto & pointsToGraph = GetSteensgaardPointsToGraph(
+    rvsdgModule,
+    statisticsCollector,
+    passManager.GetAnalysisManager(),
+    MaxFields_);
+
+  auto provisioning = RegionAwareMemoryNodeProvider::Create(
+    rvsdgModule,
+    pointsToGraph,
+    statisticsCollector,
+    passManager.GetThreadPool());
+
+  MemoryStateEncoder encoder;
+  encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
+}
+
+AndersenRegionAware::~AndersenRegionAware() noexcept
+= default;
+
+void
+AndersenRegionAware::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector)
+{
+  PassManager passManager;
+  run(rvsdgModule, statisticsCollector, passManager);
+}
 
-  auto provisioning = RegionAwareMemoryNodeProvider::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+void
+AndersenRegionAware::run(
+  RvsdgModule & rvsdgModule,
+  StatisticsCollector & statisticsCollector,
+  PassManager & passManager)
+{
+  auto & pointsToGraph = GetAndersenPointsToGraph(
+    rvsdgModule,
+    statisticsCollector,
+    passManager.GetAnalysisManager());
+
+  auto provisioning = RegionAwareMemoryNodeProvider::Create(
+    rvsdgModule,
+    pointsToGraph,
+    statisticsCollector,
+    passManager.GetThreadPool());
 
   MemoryStateEncoder encoder;
   encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
 }
 
-}
\ No newline at end of file
+}
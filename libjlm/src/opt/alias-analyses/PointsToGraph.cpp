@@ -26,7 +26,13 @@ void
 PointsToGraph::AddEscapedMemoryNode(PointsToGraph::MemoryNode & memoryNode)
 {
   JLM_ASSERT(&memoryNode.Graph() == this);
-  EscapedMemoryNodes_.Insert(&memoryNode);
+  EscapedMemoryNodes_.Insert(memoryNode.GetMemoryNodeIndex());
+}
+
+PointsToGraph::MemoryNodeSet
+PointsToGraph::GetEscapedMemoryNodes() const
+{
+  return {*this, EscapedMemoryNodes_};
 }
 
 PointsToGraph::AllocaNodeRange
@@ -53,6 +59,30 @@ PointsToGraph::DeltaNodes() const
   return {DeltaNodeConstIterator(DeltaNodes_.begin()), DeltaNodeConstIterator(DeltaNodes_.end())};
 }
 
+PointsToGraph::FieldNodeRange
+PointsToGraph::FieldNodes()
+{
+  return {FieldNodeIterator(FieldNodes_.begin()), FieldNodeIterator(FieldNodes_.end())};
+}
+
+PointsToGraph::FieldNodeConstRange
+PointsToGraph::FieldNodes() const
+{
+  return {FieldNodeConstIterator(FieldNodes_.begin()), FieldNodeConstIterator(FieldNodes_.end())};
+}
+
+std::vector<const PointsToGraph::FieldNode*>
+PointsToGraph::GetFieldNodes(const PointsToGraph::MemoryNode & memoryNode) const
+{
+  std::vector<const PointsToGraph::FieldNode*> fieldNodes;
+  for (auto it = FieldNodes_.lower_bound({&memoryNode, 0});
+       it != FieldNodes_.end() && it->first.first == &memoryNode;
+       it++)
+    fieldNodes.push_back(it->second.get());
+
+  return fieldNodes;
+}
+
 PointsToGraph::LambdaNodeRange
 PointsToGraph::LambdaNodes()
 {
@@ -119,6 +149,15 @@ PointsToGraph::AddDeltaNode(std::unique_ptr<PointsToGraph::DeltaNode> node)
   return *tmp;
 }
 
+PointsToGraph::FieldNode &
+PointsToGraph::AddFieldNode(std::unique_ptr<PointsToGraph::FieldNode> node)
+{
+  auto tmp = node.get();
+  FieldNodes_[{&node->GetMemoryNode(), node->GetOffset()}] = std::move(node);
+
+  return *tmp;
+}
+
 PointsToGraph::LambdaNode &
 PointsToGraph::AddLambdaNode(std::unique_ptr<PointsToGraph::LambdaNode> node)
 {
@@ -163,6 +202,7 @@ PointsToGraph::ToDot(const PointsToGraph & pointsToGraph)
       ({
          {typeid(AllocaNode),         "box"},
          {typeid(DeltaNode),          "box"},
+         {typeid(FieldNode),          "box"},
          {typeid(ImportNode),         "box"},
          {typeid(LambdaNode),         "box"},
          {typeid(MallocNode),         "box"},
@@ -205,6 +245,9 @@ PointsToGraph::ToDot(const PointsToGraph & pointsToGraph)
   for (auto & deltaNode : pointsToGraph.DeltaNodes())
     dot += printNodeAndEdges(deltaNode);
 
+  for (auto & fieldNode : pointsToGraph.FieldNodes())
+    dot += printNodeAndEdges(fieldNode);
+
   for (auto & importNode : pointsToGraph.ImportNodes())
     dot += printNodeAndEdges(importNode);
 
@@ -230,25 +273,39 @@ PointsToGraph::Node::~Node() noexcept
 PointsToGraph::Node::TargetRange
 PointsToGraph::Node::Targets()
 {
-  return {TargetIterator(Targets_.begin()), TargetIterator(Targets_.end())};
+  auto & memoryNodes = Graph().MemoryNodes_;
+  auto targets = Targets_.Items();
+  return {TargetIterator(memoryNodes, targets.begin()), TargetIterator(memoryNodes, targets.end())};
 }
 
 PointsToGraph::Node::TargetConstRange
 PointsToGraph::Node::Targets() const
 {
-  return {TargetConstIterator(Targets_.begin()), TargetConstIterator(Targets_.end())};
+  auto & memoryNodes = Graph().MemoryNodes_;
+  auto targets = Targets_.Items();
+  return {TargetConstIterator(memoryNodes, targets.begin()), TargetConstIterator(memoryNodes, targets.end())};
 }
 
 PointsToGraph::Node::SourceRange
 PointsToGraph::Node::Sources()
 {
-  return {SourceIterator(Sources_.begin()), SourceIterator(Sources_.end())};
+  auto & nodes = Graph().Nodes_;
+  auto sources = Sources_.Items();
+  return {SourceIterator(nodes, sources.begin()), SourceIterator(nodes, sources.end())};
 }
 
 PointsToGraph::Node::SourceConstRange
 PointsToGraph::Node::Sources() const
 {
-  return {SourceConstIterator(Sources_.begin()), SourceConstIterator(Sources_.end())};
+  auto & nodes = Graph().Nodes_;
+  auto sources = Sources_.Items();
+  return {SourceConstIterator(nodes, sources.begin()), SourceConstIterator(nodes, sources.end())};
+}
+
+PointsToGraph::MemoryNodeSet
+PointsToGraph::Node::GetTargetSet() const
+{
+  return {Graph(), Targets_};
 }
 
 void
@@ -257,8 +314,8 @@ PointsToGraph::Node::AddEdge(PointsToGraph::MemoryNode & target)
   if (&Graph() != &target.Graph())
     throw error("Points-to graph nodes are not in the same graph.");
 
-  Targets_.insert(&target);
-  target.Sources_.insert(this);
+  Targets_.Insert(target.GetMemoryNodeIndex());
+  target.Sources_.Insert(GetIndex());
 }
 
 void
@@ -267,8 +324,8 @@ PointsToGraph::Node::RemoveEdge(PointsToGraph::MemoryNode & target)
   if (&Graph() != &target.Graph())
     throw error("Points-to graph nodes are not in the same graph.");
 
-  target.Sources_.erase(this);
-  Targets_.erase(&target);
+  target.Sources_.Remove(GetIndex());
+  Targets_.Remove(target.GetMemoryNodeIndex());
 }
 
 PointsToGraph::RegisterNode::~RegisterNode() noexcept
@@ -315,6 +372,15 @@ PointsToGraph::DeltaNode::DebugString() const
   return GetDeltaNode().operation().debug_string();
 }
 
+PointsToGraph::FieldNode::~FieldNode() noexcept
+= default;
+
+std::string
+PointsToGraph::FieldNode::DebugString() const
+{
+  return strfmt(GetMemoryNode().DebugString(), "+", GetOffset());
+}
+
 PointsToGraph::LambdaNode::~LambdaNode() noexcept
 = default;
 
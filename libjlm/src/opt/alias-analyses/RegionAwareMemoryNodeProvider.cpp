@@ -9,6 +9,8 @@
 #include <jlm/ir/operators/store.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/ThreadPool.hpp>
 
 #include <jive/rvsdg/traverser.hpp>
 
@@ -33,7 +35,7 @@ public:
   RegionSummary &
   operator=(RegionSummary&&) = delete;
 
-  const HashSet<const PointsToGraph::MemoryNode*> &
+  const PointsToGraph::MemoryNodeSet &
   GetMemoryNodes() const
   {
     return MemoryNodes_;
@@ -64,7 +66,7 @@ public:
   }
 
   void
-  AddMemoryNodes(const HashSet<const PointsToGraph::MemoryNode*> & memoryNodes)
+  AddMemoryNodes(const PointsToGraph::MemoryNodeSet & memoryNodes)
   {
     MemoryNodes_.UnionWith(memoryNodes);
   }
@@ -116,7 +118,7 @@ public:
 
 private:
   const jive::region * Region_;
-  HashSet<const PointsToGraph::MemoryNode*> MemoryNodes_;
+  PointsToGraph::MemoryNodeSet MemoryNodes_;
   HashSet<const jive::simple_node*> UnknownMemoryNodeReferences_;
 
   HashSet<const CallNode*> RecursiveCalls_;
@@ -204,7 +206,10 @@ public:
   explicit
   RegionAwareMemoryNodeProvisioning(const PointsToGraph & pointsToGraph)
     : PointsToGraph_(pointsToGraph)
-  {}
+    , ExternalFunctionNodes_(pointsToGraph.GetEscapedMemoryNodes())
+  {
+    ExternalFunctionNodes_.Insert(&pointsToGraph.GetExternalMemoryNode());
+  }
 
   RegionAwareMemoryNodeProvisioning(const RegionAwareMemoryNodeProvisioning&) = delete;
 
@@ -222,21 +227,21 @@ public:
     return PointsToGraph_;
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetRegionEntryNodes(const jive::region & region) const override
   {
     auto & regionSummary = GetRegionSummary(region);
     return regionSummary.GetMemoryNodes();
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetRegionExitNodes(const jive::region & region) const override
   {
     auto & regionSummary = GetRegionSummary(region);
     return regionSummary.GetMemoryNodes();
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const override
   {
     auto callTypeClassifier = CallNode::ClassifyCall(callNode);
@@ -253,8 +258,7 @@ public:
     }
     else if (callTypeClassifier->IsExternalCall())
     {
-      auto & import = callTypeClassifier->GetImport();
-      return GetExternalFunctionNodes(import);
+      return GetExternalFunctionNodes();
     }
     else if (callTypeClassifier->IsIndirectCall())
     {
@@ -264,7 +268,7 @@ public:
     JLM_UNREACHABLE("Unhandled call type.");
   }
 
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const override
   {
     auto callTypeClassifier = CallNode::ClassifyCall(callNode);
@@ -281,8 +285,7 @@ public:
     }
     else if (callTypeClassifier->IsExternalCall())
     {
-      auto & import = callTypeClassifier->GetImport();
-      return GetExternalFunctionNodes(import);
+      return GetExternalFunctionNodes();
     }
     else if (callTypeClassifier->IsIndirectCall())
     {
@@ -292,17 +295,12 @@ public:
     JLM_UNREACHABLE("Unhandled call type!");
   }
 
-  [[nodiscard]] HashSet<const PointsToGraph::MemoryNode*>
+  [[nodiscard]] PointsToGraph::MemoryNodeSet
   GetOutputNodes(const jive::output & output) const override
   {
     JLM_ASSERT(is<PointerType>(output.type()));
     auto & registerNode = PointsToGraph_.GetRegisterNode(output);
-
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes;
-    for (auto & memoryNode : registerNode.Targets())
-      memoryNodes.Insert(&memoryNode);
-
-    return memoryNodes;
+    return registerNode.GetTargetSet();
   }
 
   RegionSummaryConstRange
@@ -317,12 +315,6 @@ public:
     return RegionSummaries_.find(&region) != RegionSummaries_.end();
   }
 
-  bool
-  ContainsExternalFunctionNodes(const jive::argument & import) const
-  {
-    return ExternalFunctionNodes_.find(&import) != ExternalFunctionNodes_.end();
-  }
-
   [[nodiscard]] RegionSummary &
   GetRegionSummary(const jive::region & region) const
   {
@@ -330,12 +322,14 @@ public:
     return *RegionSummaries_.find(&region)->second;
   }
 
-  const HashSet<const PointsToGraph::MemoryNode*> &
-  GetExternalFunctionNodes(const jive::argument & import) const
+  /**
+   * External functions can reference all escaped memory locations as well as the external memory location. The
+   * memory nodes are the same for all external functions.
+   */
+  const PointsToGraph::MemoryNodeSet &
+  GetExternalFunctionNodes() const noexcept
   {
-    JLM_ASSERT(ContainsExternalFunctionNodes(import));
-
-    return (*ExternalFunctionNodes_.find(&import)).second;
+    return ExternalFunctionNodes_;
   }
 
   RegionSummary &
@@ -349,15 +343,6 @@ public:
     return *regionSummaryPointer;
   }
 
-  void
-  AddExternalFunctionNodes(
-    const jive::argument & import,
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes)
-  {
-    JLM_ASSERT(!ContainsExternalFunctionNodes(import));
-    ExternalFunctionNodes_[&import] = std::move(memoryNodes);
-  }
-
   static std::unique_ptr<RegionAwareMemoryNodeProvisioning>
   Create(const PointsToGraph & pointsToGraph)
   {
@@ -455,7 +440,7 @@ public:
   }
 
 private:
-  [[nodiscard]] const HashSet<const PointsToGraph::MemoryNode*> &
+  [[nodiscard]] const PointsToGraph::MemoryNodeSet &
   GetIndirectCallNodes(const CallNode & callNode) const
   {
     /*
@@ -470,12 +455,38 @@ private:
 
   RegionSummaryMap RegionSummaries_;
   const PointsToGraph & PointsToGraph_;
-  std::unordered_map<const jive::argument*, HashSet<const PointsToGraph::MemoryNode*>> ExternalFunctionNodes_;
+  PointsToGraph::MemoryNodeSet ExternalFunctionNodes_;
 };
 
+/**
+ * Invokes \p body for every index in [0, \p numIterations). The invocations are distributed over the threads of
+ * \p threadPool if a thread pool is given. The function returns once all invocations have finished.
+ */
+static void
+ParallelFor(
+  size_t numIterations,
+  ThreadPool * threadPool,
+  const std::function<void(size_t)> & body)
+{
+  if (threadPool == nullptr || numIterations < 2)
+  {
+    for (size_t n = 0; n < numIterations; n++)
+      body(n);
+    return;
+  }
+
+  for (size_t n = 0; n < numIterations; n++)
+    threadPool->Submit([&body, n]() { body(n); });
+  threadPool->Wait();
+}
+
 RegionAwareMemoryNodeProvider::~RegionAwareMemoryNodeProvider() noexcept
 = default;
 
+RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider(ThreadPool * threadPool)
+  : ThreadPool_(threadPool)
+{}
+
 std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
   const jlm::RvsdgModule & rvsdgModule,
@@ -486,20 +497,37 @@ RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
 
   auto statistics = Statistics::Create(statisticsCollector, rvsdgModule, pointsToGraph);
 
+  auto & rootRegion = *rvsdgModule.Rvsdg().root();
+  auto callGraphLevels = ExtractCallGraphLevels(rvsdgModule);
+
   statistics->StartAnnotationStatistics();
-  AnnotateRegion(*rvsdgModule.Rvsdg().root());
+  CreateRegionSummaries(rootRegion);
+  std::vector<const jive::node*> rootNodes;
+  for (auto & nodes : callGraphLevels)
+    rootNodes.insert(rootNodes.end(), nodes.begin(), nodes.end());
+  ParallelFor(rootNodes.size(), ThreadPool_, [&](size_t n)
+  {
+    if (auto structuralNode = dynamic_cast<const jive::structural_node*>(rootNodes[n]))
+    {
+      AnnotateStructuralNode(*structuralNode);
+    }
+    else
+    {
+      AnnotateSimpleNode(*AssertedCast<const jive::simple_node>(rootNodes[n]));
+    }
+  });
   statistics->StopAnnotationStatistics();
 
   statistics->StartPropagationPass1Statistics();
-  Propagate(rvsdgModule);
+  Propagate(callGraphLevels, ThreadPool_);
   statistics->StopPropagationPass1Statistics();
 
   statistics->StartResolveUnknownMemoryNodeReferencesStatistics();
-  ResolveUnknownMemoryNodeReferences(rvsdgModule);
+  ResolveUnknownMemoryNodeReferences(rvsdgModule, ThreadPool_);
   statistics->StopResolveUnknownMemoryNodeReferencesStatistics();
 
   statistics->StartPropagationPass2Statistics();
-  Propagate(rvsdgModule);
+  Propagate(callGraphLevels, ThreadPool_);
   statistics->StopPropagationPass2Statistics();
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
@@ -511,9 +539,10 @@ std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::Create(
   const RvsdgModule & rvsdgModule,
   const PointsToGraph & pointsToGraph,
-  StatisticsCollector & statisticsCollector)
+  StatisticsCollector & statisticsCollector,
+  ThreadPool * threadPool)
 {
-  RegionAwareMemoryNodeProvider provider;
+  RegionAwareMemoryNodeProvider provider(threadPool);
   return provider.ProvisionMemoryNodes(rvsdgModule, pointsToGraph, statisticsCollector);
 }
 
@@ -527,7 +556,7 @@ RegionAwareMemoryNodeProvider::Create(
 }
 
 void
-RegionAwareMemoryNodeProvider::AnnotateRegion(jive::region & region)
+RegionAwareMemoryNodeProvider::CreateRegionSummaries(const jive::region & region)
 {
   auto shouldCreateRegionSummary = [](auto & region)
   {
@@ -536,11 +565,32 @@ RegionAwareMemoryNodeProvider::AnnotateRegion(jive::region & region)
            && !jive::is<delta::operation>(region.node());
   };
 
-  RegionSummary * regionSummary = nullptr;
   if (shouldCreateRegionSummary(region))
   {
-    regionSummary = &Provisioning_->AddRegionSummary(RegionSummary::Create(region));
+    Provisioning_->AddRegionSummary(RegionSummary::Create(region));
+  }
+
+  for (auto & node : region.nodes)
+  {
+    auto structuralNode = dynamic_cast<const jive::structural_node*>(&node);
+    if (structuralNode == nullptr || jive::is<delta::operation>(structuralNode))
+    {
+      continue;
+    }
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      CreateRegionSummaries(*structuralNode->subregion(n));
+    }
   }
+}
+
+void
+RegionAwareMemoryNodeProvider::AnnotateRegion(jive::region & region)
+{
+  auto regionSummary = Provisioning_->ContainsRegionSummary(region)
+    ? &Provisioning_->GetRegionSummary(region)
+    : nullptr;
 
   for (auto & node : region.nodes)
   {
@@ -596,7 +646,7 @@ RegionAwareMemoryNodeProvider::AnnotateSimpleNode(const jive::simple_node & simp
     provider.AnnotateMemcpy(simpleNode);
   };
 
-  static std::unordered_map<
+  static const std::unordered_map<
     std::type_index,
     std::function<void(RegionAwareMemoryNodeProvider&, const jive::simple_node&)>
   > nodes
@@ -611,10 +661,11 @@ RegionAwareMemoryNodeProvider::AnnotateSimpleNode(const jive::simple_node & simp
      });
 
   auto & operation = simpleNode.operation();
-  if (nodes.find(typeid(operation)) == nodes.end())
+  auto it = nodes.find(typeid(operation));
+  if (it == nodes.end())
     return;
 
-  nodes[typeid(operation)](*this, simpleNode);
+  it->second(*this, simpleNode);
 }
 
 void
@@ -638,9 +689,12 @@ RegionAwareMemoryNodeProvider::AnnotateAlloca(const jive::simple_node & allocaNo
 {
   JLM_ASSERT(jive::is<alloca_op>(allocaNode.operation()));
 
-  auto & memoryNode = Provisioning_->GetPointsToGraph().GetAllocaNode(allocaNode);
+  auto & pointsToGraph = Provisioning_->GetPointsToGraph();
+  auto & memoryNode = pointsToGraph.GetAllocaNode(allocaNode);
   auto & regionSummary = Provisioning_->GetRegionSummary(*allocaNode.region());
   regionSummary.AddMemoryNodes({&memoryNode});
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(memoryNode))
+    regionSummary.AddMemoryNodes({fieldNode});
 }
 
 void
@@ -648,9 +702,12 @@ RegionAwareMemoryNodeProvider::AnnotateMalloc(const jive::simple_node & mallocNo
 {
   JLM_ASSERT(jive::is<malloc_op>(mallocNode.operation()));
 
-  auto & memoryNode = Provisioning_->GetPointsToGraph().GetMallocNode(mallocNode);
+  auto & pointsToGraph = Provisioning_->GetPointsToGraph();
+  auto & memoryNode = pointsToGraph.GetMallocNode(mallocNode);
   auto & regionSummary = Provisioning_->GetRegionSummary(*mallocNode.region());
   regionSummary.AddMemoryNodes({&memoryNode});
+  for (auto fieldNode : pointsToGraph.GetFieldNodes(memoryNode))
+    regionSummary.AddMemoryNodes({fieldNode});
 }
 
 void
@@ -684,19 +741,8 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
   {
     JLM_ASSERT(callTypeClassifier.GetCallType() == CallTypeClassifier::CallType::ExternalCall);
 
-    auto & pointsToGraph = provider.Provisioning_->GetPointsToGraph();
-
-    HashSet<const PointsToGraph::MemoryNode*> memoryNodes;
-    memoryNodes.UnionWith(pointsToGraph.GetEscapedMemoryNodes());
-    memoryNodes.Insert(&pointsToGraph.GetExternalMemoryNode());
-
-    auto & import = callTypeClassifier.GetImport();
     auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
-    regionSummary.AddMemoryNodes(memoryNodes);
-    if (!provider.Provisioning_->ContainsExternalFunctionNodes(import))
-    {
-      provider.Provisioning_->AddExternalFunctionNodes(import, memoryNodes);
-    }
+    regionSummary.AddMemoryNodes(provider.Provisioning_->GetExternalFunctionNodes());
   };
   auto annotateIndirectCall = [](auto & provider, auto & callNode, auto & callTypeClassifier)
   {
@@ -707,7 +753,7 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
     regionSummary.AddUnknownMemoryNodeReferences({&callNode});
   };
 
-  static std::unordered_map<
+  static const std::unordered_map<
     CallTypeClassifier::CallType,
     std::function<void(RegionAwareMemoryNodeProvider&, const CallNode&, const CallTypeClassifier&)>
   > callTypes
@@ -720,7 +766,7 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
 
   auto callTypeClassifier = CallNode::ClassifyCall(callNode);
   JLM_ASSERT(callTypes.find(callTypeClassifier->GetCallType()) != callTypes.end());
-  callTypes[callTypeClassifier->GetCallType()](*this, callNode, *callTypeClassifier);
+  callTypes.at(callTypeClassifier->GetCallType())(*this, callNode, *callTypeClassifier);
 }
 
 void
@@ -755,45 +801,58 @@ RegionAwareMemoryNodeProvider::AnnotateStructuralNode(const jive::structural_nod
 }
 
 void
-RegionAwareMemoryNodeProvider::Propagate(const jlm::RvsdgModule & rvsdgModule)
+RegionAwareMemoryNodeProvider::Propagate(
+  const std::vector<std::vector<const jive::node*>> & callGraphLevels,
+  ThreadPool * threadPool)
 {
-  jive::topdown_traverser traverser(rvsdgModule.Rvsdg().root());
-  for (auto & node : traverser)
+  /*
+   * A node only reads the region summaries of the lambda nodes it calls, which are all part of lower levels, and only
+   * modifies the region summaries of its own regions.
+   */
+  for (auto & nodes : callGraphLevels)
   {
-    if (auto lambdaNode = dynamic_cast<const lambda::node*>(node))
-    {
-      PropagateRegion(*lambdaNode->subregion());
-    }
-    else if (auto phiNode = dynamic_cast<const phi::node*>(node))
-    {
-      PropagatePhi(*phiNode);
-    }
-    else if (dynamic_cast<const delta::node*>(node))
-    {
-      /*
-       * Nothing needs to be done for delta nodes.
-       */
-      continue;
-    }
-    else
+    ParallelFor(nodes.size(), threadPool, [&](size_t n)
     {
-      JLM_UNREACHABLE("Unhandled node type!");
-    }
+      PropagateNode(*nodes[n]);
+    });
   }
 
   JLM_ASSERT(RegionAwareMemoryNodeProvisioning::CheckInvariants(*Provisioning_));
 }
 
+void
+RegionAwareMemoryNodeProvider::PropagateNode(const jive::node & node)
+{
+  if (auto lambdaNode = dynamic_cast<const lambda::node*>(&node))
+  {
+    PropagateRegion(*lambdaNode->subregion());
+  }
+  else if (auto phiNode = dynamic_cast<const phi::node*>(&node))
+  {
+    PropagatePhi(*phiNode);
+  }
+  else if (dynamic_cast<const delta::node*>(&node))
+  {
+    /*
+     * Nothing needs to be done for delta nodes.
+     */
+  }
+  else
+  {
+    JLM_UNREACHABLE("Unhandled node type!");
+  }
+}
+
 void
 RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
 {
   std::function<void(
     const jive::region&,
-    const HashSet<const PointsToGraph::MemoryNode*>&,
+    const PointsToGraph::MemoryNodeSet&,
     const HashSet<const jive::simple_node*>&
   )> assignAndPropagateMemoryNodes = [&](
     const jive::region & region,
-    const HashSet<const PointsToGraph::MemoryNode*> & memoryNodes,
+    const PointsToGraph::MemoryNodeSet & memoryNodes,
     const HashSet<const jive::simple_node*> & unknownMemoryNodeReferences)
   {
     auto & regionSummary = Provisioning_->GetRegionSummary(region);
@@ -820,7 +879,7 @@ RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
 
   auto lambdaNodes = ExtractLambdaNodes(phiNode);
 
-  HashSet<const PointsToGraph::MemoryNode*> memoryNodes;
+  PointsToGraph::MemoryNodeSet memoryNodes;
   HashSet<const jive::simple_node*> unknownMemoryNodeReferences;
   for (auto & lambdaNode : lambdaNodes)
   {
@@ -859,36 +918,51 @@ RegionAwareMemoryNodeProvider::PropagateRegion(const jive::region & region)
 }
 
 void
-RegionAwareMemoryNodeProvider::ResolveUnknownMemoryNodeReferences(const jlm::RvsdgModule & rvsdgModule)
+RegionAwareMemoryNodeProvider::ResolveUnknownMemoryNodeReferences(
+  const jlm::RvsdgModule & rvsdgModule,
+  ThreadPool * threadPool)
 {
-  auto ResolveLambda = [&](const lambda::node & lambda)
+  using MemoryNodeMap = std::unordered_map<const jive::region*, PointsToGraph::MemoryNodeSet>;
+
+  /*
+   * Different tail nodes can reference unknown memory locations in the same callee. The memory nodes are therefore
+   * first collected per tail node, where the memory nodes of a lambda region include the ones that were collected for
+   * it by the same tail node.
+   */
+  auto ResolveLambda = [&](const lambda::node & lambda, MemoryNodeMap & memoryNodeMap)
   {
-    auto & lambdaRegionSummary = Provisioning_->GetRegionSummary(*lambda.subregion());
+    auto & lambdaRegion = *lambda.subregion();
+    auto & lambdaRegionSummary = Provisioning_->GetRegionSummary(lambdaRegion);
+
+    auto memoryNodes = lambdaRegionSummary.GetMemoryNodes();
+    if (auto it = memoryNodeMap.find(&lambdaRegion); it != memoryNodeMap.end())
+    {
+      memoryNodes.UnionWith(it->second);
+    }
 
     for (auto node : lambdaRegionSummary.GetUnknownMemoryNodeReferences().Items())
     {
-      auto & nodeRegion = *node->region();
-      auto & nodeRegionSummary = Provisioning_->GetRegionSummary(nodeRegion);
-      nodeRegionSummary.AddMemoryNodes(lambdaRegionSummary.GetMemoryNodes());
+      memoryNodeMap[node->region()].UnionWith(memoryNodes);
     }
   };
 
   auto nodes = ExtractRvsdgTailNodes(rvsdgModule);
-  for (auto & node : nodes)
+  std::vector<MemoryNodeMap> memoryNodeMaps(nodes.size());
+  ParallelFor(nodes.size(), threadPool, [&](size_t n)
   {
-    if (auto lambdaNode = dynamic_cast<const lambda::node*>(node))
+    if (auto lambdaNode = dynamic_cast<const lambda::node*>(nodes[n]))
     {
-      ResolveLambda(*lambdaNode);
+      ResolveLambda(*lambdaNode, memoryNodeMaps[n]);
     }
-    else if (auto phiNode = dynamic_cast<const phi::node*>(node))
+    else if (auto phiNode = dynamic_cast<const phi::node*>(nodes[n]))
     {
       auto lambdaNodes = ExtractLambdaNodes(*phiNode);
       for (auto & lambda : lambdaNodes)
       {
-        ResolveLambda(*lambda);
+        ResolveLambda(*lambda, memoryNodeMaps[n]);
       }
     }
-    else if (dynamic_cast<const delta::node*>(node))
+    else if (dynamic_cast<const delta::node*>(nodes[n]))
     {
       /*
        * Nothing needs to be done for delta nodes.
@@ -898,6 +972,15 @@ RegionAwareMemoryNodeProvider::ResolveUnknownMemoryNodeReferences(const jlm::Rvs
     {
       JLM_UNREACHABLE("Unhandled node type!");
     }
+  });
+
+  for (auto & memoryNodeMap : memoryNodeMaps)
+  {
+    for (auto & [region, memoryNodes] : memoryNodeMap)
+    {
+      auto & regionSummary = Provisioning_->GetRegionSummary(*region);
+      regionSummary.AddMemoryNodes(memoryNodes);
+    }
   }
 }
 
@@ -973,4 +1056,34 @@ RegionAwareMemoryNodeProvider::ExtractRvsdgTailNodes(const jlm::RvsdgModule & rv
   return nodes;
 }
 
+std::vector<std::vector<const jive::node*>>
+RegionAwareMemoryNodeProvider::ExtractCallGraphLevels(const jlm::RvsdgModule & rvsdgModule)
+{
+  std::unordered_map<const jive::node*, size_t> nodeLevels;
+  std::vector<std::vector<const jive::node*>> callGraphLevels;
+
+  jive::topdown_const_traverser traverser(rvsdgModule.Rvsdg().root());
+  for (auto & node : traverser)
+  {
+    size_t level = 0;
+    for (size_t n = 0; n < node->ninputs(); n++)
+    {
+      if (auto predecessor = jive::node_output::node(node->input(n)->origin()))
+      {
+        JLM_ASSERT(nodeLevels.find(predecessor) != nodeLevels.end());
+        level = std::max(level, nodeLevels[predecessor] + 1);
+      }
+    }
+
+    nodeLevels[node] = level;
+    if (level >= callGraphLevels.size())
+    {
+      callGraphLevels.resize(level + 1);
+    }
+    callGraphLevels[level].push_back(node);
+  }
+
+  return callGraphLevels;
+}
+
 }
\ No newline at end of file
@@ -6,7 +6,9 @@
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/structural-node.hpp>
 #include <jive/rvsdg/traverser.hpp>
+#include <jive/types/bitstring/constant.hpp>
 
+#include <jlm/ir/DataLayout.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/ir/types.hpp>
 #include <jlm/ir/operators.hpp>
@@ -21,6 +23,8 @@
 */
 #include <iostream>
 
+#include <optional>
+
 namespace jlm::aa {
 
 /** \brief Steensgaard analysis statistics class
@@ -88,6 +92,7 @@ public:
     , NumNodes_(0)
     , NumAllocaNodes_(0)
     , NumDeltaNodes_(0)
+    , NumFieldNodes_(0)
     , NumImportNodes_(0)
     , NumLambdaNodes_(0)
     , NumMallocNodes_(0)
@@ -111,6 +116,7 @@ public:
     NumNodes_ = pointsToGraph.NumNodes();
     NumAllocaNodes_ = pointsToGraph.NumAllocaNodes();
     NumDeltaNodes_ = pointsToGraph.NumDeltaNodes();
+    NumFieldNodes_ = pointsToGraph.NumFieldNodes();
     NumImportNodes_ = pointsToGraph.NumImportNodes();
     NumLambdaNodes_ = pointsToGraph.NumLambdaNodes();
     NumMallocNodes_ = pointsToGraph.NumMallocNodes();
@@ -129,6 +135,7 @@ public:
                   "#Nodes:", NumNodes_, " ",
                   "#AllocaNodes:", NumAllocaNodes_, " ",
                   "#DeltaNodes:", NumDeltaNodes_, " ",
+                  "#FieldNodes:", NumFieldNodes_, " ",
                   "#ImportNodes:", NumImportNodes_, " ",
                   "#LambdaNodes:", NumLambdaNodes_, " ",
                   "#MallocNodes:", NumMallocNodes_, " ",
@@ -153,6 +160,7 @@ private:
   size_t NumNodes_;
   size_t NumAllocaNodes_;
   size_t NumDeltaNodes_;
+  size_t NumFieldNodes_;
   size_t NumImportNodes_;
   size_t NumLambdaNodes_;
   size_t NumMallocNodes_;
@@ -162,659 +170,809 @@ private:
   jlm::timer Timer_;
 };
 
-/** \brief Location class
- *
- * This class represents an abstract location in the program.
- */
-class Location {
-public:
-  virtual
-  ~Location() = default;
-
-  constexpr explicit
-  Location(PointsToFlags pointsToFlags)
-    : PointsToFlags_(pointsToFlags)
-    , PointsTo_(nullptr)
-  {}
-
-  Location(const Location &) = delete;
-
-  Location(Location &&) = delete;
-
-  Location &
-  operator=(const Location &) = delete;
-
-  Location &
-  operator=(Location &&) = delete;
-
-  [[nodiscard]] virtual std::string
-  DebugString() const noexcept = 0;
+static std::string
+RegisterLocationDebugString(const jive::output & output)
+{
+  auto node = jive::node_output::node(&output);
+  auto index = output.index();
 
-  [[nodiscard]] bool
-  PointsToUnknownMemory() const noexcept
-  {
-    return (PointsToFlags_ & PointsToFlags::PointsToUnknownMemory) == PointsToFlags::PointsToUnknownMemory;
+  if (jive::is<jive::simple_op>(node)) {
+    auto nodestr = node->operation().debug_string();
+    auto outputstr = output.type().debug_string();
+    return strfmt(nodestr, ":", index, "[" + outputstr + "]");
   }
 
-  [[nodiscard]] bool
-  PointsToExternalMemory() const noexcept
-  {
-    return (PointsToFlags_ & PointsToFlags::PointsToExternalMemory) == PointsToFlags::PointsToExternalMemory;
+  if (is<lambda::cvargument>(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":cv:", index);
   }
 
-  [[nodiscard]] bool
-  PointsToEscapedMemory() const noexcept
-  {
-    return (PointsToFlags_ & PointsToFlags::PointsToEscapedMemory) == PointsToFlags::PointsToEscapedMemory;
+  if (is<lambda::fctargument>(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":arg:", index);
   }
 
-  [[nodiscard]] Location *
-  GetPointsTo() const noexcept
-  {
-    return PointsTo_;
+  if (is<delta::cvargument>(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":cv:", index);
   }
 
-  void
-  SetPointsTo(Location & location) noexcept
-  {
-    PointsTo_ = &location;
+  if (is_gamma_argument(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":arg", index);
   }
 
-  [[nodiscard]] PointsToFlags
-  GetPointsToFlags() const noexcept
-  {
-    return PointsToFlags_;
+  if (is_theta_argument(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":arg", index);
   }
 
-  void
-  SetPointsToFlags(PointsToFlags pointsToFlags) noexcept
-  {
-    PointsToFlags_ = pointsToFlags;
+  if (is_theta_output(&output)) {
+    auto dbgstr = jive::node_output::node(&output)->operation().debug_string();
+    return strfmt(dbgstr, ":out", index);
   }
 
-private:
-  PointsToFlags PointsToFlags_;
-  Location * PointsTo_;
-};
-
-class RegisterLocation final : public Location {
-public:
-  constexpr explicit
-  RegisterLocation(
-    const jive::output & output,
-    PointsToFlags pointsToFlags)
-    : Location(pointsToFlags)
-    , IsEscapingModule_(false)
-    , Output_(&output)
-  {}
+  if (is_gamma_output(&output)) {
+    auto dbgstr = jive::node_output::node(&output)->operation().debug_string();
+    return strfmt(dbgstr, ":out", index);
+  }
 
-  [[nodiscard]] const jive::output &
-  GetOutput() const noexcept
-  {
-    return *Output_;
+  if (is_import(&output)) {
+    auto import = AssertedCast<const jive::impport>(&output.port());
+    return strfmt("imp:", import->name());
   }
 
-  /** Determines whether the register location escapes the module.
-   *
-   * @return True, if the location escapes the module, otherwise false.
-   */
-  [[nodiscard]] bool
-  IsEscapingModule() const noexcept
-  {
-    return IsEscapingModule_;
+  if (is<phi::rvargument>(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":rvarg", index);
   }
 
-  void
-  SetIsEscapingModule(bool isEscapingModule) noexcept
-  {
-    IsEscapingModule_ = isEscapingModule;
+  if (is<phi::cvargument>(&output)) {
+    auto dbgstr = output.region()->node()->operation().debug_string();
+    return strfmt(dbgstr, ":cvarg", index);
   }
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    auto node = jive::node_output::node(Output_);
-    auto index = Output_->index();
+  return strfmt(jive::node_output::node(&output)->operation().debug_string(), ":", index);
+}
 
-    if (jive::is<jive::simple_op>(node)) {
-      auto nodestr = node->operation().debug_string();
-      auto outputstr = Output_->type().debug_string();
-      return strfmt(nodestr, ":", index, "[" + outputstr + "]");
-    }
+LocationSet::~LocationSet()
+= default;
 
-    if (is<lambda::cvargument>(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":cv:", index);
-    }
+LocationSet::LocationSet()
+  : NumDisjointSets_(0)
+{}
 
-    if (is<lambda::fctargument>(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":arg:", index);
-    }
+void
+LocationSet::Clear()
+{
+  Kinds_.clear();
+  Outputs_.clear();
+  PointsToFlags_.clear();
+  PointsTo_.clear();
+  IsEscapingModule_.clear();
+  FieldBases_.clear();
+  FieldOffsets_.clear();
+  IsCollapsed_.clear();
+  Fields_.clear();
+  Parents_.clear();
+  Ranks_.clear();
+  NumDisjointSets_ = 0;
+  RegisterLocations_.clear();
+}
 
-    if (is<delta::cvargument>(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":cv:", index);
-    }
+LocationIndex
+LocationSet::InsertLocation(
+  Kind kind,
+  const jive::output * output,
+  PointsToFlags pointsToFlags)
+{
+  JLM_ASSERT(NumLocations() < NoLocation);
+  auto location = static_cast<LocationIndex>(NumLocations());
+
+  Kinds_.push_back(kind);
+  Outputs_.push_back(output);
+  PointsToFlags_.push_back(pointsToFlags);
+  PointsTo_.push_back(NoLocation);
+  IsEscapingModule_.push_back(false);
+  FieldBases_.push_back(NoLocation);
+  FieldOffsets_.push_back(0);
+  IsCollapsed_.push_back(false);
+  Parents_.push_back(location);
+  Ranks_.push_back(0);
+  NumDisjointSets_++;
+
+  return location;
+}
 
-    if (is_gamma_argument(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":arg", index);
-    }
+LocationIndex
+LocationSet::InsertAllocaLocation(const jive::node & node)
+{
+  JLM_ASSERT(is<alloca_op>(&node));
+  return InsertLocation(Kind::Alloca, node.output(0), PointsToFlags::PointsToNone);
+}
 
-    if (is_theta_argument(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":arg", index);
-    }
+LocationIndex
+LocationSet::InsertMallocLocation(const jive::node & node)
+{
+  JLM_ASSERT(is<malloc_op>(&node));
+  return InsertLocation(Kind::Malloc, node.output(0), PointsToFlags::PointsToNone);
+}
 
-    if (is_theta_output(Output_)) {
-      auto dbgstr = jive::node_output::node(Output_)->operation().debug_string();
-      return strfmt(dbgstr, ":out", index);
-    }
+LocationIndex
+LocationSet::InsertLambdaLocation(const lambda::node & node)
+{
+  return InsertLocation(Kind::Lambda, node.output(), PointsToFlags::PointsToNone);
+}
 
-    if (is_gamma_output(Output_)) {
-      auto dbgstr = jive::node_output::node(Output_)->operation().debug_string();
-      return strfmt(dbgstr, ":out", index);
-    }
+LocationIndex
+LocationSet::InsertDeltaLocation(const delta::node & node)
+{
+  return InsertLocation(Kind::Delta, node.output(), PointsToFlags::PointsToNone);
+}
 
-    if (is_import(Output_)) {
-      auto import = AssertedCast<const jive::impport>(&Output_->port());
-      return strfmt("imp:", import->name());
-    }
+LocationIndex
+LocationSet::InsertDummyLocation()
+{
+  return InsertLocation(Kind::Dummy, nullptr, PointsToFlags::PointsToNone);
+}
 
-    if (is<phi::rvargument>(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":rvarg", index);
-    }
+LocationIndex
+LocationSet::InsertFieldLocation(
+  LocationIndex base,
+  size_t offset)
+{
+  JLM_ASSERT(offset != 0);
 
-    if (is<phi::cvargument>(Output_)) {
-      auto dbgstr = Output_->region()->node()->operation().debug_string();
-      return strfmt(dbgstr, ":cvarg", index);
-    }
+  auto location = InsertLocation(Kind::Field, nullptr, PointsToFlags::PointsToNone);
+  SetFieldBase(location, base, offset);
+  InsertField(base, offset, location);
 
-    return strfmt(jive::node_output::node(Output_)->operation().debug_string(), ":", index);
-  }
+  return location;
+}
 
-  [[nodiscard]] static bool
-  IsEscapingModule(const Location & location) noexcept
-  {
-      auto registerLocation = dynamic_cast<const RegisterLocation*>(&location);
-      return registerLocation
-             && registerLocation->IsEscapingModule();
-  }
+const std::map<size_t, LocationIndex> &
+LocationSet::GetFields(LocationIndex location) const noexcept
+{
+  static const std::map<size_t, LocationIndex> noFields;
 
-  static std::unique_ptr<RegisterLocation>
-  Create(
-    const jive::output & output,
-    PointsToFlags pointsToFlags)
-  {
-    return std::make_unique<RegisterLocation>(output, pointsToFlags);
-  }
+  auto it = Fields_.find(location);
+  return it != Fields_.end() ? it->second : noFields;
+}
 
-private:
-  bool IsEscapingModule_;
-  const jive::output * Output_;
-};
+std::map<size_t, LocationIndex>
+LocationSet::ExtractFields(LocationIndex location)
+{
+  auto it = Fields_.find(location);
+  if (it == Fields_.end())
+    return {};
+
+  auto fields = std::move(it->second);
+  Fields_.erase(it);
+
+  return fields;
+}
 
-/** \brief MemoryLocation class
+void
+LocationSet::InsertField(
+  LocationIndex location,
+  size_t offset,
+  LocationIndex field)
+{
+  JLM_ASSERT(GetFields(location).find(offset) == GetFields(location).end());
+  Fields_[location][offset] = field;
+}
+
+/** \brief FIXME: write documentation
 *
-* This class represents an abstract memory location.
+* FIXME: An import location should be a memory location, but we do not have a node to hand in.
 */
-class MemoryLocation : public Location {
-public:
-  constexpr
-  MemoryLocation()
-    : Location(PointsToFlags::PointsToNone)
-  {}
-};
+LocationIndex
+LocationSet::InsertImportLocation(const jive::argument & argument)
+{
+  JLM_ASSERT(dynamic_cast<const jlm::impport*>(&argument.port()));
+  auto pointerType = AssertedCast<const PointerType>(&argument.type());
 
-/** \brief AllocaLocation class
- *
- * This class represents an abstract stack location allocated by a alloca operation.
- */
-class AllocaLocation final : public MemoryLocation {
+  bool pointsToUnknownMemory = is<PointerType>(pointerType->GetElementType());
+  /**
+   * FIXME: We use pointsToUnknownMemory for pointsToExternalMemory
+   */
+  auto flags =
+    PointsToFlags::PointsToUnknownMemory |
+    PointsToFlags::PointsToExternalMemory |
+    PointsToFlags::PointsToEscapedMemory;
+
+  return InsertLocation(
+    Kind::Import,
+    &argument,
+    pointsToUnknownMemory ? flags : PointsToFlags::PointsToNone);
+}
 
-  ~AllocaLocation() override = default;
+bool
+LocationSet::Contains(const jive::output & output) const noexcept
+{
+  return RegisterLocations_.contains(output);
+}
 
-  constexpr explicit
-  AllocaLocation(const jive::node & node)
-    : MemoryLocation()
-    , Node_(node)
-  {
-    JLM_ASSERT(is<alloca_op>(&node));
-  }
+LocationIndex
+LocationSet::FindOrInsertRegisterLocation(
+  const jive::output & output,
+  PointsToFlags pointsToFlags)
+{
+  if (auto location = RegisterLocations_.lookup(output))
+    return GetRootLocation(*location);
 
-public:
-  [[nodiscard]] const jive::node &
-  GetNode() const noexcept
-  {
-    return Node_;
-  }
+  auto location = InsertLocation(Kind::Register, &output, pointsToFlags);
+  RegisterLocations_.insert(output, location);
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    return Node_.operation().debug_string();
-  }
+  return location;
+}
 
-  static std::unique_ptr<Location>
-  Create(const jive::node & node)
-  {
-    return std::unique_ptr<Location>(new AllocaLocation(node));
+LocationIndex
+LocationSet::GetRegisterLocation(const jive::output & output) const
+{
+  auto location = RegisterLocations_.lookup(output);
+  JLM_ASSERT(location != nullptr);
+
+  return *location;
+}
+
+LocationIndex
+LocationSet::Find(const jive::output & output)
+{
+  return GetRootLocation(GetRegisterLocation(output));
+}
+
+LocationIndex
+LocationSet::GetRootLocation(LocationIndex location) noexcept
+{
+  while (Parents_[location] != location) {
+    Parents_[location] = Parents_[Parents_[location]];
+    location = Parents_[location];
   }
 
-private:
-  const jive::node & Node_;
-};
+  return location;
+}
 
-/** \brief MallocLocation class
- *
- * This class represents an abstract heap location allocated by a malloc operation.
- */
-class MallocLocation final : public MemoryLocation {
+LocationIndex
+LocationSet::Merge(LocationIndex location1, LocationIndex location2)
+{
+  auto root1 = GetRootLocation(location1);
+  auto root2 = GetRootLocation(location2);
+  if (root1 == root2)
+    return root1;
 
-  ~MallocLocation() override = default;
+  if (Ranks_[root1] < Ranks_[root2])
+    std::swap(root1, root2);
 
-  constexpr explicit
-  MallocLocation(const jive::node & node)
-    : MemoryLocation()
-    , Node_(node)
-  {
-    JLM_ASSERT(is<malloc_op>(&node));
-  }
+  Parents_[root2] = root1;
+  if (Ranks_[root1] == Ranks_[root2])
+    Ranks_[root1]++;
 
-public:
-  [[nodiscard]] const jive::node &
-  GetNode() const noexcept
-  {
-    return Node_;
-  }
+  PointsToFlags_[root1] = PointsToFlags_[root1] | PointsToFlags_[root2];
+  IsCollapsed_[root1] = IsCollapsed_[root1] || IsCollapsed_[root2];
+  NumDisjointSets_--;
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
+  return root1;
+}
+
+std::string
+LocationSet::DebugString(LocationIndex location) const
+{
+  switch (GetKind(location))
   {
-    return Node_.operation().debug_string();
+    case Kind::Register:
+      return RegisterLocationDebugString(GetOutput(location));
+    case Kind::Alloca:
+    case Kind::Malloc:
+    case Kind::Lambda:
+    case Kind::Delta:
+      return jive::node_output::node(&GetOutput(location))->operation().debug_string();
+    case Kind::Import:
+      return "IMPORT[" + GetOutput(location).debug_string() + "]";
+    case Kind::Dummy:
+      return "UNNAMED";
+    case Kind::Field:
+      return "FIELD";
+    default:
+      JLM_UNREACHABLE("Unhandled location kind.");
   }
+}
+
+std::string
+LocationSet::ToDot()
+{
+  std::vector<std::vector<LocationIndex>> disjointSets(NumLocations());
+  for (LocationIndex location = 0; location < NumLocations(); location++)
+    disjointSets[GetRootLocation(location)].push_back(location);
 
-  static std::unique_ptr<Location>
-  Create(const jive::node & node)
+  auto dot_node = [&](LocationIndex rootLocation)
   {
-    return std::unique_ptr<Location>(new MallocLocation(node));
-  }
+    std::string setLabel;
+    for (auto & location : disjointSets[rootLocation]) {
+      auto unknownLabel = HasPointsToFlag(location, PointsToFlags::PointsToUnknownMemory) ? "{U}" : "";
+      auto pointsToEscapedMemoryLabel = HasPointsToFlag(location, PointsToFlags::PointsToEscapedMemory) ? "{E}" : "";
+      auto escapesModuleLabel = IsEscapingModule(location) ? "{EscapesModule}" : "";
+      auto pointsToLabel = strfmt("{pt:", (int64_t)GetPointsTo(location), "}");
+      auto locationLabel = strfmt(location, " : ", DebugString(location));
 
-private:
-  const jive::node & Node_;
-};
+      setLabel += location == rootLocation
+        ? strfmt("*",
+                 locationLabel,
+                 unknownLabel,
+                 pointsToEscapedMemoryLabel,
+                 escapesModuleLabel,
+                 pointsToLabel,
+                 "*\\n")
+        : strfmt(locationLabel, escapesModuleLabel, "\\n");
+    }
 
-/** \brief LambdaLocation class
- *
- * This class represents an abstract function location, statically allocated by a lambda operation.
- */
-class LambdaLocation final : public MemoryLocation {
+    return strfmt("{ ", rootLocation, " [label = \"", setLabel, "\"]; }");
+  };
 
-  ~LambdaLocation() override = default;
+  std::string str;
+  str.append("digraph PointsToGraph {\n");
 
-  constexpr explicit
-  LambdaLocation(const lambda::node & lambda)
-    : MemoryLocation()
-    , Lambda_(lambda)
-  {}
+  for (LocationIndex location = 0; location < NumLocations(); location++) {
+    if (disjointSets[location].empty())
+      continue;
 
-public:
-  [[nodiscard]] const lambda::node &
-  GetNode() const noexcept
-  {
-    return Lambda_;
-  }
+    str += dot_node(location) + "\n";
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    return Lambda_.operation().debug_string();
+    auto pointsTo = GetPointsTo(location);
+    if (pointsTo != NoLocation)
+      str += strfmt(location, " -> ", GetRootLocation(pointsTo)) + "\n";
   }
 
-  static std::unique_ptr<Location>
-  Create(const lambda::node & node)
-  {
-    return std::unique_ptr<Location>(new LambdaLocation(node));
-  }
+  str.append("}\n");
 
-private:
-  const lambda::node & Lambda_;
-};
+  return str;
+}
 
-/** \brief DeltaLocation class
- *
- * This class represents an abstract global variable location, statically allocated by a delta operation.
- */
-class DeltaLocation final : public MemoryLocation {
+Steensgaard::~Steensgaard()
+= default;
 
-  ~DeltaLocation() override = default;
+Steensgaard::Steensgaard()
+  : MaxFields_(0)
+  , IsJoining_(false)
+{}
 
-  constexpr explicit
-  DeltaLocation(const delta::node & delta)
-    : MemoryLocation()
-    , Delta_(delta)
-  {}
+Steensgaard::Steensgaard(size_t maxFields)
+  : MaxFields_(maxFields)
+  , IsJoining_(false)
+{
+  JLM_ASSERT(maxFields != 0);
+}
 
-public:
-  [[nodiscard]] const delta::node &
-  GetNode() const noexcept
-  {
-    return Delta_;
-  }
+void
+Steensgaard::join(LocationIndex x, LocationIndex y)
+{
+  /*
+   * The unification of two sets requires the unification of the sets they point to. We use a worklist instead of
+   * recursion as the points-to chains can be long.
+   */
+  PendingJoins_.emplace_back(x, y);
+  if (IsJoining_)
+    return;
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    return Delta_.operation().debug_string();
-  }
+  IsJoining_ = true;
+  while (!PendingJoins_.empty()) {
+    auto [location1, location2] = PendingJoins_.back();
+    PendingJoins_.pop_back();
 
-  static std::unique_ptr<Location>
-  Create(const delta::node & node)
-  {
-    return std::unique_ptr<Location>(new DeltaLocation(node));
-  }
+    auto root1 = LocationSet_.GetRootLocation(location1);
+    auto root2 = LocationSet_.GetRootLocation(location2);
+    if (root1 == root2)
+      continue;
 
-private:
-  const delta::node & Delta_;
-};
+    if (IsFieldSensitive())
+      MergeFieldSets(root1, root2);
+    else
+      MergeSets(root1, root2);
+  }
+  IsJoining_ = false;
+}
 
-/** \brief FIXME: write documentation
-*
-* FIXME: This class should be derived from a meloc, but we do not
-* have a node to hand in.
-*/
-class ImportLocation final : public Location {
-public:
-  ~ImportLocation() override = default;
+LocationIndex
+Steensgaard::MergeSets(LocationIndex root1, LocationIndex root2)
+{
+  auto pointsTo1 = LocationSet_.GetPointsTo(root1);
+  auto pointsTo2 = LocationSet_.GetPointsTo(root2);
+  auto root = LocationSet_.Merge(root1, root2);
 
-  ImportLocation(
-    const jive::argument & argument,
-    PointsToFlags pointsToFlags)
-    : Location(pointsToFlags)
-    , Argument_(argument)
-  {
-    JLM_ASSERT(dynamic_cast<const jlm::impport*>(&argument.port()));
+  if (pointsTo1 == LocationSet::NoLocation) {
+    LocationSet_.SetPointsTo(root, pointsTo2);
+    return root;
   }
 
-  [[nodiscard]] const jive::argument &
-  GetArgument() const noexcept
-  {
-    return Argument_;
-  }
+  LocationSet_.SetPointsTo(root, pointsTo1);
+  if (pointsTo2 != LocationSet::NoLocation)
+    PendingJoins_.emplace_back(pointsTo1, pointsTo2);
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    return "IMPORT[" + Argument_.debug_string() + "]";
-  }
+  return root;
+}
 
-  static std::unique_ptr<Location>
-  Create(const jive::argument & argument)
-  {
-    auto pointerType = AssertedCast<const PointerType>(&argument.type());
+void
+Steensgaard::MergeFieldSets(LocationIndex root1, LocationIndex root2)
+{
+  auto [object1, offset1] = ResolveField(root1);
+  auto [object2, offset2] = ResolveField(root2);
+  auto isField1 = object1 != root1;
+  auto isField2 = object2 != root2;
+
+  /*
+   * Both sets are part of the same memory.
+   */
+  if (object1 == object2) {
+    if (offset1 != offset2) {
+      Collapse(object1);
+      PendingJoins_.emplace_back(root1, root2);
+      return;
+    }
+
+    if (isField1 && isField2) {
+      auto root = MergeSets(root1, root2);
+      LocationSet_.SetFieldBase(root, object1, offset1);
+      if (LocationSet_.IsCollapsed(object1))
+        PendingJoins_.emplace_back(object1, root);
+      return;
+    }
 
-    bool pointsToUnknownMemory = is<PointerType>(pointerType->GetElementType());
-    /**
-     * FIXME: We use pointsToUnknownMemory for pointsToExternalMemory
+    /*
+     * One of the sets is the memory itself, i.e., the other set is a field of a collapsed set.
      */
-    auto flags =
-      PointsToFlags::PointsToUnknownMemory |
-      PointsToFlags::PointsToExternalMemory |
-      PointsToFlags::PointsToEscapedMemory;
-    return std::unique_ptr<Location>(new ImportLocation(
-      argument,
-      pointsToUnknownMemory ? flags : PointsToFlags::PointsToNone));
+    auto fields = LocationSet_.ExtractFields(object1);
+    auto root = MergeSets(root1, root2);
+    LocationSet_.ClearFieldBase(root);
+    for (auto & [offset, field] : fields)
+      LocationSet_.InsertField(root, offset, field);
+    return;
   }
 
-private:
-  const jive::argument & Argument_;
-};
-
-/** \brief FIXME: write documentation
-*/
-class DummyLocation final : public Location {
-public:
-  ~DummyLocation() override = default;
+  /*
+   * Fields of collapsed sets are unified with them first.
+   */
+  if ((isField1 && LocationSet_.IsCollapsed(object1)) || (isField2 && LocationSet_.IsCollapsed(object2))) {
+    PendingJoins_.emplace_back(root1, root2);
+    if (isField1 && LocationSet_.IsCollapsed(object1))
+      PendingJoins_.emplace_back(object1, root1);
+    if (isField2 && LocationSet_.IsCollapsed(object2))
+      PendingJoins_.emplace_back(object2, root2);
+    return;
+  }
 
-  DummyLocation()
-    : Location(PointsToFlags::PointsToNone)
-  {}
+  /*
+   * Both sets represent the beginning of their memory. Their fields are unified pairwise.
+   */
+  if (!isField1 && !isField2) {
+    auto fields1 = LocationSet_.ExtractFields(root1);
+    auto fields2 = LocationSet_.ExtractFields(root2);
+    auto root = MergeSets(root1, root2);
+
+    for (auto & [offset, field] : fields1)
+      LocationSet_.InsertField(root, offset, field);
+
+    for (auto & [offset, field] : fields2) {
+      if (auto it = fields1.find(offset); it != fields1.end())
+        PendingJoins_.emplace_back(it->second, field);
+      else
+        LocationSet_.InsertField(root, offset, field);
+    }
 
-  [[nodiscard]] std::string
-  DebugString() const noexcept override
-  {
-    return "UNNAMED";
+    if (LocationSet_.IsCollapsed(root) || LocationSet_.GetFields(root).size() > MaxFields_)
+      Collapse(root);
+    return;
   }
 
-  static std::unique_ptr<Location>
-  Create()
-  {
-    return std::make_unique<DummyLocation>();
+  /*
+   * Both sets are fields of different memory. The memory is unified if the fields are at the same offset, otherwise
+   * it is collapsed.
+   */
+  if (isField1 && isField2) {
+    if (offset1 != offset2) {
+      Collapse(object1);
+      Collapse(object2);
+      PendingJoins_.emplace_back(root1, root2);
+      PendingJoins_.emplace_back(object1, object2);
+      return;
+    }
+
+    auto root = MergeSets(root1, root2);
+    LocationSet_.SetFieldBase(root, object1, offset1);
+    PendingJoins_.emplace_back(object1, object2);
+    return;
   }
-};
 
-LocationSet::~LocationSet()
-= default;
+  /*
+   * One set is a field, while the other set represents the beginning of its memory. The latter becomes part of the
+   * field, and its fields are moved accordingly.
+   */
+  auto field = isField1 ? root1 : root2;
+  auto memory = isField1 ? root2 : root1;
+  auto [object, offset] = isField1 ? std::make_pair(object1, offset1) : std::make_pair(object2, offset2);
 
-LocationSet::LocationSet()
-= default;
+  if (LocationSet_.IsCollapsed(memory)) {
+    Collapse(object);
+    PendingJoins_.emplace_back(field, memory);
+    return;
+  }
 
-void
-LocationSet::Clear()
-{
-  LocationMap_.clear();
-  DisjointLocationSet_.clear();
-  Locations_.clear();
+  for (auto & [memoryFieldOffset, memoryField] : LocationSet_.ExtractFields(memory))
+    PendingJoins_.emplace_back(memoryField, GetFieldLocation(object, static_cast<int64_t>(memoryFieldOffset)));
+
+  auto root = MergeSets(field, memory);
+  LocationSet_.SetFieldBase(root, object, offset);
 }
 
-RegisterLocation &
-LocationSet::InsertRegisterLocation(
-  const jive::output & output,
-  PointsToFlags pointsToFlags)
+std::pair<LocationIndex, size_t>
+Steensgaard::ResolveField(LocationIndex location)
 {
-  JLM_ASSERT(!Contains(output));
+  auto root = LocationSet_.GetRootLocation(location);
 
-  auto registerLocation = RegisterLocation::Create(output, pointsToFlags);
-  auto registerLocationPointer = registerLocation.get();
+  auto object = root;
+  size_t offset = 0;
+  while (LocationSet_.GetFieldBase(object) != LocationSet::NoLocation) {
+    offset += LocationSet_.GetFieldOffset(object);
+    object = LocationSet_.GetRootLocation(LocationSet_.GetFieldBase(object));
+  }
 
-  LocationMap_[&output] = registerLocationPointer;
-  DisjointLocationSet_.insert(registerLocationPointer);
-  Locations_.push_back(std::move(registerLocation));
+  /*
+   * Shorten the chain of field bases for subsequent queries.
+   */
+  if (object != root)
+    LocationSet_.SetFieldBase(root, object, offset);
 
-  return *registerLocationPointer;
+  return {object, LocationSet_.IsCollapsed(object) ? 0 : offset};
 }
 
-Location &
-LocationSet::InsertAllocaLocation(const jive::node & node)
+LocationIndex
+Steensgaard::GetFieldLocation(LocationIndex location, int64_t offset)
 {
-  Locations_.push_back(AllocaLocation::Create(node));
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+  auto [object, objectOffset] = ResolveField(location);
+  if (LocationSet_.IsCollapsed(object))
+    return object;
 
-  return *location;
-}
+  auto fieldOffset = static_cast<int64_t>(objectOffset) + offset;
+  if (fieldOffset == 0)
+    return object;
 
-Location &
-LocationSet::InsertMallocLocation(const jive::node & node)
-{
-  Locations_.push_back(MallocLocation::Create(node));
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+  if (fieldOffset < 0) {
+    Collapse(object);
+    return LocationSet_.GetRootLocation(object);
+  }
 
-  return *location;
-}
+  auto & fields = LocationSet_.GetFields(object);
+  if (auto it = fields.find(fieldOffset); it != fields.end())
+    return LocationSet_.GetRootLocation(it->second);
 
-Location &
-LocationSet::InsertLambdaLocation(const lambda::node & node)
-{
-  Locations_.push_back(LambdaLocation::Create(node));
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+  if (fields.size() >= MaxFields_) {
+    Collapse(object);
+    return LocationSet_.GetRootLocation(object);
+  }
 
-  return *location;
+  return LocationSet_.InsertFieldLocation(object, fieldOffset);
 }
 
-Location &
-LocationSet::InsertDeltaLocation(const delta::node & node)
+void
+Steensgaard::Collapse(LocationIndex location)
 {
-  Locations_.push_back(DeltaLocation::Create(node));
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+  auto object = ResolveField(location).first;
 
-  return *location;
+  LocationSet_.MarkAsCollapsed(object);
+  for (auto & [offset, field] : LocationSet_.ExtractFields(object))
+    join(object, field);
 }
 
-Location &
-LocationSet::InsertDummyLocation()
+void
+Steensgaard::CollapseOverlappingAccesses()
 {
-  Locations_.push_back(DummyLocation::Create());
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+  /*
+   * Collapsing a set can unify it with other sets and thereby create new overlaps. We therefore iterate until a fixed
+   * point is reached.
+   */
+  bool collapsed = true;
+  while (collapsed) {
+    collapsed = false;
 
-  return *location;
-}
+    for (auto & access : MemoryAccesses_) {
+      if (!access.MayContainPointers)
+        continue;
 
-Location &
-LocationSet::InsertImportLocation(const jive::argument & argument)
-{
-  Locations_.push_back(ImportLocation::Create(argument));
-  auto location = Locations_.back().get();
-  DisjointLocationSet_.insert(location);
+      auto pointsTo = LocationSet_.GetPointsTo(LocationSet_.Find(*access.Address));
+      if (pointsTo == LocationSet::NoLocation)
+        continue;
 
-  return *location;
-}
+      auto [object, offset] = ResolveField(pointsTo);
+      if (LocationSet_.IsCollapsed(object))
+        continue;
 
-RegisterLocation *
-LocationSet::LookupRegisterLocation(const jive::output & output)
-{
-  auto it = LocationMap_.find(&output);
-  return it == LocationMap_.end() ? nullptr : it->second;
+      auto & fields = LocationSet_.GetFields(object);
+      auto it = fields.upper_bound(offset);
+      if (it != fields.end() && it->first - offset < access.Size) {
+        Collapse(object);
+        collapsed = true;
+      }
+    }
+
+    /*
+     * Unify the fields of collapsed sets that were not yet unified with them.
+     */
+    for (LocationIndex location = 0; location < LocationSet_.NumLocations(); location++) {
+      auto object = ResolveField(location).first;
+      if (object != LocationSet_.GetRootLocation(location) && LocationSet_.IsCollapsed(object)) {
+        join(object, location);
+        collapsed = true;
+      }
+    }
+  }
 }
 
-bool
-LocationSet::Contains(const jive::output & output) const noexcept
+void
+Steensgaard::PropagateFieldPointerFlags()
 {
-  return LocationMap_.find(&output) != LocationMap_.end();
+  bool changed = true;
+  while (changed) {
+    changed = false;
+
+    for (auto & [base, fieldPointer] : FieldPointers_) {
+      auto baseLocation = LocationSet_.Find(*base);
+      auto fieldPointerLocation = LocationSet_.Find(*fieldPointer);
+
+      auto flags = LocationSet_.GetPointsToFlags(fieldPointerLocation);
+      auto newFlags = flags | LocationSet_.GetPointsToFlags(baseLocation);
+      if (newFlags != flags) {
+        LocationSet_.SetPointsToFlags(fieldPointerLocation, newFlags);
+        changed = true;
+      }
+    }
+  }
 }
 
-Location &
-LocationSet::FindOrInsertRegisterLocation(
-  const jive::output & output,
-  PointsToFlags pointsToFlags)
+LocationIndex
+Steensgaard::GetOrInsertPointsTo(const jive::output & address)
 {
-  if (auto location = LookupRegisterLocation(output))
-    return GetRootLocation(*location);
+  auto addressLocation = LocationSet_.Find(address);
+  if (LocationSet_.GetPointsTo(addressLocation) == LocationSet::NoLocation)
+    LocationSet_.SetPointsTo(addressLocation, LocationSet_.InsertDummyLocation());
 
-  return InsertRegisterLocation(output, pointsToFlags);
+  return LocationSet_.GetRootLocation(LocationSet_.GetPointsTo(addressLocation));
 }
 
-Location &
-LocationSet::GetRootLocation(Location & l) const
+/**
+ * @return The allocation size of \p type, or nothing if its size is not statically known or the module has no valid
+ * data layout.
+ */
+static std::optional<size_t>
+GetStaticTypeSize(
+  const jive::type & type,
+  const std::optional<DataLayout> & dataLayout)
 {
-  return *GetSet(l).value();
+  auto valueType = dynamic_cast<const jive::valuetype*>(&type);
+  if (valueType == nullptr || !dataLayout)
+    return std::nullopt;
+
+  try {
+    return dataLayout->GetTypeAllocSize(*valueType);
+  } catch (const error &) {
+    return std::nullopt;
+  }
 }
 
-Location &
-LocationSet::Find(const jive::output & output)
+static bool
+MayContainPointers(const jive::type & type)
 {
-  auto location = LookupRegisterLocation(output);
-  JLM_ASSERT(location != nullptr);
+  if (jive::is<jive::bittype>(type) || jive::is<fptype>(type))
+    return false;
 
-  return GetRootLocation(*location);
-}
+  if (auto vectorType = dynamic_cast<const vectortype*>(&type))
+    return MayContainPointers(vectorType->type());
 
-Location &
-LocationSet::Merge(Location & location1, Location & location2)
-{
-  return *DisjointLocationSet_.merge(&location1, &location2)->value();
+  if (auto arrayType = dynamic_cast<const arraytype*>(&type))
+    return MayContainPointers(arrayType->element_type());
+
+  if (auto structType = dynamic_cast<const StructType*>(&type)) {
+    auto & declaration = structType->GetDeclaration();
+    for (size_t n = 0; n < declaration.nelements(); n++) {
+      if (MayContainPointers(declaration.element(n)))
+        return true;
+    }
+
+    return false;
+  }
+
+  return true;
 }
 
-std::string
-LocationSet::ToDot() const
+/**
+ * Computes the byte offset of a getelementptr from its base pointer.
+ *
+ * @return The byte offset, or nothing if an index is not a constant or the offset cannot be determined statically.
+ */
+static std::optional<int64_t>
+GetConstantGepOffset(
+  const jive::simple_node & node,
+  const std::optional<DataLayout> & dataLayout)
 {
-  auto dot_node = [](const DisjointLocationSet::set & set)
-  {
-    auto rootLocation = set.value();
+  if (!dataLayout)
+    return std::nullopt;
 
-    std::string setLabel;
-    for (auto & location : set) {
-      auto unknownLabel = location->PointsToUnknownMemory() ? "{U}" : "";
-      auto pointsToEscapedMemoryLabel = location->PointsToEscapedMemory() ? "{E}" : "";
-      auto escapesModuleLabel = RegisterLocation::IsEscapingModule(*location) ? "{EscapesModule}" : "";
-      auto pointsToLabel = strfmt("{pt:", (intptr_t) location->GetPointsTo(), "}");
-      auto locationLabel = strfmt((intptr_t)location, " : ", location->DebugString());
+  auto GetConstantIndex = [](const jive::input & input) -> std::optional<int64_t>
+  {
+    auto node = jive::node_output::node(input.origin());
+    if (!jive::is<jive::simple_op>(node))
+      return std::nullopt;
 
-      setLabel += location == rootLocation
-        ? strfmt("*",
-                 locationLabel,
-                 unknownLabel,
-                 pointsToEscapedMemoryLabel,
-                 escapesModuleLabel,
-                 pointsToLabel,
-                 "*\\n")
-        : strfmt(locationLabel, escapesModuleLabel, "\\n");
-    }
+    auto constant = dynamic_cast<const jive::bitconstant_op*>(&node->operation());
+    if (constant == nullptr || !constant->value().is_known())
+      return std::nullopt;
 
-    return strfmt("{ ", (intptr_t)&set, " [label = \"", setLabel, "\"]; }");
+    return constant->value().to_int();
   };
 
-  auto dot_edge = [&](const DisjointLocationSet::set & set, const DisjointLocationSet::set & pointsToSet)
-  {
-    return strfmt((intptr_t)&set, " -> ", (intptr_t)&pointsToSet);
-  };
+  auto & op = *AssertedCast<const getelementptr_op>(&node.operation());
+  auto type = &op.pointee_type();
 
-  std::string str;
-  str.append("digraph PointsToGraph {\n");
+  int64_t offset = 0;
+  for (size_t n = 1; n < node.ninputs(); n++) {
+    auto index = GetConstantIndex(*node.input(n));
+    if (!index)
+      return std::nullopt;
 
-  for (auto & set : DisjointLocationSet_) {
-    str += dot_node(set) + "\n";
+    /*
+     * The first index steps over the pointee type itself.
+     */
+    if (n == 1) {
+      auto size = GetStaticTypeSize(*type, dataLayout);
+      if (!size)
+        return std::nullopt;
 
-    auto pointsTo = set.value()->GetPointsTo();
-    if (pointsTo != nullptr) {
-      auto pointsToSet = DisjointLocationSet_.find(pointsTo);
-      str += dot_edge(set, *pointsToSet) + "\n";
+      offset += *index * static_cast<int64_t>(*size);
+      continue;
     }
-  }
 
-  str.append("}\n");
-
-  return str;
-}
+    if (auto structType = dynamic_cast<const StructType*>(type)) {
+      auto & declaration = structType->GetDeclaration();
+      if (*index < 0 || static_cast<size_t>(*index) >= declaration.nelements())
+        return std::nullopt;
 
-Steensgaard::~Steensgaard()
-= default;
+      try {
+        offset += static_cast<int64_t>(dataLayout->GetElementOffset(*structType, *index));
+      } catch (const error &) {
+        return std::nullopt;
+      }
 
-void
-Steensgaard::join(Location & x, Location & y)
-{
-  std::function<Location*(Location*, Location*)>
-    join = [&](Location * x, Location * y)
-  {
-    if (x == nullptr)
-      return y;
+      type = &declaration.element(*index);
+      continue;
+    }
 
-    if (y == nullptr)
-      return x;
+    const jive::valuetype * elementType = nullptr;
+    if (auto arrayType = dynamic_cast<const arraytype*>(type))
+      elementType = &arrayType->element_type();
+    else if (auto vectorType = dynamic_cast<const fixedvectortype*>(type))
+      elementType = &vectorType->type();
+    else
+      return std::nullopt;
 
-    if (x == y)
-      return x;
+    auto size = GetStaticTypeSize(*elementType, dataLayout);
+    if (!size)
+      return std::nullopt;
 
-    auto & rootx = LocationSet_.GetRootLocation(*x);
-    auto & rooty = LocationSet_.GetRootLocation(*y);
-    auto flags = rootx.GetPointsToFlags() | rooty.GetPointsToFlags();
-    rootx.SetPointsToFlags(flags);
-    rooty.SetPointsToFlags(flags);
-    auto & tmp = LocationSet_.Merge(rootx, rooty);
+    offset += *index * static_cast<int64_t>(*size);
+    type = elementType;
+  }
 
-    if (auto root = join(rootx.GetPointsTo(), rooty.GetPointsTo()))
-      tmp.SetPointsTo(*root);
+  return offset;
+}
 
-    return &tmp;
-  };
+void
+Steensgaard::RecordMemoryAccess(
+  const jive::output & address,
+  const jive::type & type)
+{
+  if (!IsFieldSensitive())
+    return;
 
-  join(&x, &y);
+  auto size = GetStaticTypeSize(type, DataLayout_).value_or(std::numeric_limits<size_t>::max());
+  MemoryAccesses_.push_back({&address, size, MayContainPointers(type)});
 }
 
 void
@@ -839,6 +997,7 @@ Steensgaard::Analyze(const jive::simple_node & node)
        , {typeid(ConstantPointerNullOperation), [](auto & s, auto & n){ s.AnalyzeConstantPointerNull(n);   }}
        , {typeid(UndefValueOperation),          [](auto & s, auto & n){ s.AnalyzeUndef(n);                 }}
        , {typeid(Memcpy),                       [](auto & s, auto & n){ s.AnalyzeMemcpy(n);                }}
+       , {typeid(free_op),                      [](auto & s, auto & n){ s.AnalyzeFree(n);                  }}
        , {typeid(ConstantArray),                [](auto & s, auto & n){ s.AnalyzeConstantArray(n);         }}
        , {typeid(ConstantStruct),               [](auto & s, auto & n){ s.AnalyzeConstantStruct(n);        }}
        , {typeid(ConstantAggregateZero),        [](auto & s, auto & n){ s.AnalyzeConstantAggregateZero(n); }}
@@ -846,8 +1005,8 @@ Steensgaard::Analyze(const jive::simple_node & node)
      });
 
   auto & op = node.operation();
-  if (nodes.find(typeid(op)) != nodes.end()) {
-    nodes[typeid(op)](*this, node);
+  if (auto it = nodes.find(typeid(op)); it != nodes.end()) {
+    it->second(*this, node);
     return;
   }
 
@@ -889,13 +1048,13 @@ Steensgaard::AnalyzeAlloca(const jive::simple_node & node)
     return false;
   };
 
-  auto & allocaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
+  auto allocaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
     *node.output(0),
     PointsToFlags::PointsToNone);
-  auto & allocaLocation = LocationSet_.InsertAllocaLocation(node);
-  allocaOutputLocation.SetPointsTo(allocaLocation);
+  auto allocaLocation = LocationSet_.InsertAllocaLocation(node);
+  LocationSet_.SetPointsTo(allocaOutputLocation, allocaLocation);
 
-  auto & op = *dynamic_cast<const alloca_op*>(&node.operation());
+  auto & op = *AssertedCast<const alloca_op>(&node.operation());
   /*
     FIXME: We should discover such an alloca already at construction time
     and not by traversing the type here.
@@ -904,7 +1063,8 @@ Steensgaard::AnalyzeAlloca(const jive::simple_node & node)
     /*
       FIXME: We should be able to do better than just pointing to unknown.
     */
-    allocaLocation.SetPointsToFlags(PointsToFlags::PointsToUnknownMemory);
+    LocationSet_.SetPointsToFlags(allocaLocation, PointsToFlags::PointsToUnknownMemory);
+    LocationSet_.MarkAsCollapsed(allocaLocation);
   }
 }
 
@@ -913,30 +1073,32 @@ Steensgaard::AnalyzeMalloc(const jive::simple_node & node)
 {
   JLM_ASSERT(is<malloc_op>(&node));
 
-  auto & mallocOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
+  auto mallocOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
     *node.output(0),
     PointsToFlags::PointsToNone);
-  auto & mallocLocation = LocationSet_.InsertMallocLocation(node);
-  mallocOutputLocation.SetPointsTo(mallocLocation);
+  auto mallocLocation = LocationSet_.InsertMallocLocation(node);
+  LocationSet_.SetPointsTo(mallocOutputLocation, mallocLocation);
 }
 
 void
 Steensgaard::AnalyzeLoad(const LoadNode & loadNode)
 {
+  RecordMemoryAccess(*loadNode.GetAddressInput()->origin(), loadNode.GetValueOutput()->type());
+
   if (!is<PointerType>(loadNode.GetValueOutput()->type()))
     return;
 
-  auto & address = LocationSet_.Find(*loadNode.GetAddressInput()->origin());
-  auto & result = LocationSet_.FindOrInsertRegisterLocation(
+  auto address = LocationSet_.Find(*loadNode.GetAddressInput()->origin());
+  auto result = LocationSet_.FindOrInsertRegisterLocation(
     *loadNode.GetValueOutput(),
-    address.GetPointsToFlags());
+    LocationSet_.GetPointsToFlags(address));
 
-  if (address.GetPointsTo() == nullptr) {
-    address.SetPointsTo(result);
+  if (LocationSet_.GetPointsTo(address) == LocationSet::NoLocation) {
+    LocationSet_.SetPointsTo(address, result);
     return;
   }
 
-  join(result, *address.GetPointsTo());
+  join(result, LocationSet_.GetPointsTo(address));
 }
 
 void
@@ -945,18 +1107,20 @@ Steensgaard::AnalyzeStore(const StoreNode & storeNode)
   auto & address = *storeNode.GetAddressInput()->origin();
   auto & value = *storeNode.GetValueInput()->origin();
 
+  RecordMemoryAccess(address, value.type());
+
   if (!is<PointerType>(value.type()))
     return;
 
-  auto & addressLocation = LocationSet_.Find(address);
-  auto & valueLocation = LocationSet_.Find(value);
+  auto addressLocation = LocationSet_.Find(address);
+  auto valueLocation = LocationSet_.Find(value);
 
-  if (addressLocation.GetPointsTo() == nullptr) {
-    addressLocation.SetPointsTo(valueLocation);
+  if (LocationSet_.GetPointsTo(addressLocation) == LocationSet::NoLocation) {
+    LocationSet_.SetPointsTo(addressLocation, valueLocation);
     return;
   }
 
-  join(*addressLocation.GetPointsTo(), valueLocation);
+  join(LocationSet_.GetPointsTo(addressLocation), valueLocation);
 }
 
 void
@@ -977,8 +1141,8 @@ Steensgaard::AnalyzeCall(const CallNode & callNode)
       if (!is<PointerType>(callArgument.type()))
         continue;
 
-      auto & callArgumentLocation = LocationSet_.Find(callArgument);
-      auto & lambdaArgumentLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto callArgumentLocation = LocationSet_.Find(callArgument);
+      auto lambdaArgumentLocation = LocationSet_.FindOrInsertRegisterLocation(
         lambdaArgument,
         PointsToFlags::PointsToNone);
 
@@ -995,10 +1159,10 @@ Steensgaard::AnalyzeCall(const CallNode & callNode)
       if (!is<PointerType>(callResult.type()))
         continue;
 
-      auto & callResultLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto callResultLocation = LocationSet_.FindOrInsertRegisterLocation(
         callResult,
         PointsToFlags::PointsToNone);
-      auto & lambdaResultLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto lambdaResultLocation = LocationSet_.FindOrInsertRegisterLocation(
         lambdaResult,
         PointsToFlags::PointsToNone);
 
@@ -1017,8 +1181,8 @@ Steensgaard::AnalyzeCall(const CallNode & callNode)
 
       if (is<PointerType>(callArgument.type()))
       {
-        auto registerLocation = LocationSet_.LookupRegisterLocation(callArgument);
-        registerLocation->SetIsEscapingModule(true);
+        auto registerLocation = LocationSet_.GetRegisterLocation(callArgument);
+        LocationSet_.MarkAsEscapingModule(registerLocation);
       }
     }
 
@@ -1078,9 +1242,36 @@ void
 Steensgaard::AnalyzeGep(const jive::simple_node & node)
 {
   JLM_ASSERT(is<getelementptr_op>(&node));
+  auto & baseOutput = *node.input(0)->origin();
+
+  auto offset = IsFieldSensitive() ? GetConstantGepOffset(node, DataLayout_) : 0;
+  if (offset != 0) {
+    /*
+     * The getelementptr points to a field of the memory its base points to.
+     */
+    if (offset) {
+      auto field = GetFieldLocation(GetOrInsertPointsTo(baseOutput), *offset);
+      auto value = LocationSet_.FindOrInsertRegisterLocation(
+        *node.output(0),
+        LocationSet_.GetPointsToFlags(LocationSet_.Find(baseOutput)));
+
+      if (LocationSet_.GetPointsTo(value) == LocationSet::NoLocation)
+        LocationSet_.SetPointsTo(value, field);
+      else
+        join(LocationSet_.GetPointsTo(value), field);
+
+      FieldPointers_.emplace_back(&baseOutput, node.output(0));
+      return;
+    }
+
+    /*
+     * The getelementptr can point anywhere within the memory its base points to.
+     */
+    Collapse(GetOrInsertPointsTo(baseOutput));
+  }
 
-  auto & base = LocationSet_.Find(*node.input(0)->origin());
-  auto & value = LocationSet_.FindOrInsertRegisterLocation(
+  auto base = LocationSet_.Find(baseOutput);
+  auto value = LocationSet_.FindOrInsertRegisterLocation(
     *node.output(0),
     PointsToFlags::PointsToNone);
 
@@ -1096,8 +1287,8 @@ Steensgaard::AnalyzeBitcast(const jive::simple_node & node)
   if (!is<PointerType>(input->type()))
     return;
 
-  auto & operand = LocationSet_.Find(*input->origin());
-  auto & result = LocationSet_.FindOrInsertRegisterLocation(
+  auto operand = LocationSet_.Find(*input->origin());
+  auto result = LocationSet_.FindOrInsertRegisterLocation(
     *node.output(0),
     PointsToFlags::PointsToNone);
 
@@ -1194,8 +1385,8 @@ Steensgaard::AnalyzeConstantArray(const jive::simple_node & node)
     auto input = node.input(n);
 
     if (LocationSet_.Contains(*input->origin())) {
-      auto & originLocation = LocationSet_.Find(*input->origin());
-      auto & outputLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto originLocation = LocationSet_.Find(*input->origin());
+      auto outputLocation = LocationSet_.FindOrInsertRegisterLocation(
         *node.output(0),
         PointsToFlags::PointsToNone);
       join(outputLocation, originLocation);
@@ -1212,8 +1403,8 @@ Steensgaard::AnalyzeConstantStruct(const jive::simple_node & node)
     auto input = node.input(n);
 
     if (LocationSet_.Contains(*input->origin())) {
-      auto & originLocation = LocationSet_.Find(*input->origin());
-      auto & outputLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto originLocation = LocationSet_.Find(*input->origin());
+      auto outputLocation = LocationSet_.FindOrInsertRegisterLocation(
         *node.output(0),
         PointsToFlags::PointsToNone);
       join(outputLocation, originLocation);
@@ -1234,41 +1425,65 @@ Steensgaard::AnalyzeMemcpy(const jive::simple_node & node)
     FIXME: write some documentation about the implementation
   */
 
-  auto & dstAddress = LocationSet_.Find(*node.input(0)->origin());
-  auto & srcAddress = LocationSet_.Find(*node.input(1)->origin());
+  auto dstAddress = LocationSet_.Find(*node.input(0)->origin());
+  auto srcAddress = LocationSet_.Find(*node.input(1)->origin());
 
-  if (srcAddress.GetPointsTo() == nullptr) {
+  if (LocationSet_.GetPointsTo(srcAddress) == LocationSet::NoLocation) {
     /*
       If we do not know where the source address points to yet(!),
       insert a dummy location so we have something to work with.
     */
-    auto & dummyLocation = LocationSet_.InsertDummyLocation();
-    srcAddress.SetPointsTo(dummyLocation);
+    auto dummyLocation = LocationSet_.InsertDummyLocation();
+    LocationSet_.SetPointsTo(srcAddress, dummyLocation);
   }
 
-  if (dstAddress.GetPointsTo() == nullptr) {
+  if (LocationSet_.GetPointsTo(dstAddress) == LocationSet::NoLocation) {
     /*
       If we do not know where the destination address points to yet(!),
       insert a dummy location so we have somehting to work with.
     */
-    auto & dummyLocation = LocationSet_.InsertDummyLocation();
-    dstAddress.SetPointsTo(dummyLocation);
+    auto dummyLocation = LocationSet_.InsertDummyLocation();
+    LocationSet_.SetPointsTo(dstAddress, dummyLocation);
   }
 
-  auto & srcMemory = LocationSet_.GetRootLocation(*srcAddress.GetPointsTo());
-  auto & dstMemory = LocationSet_.GetRootLocation(*dstAddress.GetPointsTo());
+  auto srcMemory = LocationSet_.GetRootLocation(LocationSet_.GetPointsTo(srcAddress));
+  auto dstMemory = LocationSet_.GetRootLocation(LocationSet_.GetPointsTo(dstAddress));
 
-  if (srcMemory.GetPointsTo() == nullptr) {
-    auto & dummyLocation = LocationSet_.InsertDummyLocation();
-    srcMemory.SetPointsTo(dummyLocation);
+  if (IsFieldSensitive()) {
+    /*
+     * The fields of the memory are copied as well. We do not copy them individually, but collapse the memory.
+     */
+    Collapse(srcMemory);
+    Collapse(dstMemory);
+    srcMemory = GetOrInsertPointsTo(*node.input(1)->origin());
+    dstMemory = GetOrInsertPointsTo(*node.input(0)->origin());
+  }
+
+  if (LocationSet_.GetPointsTo(srcMemory) == LocationSet::NoLocation) {
+    auto dummyLocation = LocationSet_.InsertDummyLocation();
+    LocationSet_.SetPointsTo(srcMemory, dummyLocation);
   }
 
-  if (dstMemory.GetPointsTo() == nullptr) {
-    auto & dummyLocation = LocationSet_.InsertDummyLocation();
-    dstMemory.SetPointsTo(dummyLocation);
+  if (LocationSet_.GetPointsTo(dstMemory) == LocationSet::NoLocation) {
+    auto dummyLocation = LocationSet_.InsertDummyLocation();
+    LocationSet_.SetPointsTo(dstMemory, dummyLocation);
   }
 
-  join(*srcMemory.GetPointsTo(), *dstMemory.GetPointsTo());
+  join(LocationSet_.GetPointsTo(srcMemory), LocationSet_.GetPointsTo(dstMemory));
+}
+
+void
+Steensgaard::AnalyzeFree(const jive::simple_node & node)
+{
+  JLM_ASSERT(is<free_op>(&node));
+
+  if (!IsFieldSensitive())
+    return;
+
+  /*
+   * A free releases the entire memory.
+   */
+  MemoryAccesses_.push_back({node.input(0)->origin(), std::numeric_limits<size_t>::max(), false});
 }
 
 void
@@ -1281,8 +1496,8 @@ Steensgaard::Analyze(const lambda::node & lambda)
     if (!jive::is<PointerType>(cv.type()))
       continue;
 
-    auto & originLocation = LocationSet_.Find(*cv.origin());
-    auto & argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
+    auto originLocation = LocationSet_.Find(*cv.origin());
+    auto argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
       *cv.argument(),
       PointsToFlags::PointsToNone);
     join(originLocation, argumentLocation);
@@ -1318,21 +1533,21 @@ Steensgaard::Analyze(const lambda::node & lambda)
    */
   for (auto & result : lambda.fctresults()) {
     if (jive::is<PointerType>(result.type())) {
-      auto registerLocation = LocationSet_.LookupRegisterLocation(*result.origin());
+      auto registerLocation = LocationSet_.GetRegisterLocation(*result.origin());
 
       if (is_exported(lambda))
-        registerLocation->SetIsEscapingModule(true);
+        LocationSet_.MarkAsEscapingModule(registerLocation);
     }
   }
 
   /*
    * Handle function
    */
-  auto & lambdaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
+  auto lambdaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
     *lambda.output(),
     PointsToFlags::PointsToNone);
-  auto & lambdaLocation = LocationSet_.InsertLambdaLocation(lambda);
-  lambdaOutputLocation.SetPointsTo(lambdaLocation);
+  auto lambdaLocation = LocationSet_.InsertLambdaLocation(lambda);
+  LocationSet_.SetPointsTo(lambdaOutputLocation, lambdaLocation);
 }
 
 void
@@ -1345,8 +1560,8 @@ Steensgaard::Analyze(const delta::node & delta)
     if (!is<PointerType>(input.type()))
       continue;
 
-    auto & origin = LocationSet_.Find(*input.origin());
-    auto & argument = LocationSet_.FindOrInsertRegisterLocation(
+    auto origin = LocationSet_.Find(*input.origin());
+    auto argument = LocationSet_.FindOrInsertRegisterLocation(
       *input.arguments.first(),
       PointsToFlags::PointsToNone);
     join(origin, argument);
@@ -1354,15 +1569,16 @@ Steensgaard::Analyze(const delta::node & delta)
 
   Analyze(*delta.subregion());
 
-  auto & deltaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
+  auto deltaOutputLocation = LocationSet_.FindOrInsertRegisterLocation(
     *delta.output(),
     PointsToFlags::PointsToNone);
-  auto & deltaLocation = LocationSet_.InsertDeltaLocation(delta);
-  deltaOutputLocation.SetPointsTo(deltaLocation);
+  auto deltaLocation = LocationSet_.InsertDeltaLocation(delta);
+  LocationSet_.SetPointsTo(deltaOutputLocation, deltaLocation);
 
   auto & origin = *delta.result()->origin();
+  RecordMemoryAccess(*delta.output(), origin.type());
   if (LocationSet_.Contains(origin)) {
-    auto & resultLocation = LocationSet_.Find(origin);
+    auto resultLocation = LocationSet_.Find(origin);
     join(deltaLocation, resultLocation);
   }
 }
@@ -1375,8 +1591,8 @@ Steensgaard::Analyze(const phi::node & phi)
     if (!is<PointerType>(cv->type()))
       continue;
 
-    auto & origin = LocationSet_.Find(*cv->origin());
-    auto & argument = LocationSet_.FindOrInsertRegisterLocation(
+    auto origin = LocationSet_.Find(*cv->origin());
+    auto argument = LocationSet_.FindOrInsertRegisterLocation(
       *cv->argument(),
       PointsToFlags::PointsToNone);
     join(origin, argument);
@@ -1399,11 +1615,11 @@ Steensgaard::Analyze(const phi::node & phi)
     if (!is<PointerType>(rv->type()))
       continue;
 
-    auto & origin = LocationSet_.Find(*rv->result()->origin());
-    auto & argument = LocationSet_.Find(*rv->argument());
+    auto origin = LocationSet_.Find(*rv->result()->origin());
+    auto argument = LocationSet_.Find(*rv->argument());
     join(origin, argument);
 
-    auto & output = LocationSet_.FindOrInsertRegisterLocation(
+    auto output = LocationSet_.FindOrInsertRegisterLocation(
       *rv.output(),
       PointsToFlags::PointsToNone);
     join(argument, output);
@@ -1418,9 +1634,9 @@ Steensgaard::Analyze(const jive::gamma_node & node)
     if (!jive::is<PointerType>(ev->type()))
       continue;
 
-    auto & originLocation = LocationSet_.Find(*ev->origin());
+    auto originLocation = LocationSet_.Find(*ev->origin());
     for (auto & argument : *ev) {
-      auto & argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
+      auto argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
         argument,
         PointsToFlags::PointsToNone);
       join(argumentLocation, originLocation);
@@ -1436,11 +1652,11 @@ Steensgaard::Analyze(const jive::gamma_node & node)
     if (!jive::is<PointerType>(ex->type()))
       continue;
 
-    auto & outputLocation = LocationSet_.FindOrInsertRegisterLocation(
+    auto outputLocation = LocationSet_.FindOrInsertRegisterLocation(
       *ex.output(),
       PointsToFlags::PointsToNone);
     for (auto & result : *ex) {
-      auto & resultLocation = LocationSet_.Find(*result.origin());
+      auto resultLocation = LocationSet_.Find(*result.origin());
       join(outputLocation, resultLocation);
     }
   }
@@ -1453,8 +1669,8 @@ Steensgaard::Analyze(const jive::theta_node & theta)
     if (!jive::is<PointerType>(thetaOutput->type()))
       continue;
 
-    auto & originLocation = LocationSet_.Find(*thetaOutput->input()->origin());
-    auto & argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
+    auto originLocation = LocationSet_.Find(*thetaOutput->input()->origin());
+    auto argumentLocation = LocationSet_.FindOrInsertRegisterLocation(
       *thetaOutput->argument(),
       PointsToFlags::PointsToNone);
 
@@ -1467,9 +1683,9 @@ Steensgaard::Analyze(const jive::theta_node & theta)
     if (!jive::is<PointerType>(thetaOutput->type()))
       continue;
 
-    auto & originLocation = LocationSet_.Find(*thetaOutput->result()->origin());
-    auto & argumentLocation = LocationSet_.Find(*thetaOutput->argument());
-    auto & outputLocation = LocationSet_.FindOrInsertRegisterLocation(
+    auto originLocation = LocationSet_.Find(*thetaOutput->result()->origin());
+    auto argumentLocation = LocationSet_.Find(*thetaOutput->argument());
+    auto outputLocation = LocationSet_.FindOrInsertRegisterLocation(
       *thetaOutput,
       PointsToFlags::PointsToNone);
 
@@ -1508,9 +1724,9 @@ Steensgaard::Analyze(jive::region & region)
 {
   using namespace jive;
 
-  topdown_traverser traverser(&region);
+  topdown_const_traverser traverser(&region);
   for (auto & node : traverser) {
-    if (auto simpleNode = dynamic_cast<const simple_node*>(node)) {
+    if (auto simpleNode = dyn_cast<simple_node>(node)) {
       Analyze(*simpleNode);
       continue;
     }
@@ -1530,11 +1746,15 @@ Steensgaard::Analyze(const jive::graph & graph)
       if (!jive::is<PointerType>(argument.type()))
         continue;
       /* FIXME: we should not add function imports */
-      auto & importLocation = lset.InsertImportLocation(argument);
-      auto & importArgumentLocation = lset.FindOrInsertRegisterLocation(
+      auto importLocation = lset.InsertImportLocation(argument);
+      /*
+       * The layout of imported memory is unknown.
+       */
+      lset.MarkAsCollapsed(importLocation);
+      auto importArgumentLocation = lset.FindOrInsertRegisterLocation(
         argument,
         PointsToFlags::PointsToNone);
-      importArgumentLocation.SetPointsTo(importLocation);
+      lset.SetPointsTo(importArgumentLocation, importLocation);
     }
   };
 
@@ -1544,14 +1764,19 @@ Steensgaard::Analyze(const jive::graph & graph)
 
     for (size_t n = 0; n < rootRegion->nresults(); n++) {
       auto & result = *rootRegion->result(n);
-      auto registerLocation = locationSet.LookupRegisterLocation(*result.origin());
-      registerLocation->SetIsEscapingModule(true);
+      auto registerLocation = locationSet.GetRegisterLocation(*result.origin());
+      locationSet.MarkAsEscapingModule(registerLocation);
     }
   };
 
   add_imports(graph, LocationSet_);
   Analyze(*graph.root());
   MarkExportsAsEscaping(graph, LocationSet_);
+
+  if (IsFieldSensitive()) {
+    CollapseOverlappingAccesses();
+    PropagateFieldPointerFlags();
+  }
 }
 
 std::unique_ptr<PointsToGraph>
@@ -1560,6 +1785,16 @@ Steensgaard::Analyze(
   StatisticsCollector & statisticsCollector)
 {
   ResetState();
+  try {
+    DataLayout_.emplace(module.DataLayout());
+  } catch (const error &) {
+    /*
+     * Without a valid data layout, no byte offsets can be determined and all sets that are accessed at an offset are
+     * collapsed.
+     */
+    DataLayout_.reset();
+  }
+
   auto steensgaardStatistics = SteensgaardAnalysisStatistics::Create(module.SourceFileName());
   auto ptgConstructionStatistics = SteensgaardPointsToGraphConstructionStatistics::Create(module.SourceFileName());
 
@@ -1575,7 +1810,7 @@ Steensgaard::Analyze(
    * Construct PointsTo graph
    */
   ptgConstructionStatistics->Start(LocationSet_);
-  auto pointsToGraph = ConstructPointsToGraph(LocationSet_);
+  auto pointsToGraph = ConstructPointsToGraph();
 //	std::cout << PointsToGraph::ToDot(*pointsToGraph) << std::flush;
   ptgConstructionStatistics->Stop(*pointsToGraph);
 
@@ -1586,161 +1821,231 @@ Steensgaard::Analyze(
 }
 
 std::unique_ptr<PointsToGraph>
-Steensgaard::ConstructPointsToGraph(const LocationSet & locationSets)
+Steensgaard::ConstructPointsToGraph()
 {
+  auto & locationSet = LocationSet_;
   auto pointsToGraph = PointsToGraph::Create();
 
-  auto CreatePointsToGraphNode = [](const Location & location, PointsToGraph & pointsToGraph) -> PointsToGraph::Node&
+  auto CreatePointsToGraphNode = [](
+    const LocationSet & locationSet,
+    LocationIndex location,
+    PointsToGraph & pointsToGraph) -> PointsToGraph::Node&
   {
-    if (auto registerLocation = dynamic_cast<const RegisterLocation*>(&location))
-      return PointsToGraph::RegisterNode::Create(pointsToGraph, registerLocation->GetOutput());
-
-    if (auto allocaLocation = dynamic_cast<const AllocaLocation*>(&location))
-      return PointsToGraph::AllocaNode::Create(pointsToGraph, allocaLocation->GetNode());
-
-    if (auto mallocLocation = dynamic_cast<const MallocLocation*>(&location))
-      return PointsToGraph::MallocNode::Create(pointsToGraph, mallocLocation->GetNode());
-
-    if (auto lambdaLocation = dynamic_cast<const LambdaLocation*>(&location))
-      return PointsToGraph::LambdaNode::Create(pointsToGraph, lambdaLocation->GetNode());
-
-    if (auto deltaLocation = dynamic_cast<const DeltaLocation*>(&location))
-      return PointsToGraph::DeltaNode::Create(pointsToGraph, deltaLocation->GetNode());
-
-    if (auto importLocation = dynamic_cast<const ImportLocation*>(&location))
-      return PointsToGraph::ImportNode::Create(pointsToGraph, importLocation->GetArgument());
-
-    JLM_UNREACHABLE("Unhandled location type.");
+    auto & output = locationSet.GetOutput(location);
+    switch (locationSet.GetKind(location))
+    {
+      case LocationSet::Kind::Register:
+        return PointsToGraph::RegisterNode::Create(pointsToGraph, output);
+      case LocationSet::Kind::Alloca:
+        return PointsToGraph::AllocaNode::Create(pointsToGraph, *jive::node_output::node(&output));
+      case LocationSet::Kind::Malloc:
+        return PointsToGraph::MallocNode::Create(pointsToGraph, *jive::node_output::node(&output));
+      case LocationSet::Kind::Lambda:
+        return PointsToGraph::LambdaNode::Create(
+          pointsToGraph,
+          *AssertedCast<const lambda::node>(jive::node_output::node(&output)));
+      case LocationSet::Kind::Delta:
+        return PointsToGraph::DeltaNode::Create(
+          pointsToGraph,
+          *AssertedCast<const delta::node>(jive::node_output::node(&output)));
+      case LocationSet::Kind::Import:
+        return PointsToGraph::ImportNode::Create(pointsToGraph, *AssertedCast<const jive::argument>(&output));
+      default:
+        JLM_UNREACHABLE("Unhandled location type.");
+    }
   };
 
   /*
    * We marked all register locations that escape the module throughout the analysis using
-   * RegisterLocation::SetIsEscapingModule(). This function uses these as starting point for computing all module
+   * LocationSet::MarkAsEscapingModule(). This function uses these as starting point for computing all module
    * escaping memory locations.
    */
-  auto FindModuleEscapingMemoryNodes = [](
-    std::unordered_set<RegisterLocation*> & moduleEscapingRegisterLocations,
-    const LocationSet & locationSets,
-    const std::unordered_map<const disjointset<Location*>::set*, std::vector<PointsToGraph::MemoryNode*>> & memoryNodeMap)
+  auto FindModuleEscapingMemoryNodes = [&](
+    const std::vector<LocationIndex> & moduleEscapingRegisterLocations,
+    LocationSet & locationSet,
+    const std::vector<std::vector<PointsToGraph::MemoryNode*>> & memoryNodeMap)
   {
     /*
      * Initialize our working set.
      */
-    std::unordered_set<Location*> toVisit;
-    while (!moduleEscapingRegisterLocations.empty()) {
-      auto registerLocation = *moduleEscapingRegisterLocations.begin();
-      moduleEscapingRegisterLocations.erase(registerLocation);
-
-      auto & set = locationSets.GetSet(*registerLocation);
-      auto pointsToLocation = set.value()->GetPointsTo();
-      if (pointsToLocation)
-        toVisit.insert(pointsToLocation);
+    std::vector<LocationIndex> toVisit;
+    for (auto & registerLocation : moduleEscapingRegisterLocations) {
+      auto pointsToLocation = locationSet.GetPointsTo(locationSet.GetRootLocation(registerLocation));
+      if (pointsToLocation != LocationSet::NoLocation)
+        toVisit.push_back(pointsToLocation);
     }
 
     /*
      * Collect escaping memory nodes.
      */
-    HashSet<const LocationSet::DisjointLocationSet::set*> visitedSets;
-    std::unordered_set<PointsToGraph::MemoryNode*> escapedMemoryNodes;
+    std::vector<bool> visitedSets(locationSet.NumLocations(), false);
+    std::vector<PointsToGraph::MemoryNode*> escapedMemoryNodes;
     while (!toVisit.empty()) {
-      auto moduleEscapingLocation = *toVisit.begin();
-      toVisit.erase(moduleEscapingLocation);
+      auto rootLocation = locationSet.GetRootLocation(toVisit.back());
+      toVisit.pop_back();
 
-      auto & set = locationSets.GetSet(*moduleEscapingLocation);
       /*
        * Check if we already visited this set to avoid an endless loop.
        */
-      if (visitedSets.Contains(&set))
-      {
+      if (visitedSets[rootLocation])
         continue;
-      }
-      visitedSets.Insert(&set);
+      visitedSets[rootLocation] = true;
 
-      auto & memoryNodes = memoryNodeMap.at(&set);
-      for (auto & memoryNode : memoryNodes)
+      for (auto & memoryNode : memoryNodeMap[rootLocation])
       {
         memoryNode->MarkAsModuleEscaping();
-        escapedMemoryNodes.insert(memoryNode);
+        escapedMemoryNodes.push_back(memoryNode);
       }
 
+      auto pointsToLocation = locationSet.GetPointsTo(rootLocation);
+      if (pointsToLocation != LocationSet::NoLocation)
+        toVisit.push_back(pointsToLocation);
 
-      auto pointsToLocation = set.value()->GetPointsTo();
-      if (pointsToLocation)
-        toVisit.insert(pointsToLocation);
+      /*
+       * The entire memory escapes if a part of it escapes.
+       */
+      toVisit.push_back(ResolveField(rootLocation).first);
+      for (auto & [offset, field] : locationSet.GetFields(rootLocation))
+        toVisit.push_back(field);
     }
 
     return escapedMemoryNodes;
   };
 
-
-  std::unordered_map<const Location*, PointsToGraph::Node*> locationMap;
-  std::unordered_map<const disjointset<Location*>::set*, std::vector<PointsToGraph::MemoryNode*>> memoryNodeMap;
-  std::unordered_set<RegisterLocation*> moduleEscapingRegisterLocations;
+  /*
+   * The memory nodes of a disjoint set are indexed by the root location of the set.
+   */
+  auto numLocations = locationSet.NumLocations();
+  std::vector<PointsToGraph::Node*> locationMap(numLocations, nullptr);
+  std::vector<std::vector<PointsToGraph::MemoryNode*>> memoryNodeMap(numLocations);
+  std::vector<LocationIndex> moduleEscapingRegisterLocations;
 
   /*
    * Create points-to graph nodes
    */
-  for (auto & locationSet : locationSets)
+  for (LocationIndex location = 0; location < numLocations; location++)
+  {
+    /*
+     * We can ignore dummy and field nodes. They have no equivalent in the RVSDG.
+     */
+    if (locationSet.GetKind(location) == LocationSet::Kind::Dummy
+        || locationSet.GetKind(location) == LocationSet::Kind::Field)
+      continue;
+
+    auto pointsToGraphNode = &CreatePointsToGraphNode(locationSet, location, *pointsToGraph);
+    locationMap[location] = pointsToGraphNode;
+
+    if (auto memoryNode = dynamic_cast<PointsToGraph::MemoryNode*>(pointsToGraphNode))
+      memoryNodeMap[locationSet.GetRootLocation(location)].push_back(memoryNode);
+
+    if (locationSet.IsEscapingModule(location))
+      moduleEscapingRegisterLocations.push_back(location);
+  }
+
+  /*
+   * Create the field nodes of a set from the memory nodes of the set it is a field of. Fields of different sets at the
+   * same offset share their field nodes.
+   */
+  std::vector<std::pair<PointsToGraph::FieldNode*, LocationIndex>> fieldNodes;
+  std::map<std::pair<const PointsToGraph::MemoryNode*, size_t>, PointsToGraph::FieldNode*> fieldNodeMap;
+  for (LocationIndex location = 0; location < numLocations; location++)
   {
-    memoryNodeMap[&locationSet] = {};
-    for (auto & location : locationSet)
+    if (locationSet.GetRootLocation(location) != location
+        || locationSet.GetFieldBase(location) == LocationSet::NoLocation)
+      continue;
+
+    auto [object, offset] = ResolveField(location);
+    JLM_ASSERT(!locationSet.IsCollapsed(object));
+
+    for (auto & memoryNode : memoryNodeMap[object])
     {
       /*
-       * We can ignore dummy nodes. They only exist for structural purposes and have no equivalent in the RVSDG.
+       * Functions have no fields.
        */
-      if (dynamic_cast<const DummyLocation*>(location))
+      if (dynamic_cast<const PointsToGraph::LambdaNode*>(memoryNode))
         continue;
 
-      auto pointsToGraphNode = &CreatePointsToGraphNode(*location, *pointsToGraph);
-      locationMap[location] = pointsToGraphNode;
-
-      if (auto memoryNode = dynamic_cast<PointsToGraph::MemoryNode*>(pointsToGraphNode))
-        memoryNodeMap[&locationSet].push_back(memoryNode);
+      auto & fieldNode = fieldNodeMap[{memoryNode, offset}];
+      if (fieldNode == nullptr)
+        fieldNode = &PointsToGraph::FieldNode::Create(*pointsToGraph, *memoryNode, offset);
 
-      if (RegisterLocation::IsEscapingModule(*location))
-        moduleEscapingRegisterLocations.insert(AssertedCast<RegisterLocation>(location));
+      memoryNodeMap[location].push_back(fieldNode);
+      fieldNodes.emplace_back(fieldNode, location);
     }
   }
 
   auto escapedMemoryNodes = FindModuleEscapingMemoryNodes(
     moduleEscapingRegisterLocations,
-    locationSets,
+    locationSet,
     memoryNodeMap);
 
   /*
    * Create points-to graph edges
    */
-  for (auto & set : locationSets) {
-    bool pointsToUnknown = locationSets.GetSet(**set.begin()).value()->PointsToUnknownMemory();
-    bool pointsToExternalMemory = locationSets.GetSet(**set.begin()).value()->PointsToExternalMemory();
-    bool pointsToEscapedMemory = locationSets.GetSet(**set.begin()).value()->PointsToEscapedMemory();
+  for (LocationIndex location = 0; location < numLocations; location++) {
+    if (locationSet.GetKind(location) == LocationSet::Kind::Dummy
+        || locationSet.GetKind(location) == LocationSet::Kind::Field)
+      continue;
 
-    for (auto & location : set) {
-      if (dynamic_cast<DummyLocation*>(location))
-        continue;
+    auto rootLocation = locationSet.GetRootLocation(location);
+    auto & pointsToGraphNode = *locationMap[location];
 
-      auto & pointsToGraphNode = *locationMap[location];
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToUnknownMemory))
+      pointsToGraphNode.AddEdge(pointsToGraph->GetUnknownMemoryNode());
 
-      if (pointsToUnknown)
-        pointsToGraphNode.AddEdge(pointsToGraph->GetUnknownMemoryNode());
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToExternalMemory))
+      pointsToGraphNode.AddEdge(pointsToGraph->GetExternalMemoryNode());
 
-      if (pointsToExternalMemory)
-        pointsToGraphNode.AddEdge(pointsToGraph->GetExternalMemoryNode());
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToEscapedMemory)) {
+      for (auto & escapedMemoryNode : escapedMemoryNodes)
+        pointsToGraphNode.AddEdge(*escapedMemoryNode);
+    }
 
-      if (pointsToEscapedMemory) {
-        for (auto & escapedMemoryNode : escapedMemoryNodes)
-          pointsToGraphNode.AddEdge(*escapedMemoryNode);
-      }
+    auto pointsToLocation = locationSet.GetPointsTo(rootLocation);
+    if (pointsToLocation == LocationSet::NoLocation)
+      continue;
 
-      auto pointsToLocation = set.value()->GetPointsTo();
-      if (pointsToLocation == nullptr)
-        continue;
+    for (auto & memoryNode : memoryNodeMap[locationSet.GetRootLocation(pointsToLocation)])
+      pointsToGraphNode.AddEdge(*memoryNode);
+  }
 
-      auto & pointsToSet = locationSets.GetSet(*pointsToLocation);
-      auto & memoryNodes = memoryNodeMap[&pointsToSet];
+  for (auto & [fieldNode, rootLocation] : fieldNodes)
+  {
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToUnknownMemory))
+      fieldNode->AddEdge(pointsToGraph->GetUnknownMemoryNode());
+
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToExternalMemory))
+      fieldNode->AddEdge(pointsToGraph->GetExternalMemoryNode());
+
+    if (locationSet.HasPointsToFlag(rootLocation, PointsToFlags::PointsToEscapedMemory)) {
+      for (auto & escapedMemoryNode : escapedMemoryNodes)
+        fieldNode->AddEdge(*escapedMemoryNode);
+    }
+
+    auto pointsToLocation = locationSet.GetPointsTo(rootLocation);
+    if (pointsToLocation == LocationSet::NoLocation)
+      continue;
+
+    for (auto & memoryNode : memoryNodeMap[locationSet.GetRootLocation(pointsToLocation)])
+      fieldNode->AddEdge(*memoryNode);
+  }
 
-      for (auto & memoryNode : memoryNodes)
-        pointsToGraphNode.AddEdge(*memoryNode);
+  /*
+   * The address of an access also points to all fields that the access overlaps with.
+   */
+  for (auto & access : MemoryAccesses_)
+  {
+    auto pointsToLocation = locationSet.GetPointsTo(locationSet.Find(*access.Address));
+    if (pointsToLocation == LocationSet::NoLocation)
+      continue;
+
+    auto [object, offset] = ResolveField(pointsToLocation);
+    auto & addressNode = *locationMap[locationSet.GetRegisterLocation(*access.Address)];
+    auto & fields = locationSet.GetFields(object);
+    for (auto it = fields.upper_bound(offset); it != fields.end() && it->first - offset < access.Size; it++)
+    {
+      for (auto & memoryNode : memoryNodeMap[locationSet.GetRootLocation(it->second)])
+        addressNode.AddEdge(*memoryNode);
     }
   }
 
@@ -1751,6 +2056,10 @@ void
 Steensgaard::ResetState()
 {
   LocationSet_.Clear();
+  PendingJoins_.clear();
+  MemoryAccesses_.clear();
+  FieldPointers_.clear();
+  DataLayout_.reset();
 }
 
 }
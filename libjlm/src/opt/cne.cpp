@@ -11,6 +11,10 @@
 #include <jlm/util/time.hpp>
 
 #include <jive/rvsdg/traverser.hpp>
+#include <jive/util/hash.hpp>
+
+#include <map>
+#include <unordered_map>
 
 namespace jlm {
 
@@ -27,10 +31,10 @@ public:
 	{}
 
 	void
-	start_mark_stat(const jive::graph & graph) noexcept
+	start_mark_stat(const jive::region & region) noexcept
 	{
-		nnodes_before_ = jive::nnodes(graph.root());
-		ninputs_before_ = jive::ninputs(graph.root());
+		nnodes_before_ = jive::nnodes(&region);
+		ninputs_before_ = jive::ninputs(&region);
 		marktimer_.start();
 	}
 
@@ -47,10 +51,10 @@ public:
 	}
 
 	void
-	end_divert_stat(const jive::graph & graph) noexcept
+	end_divert_stat(const jive::region & region) noexcept
 	{
-		nnodes_after_ = jive::nnodes(graph.root());
-		ninputs_after_ = jive::ninputs(graph.root());
+		nnodes_after_ = jive::nnodes(&region);
+		ninputs_after_ = jive::ninputs(&region);
 		diverttimer_.stop();
 	}
 
@@ -77,28 +81,66 @@ private:
 };
 
 
-typedef std::unordered_set<jive::output*> congruence_set;
-
+/**
+* \brief Congruence classes of outputs
+*
+* The classes are kept in a union-find structure over the output identifiers.
+* Outputs that were never marked congruent to another output are singleton
+* classes and do not occupy any space. Only outputs of the same region are ever
+* part of the same class.
+*
+* A local context numbers the outputs in the order they are first encountered
+* instead of using their identifiers. Its size is then bounded by the number of
+* outputs it encounters rather than by the identifiers of the entire graph,
+* which makes it suitable for processing a single lambda.
+*/
 class cnectx {
 public:
+	inline explicit
+	cnectx(bool local = false)
+	: local_(local)
+	{}
+
 	inline void
-	mark(jive::output * o1, jive::output * o2)
+	reserve(size_t bound)
 	{
-		auto s1 = set(o1);
-		auto s2 = set(o2);
+		parent_.reserve(bound);
+		size_.reserve(bound);
+	}
 
-		if (s1 == s2)
-			return;
+	/**
+	* \brief Returns the identifier of the representative of \p output's class.
+	*/
+	inline size_t
+	find(const jive::output * output)
+	{
+		auto id = index(output);
+		if (id >= parent_.size())
+			return id;
 
-		if (s2->size() < s1->size()) {
-			s1 = outputs_[o2];
-			s2 = outputs_[o1];
+		while (parent_[id] != id) {
+			parent_[id] = parent_[parent_[id]];
+			id = parent_[id];
 		}
 
-		for (auto & o : *s1) {
-			s2->insert(o);
-			outputs_[o] = s2;
-		}
+		return id;
+	}
+
+	inline void
+	mark(const jive::output * o1, const jive::output * o2)
+	{
+		grow(std::max(index(o1), index(o2)) + 1);
+
+		auto r1 = find(o1);
+		auto r2 = find(o2);
+		if (r1 == r2)
+			return;
+
+		if (size_[r1] < size_[r2])
+			std::swap(r1, r2);
+
+		parent_[r2] = r1;
+		size_[r1] += size_[r2];
 	}
 
 	inline void
@@ -111,164 +153,119 @@ public:
 	}
 
 	inline bool
-	congruent(jive::output * o1, jive::output * o2) const noexcept
+	congruent(const jive::output * o1, const jive::output * o2)
 	{
-		if (o1 == o2)
-			return true;
-
-		auto it = outputs_.find(o1);
-		if (it == outputs_.end())
-			return false;
-
-		return it->second->find(o2) != it->second->end();
+		return o1 == o2 || find(o1) == find(o2);
 	}
 
 	inline bool
-	congruent(const jive::input * i1, const jive::input * i2) const noexcept
+	congruent(const jive::input * i1, const jive::input * i2)
 	{
 		return congruent(i1->origin(), i2->origin());
 	}
 
-	congruence_set *
-	set(jive::output * output) noexcept
+	/**
+	* \brief Makes \p output a singleton class again.
+	*
+	* All other members of \p output's class must be reset as well.
+	*/
+	inline void
+	reset(const jive::output * output)
 	{
-		if (outputs_.find(output) == outputs_.end()) {
-			std::unique_ptr<congruence_set> set(new congruence_set({output}));
-			outputs_[output] = set.get();
-			sets_.insert(std::move(set));
+		auto id = index(output);
+		if (id < parent_.size()) {
+			parent_[id] = id;
+			size_[id] = 1;
 		}
+	}
+
+	/**
+	* \brief Returns the output all members of \p output's class are diverted to.
+	*
+	* The first output of a class that is passed to this method becomes the
+	* leader of the class.
+	*/
+	inline jive::output *
+	leader(jive::output * output)
+	{
+		auto id = find(output);
+		if (id >= size_.size() || size_[id] == 1)
+			return output;
+
+		if (id >= leaders_.size())
+			leaders_.resize(parent_.size(), nullptr);
 
-		return outputs_[output];
+		if (leaders_[id] == nullptr)
+			leaders_[id] = output;
+
+		return leaders_[id];
 	}
 
 private:
-	std::unordered_set<std::unique_ptr<congruence_set>> sets_;
-	std::unordered_map<const jive::output*, congruence_set*> outputs_;
-};
-
-class vset {
-public:
-	void
-	insert(const jive::output * o1, const jive::output * o2)
+	inline size_t
+	index(const jive::output * output)
 	{
-		auto it = sets_.find(o1);
-		if (it != sets_.end())
-			sets_[o1].insert(o2);
-		else
-			sets_[o1] = {o2};
+		if (!local_)
+			return output->id();
 
-		it = sets_.find(o2);
-		if (it != sets_.end())
-			sets_[o2].insert(o1);
-		else
-			sets_[o2] = {o1};
+		return indices_.emplace(output->id(), indices_.size()).first->second;
 	}
 
-	bool
-	visited(const jive::output * o1, const jive::output * o2) const
+	inline void
+	grow(size_t bound)
 	{
-		auto it = sets_.find(o1);
-		if (it == sets_.end())
-			return false;
-
-		return it->second.find(o2) != it->second.end();
+		for (size_t id = parent_.size(); id < bound; id++) {
+			parent_.push_back(id);
+			size_.push_back(1);
+		}
 	}
 
-private:
-	std::unordered_map<
-		const jive::output*,
-		std::unordered_set<const jive::output*>
-	> sets_;
+	bool local_;
+	std::unordered_map<size_t, size_t> indices_;
+	std::vector<size_t> parent_;
+	std::vector<size_t> size_;
+	std::vector<jive::output*> leaders_;
 };
 
+/**
+* \brief Candidates for congruent simple nodes of a region
+*
+* The nodes are keyed on the hash of their operation and the congruence
+* classes of their operands.
+*/
+typedef std::unordered_multimap<size_t, const jive::simple_node*> vtable;
+
 /* mark phase */
 
-static bool
-congruent(
-	jive::output * o1,
-	jive::output * o2,
-	vset & vs,
-	cnectx & ctx)
+static size_t
+hash(const jive::simple_node * node, cnectx & ctx)
 {
-	if (ctx.congruent(o1, o2) || vs.visited(o1, o2))
-		return true;
+	auto seed = node->operation().hash();
+	for (size_t n = 0; n < node->ninputs(); n++)
+		jive::detail::hash_combine(seed, ctx.find(node->input(n)->origin()));
+
+	return seed;
+}
 
-	if (o1->type() != o2->type())
+static bool
+congruent(const jive::simple_node * n1, const jive::simple_node * n2, cnectx & ctx)
+{
+	if (n1->operation() != n2->operation()
+	|| n1->ninputs() != n2->ninputs())
 		return false;
 
-	if (is_theta_argument(o1) && is_theta_argument(o2)) {
-		JLM_ASSERT(o1->region()->node() == o2->region()->node());
-		auto a1 = static_cast<jive::argument*>(o1);
-		auto a2 = static_cast<jive::argument*>(o2);
-		vs.insert(a1, a2);
-		auto i1 = a1->input(), i2 = a2->input();
-		if (!congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx))
+	for (size_t n = 0; n < n1->ninputs(); n++) {
+		if (!ctx.congruent(n1->input(n), n2->input(n)))
 			return false;
-
-		auto output1 = o1->region()->node()->output(i1->index());
-		auto output2 = o2->region()->node()->output(i2->index());
-		return congruent(output1, output2, vs, ctx);
-	}
-
-	auto n1 = jive::node_output::node(o1);
-	auto n2 = jive::node_output::node(o2);
-	if (jive::is<jive::theta_op>(n1) && jive::is<jive::theta_op>(n2) && n1 == n2) {
-		auto so1 = static_cast<jive::structural_output*>(o1);
-		auto so2 = static_cast<jive::structural_output*>(o2);
-		vs.insert(o1, o2);
-		auto r1 = so1->results.first();
-		auto r2 = so2->results.first();
-		return congruent(r1->origin(), r2->origin(), vs, ctx);
 	}
 
-	if (jive::is<jive::gamma_op>(n1) && n1 == n2) {
-		auto so1 = static_cast<jive::structural_output*>(o1);
-		auto so2 = static_cast<jive::structural_output*>(o2);
-		auto r1 = so1->results.begin();
-		auto r2 = so2->results.begin();
-		for (; r1 != so1->results.end(); r1++, r2++) {
-			JLM_ASSERT(r1->region() == r2->region());
-			if (!congruent(r1->origin(), r2->origin(), vs, ctx))
-				return false;
-		}
-		return true;
-	}
-
-	if (is_gamma_argument(o1) && is_gamma_argument(o2)) {
-		JLM_ASSERT(o1->region()->node() == o2->region()->node());
-		auto a1 = static_cast<jive::argument*>(o1);
-		auto a2 = static_cast<jive::argument*>(o2);
-		return congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx);
-	}
-
-	if (jive::is<jive::simple_op>(n1)
-	&& jive::is<jive::simple_op>(n2)
-	&& n1->operation() == n2->operation()
-	&& n1->ninputs() == n2->ninputs()
-	&& o1->index() == o2->index()) {
-		for (size_t n = 0; n < n1->ninputs(); n++) {
-			auto origin1 = n1->input(n)->origin();
-			auto origin2 = n2->input(n)->origin();
-			if (!congruent(origin1, origin2, vs, ctx))
-				return false;
-		}
-		return true;
-	}
-
-	return false;
-}
-
-static bool
-congruent(jive::output * o1, jive::output * o2, cnectx & ctx)
-{
-	vset vs;
-	return congruent(o1, o2, vs, ctx);
+	return true;
 }
 
 static void
 mark_arguments(
-	jive::structural_input * i1,
-	jive::structural_input * i2,
+	const jive::structural_input * i1,
+	const jive::structural_input * i2,
 	cnectx & ctx)
 {
 	JLM_ASSERT(i1->node() && i1->node() == i2->node());
@@ -276,10 +273,42 @@ mark_arguments(
 
 	auto a1 = i1->arguments.begin();
 	auto a2 = i2->arguments.begin();
-	for (; a1 != i1->arguments.end(); a1++, a2++) {
+	for (; a1 != i1->arguments.end(); ++a1, ++a2) {
 		JLM_ASSERT(a1->region() == a2->region());
-		if (congruent(a1.ptr(), a2.ptr(), ctx))
-			ctx.mark(a1.ptr(), a2.ptr());
+		ctx.mark(a1.ptr(), a2.ptr());
+	}
+}
+
+/**
+* Marks the arguments of all inputs of \p node with congruent origins as
+* congruent.
+*/
+static void
+mark_inputs(const jive::structural_node * node, size_t first, cnectx & ctx)
+{
+	std::unordered_map<size_t, const jive::structural_input*> inputs;
+	for (size_t n = first; n < node->ninputs(); n++) {
+		auto input = node->input(n);
+		auto other = inputs.emplace(ctx.find(input->origin()), input).first->second;
+		if (other != input)
+			mark_arguments(other, input, ctx);
+	}
+}
+
+static void
+reset(const jive::region * region, cnectx & ctx)
+{
+	for (size_t n = 0; n < region->narguments(); n++)
+		ctx.reset(region->argument(n));
+
+	for (const auto & node : region->nodes) {
+		for (size_t n = 0; n < node.noutputs(); n++)
+			ctx.reset(node.output(n));
+
+		if (auto structnode = jive::dyn_cast<jive::structural_node>(&node)) {
+			for (size_t n = 0; n < structnode->nsubregions(); n++)
+				reset(structnode->subregion(n), ctx);
+		}
 	}
 }
 
@@ -292,20 +321,43 @@ mark_gamma(const jive::structural_node * node, cnectx & ctx)
 	JLM_ASSERT(jive::is<jive::gamma_op>(node->operation()));
 
 	/* mark entry variables */
-	for (size_t i1 = 1; i1 < node->ninputs(); i1++) {
-		for (size_t i2 = i1+1; i2 < node->ninputs(); i2++)
-			mark_arguments(node->input(i1), node->input(i2), ctx);
-	}
+	mark_inputs(node, 1, ctx);
 
 	for (size_t n = 0; n < node->nsubregions(); n++)
 		mark(node->subregion(n), ctx);
 
 	/* mark exit variables */
-	for (size_t o1 = 0; o1 < node->noutputs(); o1++) {
-		for (size_t o2 = o1+1; o2 < node->noutputs(); o2++) {
-			if (congruent(node->output(o1), node->output(o2), ctx))
-				ctx.mark(node->output(o1), node->output(o2));
+	auto congruent = [&](const jive::structural_output * o1, const jive::structural_output * o2)
+	{
+		auto r1 = o1->results.begin();
+		auto r2 = o2->results.begin();
+		for (; r1 != o1->results.end(); ++r1, ++r2) {
+			JLM_ASSERT(r1->region() == r2->region());
+			if (!ctx.congruent(r1.ptr(), r2.ptr()))
+				return false;
 		}
+		return true;
+	};
+
+	std::unordered_multimap<size_t, const jive::structural_output*> exitvars;
+	for (size_t n = 0; n < node->noutputs(); n++) {
+		auto output = node->output(n);
+
+		size_t seed = 0;
+		for (const auto & result : output->results)
+			jive::detail::hash_combine(seed, ctx.find(result.origin()));
+
+		auto range = exitvars.equal_range(seed);
+		auto it = range.first;
+		for (; it != range.second; it++) {
+			if (congruent(it->second, output)) {
+				ctx.mark(it->second, output);
+				break;
+			}
+		}
+
+		if (it == range.second)
+			exitvars.emplace(seed, output);
 	}
 }
 
@@ -314,20 +366,48 @@ mark_theta(const jive::structural_node * node, cnectx & ctx)
 {
 	JLM_ASSERT(jive::is<jive::theta_op>(node));
 	auto theta = static_cast<const jive::theta_node*>(node);
-
-	/* mark loop variables */
-	for (size_t i1 = 0; i1 < theta->ninputs(); i1++) {
-		for (size_t i2 = i1+1; i2 < theta->ninputs(); i2++) {
-			auto input1 = theta->input(i1);
-			auto input2 = theta->input(i2);
-			if (congruent(input1->argument(), input2->argument(), ctx)) {
-				ctx.mark(input1->argument(), input2->argument());
-				ctx.mark(input1->output(), input2->output());
-			}
+	auto subregion = theta->subregion();
+
+	/*
+		Loop variables are optimistically assumed to be congruent if their inputs
+		are congruent. The body is marked under this assumption and the partition
+		of the loop variables is split whenever the results of a partition turn
+		out not to be congruent. The marks of the body are discarded and the body
+		is marked again until the partition is stable. Partitions are only ever
+		split, which guarantees termination.
+
+		A partition is identified by the index of its first loop variable.
+	*/
+	std::vector<size_t> partition(theta->nloopvars());
+	std::unordered_map<size_t, size_t> inputs;
+	for (size_t n = 0; n < theta->nloopvars(); n++)
+		partition[n] = inputs.emplace(ctx.find(theta->input(n)->origin()), n).first->second;
+	size_t npartitions = inputs.size();
+
+	while (true) {
+		for (size_t n = 0; n < theta->nloopvars(); n++)
+			ctx.mark(theta->input(partition[n])->argument(), theta->input(n)->argument());
+
+		mark(subregion, ctx);
+
+		std::map<std::pair<size_t, size_t>, size_t> results;
+		std::vector<size_t> refinement(theta->nloopvars());
+		for (size_t n = 0; n < theta->nloopvars(); n++) {
+			auto key = std::make_pair(partition[n], ctx.find(theta->input(n)->result()->origin()));
+			refinement[n] = results.emplace(key, n).first->second;
 		}
+
+		if (results.size() == npartitions)
+			break;
+
+		partition = std::move(refinement);
+		npartitions = results.size();
+		reset(subregion, ctx);
 	}
 
-	mark(node->subregion(0), ctx);
+	/* mark loop variables */
+	for (size_t n = 0; n < theta->nloopvars(); n++)
+		ctx.mark(theta->output(partition[n]), theta->output(n));
 }
 
 static void
@@ -336,14 +416,7 @@ mark_lambda(const jive::structural_node * node, cnectx & ctx)
 	JLM_ASSERT(jive::is<lambda::operation>(node));
 
 	/* mark dependencies */
-	for (size_t i1 = 0; i1 < node->ninputs(); i1++) {
-		for (size_t i2 = i1+1; i2 < node->ninputs(); i2++) {
-			auto input1 = node->input(i1);
-			auto input2 = node->input(i2);
-			if (ctx.congruent(input1, input2))
-				ctx.mark(input1->arguments.first(), input2->arguments.first());
-		}
-	}
+	mark_inputs(node, 0, ctx);
 
 	mark(node->subregion(0), ctx);
 }
@@ -354,14 +427,7 @@ mark_phi(const jive::structural_node * node, cnectx & ctx)
 	JLM_ASSERT(is<phi::operation>(node));
 
 	/* mark dependencies */
-	for (size_t i1 = 0; i1 < node->ninputs(); i1++) {
-		for (size_t i2 = i1+1; i2 < node->ninputs(); i2++) {
-			auto input1 = node->input(i1);
-			auto input2 = node->input(i2);
-			if (ctx.congruent(input1, input2))
-				ctx.mark(input1->arguments.first(), input2->arguments.first());
-		}
-	}
+	mark_inputs(node, 0, ctx);
 
 	mark(node->subregion(0), ctx);
 }
@@ -388,50 +454,37 @@ mark(const jive::structural_node * node, cnectx & ctx)
 
 	auto & op = node->operation();
 	JLM_ASSERT(map.find(typeid(op)) != map.end());
-	map[typeid(op)](node, ctx);
+	map.at(typeid(op))(node, ctx);
 }
 
 static void
-mark(const jive::simple_node * node, cnectx & ctx)
+mark(const jive::simple_node * node, vtable & table, cnectx & ctx)
 {
-	if (node->ninputs() == 0) {
-		for (const auto & other : node->region()->top_nodes) {
-			if (&other != node && node->operation() == other.operation()) {
-				ctx.mark(node, &other);
-				break;
-			}
-		}
-		return;
-	}
+	auto seed = hash(node, ctx);
 
-	auto set = ctx.set(node->input(0)->origin());
-	for (const auto & origin : *set) {
-		for (const auto & user : *origin) {
-			auto ni = dynamic_cast<const jive::node_input*>(user);
-			auto other = ni ? ni->node() : nullptr;
-			if (!other
-			|| other == node
-			|| other->operation() != node->operation()
-			|| other->ninputs() != node->ninputs())
-				continue;
-
-			size_t n;
-			for (n = 0; n < node->ninputs(); n++) {
-				if (!ctx.congruent(node->input(n), other->input(n)))
-					break;
-			}
-			if (n == node->ninputs())
-				ctx.mark(node, other);
+	auto range = table.equal_range(seed);
+	for (auto it = range.first; it != range.second; it++) {
+		if (congruent(it->second, node, ctx)) {
+			ctx.mark(it->second, node);
+			return;
 		}
 	}
+
+	table.emplace(seed, node);
 }
 
 static void
 mark(jive::region * region, cnectx & ctx)
 {
+	/*
+		The operands of a node are marked before the node itself in a top-down
+		traversal. The congruence classes of the operands are therefore final
+		once the node is looked up in the table.
+	*/
+	vtable table;
 	for (const auto & node : jive::topdown_traverser(region)) {
-		if (auto simple = dynamic_cast<const jive::simple_node*>(node))
-			mark(simple, ctx);
+		if (auto simple = jive::dyn_cast<const jive::simple_node>(node))
+			mark(simple, table, ctx);
 		else
 			mark(static_cast<const jive::structural_node*>(node), ctx);
 	}
@@ -442,10 +495,9 @@ mark(jive::region * region, cnectx & ctx)
 static void
 divert_users(jive::output * output, cnectx & ctx)
 {
-	auto set = ctx.set(output);
-	for (auto & other : *set)
-		other->divert_users(output);
-	set->clear();
+	auto leader = ctx.leader(output);
+	if (leader != output)
+		output->divert_users(leader);
 }
 
 static void
@@ -490,9 +542,14 @@ divert_theta(jive::structural_node * node, cnectx & ctx)
 	auto subregion = node->subregion(0);
 
 	for (const auto & lv : *theta) {
-		JLM_ASSERT(ctx.set(lv->argument())->size() == ctx.set(lv)->size());
-		divert_users(lv->argument(), ctx);
-		divert_users(lv, ctx);
+		auto argument = ctx.leader(lv->argument());
+		auto output = ctx.leader(lv);
+		JLM_ASSERT(argument->index() == output->index());
+
+		if (argument != lv->argument())
+			lv->argument()->divert_users(argument);
+		if (output != lv)
+			lv->divert_users(output);
 	}
 
 	divert(subregion, ctx);
@@ -538,14 +595,14 @@ divert(jive::structural_node * node, cnectx & ctx)
 
 	auto & op = node->operation();
 	JLM_ASSERT(map.find(typeid(op)) != map.end());
-	map[typeid(op)](node, ctx);
+	map.at(typeid(op))(node, ctx);
 }
 
 static void
 divert(jive::region * region, cnectx & ctx)
 {
 	for (const auto & node : jive::topdown_traverser(region)) {
-		if (auto simple = dynamic_cast<jive::simple_node*>(node))
+		if (auto simple = jive::dyn_cast<jive::simple_node>(node))
 			divert_outputs(simple, ctx);
 		else
 			divert(static_cast<jive::structural_node*>(node), ctx);
@@ -560,15 +617,16 @@ cne(
 	auto & graph = rm.Rvsdg();
 
 	cnectx ctx;
+	ctx.reserve(graph.output_id_bound());
 	auto statistics = cnestat::Create();
 
-	statistics->start_mark_stat(graph);
+	statistics->start_mark_stat(*graph.root());
 	mark(graph.root(), ctx);
 	statistics->end_mark_stat();
 
 	statistics->start_divert_stat();
 	divert(graph.root(), ctx);
-	statistics->end_divert_stat(graph);
+	statistics->end_divert_stat(*graph.root());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -586,4 +644,36 @@ cne::run(
 	jlm::cne(module, statisticsCollector);
 }
 
+HashSet<AnalysisId>
+cne::PreservedAnalyses() const
+{
+	return {
+		AnalysisId::AndersenPointsToGraph,
+		AnalysisId::SteensgaardFieldSensitivePointsToGraph,
+		AnalysisId::SteensgaardPointsToGraph};
+}
+
+void
+cne::RunOnLambda(
+  lambda::node & lambdaNode,
+  StatisticsCollector & statisticsCollector)
+{
+	/*
+		Context variables are only considered congruent if they have the same
+		origin as the congruence of nodes outside of the lambda is unknown.
+	*/
+	cnectx ctx(true);
+	auto statistics = cnestat::Create();
+
+	statistics->start_mark_stat(*lambdaNode.subregion());
+	mark_lambda(&lambdaNode, ctx);
+	statistics->end_mark_stat();
+
+	statistics->start_divert_stat();
+	divert_lambda(&lambdaNode, ctx);
+	statistics->end_divert_stat(*lambdaNode.subregion());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
 }
@@ -10,7 +10,10 @@
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
-#include <jive/rvsdg/traverser.hpp>
+#include <jive/rvsdg/theta.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
 
 namespace jlm {
 
@@ -24,6 +27,10 @@ public:
 	: Statistics(Statistics::Id::FunctionInlining)
   , nnodes_before_(0)
   , nnodes_after_(0)
+  , ninlined_(0)
+  , nrecursive_(0)
+  , ncost_(0)
+  , nbudget_(0)
 	{}
 
 	void
@@ -40,10 +47,49 @@ public:
 		timer_.stop();
 	}
 
+	/**
+	* Records that a call was inlined.
+	*/
+	void
+	inlined() noexcept
+	{
+		ninlined_++;
+	}
+
+	/**
+	* Records that a call was not inlined as it is part of a recursion.
+	*/
+	void
+	rejected_recursive() noexcept
+	{
+		nrecursive_++;
+	}
+
+	/**
+	* Records that a call was not inlined as its cost exceeds the threshold.
+	*/
+	void
+	rejected_cost() noexcept
+	{
+		ncost_++;
+	}
+
+	/**
+	* Records that a call was not inlined as it would exceed a growth budget.
+	*/
+	void
+	rejected_budget() noexcept
+	{
+		nbudget_++;
+	}
+
 	virtual std::string
 	ToString() const override
 	{
-		return strfmt("ILN ", nnodes_before_, " ", nnodes_after_, " ", timer_.ns());
+		return strfmt("ILN ",
+			nnodes_before_, " ", nnodes_after_, " ",
+			ninlined_, " ", nrecursive_, " ", ncost_, " ", nbudget_, " ",
+			timer_.ns());
 	}
 
   static std::unique_ptr<ilnstat>
@@ -54,6 +100,7 @@ public:
 
 private:
 	size_t nnodes_before_, nnodes_after_;
+	size_t ninlined_, nrecursive_, ncost_, nbudget_;
 	jlm::timer timer_;
 };
 
@@ -99,6 +146,41 @@ route_to_region(jive::output * output, jive::region * region)
 	return output;
 }
 
+static bool
+is_ancestor(const jive::region * ancestor, const jive::region * region)
+{
+	while (region != ancestor) {
+		if (region->node() == nullptr)
+			return false;
+		region = region->node()->region();
+	}
+
+	return true;
+}
+
+/**
+* Traces the origin of \p input upwards until it is visible in an ancestor of \p region. Recursion
+* variables of phi nodes are traced to the respective phi output if the phi region is not an ancestor of
+* \p region, which is the case if a function of a recursion group is inlined outside of the group.
+*/
+static jive::output *
+find_routable_producer(jive::input * input, const jive::region * region)
+{
+	auto origin = input->origin();
+	while (!is_ancestor(origin->region(), region)) {
+		if (auto rvargument = dynamic_cast<phi::rvargument*>(origin)) {
+			origin = rvargument->output();
+			continue;
+		}
+
+		auto argument = AssertedCast<jive::argument>(origin);
+		JLM_ASSERT(argument->input() != nullptr);
+		origin = argument->input()->origin();
+	}
+
+	return origin;
+}
+
 static std::vector<jive::output*>
 route_dependencies(const lambda::node * lambda, const jive::simple_node * apply)
 {
@@ -107,7 +189,7 @@ route_dependencies(const lambda::node * lambda, const jive::simple_node * apply)
 	/* collect origins of dependencies */
 	std::vector<jive::output*> deps;
 	for (size_t n = 0; n < lambda->ninputs(); n++)
-		deps.push_back(find_producer(lambda->input(n)));
+		deps.push_back(find_routable_producer(lambda->input(n), apply->region()));
 
 	/* route dependencies to apply region */
 	for (size_t n = 0; n < deps.size(); n++)
@@ -120,6 +202,7 @@ void
 inlineCall(jive::simple_node * call, const lambda::node * lambda)
 {
 	JLM_ASSERT(is<CallOperation>(call));
+	jive::mutation_batch batch(*call->graph());
 
 	auto deps = route_dependencies(lambda, call);
 	JLM_ASSERT(lambda->ncvarguments() == deps.size());
@@ -142,35 +225,243 @@ inlineCall(jive::simple_node * call, const lambda::node * lambda)
 	remove(call);
 }
 
+/**
+* A call in the body of a function.
+*/
+struct callsite {
+	CallNode * call;
+
+	/**
+	* The called function, or null if the call is not a direct call.
+	*/
+	lambda::node * callee;
+
+	/**
+	* The number of loops the call is nested in within its function.
+	*/
+	size_t loopdepth;
+};
+
 static void
-inlining(jive::graph & graph)
+collect_lambdas(jive::region & region, std::vector<lambda::node*> & lambdas)
 {
-	auto root = graph.root();
+	for (auto & node : region.nodes) {
+		if (auto lambda = dynamic_cast<lambda::node*>(&node))
+			lambdas.push_back(lambda);
+		else if (auto phi = dynamic_cast<phi::node*>(&node))
+			collect_lambdas(*phi->subregion(), lambdas);
+	}
+}
 
-	for (auto node : jive::topdown_traverser(root)) {
-		if (!is<lambda::operation>(node))
+static void
+collect_callsites(jive::region & region, size_t loopdepth, std::vector<callsite> & callsites)
+{
+	for (auto & node : region.nodes) {
+		if (auto call = dynamic_cast<CallNode*>(&node)) {
+			lambda::node * callee = nullptr;
+			auto classifier = CallNode::ClassifyCall(*call);
+			if (classifier->IsNonRecursiveDirectCall() || classifier->IsRecursiveDirectCall())
+				callee = classifier->GetLambdaOutput().node();
+
+			callsites.push_back({call, callee, loopdepth});
 			continue;
+		}
+
+		if (auto structnode = dynamic_cast<jive::structural_node*>(&node)) {
+			auto depth = is<jive::theta_op>(structnode) ? loopdepth + 1 : loopdepth;
+			for (size_t n = 0; n < structnode->nsubregions(); n++)
+				collect_callsites(*structnode->subregion(n), depth, callsites);
+		}
+	}
+}
+
+/**
+* The call graph of a module, with the functions partitioned into strongly connected components.
+*/
+class callgraph final {
+public:
+	explicit
+	callgraph(jive::graph & graph)
+	{
+		std::vector<lambda::node*> lambdas;
+		collect_lambdas(*graph.root(), lambdas);
+
+		for (auto lambda : lambdas)
+			collect_callsites(*lambda->subregion(), 0, callsites_[lambda]);
+
+		size_t index = 0;
+		std::vector<lambda::node*> stack;
+		std::unordered_map<const lambda::node*, std::pair<size_t, size_t>> indices;
+		for (auto lambda : lambdas) {
+			if (indices.find(lambda) == indices.end())
+				visit(lambda, index, stack, indices);
+		}
+	}
 
-		auto lambda = static_cast<const lambda::node*>(node);
+	std::vector<callsite> &
+	callsites(const lambda::node * lambda)
+	{
+		return callsites_[lambda];
+	}
 
-		std::vector<jive::simple_node*> calls;
-		bool onlyDirectCalls = lambda->direct_calls(&calls);
+	/**
+	* The strongly connected components of the call graph. A component is listed after all the
+	* components it calls.
+	*/
+	const std::vector<std::vector<lambda::node*>> &
+	sccs() const noexcept
+	{
+		return sccs_;
+	}
 
-		if (onlyDirectCalls && calls.size() == 1)
-			inlineCall(calls[0], lambda);
+private:
+	/**
+	* Tarjan's algorithm for the component of \p lambda. The pair of a visited function holds its
+	* index and lowlink, and the lowlink is set to SIZE_MAX once the function is assigned to a component.
+	*/
+	size_t
+	visit(
+		lambda::node * lambda,
+		size_t & index,
+		std::vector<lambda::node*> & stack,
+		std::unordered_map<const lambda::node*, std::pair<size_t, size_t>> & indices)
+	{
+		auto lambdaindex = index++;
+		auto lowlink = lambdaindex;
+		indices[lambda] = {lambdaindex, lowlink};
+		stack.push_back(lambda);
+
+		for (auto & callsite : callsites_[lambda]) {
+			if (callsite.callee == nullptr)
+				continue;
+
+			auto it = indices.find(callsite.callee);
+			if (it == indices.end())
+				lowlink = std::min(lowlink, visit(callsite.callee, index, stack, indices));
+			else if (it->second.second != SIZE_MAX)
+				lowlink = std::min(lowlink, it->second.first);
+		}
+
+		if (lowlink != lambdaindex) {
+			indices[lambda].second = lowlink;
+			return lowlink;
+		}
+
+		std::vector<lambda::node*> scc;
+		lambda::node * member = nullptr;
+		do {
+			member = stack.back();
+			stack.pop_back();
+			indices[member].second = SIZE_MAX;
+			scc.push_back(member);
+		} while (member != lambda);
+		sccs_.push_back(std::move(scc));
+
+		return lowlink;
+	}
+
+	std::vector<std::vector<lambda::node*>> sccs_;
+	std::unordered_map<const lambda::node*, std::vector<callsite>> callsites_;
+};
+
+/**
+* @return The number of arguments of \p call that are produced by a constant and used in \p callee.
+*/
+static size_t
+nconstant_arguments(const CallNode & call, const lambda::node & callee)
+{
+	size_t nconstants = 0;
+	for (size_t n = 1; n < call.ninputs(); n++) {
+		auto producer = jive::node_output::node(call.input(n)->origin());
+		if (is<jive::simple_op>(producer)
+		&& producer->ninputs() == 0
+		&& callee.fctargument(n-1)->nusers() != 0)
+			nconstants++;
+	}
+
+	return nconstants;
+}
+
+static void
+inlining(
+	jive::graph & graph,
+	const InliningConfiguration & configuration,
+	ilnstat & statistics)
+{
+	callgraph callgraph(graph);
+
+	std::unordered_map<const lambda::node*, size_t> sizes;
+	auto size = [&](const lambda::node * lambda)
+	{
+		auto it = sizes.find(lambda);
+		if (it != sizes.end())
+			return it->second;
+
+		return sizes[lambda] = jive::nnodes(lambda->subregion());
+	};
+
+	size_t growth = 0;
+	size_t budget = jive::nnodes(graph.root()) * configuration.GlobalGrowthBudget / 100;
+
+	for (auto & scc : callgraph.sccs()) {
+		std::unordered_set<const lambda::node*> members(scc.begin(), scc.end());
+
+		for (auto caller : scc) {
+			size_t callergrowth = 0;
+			for (auto & callsite : callgraph.callsites(caller)) {
+				auto callee = callsite.callee;
+				if (callee == nullptr)
+					continue;
+
+				if (members.find(callee) != members.end()) {
+					statistics.rejected_recursive();
+					continue;
+				}
+
+				auto calleesize = size(callee);
+				std::vector<jive::simple_node*> calls;
+				if (!callee->direct_calls(&calls) || calls.size() != 1) {
+					auto bonus = configuration.ConstantArgumentBonus * nconstant_arguments(*callsite.call, *callee);
+					auto cost = calleesize > bonus ? calleesize - bonus : 0;
+					auto threshold = configuration.Threshold + configuration.LoopDepthBonus * callsite.loopdepth;
+					if (cost > threshold) {
+						statistics.rejected_cost();
+						continue;
+					}
+
+					if (callergrowth + calleesize > configuration.CallerGrowthBudget
+					|| growth + calleesize > budget) {
+						statistics.rejected_budget();
+						continue;
+					}
+
+					/*
+						The callee remains alive as long as it has further users, and its body is therefore
+						only charged to the budgets if it is duplicated.
+					*/
+					callergrowth += calleesize;
+					growth += calleesize;
+				}
+
+				inlineCall(callsite.call, callee);
+				sizes[caller] = size(caller) + calleesize - 1;
+				statistics.inlined();
+			}
+		}
 	}
 }
 
 static void
 inlining(
   RvsdgModule & rm,
+  const InliningConfiguration & configuration,
   StatisticsCollector & statisticsCollector)
 {
 	auto & graph = rm.Rvsdg();
 	auto statistics = ilnstat::Create();
 
 	statistics->start(graph);
-	inlining(graph);
+	inlining(graph, configuration, *statistics);
 	statistics->stop(graph);
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
@@ -186,7 +477,7 @@ fctinline::run(
   RvsdgModule & module,
   StatisticsCollector & statisticsCollector)
 {
-	inlining(module, statisticsCollector);
+	inlining(module, Configuration_, statisticsCollector);
 }
 
 }
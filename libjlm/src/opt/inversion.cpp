@@ -28,18 +28,18 @@ public:
 	{}
 
 	void
-	start(const jive::graph & graph) noexcept
+	start(const jive::region & region) noexcept
 	{
-		nnodes_before_ = jive::nnodes(graph.root());
-		ninputs_before_ = jive::ninputs(graph.root());
+		nnodes_before_ = jive::nnodes(&region);
+		ninputs_before_ = jive::ninputs(&region);
 		timer_.start();
 	}
 
 	void
-	end(const jive::graph & graph) noexcept
+	end(const jive::region & region) noexcept
 	{
-		nnodes_after_ = jive::nnodes(graph.root());
-		ninputs_after_ = jive::ninputs(graph.root());
+		nnodes_after_ = jive::nnodes(&region);
+		ninputs_after_ = jive::ninputs(&region);
 		timer_.stop();
 	}
 
@@ -303,9 +303,9 @@ invert(
 {
 	auto statistics = ivtstat::Create();
 
-	statistics->start(rm.Rvsdg());
+	statistics->start(*rm.Rvsdg().root());
 	invert(rm.Rvsdg().root());
-	statistics->end(rm.Rvsdg());
+	statistics->end(*rm.Rvsdg().root());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -323,4 +323,18 @@ tginversion::run(
 	invert(module, statisticsCollector);
 }
 
+void
+tginversion::RunOnLambda(
+  lambda::node & lambdaNode,
+  StatisticsCollector & statisticsCollector)
+{
+	auto statistics = ivtstat::Create();
+
+	statistics->start(*lambdaNode.subregion());
+	invert(lambdaNode.subregion());
+	statistics->end(*lambdaNode.subregion());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
 }
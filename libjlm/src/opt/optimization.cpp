@@ -4,8 +4,8 @@
  */
 
 #include <jlm/ir/RvsdgModule.hpp>
-#include <jlm/opt/inlining.hpp>
 #include <jlm/opt/optimization.hpp>
+#include <jlm/opt/PassManager.hpp>
 
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/strfmt.hpp>
@@ -18,6 +18,26 @@ namespace jlm {
 optimization::~optimization()
 {}
 
+void
+optimization::run(
+  RvsdgModule & module,
+  StatisticsCollector & statisticsCollector,
+  PassManager&)
+{
+  run(module, statisticsCollector);
+}
+
+HashSet<AnalysisId>
+optimization::PreservedAnalyses() const
+{
+  return {};
+}
+
+/* RegionLocalOptimization class */
+
+RegionLocalOptimization::~RegionLocalOptimization()
+{}
+
 /* optimization_stat class */
 
 class optimization_stat final : public Statistics {
@@ -72,12 +92,22 @@ optimize(
   StatisticsCollector & statisticsCollector,
   const std::vector<optimization*> & opts)
 {
-	auto statistics = optimization_stat::Create(rm.SourceFileName());
+  optimize(rm, statisticsCollector, opts, 1);
+}
+
+void
+optimize(
+  RvsdgModule & rm,
+  StatisticsCollector & statisticsCollector,
+  const std::vector<optimization*> & opts,
+  size_t numThreads)
+{
+  auto statistics = optimization_stat::Create(rm.SourceFileName());
 
-	statistics->start(rm.Rvsdg());
-	for (const auto & opt : opts)
-		opt->run(rm, statisticsCollector);
-	statistics->end(rm.Rvsdg());
+  statistics->start(rm.Rvsdg());
+  PassManager passManager(numThreads);
+  passManager.Run(rm, statisticsCollector, opts);
+  statistics->end(rm.Rvsdg());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
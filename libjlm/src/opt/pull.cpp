@@ -27,16 +27,16 @@ public:
 	{}
 
 	void
-	start(const jive::graph & graph) noexcept
+	start(const jive::region & region) noexcept
 	{
-		ninputs_before_ = jive::ninputs(graph.root());
+		ninputs_before_ = jive::ninputs(&region);
 		timer_.start();
 	}
 
 	void
-	end(const jive::graph & graph) noexcept
+	end(const jive::region & region) noexcept
 	{
-		ninputs_after_ = jive::ninputs(graph.root());
+		ninputs_after_ = jive::ninputs(&region);
 		timer_.stop();
 	}
 
@@ -288,9 +288,9 @@ pull(
 {
 	auto statistics = pullstat::Create();
 
-	statistics->start(rm.Rvsdg());
+	statistics->start(*rm.Rvsdg().root());
 	pull(rm.Rvsdg().root());
-	statistics->end(rm.Rvsdg());
+	statistics->end(*rm.Rvsdg().root());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -308,4 +308,18 @@ pullin::run(
 	pull(module, statisticsCollector);
 }
 
+void
+pullin::RunOnLambda(
+  lambda::node & lambdaNode,
+  StatisticsCollector & statisticsCollector)
+{
+	auto statistics = pullstat::Create();
+
+	statistics->start(*lambdaNode.subregion());
+	pull(lambdaNode.subregion());
+	statistics->end(*lambdaNode.subregion());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
 }
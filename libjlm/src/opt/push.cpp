@@ -28,16 +28,16 @@ public:
 	{}
 
 	void
-	start(const jive::graph & graph) noexcept
+	start(const jive::region & region) noexcept
 	{
-		ninputs_before_ = jive::ninputs(graph.root());
+		ninputs_before_ = jive::ninputs(&region);
 		timer_.start();
 	}
 
 	void
-	end(const jive::graph & graph) noexcept
+	end(const jive::region & region) noexcept
 	{
-		ninputs_after_ = jive::ninputs(graph.root());
+		ninputs_after_ = jive::ninputs(&region);
 		timer_.stop();
 	}
 
@@ -411,9 +411,9 @@ push(
 {
 	auto statistics = pushstat::Create();
 
-	statistics->start(rm.Rvsdg());
+	statistics->start(*rm.Rvsdg().root());
 	push(rm.Rvsdg().root());
-	statistics->end(rm.Rvsdg());
+	statistics->end(*rm.Rvsdg().root());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -431,4 +431,18 @@ pushout::run(
 	push(module, statisticsCollector);
 }
 
+void
+pushout::RunOnLambda(
+  lambda::node & lambdaNode,
+  StatisticsCollector & statisticsCollector)
+{
+	auto statistics = pushstat::Create();
+
+	statistics->start(*lambdaNode.subregion());
+	push(lambdaNode.subregion());
+	statistics->end(*lambdaNode.subregion());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
 }
@@ -5,66 +5,206 @@
 
 #include <jive/rvsdg/binary.hpp>
 #include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/id-map.hpp>
 #include <jive/rvsdg/statemux.hpp>
+#include <jive/rvsdg/traverser.hpp>
 
 #include <jlm/ir/operators.hpp>
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/opt/reduction.hpp>
-#include <jlm/util/Statistics.hpp>
-#include <jlm/util/time.hpp>
 
 namespace jlm {
 
-class redstat final : public Statistics {
+/* nodereduction statistics class */
+
+void
+nodereduction::Statistics::Start(const jive::graph & graph) noexcept
+{
+  NumNodesBefore_ = jive::nnodes(graph.root());
+  NumInputsBefore_ = jive::ninputs(graph.root());
+  Timer_.start();
+}
+
+void
+nodereduction::Statistics::End(const jive::graph & graph) noexcept
+{
+  NumNodesAfter_ = jive::nnodes(graph.root());
+  NumInputsAfter_ = jive::ninputs(graph.root());
+  Timer_.stop();
+}
+
+std::string
+nodereduction::Statistics::ToString() const
+{
+  static const char * reductionNames[] = {
+    "Mux", "Store", "Load", "Gamma", "Unary", "Binary", "CommonNodeElimination"
+  };
+  static_assert(
+    sizeof(reductionNames)/sizeof(reductionNames[0]) == static_cast<size_t>(Reduction::LastEnumValue),
+    "Every reduction needs a name.");
+
+  auto s = strfmt("RED ",
+    NumNodesBefore_, " ", NumNodesAfter_, " ",
+    NumInputsBefore_, " ", NumInputsAfter_, " ",
+    Timer_.ns(), " ",
+    NumVisitedNodes_);
+
+  for (size_t n = 0; n < NumReductions_.size(); n++)
+    s += strfmt(" ", reductionNames[n], ":", NumReductions_[n]);
+
+  return s;
+}
+
+/** \brief Worklist of the nodes that need to be normalized
+ *
+ * The worklist is seeded with all nodes of the graph and subsequently tracks the mutations of the graph through its
+ * notifiers: Nodes created by a reduction are added, the users of diverted inputs as well as the producers of their
+ * new origins are added, and destroyed nodes are dropped. Nodes are taken from the worklist in the order they were
+ * added.
+ */
+class ReductionWorklist final {
 public:
-	virtual
-	~redstat()
-	{}
-
-	redstat()
-	: Statistics(Statistics::Id::ReduceNodes)
-  , nnodes_before_(0), nnodes_after_(0)
-	, ninputs_before_(0), ninputs_after_(0)
-	{}
-
-	void
-	start(const jive::graph & graph) noexcept
-	{
-		nnodes_before_ = jive::nnodes(graph.root());
-		ninputs_before_ = jive::ninputs(graph.root());
-		timer_.start();
-	}
-
-	void
-	end(const jive::graph & graph) noexcept
-	{
-		nnodes_after_ = jive::nnodes(graph.root());
-		ninputs_after_ = jive::ninputs(graph.root());
-		timer_.stop();
-	}
-
-	virtual std::string
-	ToString() const override
-	{
-		return strfmt("RED ",
-			nnodes_before_, " ", nnodes_after_, " ",
-			ninputs_before_, " ", ninputs_after_, " ",
-			timer_.ns()
-		);
-	}
-
-  static std::unique_ptr<redstat>
-  Create()
+  explicit
+  ReductionWorklist(jive::graph & graph)
+    : Head_(0)
+    , Current_(nullptr)
+  {
+    auto & notifiers = graph.notifiers();
+    Callbacks_.push_back(notifiers.on_node_create.connect(
+      [this](jive::node * node) { Push(node); }));
+    Callbacks_.push_back(notifiers.on_node_destroy.connect(
+      [this](jive::node * node) { Remove(node); }));
+    Callbacks_.push_back(notifiers.on_input_change.connect(
+      [this](jive::input * input, jive::output*, jive::output * newOrigin) { InputChange(input, newOrigin); }));
+
+    PushRegion(*graph.root());
+  }
+
+  ReductionWorklist(const ReductionWorklist&) = delete;
+
+  ReductionWorklist &
+  operator=(const ReductionWorklist&) = delete;
+
+  /**
+   * Takes the next node from the worklist and marks it as the node that is currently normalized.
+   *
+   * @return The next node, or nullptr if the worklist is empty.
+   */
+  jive::node *
+  Pop()
+  {
+    Current_ = nullptr;
+    while (Head_ < Nodes_.size())
+    {
+      auto node = Nodes_[Head_++];
+      if (node == nullptr)
+        continue;
+
+      Positions_.remove(*node);
+      Current_ = node;
+      break;
+    }
+
+    if (Head_ == Nodes_.size())
+    {
+      Nodes_.clear();
+      Head_ = 0;
+    }
+
+    return Current_;
+  }
+
+  /**
+   * @return The node that was last taken from the worklist, or nullptr if it was destroyed in the meantime.
+   */
+  [[nodiscard]] jive::node *
+  Current() const noexcept
+  {
+    return Current_;
+  }
+
+  void
+  Push(jive::node * node)
   {
-    return std::make_unique<redstat>();
+    if (Positions_.contains(*node))
+      return;
+
+    Positions_.insert(*node, Nodes_.size());
+    Nodes_.push_back(node);
   }
 
 private:
-	size_t nnodes_before_, nnodes_after_;
-	size_t ninputs_before_, ninputs_after_;
-	jlm::timer timer_;
+  void
+  PushRegion(const jive::region & region)
+  {
+    for (auto & node : jive::topdown_const_traverser(&region))
+    {
+      if (auto structuralNode = dynamic_cast<const jive::structural_node*>(node))
+      {
+        for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+          PushRegion(*structuralNode->subregion(n));
+      }
+
+      Push(const_cast<jive::node*>(node));
+    }
+  }
+
+  void
+  Remove(jive::node * node)
+  {
+    if (node == Current_)
+      Current_ = nullptr;
+
+    if (auto position = Positions_.lookup(*node))
+    {
+      Nodes_[*position] = nullptr;
+      Positions_.remove(*node);
+    }
+  }
+
+  void
+  InputChange(jive::input * input, jive::output * newOrigin)
+  {
+    if (auto nodeInput = dynamic_cast<jive::node_input*>(input))
+      Push(nodeInput->node());
+    else if (auto structuralNode = input->region()->node())
+      Push(structuralNode);
+
+    if (auto producer = jive::node_output::node(newOrigin))
+      Push(producer);
+  }
+
+  size_t Head_;
+  jive::node * Current_;
+  std::vector<jive::node*> Nodes_;
+  jive::node_map<size_t> Positions_;
+  std::vector<jive::callback> Callbacks_;
 };
 
+static nodereduction::Reduction
+GetReduction(const jive::operation & operation)
+{
+  if (jive::is<jive::mux_op>(operation))
+    return nodereduction::Reduction::Mux;
+
+  if (jive::is<StoreOperation>(operation))
+    return nodereduction::Reduction::Store;
+
+  if (jive::is<LoadOperation>(operation))
+    return nodereduction::Reduction::Load;
+
+  if (jive::is<jive::gamma_op>(operation))
+    return nodereduction::Reduction::Gamma;
+
+  if (jive::is<jive::unary_op>(operation))
+    return nodereduction::Reduction::Unary;
+
+  if (jive::is<jive::binary_op>(operation))
+    return nodereduction::Reduction::Binary;
+
+  return nodereduction::Reduction::CommonNodeElimination;
+}
+
 static void
 enable_mux_reductions(jive::graph & graph)
 {
@@ -131,9 +271,9 @@ reduce(
   StatisticsCollector & statisticsCollector)
 {
 	auto & graph = rm.Rvsdg();
-  auto statistics = redstat::Create();
+  auto statistics = nodereduction::Statistics::Create();
 
-	statistics->start(graph);
+	statistics->Start(graph);
 
 	enable_mux_reductions(graph);
 	enable_store_reductions(graph);
@@ -142,8 +282,34 @@ reduce(
 	enable_unary_reductions(graph);
 	enable_binary_reductions(graph);
 
-	graph.normalize();
-	statistics->end(graph);
+  ReductionWorklist worklist(graph);
+  while (auto node = worklist.Pop())
+  {
+    const auto & operation = node->operation();
+    auto reduction = GetReduction(operation);
+
+    statistics->AddVisitedNode();
+    auto mutationCount = graph.mutation_count();
+    if (graph.node_normal_form(typeid(operation))->normalize_node(node))
+      continue;
+
+    /*
+     * A normal form that reports a non-normalized node without changing the graph would otherwise have the node
+     * re-queued forever.
+     */
+    if (graph.mutation_count() == mutationCount)
+      continue;
+
+    statistics->AddReduction(reduction);
+
+    /*
+     * Some reductions change a node without removing it. Such a node needs to be normalized again.
+     */
+    if (auto current = worklist.Current())
+      worklist.Push(current);
+  }
+
+	statistics->End(graph);
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -21,6 +21,8 @@
 #include <jlm/util/strfmt.hpp>
 #include <jlm/util/time.hpp>
 
+#include <functional>
+
 namespace jlm {
 
 class unrollstat final : public Statistics {
@@ -32,6 +34,7 @@ public:
 	unrollstat()
 	: Statistics(Statistics::Id::LoopUnrolling)
   , nnodes_before_(0), nnodes_after_(0)
+  , nfull_(0), npartial_(0), nskipped_(0)
 	{}
 
 	void
@@ -48,11 +51,30 @@ public:
 		timer_.stop();
 	}
 
+	void
+	fully_unrolled() noexcept
+	{
+		nfull_++;
+	}
+
+	void
+	partially_unrolled() noexcept
+	{
+		npartial_++;
+	}
+
+	void
+	skipped() noexcept
+	{
+		nskipped_++;
+	}
+
 	virtual std::string
 	ToString() const override
 	{
 		return strfmt("UNROLL ",
 			nnodes_before_, " ", nnodes_after_, " ",
+			nfull_, " ", npartial_, " ", nskipped_, " ",
 			timer_.ns()
 		);
 	}
@@ -65,6 +87,7 @@ public:
 
 private:
 	size_t nnodes_before_, nnodes_after_;
+	size_t nfull_, npartial_, nskipped_;
 	jlm::timer timer_;
 };
 
@@ -484,6 +507,34 @@ unroll_unknown_theta(const unrollinfo & ui, size_t factor)
 	remove(otheta);
 }
 
+static bool
+is_full_unroll(const unrollinfo & ui, size_t factor)
+{
+	if (!ui.is_known())
+		return false;
+
+	auto niterations = ui.niterations();
+	return niterations && niterations->ule({ui.nbits(), (int64_t)factor}) == '1';
+}
+
+static void
+unroll(const unrollinfo & ui, size_t factor)
+{
+	auto graph = ui.theta()->graph();
+	auto nf = graph->node_normal_form(typeid(jive::operation));
+	nf->set_mutable(false);
+
+	{
+		jive::mutation_batch batch(*graph);
+		if (ui.is_known() && ui.niterations())
+			unroll_known_theta(ui, factor);
+		else
+			unroll_unknown_theta(ui, factor);
+	}
+
+	nf->set_mutable(true);
+}
+
 void
 unroll(jive::theta_node * otheta, size_t factor)
 {
@@ -493,30 +544,88 @@ unroll(jive::theta_node * otheta, size_t factor)
 	auto ui = unrollinfo::create(otheta);
 	if (!ui) return;
 
-	auto nf = otheta->graph()->node_normal_form(typeid(jive::operation));
-	nf->set_mutable(false);
+	unroll(*ui, factor);
+}
+
+size_t
+select_unroll_factor(const unrollinfo & ui, const UnrollHeuristic & heuristic)
+{
+	auto bodysize = std::max(jive::nnodes(ui.theta()->subregion()), size_t(1));
+
+	size_t niterations = 0;
+	if (ui.is_known()) {
+		if (auto n = ui.niterations())
+			niterations = n->to_uint();
+	}
+
+	if (niterations != 0
+	&& niterations <= heuristic.FullUnrollTripCount
+	&& niterations * bodysize <= heuristic.FullUnrollBudget)
+		return std::max(niterations, size_t(2));
 
-	if (ui->is_known() && ui->niterations())
-		unroll_known_theta(*ui, factor);
+	auto maxfactor = std::min(heuristic.MaxFactor, heuristic.BodyBudget / bodysize);
+	if (maxfactor < 2)
+		return 0;
+
+	/*
+		Prefer a factor that divides the trip count, as it avoids the epilogue for the
+		residual iterations.
+	*/
+	if (niterations != 0) {
+		for (size_t factor = maxfactor; factor >= 2; factor--) {
+			if (niterations % factor == 0)
+				return factor;
+		}
+	}
+
+	return maxfactor;
+}
+
+/*
+	Unroll the given theta by the factor returned from select_factor.
+*/
+static void
+unroll(
+	jive::theta_node * theta,
+	const std::function<size_t(const unrollinfo&)> & select_factor,
+	unrollstat & statistics)
+{
+	auto ui = unrollinfo::create(theta);
+	if (!ui) {
+		statistics.skipped();
+		return;
+	}
+
+	auto factor = select_factor(*ui);
+	if (factor < 2) {
+		statistics.skipped();
+		return;
+	}
+
+	if (is_full_unroll(*ui, factor))
+		statistics.fully_unrolled();
 	else
-		unroll_unknown_theta(*ui, factor);
+		statistics.partially_unrolled();
 
-	nf->set_mutable(true);
+	unroll(*ui, factor);
 }
 
 static bool
-unroll(jive::region * region, size_t factor)
+unroll(
+	jive::region * region,
+	const std::function<size_t(const unrollinfo&)> & select_factor,
+	unrollstat & statistics)
 {
 	bool unrolled = false;
 	for (auto & node : jive::topdown_traverser(region)) {
 		if (auto structnode = dynamic_cast<jive::structural_node*>(node)) {
 			for (size_t n = 0; n < structnode->nsubregions(); n++)
-				unrolled = unroll(structnode->subregion(n), factor);
+				unrolled = unroll(structnode->subregion(n), select_factor, statistics);
 
 			/* Try to unroll if an inner loop hasn't already been found */
 			if (!unrolled) {
 				if (auto theta = dynamic_cast<jive::theta_node*>(node)) {
-					unroll(theta, factor);
+					unroll(theta, select_factor, statistics);
 					unrolled = true;
 				}
 			}
@@ -535,14 +644,19 @@ loopunroll::run(
   RvsdgModule & module,
   StatisticsCollector & statisticsCollector)
 {
-  if (factor_ < 2)
+  if (!auto_ && factor_ < 2)
     return;
 
   auto & graph = module.Rvsdg();
   auto statistics = unrollstat::Create();
 
+  auto selectFactor = [&](const unrollinfo & ui)
+  {
+    return auto_ ? select_unroll_factor(ui, heuristic_) : factor_;
+  };
+
   statistics->start(module.Rvsdg());
-  unroll(graph.root(), factor_);
+  unroll(graph.root(), selectFactor, *statistics);
   statistics->end(module.Rvsdg());
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
@@ -252,7 +252,7 @@ JlmOptCommand::ToString() const
 
   return strfmt(
     "jlm-opt ",
-    "--llvm ",
+    "--output-format=llvm ",
     optimizationArguments,
     "-o ", OutputFile_.to_str(), " ",
     InputFile_.to_str());
@@ -270,13 +270,16 @@ JlmOptCommand::ToString(const Optimization & optimization)
 {
   static std::unordered_map<Optimization, const char*>
     map({
+          {Optimization::AAAndersenRegionAware,     "--AAAndersenRegionAware"},
           {Optimization::AASteensgaardAgnostic,     "--AASteensgaardAgnostic"},
+          {Optimization::AASteensgaardFieldSensitiveRegionAware, "--AASteensgaardFieldSensitiveRegionAware"},
           {Optimization::AASteensgaardRegionAware,  "--AASteensgaardRegionAware"},
           {Optimization::CommonNodeElimination,     "--cne"},
           {Optimization::DeadNodeElimination,       "--dne"},
           {Optimization::FunctionInlining,          "--iln"},
           {Optimization::InvariantValueRedirection, "--InvariantValueRedirection"},
           {Optimization::LoopUnrolling,             "--url"},
+          {Optimization::LoopUnrollingAuto,         "--url-auto"},
           {Optimization::NodePullIn,                "--pll"},
           {Optimization::NodePushOut,               "--psh"},
           {Optimization::NodeReduction,             "--red"},
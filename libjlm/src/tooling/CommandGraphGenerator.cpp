@@ -118,7 +118,9 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
       if (!commandLineOptions.JlmOptOptimizations_.empty()) {
         static std::unordered_map<std::string, JlmOptCommand::Optimization>map(
         {
+          {"AAAndersenRegionAware", JlmOptCommand::Optimization::AAAndersenRegionAware},
           {"AASteensgaardAgnostic", JlmOptCommand::Optimization::AASteensgaardAgnostic},
+          {"AASteensgaardFieldSensitiveRegionAware", JlmOptCommand::Optimization::AASteensgaardFieldSensitiveRegionAware},
           {"AASteensgaardRegionAware", JlmOptCommand::Optimization::AASteensgaardRegionAware},
           {"cne", JlmOptCommand::Optimization::CommonNodeElimination},
           {"dne", JlmOptCommand::Optimization::DeadNodeElimination},
@@ -129,6 +131,7 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
           {"red", JlmOptCommand::Optimization::NodeReduction},
           {"ivt", JlmOptCommand::Optimization::ThetaGammaInversion},
           {"url", JlmOptCommand::Optimization::LoopUnrolling},
+          {"url-auto", JlmOptCommand::Optimization::LoopUnrollingAuto},
         });
         for (const auto & jlmOpt : commandLineOptions.JlmOptOptimizations_)
 	{
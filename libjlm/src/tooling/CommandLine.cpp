@@ -4,6 +4,7 @@
  */
 
 #include <jlm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/opt/alias-analyses/Steensgaard.hpp>
 #include <jlm/opt/cne.hpp>
 #include <jlm/opt/DeadNodeElimination.hpp>
 #include <jlm/opt/inlining.hpp>
@@ -12,8 +13,10 @@
 #include <jlm/opt/push.hpp>
 #include <jlm/opt/inversion.hpp>
 #include <jlm/opt/unroll.hpp>
+#include <jlm/opt/PassManager.hpp>
 #include <jlm/opt/reduction.hpp>
 #include <jlm/tooling/CommandLine.hpp>
+#include <jlm/util/strfmt.hpp>
 
 #include <llvm/Support/CommandLine.h>
 
@@ -93,9 +96,11 @@ JlmOptCommandLineOptions::Reset() noexcept
 {
   InputFile_ = filepath("");
   OutputFile_ = filepath("");
+  InputFormat_ = InputFormat::Llvm;
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = StatisticsCollectorSettings();
   Optimizations_.clear();
+  NumThreads_ = 1;
 }
 
 void
@@ -364,8 +369,10 @@ JlmOptCommandLineParser::~JlmOptCommandLineParser() noexcept
 optimization *
 JlmOptCommandLineParser::GetOptimization(enum OptimizationId id)
 {
+  static aa::AndersenRegionAware andersenRegionAware;
   static aa::SteensgaardAgnostic steensgaardAgnostic;
   static aa::SteensgaardRegionAware steensgaardRegionAware;
+  static aa::SteensgaardRegionAware steensgaardFieldSensitiveRegionAware(aa::Steensgaard::DefaultMaxFields);
   static cne commonNodeElimination;
   static DeadNodeElimination deadNodeElimination;
   static fctinline functionInlining;
@@ -374,11 +381,14 @@ JlmOptCommandLineParser::GetOptimization(enum OptimizationId id)
   static pushout nodePushOt;
   static tginversion thetaGammaInversion;
   static loopunroll loopUnrolling(4);
+  static loopunroll heuristicLoopUnrolling(UnrollHeuristic{});
   static nodereduction nodeReduction;
 
   static std::unordered_map<OptimizationId, jlm::optimization*> map(
     {
+      {OptimizationId::AAAndersenRegionAware,     &andersenRegionAware},
       {OptimizationId::AASteensgaardAgnostic,     &steensgaardAgnostic},
+      {OptimizationId::AASteensgaardFieldSensitiveRegionAware, &steensgaardFieldSensitiveRegionAware},
       {OptimizationId::AASteensgaardRegionAware,  &steensgaardRegionAware},
       {OptimizationId::cne,                       &commonNodeElimination},
       {OptimizationId::dne,                       &deadNodeElimination},
@@ -388,6 +398,7 @@ JlmOptCommandLineParser::GetOptimization(enum OptimizationId id)
       {OptimizationId::psh,                       &nodePushOt},
       {OptimizationId::ivt,                       &thetaGammaInversion},
       {OptimizationId::url,                       &loopUnrolling},
+      {OptimizationId::urlAuto,                   &heuristicLoopUnrolling},
       {OptimizationId::red,                       &nodeReduction}
     });
 
@@ -395,10 +406,81 @@ JlmOptCommandLineParser::GetOptimization(enum OptimizationId id)
   return map[id];
 }
 
+JlmOptCommandLineParser::OptimizationId
+JlmOptCommandLineParser::GetOptimizationId(const std::string & name)
+{
+  static std::unordered_map<std::string, OptimizationId> map(
+    {
+      {"AAAndersenRegionAware",     OptimizationId::AAAndersenRegionAware},
+      {"AASteensgaardAgnostic",     OptimizationId::AASteensgaardAgnostic},
+      {"AASteensgaardFieldSensitiveRegionAware", OptimizationId::AASteensgaardFieldSensitiveRegionAware},
+      {"AASteensgaardRegionAware",  OptimizationId::AASteensgaardRegionAware},
+      {"cne",                       OptimizationId::cne},
+      {"dne",                       OptimizationId::dne},
+      {"iln",                       OptimizationId::iln},
+      {"InvariantValueRedirection", OptimizationId::InvariantValueRedirection},
+      {"pll",                       OptimizationId::pll},
+      {"psh",                       OptimizationId::psh},
+      {"ivt",                       OptimizationId::ivt},
+      {"url",                       OptimizationId::url},
+      {"url-auto",                  OptimizationId::urlAuto},
+      {"red",                       OptimizationId::red}
+    });
+
+  auto it = map.find(name);
+  if (it == map.end())
+    throw error(strfmt("Unknown optimization '", name, "' in pipeline."));
+
+  return it->second;
+}
+
+std::vector<optimization*>
+JlmOptCommandLineParser::ParsePipeline(const std::string & pipeline)
+{
+  size_t position = 0;
+  auto optimizations = ParsePipeline(pipeline, position);
+  if (position != pipeline.size())
+    throw error(strfmt("Unexpected '", pipeline[position], "' at position ", position, " of pipeline."));
+
+  return optimizations;
+}
+
+std::vector<optimization*>
+JlmOptCommandLineParser::ParsePipeline(const std::string & pipeline, size_t & position)
+{
+  std::vector<optimization*> optimizations;
+  while (true)
+  {
+    if (position < pipeline.size() && pipeline[position] == '(')
+    {
+      position++;
+      auto groupOptimizations = ParsePipeline(pipeline, position);
+      if (pipeline.compare(position, 2, ")*") != 0)
+        throw error(strfmt("Expected ')*' at position ", position, " of pipeline."));
+      position += 2;
+
+      FixpointGroups_.push_back(std::make_unique<FixpointGroup>(std::move(groupOptimizations)));
+      optimizations.push_back(FixpointGroups_.back().get());
+    }
+    else
+    {
+      auto end = std::min(pipeline.find_first_of(",()*", position), pipeline.size());
+      optimizations.push_back(GetOptimization(GetOptimizationId(pipeline.substr(position, end - position))));
+      position = end;
+    }
+
+    if (position == pipeline.size() || pipeline[position] != ',')
+      return optimizations;
+
+    position++;
+  }
+}
+
 const JlmOptCommandLineOptions &
 JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
 {
   CommandLineOptions_.Reset();
+  FixpointGroups_.clear();
 
   using namespace llvm;
 
@@ -433,6 +515,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
         Statistics::Id::Aggregation,
         "print-aggregation-time",
         "Write aggregation statistics to file."),
+      clEnumValN(
+        Statistics::Id::AndersenAnalysis,
+        "print-andersen-analysis",
+        "Write Andersen analysis statistics to file."),
       clEnumValN(
         Statistics::Id::Annotation,
         "print-annotation-time",
@@ -473,6 +559,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
         Statistics::Id::LoopUnrolling,
         "print-unroll-stat",
         "Write loop unrolling statistics to file."),
+      clEnumValN(
+        Statistics::Id::FixpointGroup,
+        "print-fixpoint-group",
+        "Write fixpoint group statistics to file."),
       clEnumValN(
         Statistics::Id::MemoryNodeProvisioning,
         "print-memory-node-provisioning",
@@ -515,24 +605,71 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
         "Write theta-gamma inversion statistics to file.")),
     cl::desc("Write statistics"));
 
+  cl::opt<JlmOptCommandLineOptions::InputFormat> inputFormat(
+    "input-format",
+    cl::values(
+      clEnumValN(
+        JlmOptCommandLineOptions::InputFormat::Llvm,
+        "llvm",
+        "Read LLVM IR [default]"),
+      clEnumValN(
+        JlmOptCommandLineOptions::InputFormat::Rvsdg,
+        "rvsdg",
+        "Read binary RVSDG")),
+    cl::init(JlmOptCommandLineOptions::InputFormat::Llvm),
+    cl::desc("Select input format"));
+
   cl::opt<JlmOptCommandLineOptions::OutputFormat> outputFormat(
+    "output-format",
     cl::values(
       clEnumValN(
         JlmOptCommandLineOptions::OutputFormat::Llvm,
         "llvm",
         "Output LLVM IR [default]"),
+      clEnumValN(
+        JlmOptCommandLineOptions::OutputFormat::Rvsdg,
+        "rvsdg",
+        "Output binary RVSDG"),
       clEnumValN(
         JlmOptCommandLineOptions::OutputFormat::Xml,
         "xml",
-        "Output XML")),
+        "Output XML"),
+      clEnumValN(
+        JlmOptCommandLineOptions::OutputFormat::XmlGzip,
+        "xml-gz",
+        "Output gzip-compressed XML")),
+    cl::init(JlmOptCommandLineOptions::OutputFormat::Llvm),
+    cl::desc("Select output format"));
+
+  /*
+   * The bare output format flags predate --output-format and are kept for existing invocations.
+   */
+  cl::opt<JlmOptCommandLineOptions::OutputFormat> outputFormatFlag(
+    cl::values(
+      clEnumValN(
+        JlmOptCommandLineOptions::OutputFormat::Llvm,
+        "llvm",
+        "Output LLVM IR (alias of --output-format=llvm)"),
+      clEnumValN(
+        JlmOptCommandLineOptions::OutputFormat::Xml,
+        "xml",
+        "Output XML (alias of --output-format=xml)")),
     cl::desc("Select output format"));
 
   cl::list<OptimizationId> optimizationIds(
     cl::values(
+      clEnumValN(
+        OptimizationId::AAAndersenRegionAware,
+        "AAAndersenRegionAware",
+        "Andersen alias analysis with region-aware memory state encoding."),
       clEnumValN(
         OptimizationId::AASteensgaardAgnostic,
         "AASteensgaardAgnostic",
         "Steensgaard alias analysis with agnostic memory state encoding."),
+      clEnumValN(
+        OptimizationId::AASteensgaardFieldSensitiveRegionAware,
+        "AASteensgaardFieldSensitiveRegionAware",
+        "Field-sensitive Steensgaard alias analysis with region-aware memory state encoding."),
       clEnumValN(
         OptimizationId::AASteensgaardRegionAware,
         "AASteensgaardRegionAware",
@@ -572,9 +709,29 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
       clEnumValN(
         OptimizationId::url,
         "url",
-        "Loop unrolling")),
+        "Loop unrolling"),
+      clEnumValN(
+        OptimizationId::urlAuto,
+        "url-auto",
+        "Loop unrolling with trip count and size based unroll factors")),
     cl::desc("Perform optimization"));
 
+  cl::opt<std::string> pipeline(
+    "pipeline",
+    cl::desc("Perform the optimizations of <pipeline> in order. A comma-separated list of optimizations that is "
+             "enclosed in parentheses and followed by '*' is repeated until it no longer changes the module, "
+             "but at most 16 times, e.g., 'iln,(red,cne,dne)*'. Any change of the graph counts, such that groups "
+             "with passes that always grow the graph, e.g., psh, stop at this limit without reaching a fixpoint. "
+             "--print-fixpoint-group reports whether a group converged."),
+    cl::value_desc("pipeline"));
+
+  cl::opt<unsigned> numThreads(
+    "j",
+    cl::Prefix,
+    cl::init(1),
+    cl::desc("Perform region-local optimizations with <n> threads"),
+    cl::value_desc("n"));
+
   cl::ParseCommandLineOptions(argc, argv);
 
   if (!outputFile.empty())
@@ -583,15 +740,42 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char **argv)
   if (!statisticFile.empty())
     CommandLineOptions_.StatisticsCollectorSettings_.SetFilePath(statisticFile);
 
+  if (outputFormat.getNumOccurrences() != 0 && outputFormatFlag.getNumOccurrences() != 0) {
+    std::cerr << "The output format cannot be specified both with --output-format and a bare format flag.\n";
+    exit(EXIT_FAILURE);
+  }
+
+  if (!pipeline.empty() && !optimizationIds.empty()) {
+    std::cerr << "Optimizations cannot be specified both individually and with a pipeline.\n";
+    exit(EXIT_FAILURE);
+  }
+
   std::vector<jlm::optimization*> optimizations;
   for (auto & optimizationId : optimizationIds)
     optimizations.push_back(GetOptimization(optimizationId));
 
+  if (!pipeline.empty()) {
+    try {
+      optimizations = ParsePipeline(pipeline);
+    } catch (const jlm::error & e) {
+      std::cerr << e.what() << "\n";
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  /*
+   * Dead node elimination is not region-local, but sweeps lambda nodes in parallel by itself.
+   */
+  auto deadNodeElimination = static_cast<DeadNodeElimination*>(GetOptimization(OptimizationId::dne));
+  deadNodeElimination->SetNumThreads(numThreads);
+
   HashSet<Statistics::Id> printStatisticsIds({printStatistics.begin(), printStatistics.end()});
 
   CommandLineOptions_.InputFile_ = inputFile;
-  CommandLineOptions_.OutputFormat_ = outputFormat;
+  CommandLineOptions_.InputFormat_ = inputFormat;
+  CommandLineOptions_.OutputFormat_ = outputFormatFlag.getNumOccurrences() != 0 ? outputFormatFlag : outputFormat;
   CommandLineOptions_.Optimizations_ = optimizations;
+  CommandLineOptions_.NumThreads_ = numThreads;
   CommandLineOptions_.StatisticsCollectorSettings_.SetDemandedStatistics(printStatisticsIds);
 
   return CommandLineOptions_;
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/common.hpp>
+#include <jlm/util/ThreadPool.hpp>
+
+#include <cstdint>
+
+namespace jlm
+{
+
+static thread_local size_t ThreadWorkerIndex = SIZE_MAX;
+
+class ThreadPool::Worker final
+{
+public:
+  std::mutex Mutex_;
+  std::deque<std::function<void()>> Tasks_;
+};
+
+ThreadPool::~ThreadPool() noexcept
+{
+  Wait();
+
+  {
+    std::lock_guard<std::mutex> lock(Mutex_);
+    Done_ = true;
+  }
+  TaskAvailable_.notify_all();
+
+  for (auto & thread : Threads_)
+    thread.join();
+}
+
+ThreadPool::ThreadPool(size_t numThreads)
+  : Done_(false)
+  , NumPending_(0)
+  , NumQueued_(0)
+  , NextWorker_(0)
+{
+  JLM_ASSERT(numThreads > 0);
+
+  for (size_t n = 0; n < numThreads; n++)
+    Workers_.push_back(std::make_unique<Worker>());
+
+  for (size_t n = 0; n < numThreads; n++)
+    Threads_.emplace_back([this, n]() { Run(n); });
+}
+
+void
+ThreadPool::Submit(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(Mutex_);
+    NumPending_++;
+    NumQueued_++;
+
+    auto & worker = *Workers_[NextWorker_];
+    NextWorker_ = (NextWorker_ + 1) % Workers_.size();
+
+    std::lock_guard<std::mutex> workerLock(worker.Mutex_);
+    worker.Tasks_.push_back(std::move(task));
+  }
+
+  TaskAvailable_.notify_one();
+}
+
+void
+ThreadPool::Wait()
+{
+  std::unique_lock<std::mutex> lock(Mutex_);
+  AllTasksDone_.wait(lock, [this]() { return NumPending_ == 0; });
+}
+
+bool
+ThreadPool::TryPop(size_t workerIndex, std::function<void()> & task)
+{
+  {
+    auto & worker = *Workers_[workerIndex];
+    std::lock_guard<std::mutex> lock(worker.Mutex_);
+    if (!worker.Tasks_.empty())
+    {
+      task = std::move(worker.Tasks_.back());
+      worker.Tasks_.pop_back();
+      return true;
+    }
+  }
+
+  for (size_t n = 1; n < Workers_.size(); n++)
+  {
+    auto & victim = *Workers_[(workerIndex + n) % Workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.Mutex_);
+    if (!victim.Tasks_.empty())
+    {
+      task = std::move(victim.Tasks_.front());
+      victim.Tasks_.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+size_t
+ThreadPool::CurrentWorkerIndex() noexcept
+{
+  return ThreadWorkerIndex;
+}
+
+void
+ThreadPool::Run(size_t workerIndex)
+{
+  ThreadWorkerIndex = workerIndex;
+
+  std::function<void()> task;
+  while (true)
+  {
+    if (TryPop(workerIndex, task))
+    {
+      {
+        std::lock_guard<std::mutex> lock(Mutex_);
+        NumQueued_--;
+      }
+
+      task();
+      task = nullptr;
+
+      std::lock_guard<std::mutex> lock(Mutex_);
+      if (--NumPending_ == 0)
+        AllTasksDone_.notify_all();
+      continue;
+    }
+
+    /*
+     * Tasks are queued while holding Mutex_, so a worker that finds NumQueued_ to be non-zero is guaranteed to find
+     * a task in one of the queues, unless another worker took it first.
+     */
+    std::unique_lock<std::mutex> lock(Mutex_);
+    TaskAvailable_.wait(lock, [this]() { return Done_ || NumQueued_ > 0; });
+    if (Done_)
+      return;
+  }
+}
+
+}
@@ -292,6 +292,8 @@ GetElementPtrTest::SetupRvsdg()
   this->getElementPtrX = jive::node_output::node(gepx);
   this->getElementPtrY = jive::node_output::node(gepy);
 
+  module->AddStructTypeDeclaration(std::move(dcl));
+
   return module;
 }
 
@@ -3054,5 +3056,164 @@ LinkedListTest::SetupRvsdg()
   this->LambdaNext_ = lambdaNext->node();
   this->Alloca_ = alloca;
 
+  rvsdgModule->AddStructTypeDeclaration(std::move(declaration));
+
+  return rvsdgModule;
+}
+
+std::unique_ptr<jlm::RvsdgModule>
+StructFieldTest::SetupRvsdg()
+{
+  using namespace jlm;
+
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto nf = rvsdg.node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  PointerType p32(jive::bit32);
+  PointerType pp32(*static_cast<const jive::valuetype*>(&p32));
+  auto declaration = jive::rcddeclaration::create({&p32, &p32, &p32});
+  auto structType = StructType::Create("s", false, *declaration);
+
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&iOStateType, &memoryStateType, &loopStateType},
+    {&p32, &iOStateType, &memoryStateType, &loopStateType});
+
+  auto lambda = lambda::node::create(
+    rvsdg.root(),
+    functionType,
+    "f",
+    linkage::external_linkage);
+  auto iOStateArgument = lambda->fctargument(0);
+  auto memoryStateArgument = lambda->fctargument(1);
+  auto loopStateArgument = lambda->fctargument(2);
+
+  auto zero = jive::create_bitconstant(lambda->subregion(), 32, 0);
+  auto one = jive::create_bitconstant(lambda->subregion(), 32, 1);
+  auto two = jive::create_bitconstant(lambda->subregion(), 32, 2);
+
+  auto allocaA = alloca_op::create(jive::bit32, one, 4);
+  auto allocaB = alloca_op::create(jive::bit32, one, 4);
+  auto allocaS = alloca_op::create(*structType, one, 8);
+  auto mergedMemoryState = MemStateMergeOperator::Create(
+    {allocaA[1], allocaB[1], allocaS[1], memoryStateArgument});
+
+  auto gepY = getelementptr_op::create(allocaS[0], {zero, one}, pp32);
+  auto gepZ = getelementptr_op::create(allocaS[0], {zero, two}, pp32);
+
+  auto storeY = StoreNode::Create(gepY, allocaA[0], {mergedMemoryState}, 8);
+  auto storeZ = StoreNode::Create(gepZ, allocaB[0], {storeY[0]}, 8);
+
+  PointerType p8(jive::bit8);
+  auto eight = jive::create_bitconstant(lambda->subregion(), 32, 8);
+  auto bitcastS = bitcast_op::create(allocaS[0], p8);
+  auto gepByte = getelementptr_op::create(bitcastS, {eight}, p8);
+  auto bitcastByte = bitcast_op::create(gepByte, pp32);
+
+  auto loadResults = LoadNode::Create(bitcastByte, {storeZ[0]}, p32, 8);
+
+  auto lambdaOutput = lambda->finalize({loadResults[0], iOStateArgument, loadResults[1], loopStateArgument});
+  rvsdg.add_export(lambdaOutput, {PointerType(lambda->type()), "f"});
+
+  /*
+   * Assign nodes
+   */
+  this->LambdaF_ = lambdaOutput->node();
+
+  this->AllocaA_ = jive::node_output::node(allocaA[0]);
+  this->AllocaB_ = jive::node_output::node(allocaB[0]);
+  this->AllocaS_ = jive::node_output::node(allocaS[0]);
+
+  this->GepY_ = jive::node_output::node(gepY);
+  this->GepZ_ = jive::node_output::node(gepZ);
+  this->GepByte_ = jive::node_output::node(gepByte);
+
+  this->Load_ = AssertedCast<LoadNode>(jive::node_output::node(loadResults[0]));
+
+  rvsdgModule->AddStructTypeDeclaration(std::move(declaration));
+
+  return rvsdgModule;
+}
+
+std::unique_ptr<jlm::RvsdgModule>
+WideStructFieldTest::SetupRvsdg()
+{
+  using namespace jlm;
+
+  auto rvsdgModule = RvsdgModule::Create(
+    filepath(""),
+    "x86_64-unknown-linux-gnu",
+    "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto nf = rvsdg.node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  jive::bittype bit128(128);
+  PointerType p32(jive::bit32);
+  PointerType pp32(*static_cast<const jive::valuetype*>(&p32));
+  auto declaration = jive::rcddeclaration::create({&jive::bit64, &bit128, &p32});
+  auto structType = StructType::Create("u", false, *declaration);
+
+  iostatetype iOStateType;
+  MemoryStateType memoryStateType;
+  loopstatetype loopStateType;
+  FunctionType functionType(
+    {&iOStateType, &memoryStateType, &loopStateType},
+    {&p32, &iOStateType, &memoryStateType, &loopStateType});
+
+  auto lambda = lambda::node::create(
+    rvsdg.root(),
+    functionType,
+    "f",
+    linkage::external_linkage);
+  auto iOStateArgument = lambda->fctargument(0);
+  auto memoryStateArgument = lambda->fctargument(1);
+  auto loopStateArgument = lambda->fctargument(2);
+
+  auto zero = jive::create_bitconstant(lambda->subregion(), 32, 0);
+  auto one = jive::create_bitconstant(lambda->subregion(), 32, 1);
+  auto two = jive::create_bitconstant(lambda->subregion(), 32, 2);
+
+  auto allocaA = alloca_op::create(jive::bit32, one, 4);
+  auto allocaB = alloca_op::create(jive::bit32, one, 4);
+  auto allocaU = alloca_op::create(*structType, one, 16);
+  auto mergedMemoryState = MemStateMergeOperator::Create(
+    {allocaA[1], allocaB[1], allocaU[1], memoryStateArgument});
+
+  auto gepZ = getelementptr_op::create(allocaU[0], {zero, two}, pp32);
+  auto storeZ = StoreNode::Create(gepZ, allocaA[0], {mergedMemoryState}, 8);
+
+  PointerType p8(jive::bit8);
+  auto twentyFour = jive::create_bitconstant(lambda->subregion(), 32, 24);
+  auto bitcastU = bitcast_op::create(allocaU[0], p8);
+  auto gepByte = getelementptr_op::create(bitcastU, {twentyFour}, p8);
+  auto bitcastByte = bitcast_op::create(gepByte, pp32);
+  auto storeByte = StoreNode::Create(bitcastByte, allocaB[0], {storeZ[0]}, 8);
+
+  auto loadResults = LoadNode::Create(gepZ, {storeByte[0]}, p32, 8);
+
+  auto lambdaOutput = lambda->finalize({loadResults[0], iOStateArgument, loadResults[1], loopStateArgument});
+  rvsdg.add_export(lambdaOutput, {PointerType(lambda->type()), "f"});
+
+  /*
+   * Assign nodes
+   */
+  this->AllocaA_ = jive::node_output::node(allocaA[0]);
+  this->AllocaB_ = jive::node_output::node(allocaB[0]);
+  this->AllocaU_ = jive::node_output::node(allocaU[0]);
+
+  this->GepZ_ = jive::node_output::node(gepZ);
+  this->GepByte_ = jive::node_output::node(gepByte);
+
+  this->Load_ = AssertedCast<LoadNode>(jive::node_output::node(loadResults[0]));
+
+  rvsdgModule->AddStructTypeDeclaration(std::move(declaration));
+
   return rvsdgModule;
 }
\ No newline at end of file
@@ -1642,4 +1642,178 @@ private:
   jlm::lambda::node * LambdaNext_;
 
   jive::node * Alloca_;
+};
+
+/** \brief StructFieldTest class
+ *
+ * This class sets up an RVSDG representing the following code snippet:
+ *
+ * \code{.c}
+ *  struct s
+ *  {
+ *    int32_t * x;
+ *    int32_t * y;
+ *    int32_t * z;
+ *  };
+ *
+ *  int32_t*
+ *  f()
+ *  {
+ *    int32_t a, b;
+ *    struct s s;
+ *    s.y = &a;
+ *    s.z = &b;
+ *    return *(int32_t**)((char*)&s + 8);
+ *  }
+ * \endcode
+ *
+ * The return statement reads field y through an i8 pointer, which addresses the same field as the getelementptr of
+ * the first assignment. It uses a single memory state to sequentialize the respective memory operations.
+ */
+class StructFieldTest final : public RvsdgTest
+{
+public:
+  [[nodiscard]] const jlm::lambda::node &
+  GetLambdaF() const noexcept
+  {
+    return *LambdaF_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetAllocaA() const noexcept
+  {
+    return *AllocaA_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetAllocaB() const noexcept
+  {
+    return *AllocaB_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetAllocaS() const noexcept
+  {
+    return *AllocaS_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetGepY() const noexcept
+  {
+    return *GepY_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetGepZ() const noexcept
+  {
+    return *GepZ_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetGepByte() const noexcept
+  {
+    return *GepByte_;
+  }
+
+  [[nodiscard]] const jlm::LoadNode &
+  GetLoad() const noexcept
+  {
+    return *Load_;
+  }
+
+private:
+  std::unique_ptr<jlm::RvsdgModule>
+  SetupRvsdg() override;
+
+  jlm::lambda::node * LambdaF_;
+
+  jive::node * AllocaA_;
+  jive::node * AllocaB_;
+  jive::node * AllocaS_;
+
+  jive::node * GepY_;
+  jive::node * GepZ_;
+  jive::node * GepByte_;
+
+  jlm::LoadNode * Load_;
+};
+
+/** \brief WideStructFieldTest class
+ *
+ * This class sets up an RVSDG representing the following code snippet:
+ *
+ * \code{.c}
+ *  struct u
+ *  {
+ *    int64_t x;
+ *    __int128 y;
+ *    int32_t * z;
+ *  };
+ *
+ *  int32_t*
+ *  f()
+ *  {
+ *    int32_t a, b;
+ *    struct u u;
+ *    u.z = &a;
+ *    *(int32_t**)((char*)&u + 24) = &b;
+ *    return u.z;
+ *  }
+ * \endcode
+ *
+ * The module has the data layout of x86-64, which aligns i128 values to eight bytes. The second assignment thus
+ * writes field z through an i8 pointer. It uses a single memory state to sequentialize the respective memory
+ * operations.
+ */
+class WideStructFieldTest final : public RvsdgTest
+{
+public:
+  [[nodiscard]] const jive::node &
+  GetAllocaA() const noexcept
+  {
+    return *AllocaA_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetAllocaB() const noexcept
+  {
+    return *AllocaB_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetAllocaU() const noexcept
+  {
+    return *AllocaU_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetGepZ() const noexcept
+  {
+    return *GepZ_;
+  }
+
+  [[nodiscard]] const jive::node &
+  GetGepByte() const noexcept
+  {
+    return *GepByte_;
+  }
+
+  [[nodiscard]] const jlm::LoadNode &
+  GetLoad() const noexcept
+  {
+    return *Load_;
+  }
+
+private:
+  std::unique_ptr<jlm::RvsdgModule>
+  SetupRvsdg() override;
+
+  jive::node * AllocaA_;
+  jive::node * AllocaB_;
+  jive::node * AllocaU_;
+
+  jive::node * GepZ_;
+  jive::node * GepByte_;
+
+  jlm::LoadNode * Load_;
 };
\ No newline at end of file
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/view.hpp>
+
+#include <cassert>
+#include <stdexcept>
+
+class ChunkRecorder final : public jive::xml_sink {
+public:
+  void
+  write(const char * data, size_t size) override
+  {
+    Chunks_.emplace_back(data, size);
+  }
+
+  [[nodiscard]] const std::vector<std::string> &
+  Chunks() const noexcept
+  {
+    return Chunks_;
+  }
+
+private:
+  std::vector<std::string> Chunks_;
+};
+
+static size_t
+CountOccurrences(const std::string & s, const std::string & pattern)
+{
+  size_t count = 0;
+  for (auto pos = s.find(pattern); pos != std::string::npos; pos = s.find(pattern, pos + 1))
+    count++;
+
+  return count;
+}
+
+static void
+TestXmlStreaming()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+
+  jive::graph graph;
+  auto import = graph.add_import({vt, "import"});
+
+  const size_t numNodes = 2000;
+  jive::output * output = import;
+  for (size_t n = 0; n < numNodes; n++)
+    output = test_op::create(graph.root(), {output}, {&vt})->output(0);
+
+  auto structuralNode = structural_node::create(graph.root(), 2);
+  jive::structural_input::create(structuralNode, output, vt);
+
+  graph.add_export(output, {vt, "export"});
+
+  /*
+   * Act
+   */
+  ChunkRecorder recorder;
+  jive::view_xml(graph.root(), recorder);
+
+  /*
+   * Assert
+   */
+  std::string document;
+  for (auto & chunk : recorder.Chunks())
+  {
+    assert(chunk.size() <= 64 * 1024);
+    document += chunk;
+  }
+
+  assert(recorder.Chunks().size() > 1);
+  assert(document == jive::to_xml(graph.root()));
+  assert(document.find("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<rvsdg>\n") == 0);
+  assert(document.size() >= 9 && document.substr(document.size() - 9) == "</rvsdg>\n");
+  assert(CountOccurrences(document, "<node ") == numNodes + 1);
+  assert(CountOccurrences(document, "<region ") == 3);
+  assert(CountOccurrences(document, "<edge ") == numNodes + 2);
+}
+
+class FailingSink final : public jive::xml_sink {
+public:
+  void
+  write(const char *, size_t) override
+  {
+    throw std::runtime_error("Failed to write.");
+  }
+};
+
+static void
+TestXmlSinkFailure()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+
+  jive::graph graph;
+  auto import = graph.add_import({vt, "import"});
+  graph.add_export(import, {vt, "export"});
+
+  /*
+   * Act & Assert
+   */
+  FailingSink sink;
+  bool hasThrown = false;
+  try {
+    jive::view_xml(graph.root(), sink);
+  } catch (const std::runtime_error &) {
+    hasThrown = true;
+  }
+
+  assert(hasThrown);
+}
+
+static int
+TestView()
+{
+  TestXmlStreaming();
+  TestXmlSinkFailure();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/TestView", TestView)
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/types/bitstring/type.hpp>
+
+#include <cassert>
+
+static void
+TestPorts()
+{
+  using namespace jive;
+
+  /*
+   * Arrange
+   */
+  jlm::valuetype vt;
+
+  jive::graph graph;
+  auto import = graph.add_import({vt, "import"});
+
+  auto structuralNode = jlm::structural_node::create(graph.root(), 1);
+  auto structuralInput = structural_input::create(structuralNode, import, vt);
+  auto regionArgument = argument::create(structuralNode->subregion(0), structuralInput, vt);
+
+  auto simpleNode = jlm::test_op::create(structuralNode->subregion(0), {regionArgument}, {&vt});
+  auto regionResult = result::create(structuralNode->subregion(0), simpleNode->output(0), nullptr, vt);
+  auto structuralOutput = structural_output::create(structuralNode, vt);
+
+  /*
+   * Act & Assert
+   */
+  assert(isa<argument>(*import));
+  assert(isa<argument>(*regionArgument));
+  assert(!isa<node_output>(*regionArgument));
+  assert(isa<node_output>(*simpleNode->output(0)));
+  assert(isa<simple_output>(*simpleNode->output(0)));
+  assert(!isa<structural_output>(*simpleNode->output(0)));
+  assert(isa<structural_output>(*structuralOutput));
+  assert(!isa<simple_output>(*structuralOutput));
+
+  assert(isa<node_input>(*simpleNode->input(0)));
+  assert(isa<simple_input>(*simpleNode->input(0)));
+  assert(isa<structural_input>(*structuralInput));
+  assert(!isa<simple_input>(*structuralInput));
+  assert(isa<result>(*regionResult));
+  assert(!isa<node_input>(*regionResult));
+
+  const jive::output * constOutput = structuralOutput;
+  assert(dyn_cast<structural_output>(constOutput) == structuralOutput);
+  assert(dyn_cast<simple_output>(constOutput) == nullptr);
+  assert(dyn_cast<argument>(static_cast<jive::output*>(nullptr)) == nullptr);
+  assert(dyn_cast<simple_output>(simpleNode->output(0)) == simpleNode->output(0));
+}
+
+static void
+TestNodesAndOperations()
+{
+  using namespace jive;
+
+  /*
+   * Arrange
+   */
+  jlm::valuetype vt;
+
+  jive::graph graph;
+  auto import = graph.add_import({vt, "import"});
+
+  auto structuralNode = jlm::structural_node::create(graph.root(), 1);
+  auto simpleNode = jlm::test_op::create(graph.root(), {import}, {&vt});
+
+  /*
+   * Act & Assert
+   */
+  assert(isa<simple_node>(*simpleNode));
+  assert(!isa<structural_node>(*simpleNode));
+  assert(isa<structural_node>(*structuralNode));
+  assert(isa<jlm::structural_node>(*structuralNode));
+  assert(!isa<simple_node>(*structuralNode));
+
+  assert(isa<simple_op>(simpleNode->operation()));
+  assert(isa<jlm::test_op>(simpleNode->operation()));
+  assert(!isa<jlm::structural_op>(simpleNode->operation()));
+  assert(isa<structural_op>(structuralNode->operation()));
+  assert(is<jlm::structural_op>(structuralNode));
+  assert(!is<jlm::test_op>(structuralNode));
+}
+
+static void
+TestTypes()
+{
+  using namespace jive;
+
+  /*
+   * Arrange
+   */
+  bittype bt32(32);
+  ctltype ct2(2);
+
+  /*
+   * Act & Assert
+   */
+  assert(isa<valuetype>(bt32));
+  assert(!isa<statetype>(bt32));
+  assert(isa<bittype>(bt32));
+  assert(!isa<ctltype>(bt32));
+  assert(isa<statetype>(ct2));
+  assert(dyn_cast<ctltype>(&ct2) == &ct2);
+  assert(dyn_cast<bittype>(static_cast<const jive::type*>(&ct2)) == nullptr);
+}
+
+static int
+TestCasting()
+{
+  TestPorts();
+  TestNodesAndOperations();
+  TestTypes();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/TestCasting", TestCasting)
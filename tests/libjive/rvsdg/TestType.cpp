@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/types/bitstring/type.hpp>
+
+#include <cassert>
+
+static void
+TestCanonicalType()
+{
+  using namespace jive;
+
+  /*
+   * Arrange
+   */
+  bittype bt32a(32);
+  bittype bt32b(32);
+  bittype bt8(8);
+  ctltype ct2(2);
+
+  /*
+   * Act
+   */
+  auto & canonicalBt32a = canonical_type(bt32a);
+  auto & canonicalBt32b = canonical_type(bt32b);
+  auto & canonicalBt8 = canonical_type(bt8);
+  auto & canonicalCt2 = canonical_type(ct2);
+
+  /*
+   * Assert
+   */
+  assert(&canonicalBt32a == &canonicalBt32b);
+  assert(&canonicalBt32a != &bt32a);
+  assert(canonicalBt32a == bt32a);
+  assert(&canonical_type(canonicalBt32a) == &canonicalBt32a);
+
+  assert(&canonicalBt8 != &canonicalBt32a);
+  assert(&canonicalCt2 != &canonical_type(ctltype(3)));
+
+  assert(bt32a.hash() == bt32b.hash());
+  assert(bt32a.hash() != bt8.hash());
+}
+
+static void
+TestPortTypes()
+{
+  using namespace jive;
+
+  /*
+   * Arrange
+   */
+  jlm::valuetype vt;
+
+  jive::graph graph;
+  auto import = graph.add_import({vt, "import"});
+
+  /*
+   * Act
+   */
+  auto node = jlm::test_op::create(graph.root(), {import}, {&vt});
+
+  /*
+   * Assert
+   */
+  assert(&node->input(0)->type() == &import->type());
+  assert(&node->output(0)->type() == &import->type());
+  assert(&node->input(0)->type() == &canonical_type(vt));
+}
+
+static int
+TestType()
+{
+  TestCanonicalType();
+  TestPortTypes();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/TestType", TestType)
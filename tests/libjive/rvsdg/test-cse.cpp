@@ -9,8 +9,54 @@
 
 #include <jive/rvsdg/graph.hpp>
 #include <jive/rvsdg/simple-normal-form.hpp>
+#include <jive/types/bitstring/constant.hpp>
 #include <jive/view.hpp>
 
+static void
+test_diverted_operands()
+{
+	jlm::valuetype t;
+
+	jive::graph graph;
+	auto i0 = graph.add_import({t, "i0"});
+	auto i1 = graph.add_import({t, "i1"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {i0}, {&t});
+	auto n2 = jlm::test_op::create(graph.root(), {i1}, {&t});
+
+	auto e1 = graph.add_export(n1->output(0), {t, "e1"});
+	auto e2 = graph.add_export(n2->output(0), {t, "e2"});
+
+	/*
+		n2 only becomes equivalent to n1 after its operand was diverted.
+	*/
+	n2->input(0)->divert_to(i0);
+	graph.normalize();
+	assert(e1->origin() == e2->origin());
+
+	auto o1 = jlm::create_testop(graph.root(), {i0}, {&t})[0];
+	assert(o1 == e1->origin());
+
+	auto o2 = jlm::create_testop(graph.root(), {i1}, {&t})[0];
+	assert(o2 != e1->origin());
+}
+
+static void
+test_constants()
+{
+	jive::graph graph;
+
+	auto c1 = jive::create_bitconstant(graph.root(), 32, 5);
+	auto c2 = jive::create_bitconstant(graph.root(), 32, 5);
+	auto c3 = jive::create_bitconstant(graph.root(), 32, 6);
+	auto c4 = jive::create_bitconstant(graph.root(), 16, 5);
+
+	assert(c1 == c2);
+	assert(c1 != c3);
+	assert(c1 != c4);
+	assert(graph.root()->nnodes() == 3);
+}
+
 static int
 test_main()
 {
@@ -56,6 +102,9 @@ test_main()
 	graph.normalize();
 	assert(o7 != e1->origin());
 
+	test_diverted_operands();
+	test_constants();
+
 	return 0;
 }
 
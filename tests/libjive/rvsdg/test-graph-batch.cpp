@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <assert.h>
+
+#include <jive/rvsdg.hpp>
+
+static int
+test_graph_batch()
+{
+	jlm::valuetype type;
+
+	jive::graph graph;
+	auto imp = graph.add_import({type, "i"});
+
+	std::vector<jive::node*> chain1, chain2;
+	jive::output * o1 = imp, * o2 = imp;
+	for (size_t n = 0; n < 10; n++) {
+		chain1.push_back(jlm::test_op::create(graph.root(), {o1}, {&type}));
+		chain2.push_back(jlm::test_op::create(graph.root(), {o2}, {&type}));
+		o1 = chain1.back()->output(0);
+		o2 = chain2.back()->output(0);
+	}
+
+	size_t ndepth_changes = 0;
+	auto c = graph.notifiers().on_node_depth_change.connect(
+		[&](jive::node*, size_t){ ndepth_changes++; });
+
+	graph.BeginBatch();
+	{
+		jive::mutation_batch batch(graph);
+		chain2[0]->input(0)->divert_to(chain1[9]->output(0));
+	}
+	assert(graph.InBatch());
+
+	/* nodes that are destroyed within the batch are dropped from it */
+	auto tmp = jlm::test_op::create(graph.root(), {chain2[9]->output(0)}, {&type});
+	remove(tmp);
+
+	assert(ndepth_changes == 0);
+	assert(chain2[9]->depth() == 9);
+	graph.EndBatch();
+
+	assert(!graph.InBatch());
+	assert(ndepth_changes == 10);
+	for (size_t n = 0; n < 10; n++)
+		assert(chain2[n]->depth() == 10+n);
+
+	/* region copies within a batch observe up to date depths */
+	jive::mutation_batch batch(graph);
+	chain2[0]->input(0)->divert_to(imp);
+	jive::substitution_map smap;
+	graph.root()->copy(graph.root(), smap, false, false);
+	assert(chain2[9]->depth() == 9);
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-graph-batch", test_graph_batch)
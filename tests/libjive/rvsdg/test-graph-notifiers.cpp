@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-operation.hpp"
+#include "test-types.hpp"
+
+#include <assert.h>
+
+#include <jive/rvsdg.hpp>
+
+static void
+test_region_notifiers()
+{
+	jlm::valuetype type;
+
+	jive::graph graph;
+	auto x = graph.add_import({type, "x"});
+	auto structural = jlm::structural_node::create(graph.root(), 1);
+	auto subregion = structural->subregion(0);
+
+	std::vector<jive::node*> created, destroyed;
+	size_t ninput_changes = 0, ndepth_changes = 0;
+	auto c1 = subregion->notifiers().on_node_create.connect(
+		[&](jive::node * node){ created.push_back(node); });
+	auto c2 = subregion->notifiers().on_node_destroy.connect(
+		[&](jive::node * node){ destroyed.push_back(node); });
+	auto c3 = subregion->notifiers().on_input_change.connect(
+		[&](jive::input*, jive::output*, jive::output*){ ninput_changes++; });
+	auto c4 = subregion->notifiers().on_node_depth_change.connect(
+		[&](jive::node*, size_t){ ndepth_changes++; });
+
+	/* mutations of other regions are not reported */
+	auto n1 = jlm::test_op::create(graph.root(), {x}, {&type});
+	auto n2 = jlm::test_op::create(graph.root(), {n1->output(0)}, {&type});
+	n2->input(0)->divert_to(x);
+	jive::remove(n2);
+	jive::remove(n1);
+	assert(created.empty() && destroyed.empty());
+	assert(ninput_changes == 0 && ndepth_changes == 0);
+
+	auto n3 = jlm::test_op::create(subregion, {}, {&type});
+	auto n4 = jlm::test_op::create(subregion, {}, {&type});
+	auto n5 = jlm::test_op::create(subregion, {n4->output(0)}, {&type});
+	auto n6 = jlm::test_op::create(subregion, {n5->output(0)}, {&type});
+	assert(created.size() == 4 && created[0] == n3 && created[3] == n6);
+	/* the operands of n5 and n6 deepen them while they are created */
+	assert(ninput_changes == 0 && ndepth_changes == 2);
+
+	n6->input(0)->divert_to(n3->output(0));
+	assert(ninput_changes == 1 && ndepth_changes == 3);
+	assert(n6->depth() == 1);
+
+	jive::remove(n5);
+	assert(destroyed.size() == 1 && destroyed[0] == n5);
+}
+
+static int
+test_graph_notifiers()
+{
+	jlm::valuetype type;
+
+	jive::graph graph1;
+	jive::graph graph2;
+
+	size_t ncreated1 = 0, ncreated2 = 0;
+	auto c1 = graph1.notifiers().on_node_create.connect([&](jive::node*){ ncreated1++; });
+	auto c2 = graph2.notifiers().on_node_create.connect([&](jive::node*){ ncreated2++; });
+
+	std::vector<jive::node*> destroyed;
+	auto c3 = graph1.notifiers().on_node_destroy.connect(
+		[&](jive::node * node){ destroyed.push_back(node); });
+
+	auto n1 = jlm::test_op::create(graph1.root(), {}, {&type});
+	jlm::test_op::create(graph2.root(), {}, {&type});
+	jlm::test_op::create(graph2.root(), {}, {&type});
+	assert(ncreated1 == 1);
+	assert(ncreated2 == 2);
+
+	graph2.prune();
+	assert(destroyed.empty());
+
+	graph1.prune();
+	assert(destroyed.size() == 1 && destroyed[0] == n1);
+
+	test_region_notifiers();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-graph-notifiers", test_graph_notifiers)
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/id-map.hpp>
+
+#include <assert.h>
+
+static void
+test_ids()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	auto n2 = jlm::test_op::create(graph.root(), {n1->output(0)}, {&vt});
+
+	assert(n1->id() != n2->id());
+	assert(n1->output(0)->id() != n2->output(0)->id());
+	assert(n1->output(0)->id() != x->id());
+	assert(n1->input(0)->id() != n2->input(0)->id());
+	assert(graph.node_id_bound() == 2);
+
+	/* identifiers of removed nodes are recycled */
+	auto id = n2->id();
+	remove(n2);
+	auto n3 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	assert(n3->id() == id);
+	assert(graph.node_id_bound() == 2);
+}
+
+static void
+test_maps()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	auto n2 = jlm::test_op::create(graph.root(), {x}, {&vt});
+
+	jive::node_map<size_t> nodeMap;
+	assert(nodeMap.size() == 0);
+	assert(!nodeMap.contains(*n1));
+	assert(nodeMap.lookup(*n1) == nullptr);
+
+	nodeMap.insert(*n2, 2);
+	assert(nodeMap.size() == 1);
+	assert(!nodeMap.contains(*n1));
+	assert(*nodeMap.lookup(*n2) == 2);
+
+	nodeMap[*n1] += 1;
+	assert(nodeMap.size() == 2);
+	assert(nodeMap[*n1] == 1);
+
+	assert(nodeMap.remove(*n2));
+	assert(!nodeMap.remove(*n2));
+	assert(nodeMap.size() == 1);
+	assert(!nodeMap.contains(*n2));
+
+	jive::output_set outputSet;
+	assert(outputSet.insert(*x));
+	assert(!outputSet.insert(*x));
+	assert(outputSet.contains(*x));
+	assert(!outputSet.contains(*n1->output(0)));
+	assert(outputSet.size() == 1);
+
+	assert(outputSet.remove(*x));
+	assert(outputSet.size() == 0);
+
+	outputSet.insert(*n2->output(0));
+	outputSet.clear();
+	assert(!outputSet.contains(*n2->output(0)));
+}
+
+static int
+test()
+{
+	test_ids();
+	test_maps();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/test-id-map", test)
@@ -114,11 +114,44 @@ test_node_depth()
 	assert(un->depth() == 1);
 }
 
+static void
+test_node_users()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+	auto y = graph.add_import({vt, "y"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	auto n2 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	auto n3 = jlm::test_op::create(graph.root(), {x, x}, {&vt});
+
+	/* users are visited in insertion order */
+	std::vector<jive::input*> users(x->begin(), x->end());
+	assert((users == std::vector<jive::input*>{n1->input(0), n2->input(0), n3->input(0), n3->input(1)}));
+
+	/* removal moves the last user into the freed slot */
+	n1->input(0)->divert_to(y);
+	users = std::vector<jive::input*>(x->begin(), x->end());
+	assert((users == std::vector<jive::input*>{n3->input(1), n2->input(0), n3->input(0)}));
+	assert(y->nusers() == 1 && *y->begin() == n1->input(0));
+
+	remove(n3);
+	assert(x->nusers() == 1 && *x->begin() == n2->input(0));
+
+	x->divert_users(y);
+	assert(x->nusers() == 0);
+	assert(y->nusers() == 2);
+	assert(n2->input(0)->origin() == y);
+}
+
 static int
 test_nodes()
 {
 	test_node_copy();
 	test_node_depth();
+	test_node_users();
 
 	return 0;
 }
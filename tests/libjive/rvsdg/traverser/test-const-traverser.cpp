@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jive/rvsdg/graph.hpp>
+#include <jive/rvsdg/traverser.hpp>
+
+#include <assert.h>
+
+static void
+test_order()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+
+	auto n3 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	auto n2 = jlm::test_op::create(graph.root(), {n3->output(0)}, {&vt});
+	auto n1 = jlm::test_op::create(graph.root(), {n2->output(0), x}, {&vt});
+	auto n4 = jlm::test_op::create(graph.root(), {}, {&vt});
+
+	graph.add_export(n1->output(0), {vt, "n1"});
+	graph.add_export(n4->output(0), {vt, "n4"});
+
+	std::vector<const jive::node*> nodes;
+	for (auto & node : jive::topdown_const_traverser(graph.root()))
+		nodes.push_back(node);
+
+	assert(nodes.size() == 4);
+	assert(nodes[0] == n3 || nodes[0] == n4);
+	assert(nodes[1] == n3 || nodes[1] == n4);
+	assert(nodes[2] == n2);
+	assert(nodes[3] == n1);
+
+	nodes.clear();
+	for (auto & node : jive::bottomup_const_traverser(graph.root()))
+		nodes.push_back(node);
+
+	assert(nodes.size() == 4);
+	assert(nodes[0] == n1);
+	assert(nodes[1] == n2);
+	assert(nodes[2] == n3 || nodes[2] == n4);
+	assert(nodes[3] == n3 || nodes[3] == n4);
+}
+
+static void
+test_nesting()
+{
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+
+	auto n1 = jlm::test_op::create(graph.root(), {x}, {&vt});
+	jlm::test_op::create(graph.root(), {n1->output(0)}, {&vt});
+
+	/* nested traversals use distinct scratch buffers */
+	size_t nvisited = 0;
+	for (auto & outer : jive::topdown_const_traverser(graph.root())) {
+		size_t ninner = 0;
+		for (auto & inner : jive::bottomup_const_traverser(graph.root())) {
+			assert(inner->region() == outer->region());
+			ninner++;
+		}
+		assert(ninner == 2);
+		nvisited++;
+	}
+	assert(nvisited == 2);
+}
+
+static void
+test_large_graph()
+{
+	static const size_t nnodes = 20000;
+
+	jlm::valuetype vt;
+
+	jive::graph graph;
+	auto x = graph.add_import({vt, "x"});
+
+	std::vector<jive::output*> outputs({x});
+	for (size_t n = 0; n < nnodes; n++) {
+		auto operand = outputs[(n * 7) % outputs.size()];
+		outputs.push_back(jlm::test_op::create(graph.root(), {operand, outputs.back()}, {&vt})->output(0));
+	}
+	graph.add_export(outputs.back(), {vt, "y"});
+
+	size_t ntracking = 0;
+	for (auto node : jive::topdown_traverser(graph.root())) {
+		if (node) ntracking++;
+	}
+
+	size_t nconst = 0;
+	for (auto node : jive::topdown_const_traverser(graph.root())) {
+		if (node) nconst++;
+	}
+
+	assert(ntracking == nnodes);
+	assert(nconst == nnodes);
+}
+
+static int
+test()
+{
+	test_order();
+	test_nesting();
+	test_large_graph();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/rvsdg/traverser/test-const-traverser", test)
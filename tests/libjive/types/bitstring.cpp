@@ -1405,6 +1405,39 @@ types_bitstring_test_value_representation()
 		}
 	}
 
+	bitvalue_repr max64(64, -1);
+	assert(max64.umulh(max64) == -2);
+	assert(max64.smulh(max64) == 0);
+	assert(bitvalue_repr(64, INT64_MIN).smulh(bitvalue_repr(64, INT64_MIN)) == int64_t(1) << 62);
+
+	/* 2^64 */
+	auto two64 = bitvalue_repr(64, 0).concat(bitvalue_repr(64, 1));
+	assert(two64.sub(bitvalue_repr(128, 1)) == max64.zext(64));
+	assert(bitvalue_repr(128, -1).add(bitvalue_repr(128, 1)) == 0);
+	assert(two64.neg() == bitvalue_repr(64, 0).concat(bitvalue_repr(64, -1)));
+	assert(two64.ult(bitvalue_repr(128, -1)) == '1');
+	assert(two64.slt(bitvalue_repr(128, -1)) == '0');
+
+	/* (2^64-1)^2 = 2^128 - 2^65 + 1 */
+	auto max64_128 = max64.zext(64);
+	auto square = max64_128.mul(max64_128);
+	assert(square == bitvalue_repr(64, 1).concat(bitvalue_repr(64, -2)));
+	assert(square.udiv(max64_128) == max64_128);
+	assert(square.umod(max64_128) == 0);
+	assert(square.add(bitvalue_repr(128, 5)).umod(max64_128) == 5);
+	assert(max64_128.umulh(max64_128) == 0);
+	assert(bitvalue_repr(128, -1).smulh(bitvalue_repr(128, -1)) == 0);
+	assert(bitvalue_repr(128, -3).sdiv(bitvalue_repr(128, 2)) == -1);
+	assert(bitvalue_repr(128, -3).smod(bitvalue_repr(128, 2)) == -1);
+
+	/* unknown bits beyond the first limb */
+	auto unknown = bitvalue_repr::repeat(70, 'D');
+	assert(!unknown.is_known() && unknown.is_defined());
+	assert(unknown.land(bitvalue_repr(70, 0)) == 0);
+	assert(unknown.lor(bitvalue_repr(70, -1)) == -1);
+	assert(unknown.add(bitvalue_repr(70, 0)) == unknown);
+	assert(unknown[69] == 'D');
+
 	return 0;
 }
 
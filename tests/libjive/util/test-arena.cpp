@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <assert.h>
+#include <jive/rvsdg/graph.hpp>
+#include <jive/util/arena.hpp>
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+static void
+test_arena()
+{
+	jive::detail::arena arena;
+
+	auto p1 = arena.allocate(24);
+	auto p2 = arena.allocate(24);
+	assert(p1 != p2);
+	assert(reinterpret_cast<uintptr_t>(p1) % jive::detail::arena::granularity == 0);
+	assert(reinterpret_cast<uintptr_t>(p2) % jive::detail::arena::granularity == 0);
+	assert(arena.stats().nchunks == 1);
+
+	/* freed blocks are reused by allocations of the same size class */
+	arena.deallocate(p1, 24);
+	auto p3 = arena.allocate(32);
+	assert(p3 == p1);
+	assert(arena.stats().nreused == 1);
+
+	/* large blocks are forwarded to the global allocator */
+	auto p4 = arena.allocate(4096);
+	assert(arena.stats().nlarge_allocations == 1);
+	arena.deallocate(p4, 4096);
+
+	arena.deallocate(p2, 24);
+	arena.deallocate(p3, 32);
+	assert(arena.stats().nallocations == 4);
+	assert(arena.stats().ndeallocations == 4);
+}
+
+static void
+test_synchronized_arena()
+{
+	jive::detail::arena arena;
+	arena.set_synchronized(true);
+
+	std::vector<std::vector<void*>> blocks(4);
+	std::vector<std::thread> threads;
+	for (auto & b : blocks) {
+		threads.emplace_back([&]()
+		{
+			for (size_t n = 0; n < 1000; n++)
+				b.push_back(arena.allocate(24));
+
+			/* blocks are reused by the thread that freed them */
+			arena.deallocate(b.back(), 24);
+			b.back() = arena.allocate(24);
+			arena.deallocate(arena.allocate(4096), 4096);
+		});
+	}
+	for (auto & thread : threads)
+		thread.join();
+
+	std::unordered_set<void*> distinct;
+	for (auto & b : blocks)
+		distinct.insert(b.begin(), b.end());
+	assert(distinct.size() == 4000);
+
+	auto stats = arena.stats();
+	assert(stats.nallocations == 4008);
+	assert(stats.ndeallocations == 8);
+	assert(stats.nreused == 4);
+	assert(stats.nlarge_allocations == 4);
+
+	/* blocks freed while synchronized are reused afterwards */
+	for (auto & b : blocks) {
+		for (auto p : b)
+			arena.deallocate(p, 24);
+	}
+	arena.set_synchronized(false);
+
+	auto p = arena.allocate(24);
+	assert(distinct.find(p) != distinct.end());
+	assert(arena.stats().nchunks == stats.nchunks);
+	arena.deallocate(p, 24);
+}
+
+static void
+test_graph()
+{
+	jlm::valuetype t;
+
+	jive::graph graph;
+	auto x = graph.add_import({t, "x"});
+
+	auto nallocations = graph.arena().stats().nallocations;
+	auto heap_stats = jive::detail::arena_allocated::heap_stats();
+
+	/* a node with one input and one output */
+	auto node = jlm::test_op::create(graph.root(), {x}, {&t});
+	assert(graph.arena().stats().nallocations == nallocations + 3);
+	assert(jive::detail::arena_allocated::heap_stats().nheap_allocations
+		== heap_stats.nheap_allocations);
+
+	jive::remove(node);
+	assert(graph.arena().stats().ndeallocations == 3);
+}
+
+static int
+test_main()
+{
+	test_arena();
+	test_synchronized_arena();
+	test_graph();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/util/test-arena", test_main)
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <assert.h>
+#include <jive/util/id-allocator.hpp>
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+static void
+test_allocator()
+{
+	jive::detail::id_allocator ids;
+
+	auto id0 = ids.allocate();
+	auto id1 = ids.allocate();
+	assert(id0 == 0 && id1 == 1);
+	assert(ids.bound() == 2);
+
+	/* released identifiers are recycled */
+	ids.release(id0);
+	assert(ids.nallocated() == 1);
+	assert(ids.allocate() == id0);
+	assert(ids.bound() == 2);
+}
+
+static void
+test_synchronized_allocator()
+{
+	jive::detail::id_allocator ids;
+	ids.set_synchronized(true);
+
+	std::vector<std::vector<size_t>> allocated(4);
+	std::vector<std::thread> threads;
+	for (auto & a : allocated) {
+		threads.emplace_back([&]()
+		{
+			for (size_t n = 0; n < 1000; n++)
+				a.push_back(ids.allocate());
+
+			for (size_t n = 0; n < 500; n++) {
+				ids.release(a.back());
+				a.pop_back();
+			}
+
+			for (size_t n = 0; n < 500; n++)
+				a.push_back(ids.allocate());
+		});
+	}
+	for (auto & thread : threads)
+		thread.join();
+
+	std::unordered_set<size_t> distinct;
+	for (auto & a : allocated)
+		distinct.insert(a.begin(), a.end());
+	assert(distinct.size() == 4000);
+	assert(ids.bound() >= 4000);
+
+	/* the identifiers held by the threads are handed back */
+	ids.set_synchronized(false);
+	assert(ids.nallocated() == 4000);
+
+	for (auto & a : allocated) {
+		for (auto id : a)
+			ids.release(id);
+	}
+	assert(ids.nallocated() == 0);
+}
+
+static int
+test_main()
+{
+	test_allocator();
+	test_synchronized_allocator();
+
+	return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjive/util/test-id-allocator", test_main)
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jive/types/bitstring/type.hpp>
+#include <jive/types/record.hpp>
+
+#include <jlm/common.hpp>
+#include <jlm/ir/DataLayout.hpp>
+#include <jlm/ir/types.hpp>
+
+#include <cassert>
+
+static const char * X86_64DataLayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128";
+
+static void
+TestTypeAllocSize()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  DataLayout dataLayout(X86_64DataLayout);
+
+  jive::bittype bit1(1);
+  jive::bittype bit24(24);
+  jive::bittype bit128(128);
+  PointerType pointerType(jive::bit32);
+  fptype doubleType(fpsize::dbl);
+  fptype x86fp80Type(fpsize::x86fp80);
+  arraytype arrayType(jive::bit16, 5);
+  fixedvectortype vectorType(jive::bit32, 3);
+
+  /*
+   * Act & Assert
+   */
+  assert(dataLayout.GetTypeAllocSize(bit1) == 1);
+  assert(dataLayout.GetTypeAllocSize(bit24) == 4);
+  assert(dataLayout.GetTypeAllocSize(jive::bit64) == 8);
+  assert(dataLayout.GetTypeAllocSize(bit128) == 16);
+  assert(dataLayout.GetTypeAlignment(bit128) == 8);
+  assert(dataLayout.GetTypeAllocSize(pointerType) == 8);
+  assert(dataLayout.GetTypeAllocSize(doubleType) == 8);
+  assert(dataLayout.GetTypeStoreSize(x86fp80Type) == 10);
+  assert(dataLayout.GetTypeAllocSize(x86fp80Type) == 16);
+  assert(dataLayout.GetTypeAllocSize(arrayType) == 10);
+  assert(dataLayout.GetTypeAlignment(arrayType) == 2);
+  assert(dataLayout.GetTypeStoreSize(vectorType) == 12);
+  assert(dataLayout.GetTypeAllocSize(vectorType) == 16);
+}
+
+static void
+TestStructLayout()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  DataLayout dataLayout(X86_64DataLayout);
+
+  PointerType pointerType(jive::bit32);
+  auto declaration = jive::rcddeclaration::create({&jive::bit8, &pointerType, &jive::bit16});
+  auto structType = StructType::Create(false, *declaration);
+  auto packedStructType = StructType::Create(true, *declaration);
+
+  jive::bittype bit128(128);
+  auto wideDeclaration = jive::rcddeclaration::create({&jive::bit64, &bit128, &pointerType});
+  auto wideStructType = StructType::Create(false, *wideDeclaration);
+
+  /*
+   * Act & Assert
+   */
+  assert(dataLayout.GetElementOffset(*structType, 0) == 0);
+  assert(dataLayout.GetElementOffset(*structType, 1) == 8);
+  assert(dataLayout.GetElementOffset(*structType, 2) == 16);
+  assert(dataLayout.GetTypeAllocSize(*structType) == 24);
+  assert(dataLayout.GetTypeAlignment(*structType) == 8);
+
+  assert(dataLayout.GetElementOffset(*packedStructType, 1) == 1);
+  assert(dataLayout.GetElementOffset(*packedStructType, 2) == 9);
+  assert(dataLayout.GetTypeAllocSize(*packedStructType) == 11);
+  assert(dataLayout.GetTypeAlignment(*packedStructType) == 1);
+
+  /*
+   * The i128 is only eight byte aligned on x86-64.
+   */
+  assert(dataLayout.GetElementOffset(*wideStructType, 1) == 8);
+  assert(dataLayout.GetElementOffset(*wideStructType, 2) == 24);
+  assert(dataLayout.GetTypeAllocSize(*wideStructType) == 32);
+}
+
+static void
+TestDefaultLayout()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  DataLayout defaultLayout("");
+  DataLayout pointer32Layout("e-p:32:32-i64:64");
+
+  PointerType pointerType(jive::bit32);
+  auto declaration = jive::rcddeclaration::create({&jive::bit32, &jive::bit64});
+  auto structType = StructType::Create(false, *declaration);
+  auto pointerDeclaration = jive::rcddeclaration::create({&jive::bit32, &pointerType, &jive::bit64});
+  auto pointerStructType = StructType::Create(false, *pointerDeclaration);
+
+  /*
+   * Act & Assert
+   */
+  assert(defaultLayout.GetTypeAlignment(jive::bit64) == 4);
+  assert(defaultLayout.GetElementOffset(*structType, 1) == 4);
+  assert(defaultLayout.GetTypeAllocSize(*structType) == 12);
+  assert(defaultLayout.GetPointerSize() == 8);
+
+  assert(pointer32Layout.GetPointerSize() == 4);
+  assert(pointer32Layout.GetElementOffset(*pointerStructType, 1) == 4);
+  assert(pointer32Layout.GetElementOffset(*pointerStructType, 2) == 8);
+  assert(pointer32Layout.GetTypeAllocSize(*pointerStructType) == 16);
+}
+
+static void
+TestMalformedLayout()
+{
+  using namespace jlm;
+
+  auto IsMalformed = [](const std::string & specification)
+  {
+    try {
+      DataLayout dataLayout(specification);
+    } catch (const error &) {
+      return true;
+    }
+
+    return false;
+  };
+
+  assert(IsMalformed("e-i64"));
+  assert(IsMalformed("e-i64:abc"));
+  assert(IsMalformed("e-i64:12"));
+  assert(IsMalformed("e-p:64"));
+  assert(!IsMalformed("e-m:o-i64:64-i128:128-n32:64-S128"));
+}
+
+static int
+TestDataLayout()
+{
+  TestTypeAllocSize();
+  TestStructLayout();
+  TestDefaultLayout();
+  TestMalformedLayout();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/ir/TestDataLayout", TestDataLayout)
\ No newline at end of file
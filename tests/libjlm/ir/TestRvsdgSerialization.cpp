@@ -0,0 +1,273 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jive/types/bitstring.hpp>
+#include <jive/view.hpp>
+
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/ir/RvsdgSerialization.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <unistd.h>
+
+static std::unique_ptr<jlm::RvsdgModule>
+AssertRoundTrip(const jlm::RvsdgModule & rvsdgModule)
+{
+  auto bytes = jlm::SerializeRvsdgModule(rvsdgModule);
+  auto deserializedModule = jlm::DeserializeRvsdgModule(bytes.data(), bytes.size());
+
+  assert(deserializedModule->SourceFileName() == rvsdgModule.SourceFileName());
+  assert(deserializedModule->TargetTriple() == rvsdgModule.TargetTriple());
+  assert(deserializedModule->DataLayout() == rvsdgModule.DataLayout());
+
+  auto & root = *rvsdgModule.Rvsdg().root();
+  auto & deserializedRoot = *deserializedModule->Rvsdg().root();
+  assert(deserializedRoot.narguments() == root.narguments());
+  assert(deserializedRoot.nresults() == root.nresults());
+  assert(deserializedRoot.nnodes() == root.nnodes());
+  assert(jive::view(&deserializedRoot) == jive::view(&root));
+
+  /*
+   * The nodes of the deserialized module are created in the order they are stored, which makes the serialization of
+   * the deserialized module identical to the original serialization.
+   */
+  assert(jlm::SerializeRvsdgModule(*deserializedModule) == bytes);
+
+  return deserializedModule;
+}
+
+/*
+ * attributeset::operator== does not compare the attributes, so we compare them pairwise. The deserialized set
+ * preserves the order of the original set.
+ */
+static bool
+AttributesAreEqual(
+  const jlm::attributeset & attributes1,
+  const jlm::attributeset & attributes2)
+{
+  auto it1 = attributes1.begin();
+  auto it2 = attributes2.begin();
+  for (; it1 != attributes1.end() && it2 != attributes2.end(); it1++, it2++)
+  {
+    if (!(*it1 == *it2))
+      return false;
+  }
+
+  return it1 == attributes1.end() && it2 == attributes2.end();
+}
+
+template<class Test> static void
+TestRoundTrip()
+{
+  Test test;
+  AssertRoundTrip(test.module());
+}
+
+static void
+TestLambdaAttributes()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath("test.c"), "x86_64-unknown-linux-gnu", "e-m:e");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  jive::bittype bt32(32);
+  PointerType pt(bt32);
+  MemoryStateType mt;
+  FunctionType functionType({&pt, &mt}, {&mt});
+
+  attributeset attributes;
+  attributes.insert(enum_attribute::create(attribute::kind::no_unwind));
+  attributes.insert(string_attribute::create("frame-pointer", "all"));
+
+  auto lambda = lambda::node::create(rvsdg.root(), functionType, "f", linkage::internal_linkage, attributes);
+
+  attributeset argumentAttributes;
+  argumentAttributes.insert(int_attribute::create(attribute::kind::alignment, 8));
+  argumentAttributes.insert(type_attribute::create_byval(std::make_unique<jive::bittype>(32)));
+  lambda->fctargument(0)->set_attributes(argumentAttributes);
+
+  auto lambdaOutput = lambda->finalize({lambda->fctargument(1)});
+  rvsdg.add_export(lambdaOutput, {lambdaOutput->type(), "f"});
+
+  /*
+   * Act
+   */
+  auto deserializedModule = AssertRoundTrip(*rvsdgModule);
+
+  /*
+   * Assert
+   */
+  auto & root = *deserializedModule->Rvsdg().root();
+  auto deserializedLambda = AssertedCast<const lambda::node>(root.nodes.first());
+  assert(deserializedLambda->name() == "f");
+  assert(deserializedLambda->linkage() == linkage::internal_linkage);
+  assert(AttributesAreEqual(deserializedLambda->attributes(), attributes));
+  assert(AttributesAreEqual(deserializedLambda->fctargument(0)->attributes(), argumentAttributes));
+}
+
+static void
+TestFileRoundTrip()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  PhiTest1 test;
+
+  char fileName[] = "/tmp/TestRvsdgSerializationXXXXXX";
+  auto fd = mkstemp(fileName);
+  assert(fd >= 0);
+  close(fd);
+
+  /*
+   * Act
+   */
+  WriteRvsdgModule(test.module(), filepath(fileName));
+  auto rvsdgModule = ReadRvsdgModule(filepath(fileName));
+  remove(fileName);
+
+  /*
+   * Assert
+   */
+  assert(SerializeRvsdgModule(*rvsdgModule) == SerializeRvsdgModule(test.module()));
+}
+
+static void
+TestInvalidInput()
+{
+  using namespace jlm;
+
+  auto ExpectError = [](const std::vector<uint8_t> & bytes)
+  {
+    try
+    {
+      DeserializeRvsdgModule(bytes.data(), bytes.size());
+      assert(false);
+    }
+    catch (const jlm::error &)
+    {}
+  };
+
+  StoreTest1 test;
+  auto bytes = SerializeRvsdgModule(test.module());
+
+  /*
+   * Wrong magic
+   */
+  auto wrongMagic = bytes;
+  wrongMagic[0] = 'X';
+  ExpectError(wrongMagic);
+
+  /*
+   * Truncated file
+   */
+  ExpectError(std::vector<uint8_t>(bytes.begin(), bytes.begin() + bytes.size() / 2));
+
+  /*
+   * Trailing data
+   */
+  auto trailingData = bytes;
+  trailingData.push_back(0);
+  ExpectError(trailingData);
+}
+
+static void
+TestOperandTypeMismatch()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+
+  auto x = graph.add_import({jive::bit32, "x"});
+  auto y = graph.add_import({jive::bit64, "y"});
+  graph.add_export(jive::bitadd_op::create(32, x, x), {jive::bit32, "s"});
+  graph.add_export(jive::bitadd_op::create(64, y, y), {jive::bit64, "t"});
+
+  auto bytes = SerializeRvsdgModule(*rvsdgModule);
+
+  /*
+   * An import is stored as its type index followed by its name, which is why swapping the type indices of the
+   * imports makes the operand types of both additions mismatch.
+   */
+  auto FindImportTypeIndex = [&](char name)
+  {
+    for (size_t n = 2; n < bytes.size(); n++)
+    {
+      if (bytes[n-1] == 1 && bytes[n] == name)
+        return n-2;
+    }
+
+    JLM_UNREACHABLE("Import not found.");
+  };
+  std::swap(bytes[FindImportTypeIndex('x')], bytes[FindImportTypeIndex('y')]);
+
+  /*
+   * Act & Assert
+   */
+  try
+  {
+    DeserializeRvsdgModule(bytes.data(), bytes.size());
+    assert(false);
+  }
+  catch (const jlm::error & e)
+  {
+    assert(std::string(e.what()).find("Malformed RVSDG file") == 0);
+  }
+}
+
+static int
+TestRvsdgSerialization()
+{
+  TestRoundTrip<StoreTest1>();
+  TestRoundTrip<StoreTest2>();
+  TestRoundTrip<LoadTest1>();
+  TestRoundTrip<LoadTest2>();
+  TestRoundTrip<LoadFromUndefTest>();
+  TestRoundTrip<GetElementPtrTest>();
+  TestRoundTrip<BitCastTest>();
+  TestRoundTrip<Bits2PtrTest>();
+  TestRoundTrip<ConstantPointerNullTest>();
+  TestRoundTrip<CallTest1>();
+  TestRoundTrip<CallTest2>();
+  TestRoundTrip<IndirectCallTest1>();
+  TestRoundTrip<IndirectCallTest2>();
+  TestRoundTrip<ExternalCallTest>();
+  TestRoundTrip<GammaTest>();
+  TestRoundTrip<ThetaTest>();
+  TestRoundTrip<DeltaTest1>();
+  TestRoundTrip<DeltaTest2>();
+  TestRoundTrip<DeltaTest3>();
+  TestRoundTrip<ImportTest>();
+  TestRoundTrip<PhiTest1>();
+  TestRoundTrip<PhiTest2>();
+  TestRoundTrip<ExternalMemoryTest>();
+  TestRoundTrip<EscapedMemoryTest1>();
+  TestRoundTrip<EscapedMemoryTest2>();
+  TestRoundTrip<EscapedMemoryTest3>();
+  TestRoundTrip<MemcpyTest>();
+  TestRoundTrip<LinkedListTest>();
+
+  TestLambdaAttributes();
+  TestFileRoundTrip();
+  TestInvalidInput();
+  TestOperandTypeMismatch();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/ir/TestRvsdgSerialization", TestRvsdgSerialization)
@@ -17,6 +17,7 @@
 #include <jlm/ir/RvsdgModule.hpp>
 #include <jlm/opt/DeadNodeElimination.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/strfmt.hpp>
 
 static void
 RunDeadNodeElimination(jlm::RvsdgModule & rvsdgModule)
@@ -312,6 +313,98 @@ TestPhi()
 //	jive::view(graph.root(), stdout);
 }
 
+/**
+ * Test that the mark phase does not recurse along long dependency chains.
+ */
+static void
+TestLongChain()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jlm::valuetype vt;
+
+  RvsdgModule rm(filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto x = graph.add_import({vt, "x"});
+
+  const size_t numNodes = 200000;
+  jive::output * chain = x;
+  for (size_t n = 0; n < numNodes; n++)
+    chain = jlm::test_op::create(graph.root(), {chain}, {&vt})->output(0);
+  jlm::test_op::create(graph.root(), {x}, {&vt});
+
+  graph.add_export(chain, {chain->type(), "chain"});
+
+  /*
+   * Act
+   */
+  RunDeadNodeElimination(rm);
+
+  /*
+   * Assert
+   */
+  assert(graph.root()->nnodes() == numNodes);
+}
+
+/**
+ * Test that the subregions of multiple lambda nodes are swept correctly in parallel.
+ */
+static void
+TestParallelSweep()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jlm::valuetype vt;
+
+  RvsdgModule rm(filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto x = graph.add_import({vt, "x"});
+  auto y = graph.add_import({vt, "y"});
+
+  std::vector<lambda::node*> lambdaNodes;
+  for (size_t n = 0; n < 8; n++) {
+    auto lambda = lambda::node::create(graph.root(), {{&vt}, {&vt}}, strfmt("f", n),
+      linkage::external_linkage);
+
+    auto cv1 = lambda->add_ctxvar(x);
+    auto cv2 = lambda->add_ctxvar(y);
+    auto alive = jlm::create_testop(lambda->subregion(), {lambda->fctargument(0), cv1}, {&vt});
+    for (size_t i = 0; i < 100; i++)
+      jlm::create_testop(lambda->subregion(), {lambda->fctargument(0), cv2}, {&vt});
+
+    auto output = lambda->finalize({alive[0]});
+    graph.add_export(output, {output->type(), strfmt("f", n)});
+    lambdaNodes.push_back(lambda);
+  }
+
+  auto deadLambda = lambda::node::create(graph.root(), {{&vt}, {&vt}}, "dead", linkage::external_linkage);
+  deadLambda->finalize({deadLambda->fctargument(0)});
+
+  /*
+   * Act
+   */
+  StatisticsCollector statisticsCollector;
+  DeadNodeElimination deadNodeElimination(4);
+  deadNodeElimination.run(rm, statisticsCollector);
+
+  /*
+   * Assert
+   */
+  assert(graph.root()->nnodes() == lambdaNodes.size());
+  for (auto lambda : lambdaNodes) {
+    assert(lambda->subregion()->nnodes() == 1);
+    assert(lambda->ninputs() == 1);
+    assert(lambda->subregion()->narguments() == 2);
+  }
+  assert(graph.root()->narguments() == 1);
+}
+
 static int
 verify()
 {
@@ -323,6 +416,8 @@ verify()
   TestEvolvingTheta();
   TestLambda();
   TestPhi();
+  TestLongChain();
+  TestParallelSweep();
 
 	return 0;
 }
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/gamma.hpp>
+#include <jive/rvsdg/simple-normal-form.hpp>
+#include <jive/types/bitstring.hpp>
+
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/reduction.hpp>
+
+#include <cassert>
+
+static std::unique_ptr<jlm::StatisticsCollector>
+CreateStatisticsCollector()
+{
+  jlm::StatisticsCollectorSettings settings(
+    jlm::filepath(""),
+    {jlm::Statistics::Id::ReduceNodes});
+
+  return std::make_unique<jlm::StatisticsCollector>(std::move(settings));
+}
+
+static const jlm::nodereduction::Statistics &
+GetStatistics(const jlm::StatisticsCollector & statisticsCollector)
+{
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  return dynamic_cast<const jlm::nodereduction::Statistics&>(*statisticsCollector.CollectedStatistics().begin());
+}
+
+/**
+ * Creates a chain of \p length additions that starts with a constant and adds a constant in every step. The
+ * additions are created without normalization.
+ */
+static jive::output *
+CreateAdditionChain(jive::region * region, size_t length)
+{
+  auto result = jive::create_bitconstant(region, 32, 1);
+  for (size_t n = 0; n < length; n++)
+  {
+    auto constant = jive::create_bitconstant(region, 32, n);
+    result = jive::simple_node::create(region, jive::bitadd_op(32), {result, constant})->output(0);
+  }
+
+  return result;
+}
+
+static void
+TestAdditionChain()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  const size_t length = 100;
+  auto sum = CreateAdditionChain(rvsdg.root(), length);
+  auto ex = rvsdg.add_export(sum, {sum->type(), "sum"});
+
+  auto statisticsCollector = CreateStatisticsCollector();
+
+  /*
+   * Act
+   */
+  nodereduction reduction;
+  reduction.run(*rvsdgModule, *statisticsCollector);
+  rvsdg.prune();
+
+  /*
+   * Assert
+   */
+  auto constant = jive::node_output::node(ex->origin());
+  auto constantOperation = dynamic_cast<const jive::bitconstant_op*>(&constant->operation());
+  assert(constantOperation);
+  assert(constantOperation->value() == jive::bitvalue_repr(32, 1 + length*(length-1)/2));
+
+  auto & statistics = GetStatistics(*statisticsCollector);
+  assert(statistics.NumReductions(nodereduction::Reduction::Binary) == length);
+  assert(statistics.NumReductions(nodereduction::Reduction::Gamma) == 0);
+}
+
+static void
+TestGammaPredicateReduction()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto predicate = jive_control_constant(rvsdg.root(), 2, 1);
+  auto gamma = jive::gamma_node::create(predicate, 2);
+
+  auto sum0 = CreateAdditionChain(gamma->subregion(0), 3);
+  auto sum1 = CreateAdditionChain(gamma->subregion(1), 5);
+  auto exitvar = gamma->add_exitvar({sum0, sum1});
+
+  auto ex = rvsdg.add_export(exitvar, {exitvar->type(), "sum"});
+
+  auto statisticsCollector = CreateStatisticsCollector();
+
+  /*
+   * Act
+   */
+  nodereduction reduction;
+  reduction.run(*rvsdgModule, *statisticsCollector);
+  rvsdg.prune();
+
+  /*
+   * Assert
+   */
+  assert(rvsdg.root()->nnodes() == 1);
+
+  auto constant = jive::node_output::node(ex->origin());
+  auto constantOperation = dynamic_cast<const jive::bitconstant_op*>(&constant->operation());
+  assert(constantOperation);
+  assert(constantOperation->value() == jive::bitvalue_repr(32, 11));
+
+  auto & statistics = GetStatistics(*statisticsCollector);
+  assert(statistics.NumReductions(nodereduction::Reduction::Gamma) == 1);
+}
+
+/**
+ * Operation whose normal form reports every node as not normalized without ever changing it.
+ */
+class UnchangedOperation final : public jive::simple_op {
+public:
+  ~UnchangedOperation() override = default;
+
+  UnchangedOperation()
+    : simple_op({jive::bit32}, {jive::bit32})
+  {}
+
+  bool
+  operator==(const operation & other) const noexcept override
+  {
+    return dynamic_cast<const UnchangedOperation*>(&other) != nullptr;
+  }
+
+  [[nodiscard]] std::string
+  debug_string() const override
+  {
+    return "UNCHANGED";
+  }
+
+  [[nodiscard]] std::unique_ptr<jive::operation>
+  copy() const override
+  {
+    return std::unique_ptr<jive::operation>(new UnchangedOperation(*this));
+  }
+};
+
+class UnchangedNormalForm final : public jive::simple_normal_form {
+public:
+  using simple_normal_form::simple_normal_form;
+
+  bool
+  normalize_node(jive::node*) const override
+  {
+    return false;
+  }
+};
+
+static jive::node_normal_form *
+CreateUnchangedNormalForm(
+  const std::type_info & operatorClass,
+  jive::node_normal_form * parent,
+  jive::graph * graph)
+{
+  return new UnchangedNormalForm(operatorClass, parent, graph);
+}
+
+static void __attribute__((constructor))
+RegisterUnchangedNormalForm()
+{
+  jive::node_normal_form::register_factory(typeid(UnchangedOperation), CreateUnchangedNormalForm);
+}
+
+static void
+TestUnchangedNode()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+  auto & rvsdg = rvsdgModule->Rvsdg();
+
+  auto constant = jive::create_bitconstant(rvsdg.root(), 32, 1);
+  auto node = jive::simple_node::create(rvsdg.root(), UnchangedOperation(), {constant});
+  rvsdg.add_export(node->output(0), {node->output(0)->type(), "x"});
+
+  auto statisticsCollector = CreateStatisticsCollector();
+
+  /*
+   * Act
+   */
+  nodereduction reduction;
+  reduction.run(*rvsdgModule, *statisticsCollector);
+
+  /*
+   * Assert
+   */
+  assert(rvsdg.root()->nnodes() == 2);
+
+  auto & statistics = GetStatistics(*statisticsCollector);
+  assert(statistics.NumReductions(nodereduction::Reduction::CommonNodeElimination) == 0);
+}
+
+static int
+TestNodeReduction()
+{
+  TestAdditionChain();
+  TestGammaPredicateReduction();
+  TestUnchangedNode();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestNodeReduction", TestNodeReduction)
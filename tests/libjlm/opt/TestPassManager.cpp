@@ -0,0 +1,317 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/constant.hpp>
+#include <jive/types/bitstring/type.hpp>
+
+#include <jlm/ir/operators/lambda.hpp>
+#include <jlm/ir/RvsdgModule.hpp>
+#include <jlm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/opt/cne.hpp>
+#include <jlm/opt/DeadNodeElimination.hpp>
+#include <jlm/opt/InvariantValueRedirection.hpp>
+#include <jlm/opt/PassManager.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+/**
+ * Requests the Steensgaard points-to graph from the pass manager and counts how often it is computed.
+ */
+class PointsToGraphUser final : public jlm::optimization {
+public:
+  PointsToGraphUser()
+    : NumComputations_(0)
+  {}
+
+  void
+  run(jlm::RvsdgModule &, jlm::StatisticsCollector &) override
+  {
+    assert(false);
+  }
+
+  void
+  run(
+    jlm::RvsdgModule & rvsdgModule,
+    jlm::StatisticsCollector & statisticsCollector,
+    jlm::PassManager & passManager) override
+  {
+    passManager.GetAnalysisManager().GetOrCompute<jlm::aa::PointsToGraph>(
+      jlm::AnalysisId::SteensgaardPointsToGraph,
+      rvsdgModule,
+      [&]()
+      {
+        NumComputations_++;
+        jlm::aa::Steensgaard steensgaard;
+        return steensgaard.Analyze(rvsdgModule, statisticsCollector);
+      });
+  }
+
+  size_t NumComputations_;
+};
+
+/**
+ * Adds an import to the module on every invocation if it is modifying.
+ */
+class ImportPass final : public jlm::optimization {
+public:
+  ImportPass(bool modifying, jlm::HashSet<jlm::AnalysisId> preservedAnalyses)
+    : Modifying_(modifying)
+    , PreservedAnalyses_(std::move(preservedAnalyses))
+  {}
+
+  void
+  run(jlm::RvsdgModule & rvsdgModule, jlm::StatisticsCollector &) override
+  {
+    if (Modifying_)
+      rvsdgModule.Rvsdg().add_import({jive::bittype(32), "i"});
+  }
+
+  jlm::HashSet<jlm::AnalysisId>
+  PreservedAnalyses() const override
+  {
+    return PreservedAnalyses_;
+  }
+
+private:
+  bool Modifying_;
+  jlm::HashSet<jlm::AnalysisId> PreservedAnalyses_;
+};
+
+static void
+TestAnalysisCaching()
+{
+  using namespace jlm;
+
+  auto RunPasses = [](std::vector<optimization*> passes)
+  {
+    StoreTest1 test;
+    StatisticsCollector statisticsCollector;
+
+    PassManager passManager;
+    passManager.Run(test.module(), statisticsCollector, passes);
+
+    return passManager.GetAnalysisManager().IsCached(AnalysisId::SteensgaardPointsToGraph, test.module());
+  };
+
+  ImportPass unmodifyingPass(false, {});
+  ImportPass modifyingPass(true, {});
+  ImportPass preservingPass(true, {AnalysisId::SteensgaardPointsToGraph});
+
+  /*
+   * The points-to graph is computed only once if the module does not change.
+   */
+  {
+    PointsToGraphUser user;
+    auto isCached = RunPasses({&user, &unmodifyingPass, &user});
+    assert(isCached);
+    assert(user.NumComputations_ == 1);
+  }
+
+  /*
+   * The points-to graph is recomputed after a pass changed the module.
+   */
+  {
+    PointsToGraphUser user;
+    auto isCached = RunPasses({&user, &modifyingPass});
+    assert(!isCached);
+
+    RunPasses({&user, &modifyingPass, &user});
+    assert(user.NumComputations_ == 3);
+  }
+
+  /*
+   * The points-to graph remains valid after a pass that changed the module but preserves it.
+   */
+  {
+    PointsToGraphUser user;
+    auto isCached = RunPasses({&user, &preservingPass, &user});
+    assert(isCached);
+    assert(user.NumComputations_ == 1);
+  }
+
+  /*
+   * A fixpoint group only preserves the analyses that all of its passes preserve.
+   */
+  {
+    PointsToGraphUser user;
+    FixpointGroup group({&preservingPass, &modifyingPass}, 1);
+    auto isCached = RunPasses({&user, &group});
+    assert(!isCached);
+  }
+}
+
+static void
+TestAnalysisCachingWithOptimizations()
+{
+  using namespace jlm;
+
+  /*
+   * Creates a module with a function that adds two identical constants, which common node elimination merges.
+   */
+  auto CreateModule = []()
+  {
+    auto rvsdgModule = RvsdgModule::Create(filepath(""), "", "");
+    auto & rvsdg = rvsdgModule->Rvsdg();
+    auto nf = rvsdg.node_normal_form(typeid(jive::operation));
+    nf->set_mutable(false);
+
+    FunctionType functionType({}, {&jive::bit32});
+    auto lambda = lambda::node::create(rvsdg.root(), functionType, "f", linkage::external_linkage);
+
+    auto c1 = jive::create_bitconstant(lambda->subregion(), 32, 1);
+    auto c2 = jive::create_bitconstant(lambda->subregion(), 32, 1);
+    auto sum = jive::bitadd_op::create(32, c1, c2);
+
+    auto lambdaOutput = lambda->finalize({sum});
+    rvsdg.add_export(lambdaOutput, {PointerType(lambda->type()), "f"});
+
+    return rvsdgModule;
+  };
+
+  cne commonNodeElimination;
+  InvariantValueRedirection invariantValueRedirection;
+  DeadNodeElimination deadNodeElimination;
+
+  /*
+   * The points-to graph is reused across common node elimination and invariant value redirection, which both change
+   * the module but preserve it.
+   */
+  {
+    auto rvsdgModule = CreateModule();
+    StatisticsCollector statisticsCollector;
+    PointsToGraphUser user;
+
+    PassManager passManager;
+    auto mutationCount = rvsdgModule->Rvsdg().mutation_count();
+    passManager.Run(
+      *rvsdgModule,
+      statisticsCollector,
+      {&user, &commonNodeElimination, &invariantValueRedirection, &user});
+
+    assert(rvsdgModule->Rvsdg().mutation_count() != mutationCount);
+    assert(passManager.GetAnalysisManager().IsCached(AnalysisId::SteensgaardPointsToGraph, *rvsdgModule));
+    assert(user.NumComputations_ == 1);
+  }
+
+  /*
+   * The points-to graph is recomputed after dead node elimination removed the merged constant.
+   */
+  {
+    auto rvsdgModule = CreateModule();
+    StatisticsCollector statisticsCollector;
+    PointsToGraphUser user;
+
+    PassManager passManager;
+    passManager.Run(
+      *rvsdgModule,
+      statisticsCollector,
+      {&user, &commonNodeElimination, &deadNodeElimination, &user});
+
+    assert(user.NumComputations_ == 2);
+  }
+}
+
+static void
+TestFixpointGroup()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  valuetype vt;
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto nf = rvsdg.node_normal_form(typeid(jive::operation));
+  nf->set_mutable(false);
+
+  auto x = rvsdg.add_import({vt, "x"});
+
+  auto b1 = create_testop(rvsdg.root(), {x, x}, {&vt})[0];
+  auto b2 = create_testop(rvsdg.root(), {x, x}, {&vt})[0];
+  auto u1 = create_testop(rvsdg.root(), {b1}, {&vt})[0];
+  auto u2 = create_testop(rvsdg.root(), {b2}, {&vt})[0];
+
+  rvsdg.add_export(u1, {vt, "u1"});
+  rvsdg.add_export(u2, {vt, "u2"});
+
+  cne commonNodeElimination;
+  DeadNodeElimination deadNodeElimination;
+  FixpointGroup group({&commonNodeElimination, &deadNodeElimination});
+
+  /*
+   * Act
+   */
+  StatisticsCollector statisticsCollector;
+  PassManager passManager;
+  passManager.Run(rvsdgModule, statisticsCollector, {&group});
+
+  /*
+   * Assert
+   */
+  assert(rvsdg.root()->nnodes() == 2);
+  assert(rvsdg.root()->result(0)->origin() == rvsdg.root()->result(1)->origin());
+
+  /*
+   * The first iteration changes the module, the second one does not.
+   */
+  assert(group.NumIterations() == 2);
+  assert(group.Converged());
+}
+
+static void
+TestMaxIterations()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+
+  ImportPass modifyingPass(true, {});
+  FixpointGroup group({&modifyingPass}, 3);
+
+  /*
+   * Act
+   */
+  StatisticsCollector statisticsCollector(
+    StatisticsCollectorSettings(filepath(""), {Statistics::Id::FixpointGroup}));
+  group.run(rvsdgModule, statisticsCollector);
+
+  /*
+   * Assert
+   */
+  assert(group.NumIterations() == 3);
+  assert(!group.Converged());
+  assert(rvsdgModule.Rvsdg().root()->narguments() == 3);
+
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetId() == Statistics::Id::FixpointGroup);
+  assert(statistics.ToString().find("Converged:no") != std::string::npos);
+}
+
+static int
+TestPassManager()
+{
+  TestAnalysisCaching();
+  TestAnalysisCachingWithOptimizations();
+  TestFixpointGroup();
+  TestMaxIterations();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestPassManager", TestPassManager)
@@ -0,0 +1,403 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+
+#include <jive/rvsdg/control.hpp>
+#include <jive/rvsdg/theta.hpp>
+#include <jive/types/bitstring/arithmetic.hpp>
+#include <jive/types/bitstring/comparison.hpp>
+#include <jive/types/bitstring/constant.hpp>
+
+#include <jlm/opt/ScalarEvolution.hpp>
+
+#include <cassert>
+
+static const jlm::ScevAddRecurrence &
+AssertAddRecurrence(
+  const jlm::ScevExpression & expression,
+  const jive::theta_node & thetaNode,
+  size_t numOperands)
+{
+  auto recurrence = dynamic_cast<const jlm::ScevAddRecurrence*>(&expression);
+  assert(recurrence);
+  assert(&recurrence->ThetaNode() == &thetaNode);
+  assert(recurrence->Operands().size() == numOperands);
+
+  return *recurrence;
+}
+
+static void
+AssertConstant(const jlm::ScevExpression & expression, int64_t value)
+{
+  auto constant = dynamic_cast<const jlm::ScevConstant*>(&expression);
+  assert(constant && constant->Value() == value);
+}
+
+/**
+ * for (i = 0; i < 100; i++)
+ */
+static void
+TestAffineRecurrence()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::graph graph;
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+
+  auto thetaNode = jive::theta_node::create(graph.root());
+  auto i = thetaNode->add_loopvar(zero);
+  auto step = thetaNode->add_loopvar(one);
+
+  auto hundred = jive::create_bitconstant(thetaNode->subregion(), 32, 100);
+
+  auto next = jive::bitadd_op::create(32, i->argument(), step->argument());
+  auto compare = jive::bitult_op::create(32, next, hundred);
+  auto predicate = jive::match(1, {{1, 1}}, 0, 2, compare);
+
+  i->result()->divert_to(next);
+  thetaNode->set_predicate(predicate);
+
+  /*
+   * Act
+   */
+  ScalarEvolution scalarEvolution;
+  auto & iExpression = scalarEvolution.GetExpression(*i->argument());
+  auto & nextExpression = scalarEvolution.GetExpression(*next);
+
+  /*
+   * Assert
+   */
+  auto & iRecurrence = AssertAddRecurrence(iExpression, *thetaNode, 2);
+  assert(iRecurrence.IsAffine());
+  AssertConstant(iRecurrence.Operand(0), 0);
+  AssertConstant(iRecurrence.Operand(1), 1);
+
+  auto & nextRecurrence = AssertAddRecurrence(nextExpression, *thetaNode, 2);
+  AssertConstant(nextRecurrence.Operand(0), 1);
+
+  AssertConstant(scalarEvolution.GetExpression(*step->argument()), 1);
+
+  assert(scalarEvolution.GetTripCount(*thetaNode) == 100);
+  assert(scalarEvolution.GetRange(*i->argument()) == std::make_pair(int64_t(0), int64_t(99)));
+  AssertConstant(scalarEvolution.GetExpression(*i), 100);
+}
+
+/**
+ * for (i = 10; i != 0; i -= 2) { s += i; p *= 3; }
+ */
+static void
+TestPolynomialAndGeometricRecurrences()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::graph graph;
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto one = jive::create_bitconstant(graph.root(), 32, 1);
+  auto ten = jive::create_bitconstant(graph.root(), 32, 10);
+
+  auto thetaNode = jive::theta_node::create(graph.root());
+  auto i = thetaNode->add_loopvar(ten);
+  auto s = thetaNode->add_loopvar(zero);
+  auto p = thetaNode->add_loopvar(one);
+
+  auto two = jive::create_bitconstant(thetaNode->subregion(), 32, 2);
+  auto three = jive::create_bitconstant(thetaNode->subregion(), 32, 3);
+  auto zeroInside = jive::create_bitconstant(thetaNode->subregion(), 32, 0);
+
+  auto nextS = jive::bitadd_op::create(32, s->argument(), i->argument());
+  auto nextP = jive::bitmul_op::create(32, three, p->argument());
+  auto nextI = jive::bitsub_op::create(32, i->argument(), two);
+  auto compare = jive::bitne_op::create(32, nextI, zeroInside);
+  auto predicate = jive::match(1, {{1, 1}}, 0, 2, compare);
+
+  i->result()->divert_to(nextI);
+  s->result()->divert_to(nextS);
+  p->result()->divert_to(nextP);
+  thetaNode->set_predicate(predicate);
+
+  /*
+   * Act
+   */
+  ScalarEvolution scalarEvolution;
+  auto & sExpression = scalarEvolution.GetExpression(*s->argument());
+  auto & pExpression = scalarEvolution.GetExpression(*p->argument());
+
+  /*
+   * Assert
+   */
+  auto & sRecurrence = AssertAddRecurrence(sExpression, *thetaNode, 3);
+  AssertConstant(sRecurrence.Operand(0), 0);
+  AssertConstant(sRecurrence.Operand(1), 10);
+  AssertConstant(sRecurrence.Operand(2), -2);
+
+  auto pRecurrence = dynamic_cast<const ScevMulRecurrence*>(&pExpression);
+  assert(pRecurrence && &pRecurrence->ThetaNode() == thetaNode);
+  AssertConstant(pRecurrence->Start(), 1);
+  AssertConstant(pRecurrence->Ratio(), 3);
+
+  /*
+   * The values of s are 0, 10, 18, 24, 28, and the values of p are powers of three.
+   */
+  assert(ScalarEvolution::Evaluate(sExpression, 3) == 24);
+  assert(ScalarEvolution::Evaluate(pExpression, 4) == 81);
+
+  assert(scalarEvolution.GetTripCount(*thetaNode) == 5);
+  AssertConstant(scalarEvolution.GetExpression(*s), 30);
+  AssertConstant(scalarEvolution.GetExpression(*p), 243);
+  assert(scalarEvolution.GetRange(*s->argument()) == std::make_pair(int64_t(0), int64_t(28)));
+}
+
+/**
+ * for (i = 0; i < 10; i++) for (j = i; j < 20; j++)
+ */
+static void
+TestNestedRecurrences()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::graph graph;
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+
+  auto outerThetaNode = jive::theta_node::create(graph.root());
+  auto i = outerThetaNode->add_loopvar(zero);
+
+  auto innerThetaNode = jive::theta_node::create(outerThetaNode->subregion());
+  auto iInner = innerThetaNode->add_loopvar(i->argument());
+  auto j = innerThetaNode->add_loopvar(i->argument());
+
+  auto one = jive::create_bitconstant(innerThetaNode->subregion(), 32, 1);
+  auto twenty = jive::create_bitconstant(innerThetaNode->subregion(), 32, 20);
+  auto nextJ = jive::bitadd_op::create(32, j->argument(), one);
+  auto innerCompare = jive::bitslt_op::create(32, nextJ, twenty);
+  j->result()->divert_to(nextJ);
+  innerThetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, innerCompare));
+
+  auto oneOuter = jive::create_bitconstant(outerThetaNode->subregion(), 32, 1);
+  auto ten = jive::create_bitconstant(outerThetaNode->subregion(), 32, 10);
+  auto nextI = jive::bitadd_op::create(32, iInner, oneOuter);
+  auto outerCompare = jive::bitslt_op::create(32, nextI, ten);
+  i->result()->divert_to(nextI);
+  outerThetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, outerCompare));
+
+  /*
+   * Act
+   */
+  ScalarEvolution scalarEvolution;
+  auto & jExpression = scalarEvolution.GetExpression(*j->argument());
+
+  /*
+   * Assert
+   */
+  auto & jRecurrence = AssertAddRecurrence(jExpression, *innerThetaNode, 2);
+  auto & iRecurrence = AssertAddRecurrence(jRecurrence.Operand(0), *outerThetaNode, 2);
+  AssertConstant(iRecurrence.Operand(0), 0);
+  AssertConstant(iRecurrence.Operand(1), 1);
+  AssertConstant(jRecurrence.Operand(1), 1);
+
+  assert(ScalarEvolution::IsInvariant(iRecurrence, *innerThetaNode));
+  assert(!ScalarEvolution::IsInvariant(jRecurrence, *innerThetaNode));
+  assert(!ScalarEvolution::IsInvariant(iRecurrence, *outerThetaNode));
+
+  /*
+   * The loop variable i is passed through the inner theta node unchanged.
+   */
+  assert(&scalarEvolution.GetExpression(*iInner) == &scalarEvolution.GetExpression(*i->argument()));
+  assert(scalarEvolution.GetTripCount(*outerThetaNode) == 10);
+  assert(!scalarEvolution.GetTripCount(*innerThetaNode));
+}
+
+static void
+TestUnknown()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::bittype bt32(32);
+
+  jive::graph graph;
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto zero = jive::create_bitconstant(graph.root(), 32, 0);
+  auto n = graph.add_import({bt32, "n"});
+
+  auto thetaNode = jive::theta_node::create(graph.root());
+  auto i = thetaNode->add_loopvar(zero);
+  auto x = thetaNode->add_loopvar(zero);
+  auto end = thetaNode->add_loopvar(n);
+
+  auto one = jive::create_bitconstant(thetaNode->subregion(), 32, 1);
+  auto nextI = jive::bitadd_op::create(32, i->argument(), one);
+  auto nextX = jive::bitxor_op::create(32, x->argument(), nextI);
+  auto compare = jive::bitult_op::create(32, nextI, end->argument());
+
+  i->result()->divert_to(nextI);
+  x->result()->divert_to(nextX);
+  thetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, compare));
+
+  /*
+   * Act
+   */
+  ScalarEvolution scalarEvolution;
+  auto & xExpression = scalarEvolution.GetExpression(*x->argument());
+  auto & endExpression = scalarEvolution.GetExpression(*end->argument());
+
+  /*
+   * Assert
+   */
+  assert(xExpression.GetKind() == ScevExpression::Kind::Unknown);
+  assert(endExpression.GetKind() == ScevExpression::Kind::Unknown);
+  assert(ScalarEvolution::IsInvariant(endExpression, *thetaNode));
+
+  AssertAddRecurrence(scalarEvolution.GetExpression(*i->argument()), *thetaNode, 2);
+  assert(!scalarEvolution.GetTripCount(*thetaNode));
+  assert(!scalarEvolution.GetRange(*i->argument()));
+  assert(scalarEvolution.GetExpression(*i).GetKind() == ScevExpression::Kind::Unknown);
+}
+
+/**
+ * for (i = 0, j = 0; i < 3; i++, j += step) with an 8-bit j
+ */
+static void
+TestWrappingRecurrence()
+{
+  using namespace jlm;
+
+  auto test = [](int64_t step)
+  {
+    /*
+     * Arrange
+     */
+    jive::graph graph;
+    graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+    auto zero32 = jive::create_bitconstant(graph.root(), 32, 0);
+    auto zero8 = jive::create_bitconstant(graph.root(), 8, 0);
+
+    auto thetaNode = jive::theta_node::create(graph.root());
+    auto i = thetaNode->add_loopvar(zero32);
+    auto j = thetaNode->add_loopvar(zero8);
+
+    auto one = jive::create_bitconstant(thetaNode->subregion(), 32, 1);
+    auto three = jive::create_bitconstant(thetaNode->subregion(), 32, 3);
+    auto stepConstant = jive::create_bitconstant(thetaNode->subregion(), 8, step);
+
+    auto nextI = jive::bitadd_op::create(32, i->argument(), one);
+    auto nextJ = jive::bitadd_op::create(8, j->argument(), stepConstant);
+    auto compare = jive::bitult_op::create(32, nextI, three);
+
+    i->result()->divert_to(nextI);
+    j->result()->divert_to(nextJ);
+    thetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, compare));
+
+    ScalarEvolution scalarEvolution;
+    assert(scalarEvolution.GetTripCount(*thetaNode) == 3);
+
+    /*
+     * Act
+     */
+    return scalarEvolution.GetRange(*j->argument());
+  };
+
+  /*
+   * Assert
+   */
+  assert(test(40) == std::make_pair(int64_t(0), int64_t(80)));
+  assert(test(-60) == std::make_pair(int64_t(-120), int64_t(0)));
+
+  /*
+   * The values are 0, 100, and -56.
+   */
+  assert(!test(100));
+  assert(!test(-100));
+}
+
+/**
+ * for (i = 0; i < 2^65; i += 2^32 * 2^32) with a 128-bit i
+ */
+static void
+TestWideBitstrings()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  jive::graph graph;
+  graph.node_normal_form(typeid(jive::operation))->set_mutable(false);
+
+  auto zero = jive::create_bitconstant(graph.root(), 128, 0);
+
+  auto thetaNode = jive::theta_node::create(graph.root());
+  auto i = thetaNode->add_loopvar(zero);
+
+  /*
+   * The bound 2^65 does not fit into 64 bits.
+   */
+  std::string boundBits(128, '0');
+  boundBits[65] = '1';
+  auto bound = jive::create_bitconstant(thetaNode->subregion(), jive::bitvalue_repr(boundBits.c_str()));
+
+  auto twoPow32 = jive::create_bitconstant(thetaNode->subregion(), 128, int64_t(1) << 32);
+  auto step = jive::bitmul_op::create(128, twoPow32, twoPow32);
+  auto next = jive::bitadd_op::create(128, i->argument(), step);
+  auto compare = jive::bitult_op::create(128, next, bound);
+
+  i->result()->divert_to(next);
+  thetaNode->set_predicate(jive::match(1, {{1, 1}}, 0, 2, compare));
+
+  /*
+   * Act
+   */
+  ScalarEvolution scalarEvolution;
+  auto & boundExpression = scalarEvolution.GetExpression(*bound);
+  auto & stepExpression = scalarEvolution.GetExpression(*step);
+  auto & iExpression = scalarEvolution.GetExpression(*i->argument());
+
+  /*
+   * Assert
+   */
+  assert(boundExpression.GetKind() == ScevExpression::Kind::Unknown);
+  assert(stepExpression.GetKind() == ScevExpression::Kind::Unknown);
+  assert(iExpression.GetKind() == ScevExpression::Kind::Unknown);
+
+  assert(!scalarEvolution.GetTripCount(*thetaNode));
+  assert(!scalarEvolution.GetRange(*i->argument()));
+  assert(scalarEvolution.GetExpression(*i).GetKind() == ScevExpression::Kind::Unknown);
+}
+
+static int
+TestScalarEvolution()
+{
+  TestAffineRecurrence();
+  TestPolynomialAndGeometricRecurrences();
+  TestNestedRecurrences();
+  TestUnknown();
+  TestWrappingRecurrence();
+  TestWideBitstrings();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/TestScalarEvolution", TestScalarEvolution)
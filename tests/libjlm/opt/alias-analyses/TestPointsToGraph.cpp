@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "TestRvsdgs.hpp"
+
+#include <test-registry.hpp>
+
+#include <jlm/opt/alias-analyses/PointsToGraph.hpp>
+
+#include <cassert>
+#include <vector>
+
+static void
+TestNodeIndices()
+{
+  using namespace jlm::aa;
+
+  /*
+   * Arrange
+   */
+  StoreTest1 test;
+  test.module();
+  auto pointsToGraph = PointsToGraph::Create();
+
+  /*
+   * Act
+   */
+  auto & registerNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, *test.alloca_a->output(0));
+  auto & allocaA = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_a);
+  auto & allocaB = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_b);
+
+  /*
+   * Assert
+   */
+  auto & unknownMemoryNode = pointsToGraph->GetUnknownMemoryNode();
+  auto & externalMemoryNode = pointsToGraph->GetExternalMemoryNode();
+
+  assert(unknownMemoryNode.GetIndex() == 0 && unknownMemoryNode.GetMemoryNodeIndex() == 0);
+  assert(externalMemoryNode.GetIndex() == 1 && externalMemoryNode.GetMemoryNodeIndex() == 1);
+  assert(registerNode.GetIndex() == 2);
+  assert(allocaA.GetIndex() == 3 && allocaA.GetMemoryNodeIndex() == 2);
+  assert(allocaB.GetIndex() == 4 && allocaB.GetMemoryNodeIndex() == 3);
+}
+
+static void
+TestEdges()
+{
+  using namespace jlm::aa;
+
+  /*
+   * Arrange
+   */
+  StoreTest1 test;
+  test.module();
+  auto pointsToGraph = PointsToGraph::Create();
+
+  auto & registerNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, *test.alloca_a->output(0));
+  auto & allocaA = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_a);
+  auto & allocaB = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_b);
+
+  /*
+   * Act
+   */
+  registerNode.AddEdge(allocaB);
+  registerNode.AddEdge(allocaA);
+  registerNode.AddEdge(allocaA);
+  allocaA.AddEdge(allocaB);
+
+  /*
+   * Assert
+   */
+  assert(registerNode.NumTargets() == 2);
+  assert(allocaB.NumSources() == 2);
+
+  std::vector<const PointsToGraph::MemoryNode*> targets;
+  for (auto & target : registerNode.Targets())
+    targets.push_back(&target);
+  assert(targets == std::vector<const PointsToGraph::MemoryNode*>({&allocaA, &allocaB}));
+
+  std::vector<const PointsToGraph::Node*> sources;
+  for (auto & source : allocaB.Sources())
+    sources.push_back(&source);
+  assert(sources == std::vector<const PointsToGraph::Node*>({&registerNode, &allocaA}));
+
+  assert(registerNode.GetTargetSet() == PointsToGraph::MemoryNodeSet({&allocaA, &allocaB}));
+
+  registerNode.RemoveEdge(allocaB);
+  assert(registerNode.NumTargets() == 1);
+  assert(allocaB.NumSources() == 1);
+  assert(&*allocaB.Sources().begin() == &allocaA);
+}
+
+static void
+TestMemoryNodeSet()
+{
+  using namespace jlm::aa;
+
+  /*
+   * Arrange
+   */
+  StoreTest1 test;
+  test.module();
+  auto pointsToGraph = PointsToGraph::Create();
+
+  auto & allocaA = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_a);
+  auto & allocaB = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_b);
+  auto & allocaC = PointsToGraph::AllocaNode::Create(*pointsToGraph, *test.alloca_c);
+  allocaC.MarkAsModuleEscaping();
+
+  /*
+   * Act & Assert
+   */
+  PointsToGraph::MemoryNodeSet memoryNodes;
+  assert(memoryNodes.IsEmpty());
+  assert(memoryNodes.Items().begin() == memoryNodes.Items().end());
+
+  assert(memoryNodes.Insert(&allocaB));
+  assert(!memoryNodes.Insert(&allocaB));
+  assert(memoryNodes.Contains(&allocaB));
+  assert(!memoryNodes.Contains(&allocaA));
+
+  assert(memoryNodes.UnionWith(pointsToGraph->GetEscapedMemoryNodes()));
+  assert(!memoryNodes.UnionWith({&allocaC}));
+  assert(memoryNodes.Size() == 2);
+
+  assert(PointsToGraph::MemoryNodeSet({&allocaC}).IsSubsetOf(memoryNodes));
+  assert(!PointsToGraph::MemoryNodeSet({&allocaA}).IsSubsetOf(memoryNodes));
+
+  std::vector<const PointsToGraph::MemoryNode*> items;
+  for (auto & memoryNode : memoryNodes.Items())
+    items.push_back(memoryNode);
+  assert(items == std::vector<const PointsToGraph::MemoryNode*>({&allocaB, &allocaC}));
+
+  assert(memoryNodes.Remove(&allocaB));
+  assert(memoryNodes == pointsToGraph->GetEscapedMemoryNodes());
+}
+
+static int
+TestPointsToGraph()
+{
+  TestNodeIndices();
+  TestEdges();
+  TestMemoryNodeSet();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/opt/alias-analyses/TestPointsToGraph", TestPointsToGraph)
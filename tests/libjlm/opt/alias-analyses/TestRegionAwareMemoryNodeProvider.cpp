@@ -10,6 +10,7 @@
 #include <jlm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/opt/alias-analyses/Steensgaard.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/ThreadPool.hpp>
 
 #include <jive/view.hpp>
 
@@ -25,8 +26,8 @@ RunSteensgaard(jlm::RvsdgModule & rvsdgModule)
 
 static void
 AssertMemoryNodes(
-  const jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> & receivedMemoryNodes,
-  const jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> & expectedMemoryNodes)
+  const jlm::aa::PointsToGraph::MemoryNodeSet & receivedMemoryNodes,
+  const jlm::aa::PointsToGraph::MemoryNodeSet & expectedMemoryNodes)
 {
   assert(receivedMemoryNodes == expectedMemoryNodes);
 }
@@ -47,7 +48,7 @@ TestStore1()
     auto & allocaCMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_c);
     auto & allocaDMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_d);
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes(
       {
         &allocaAMemoryNode,
         &allocaBMemoryNode,
@@ -96,7 +97,7 @@ TestStore2()
     auto & allocaXMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_x);
     auto & allocaYMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_y);
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes(
       {
         &allocaAMemoryNode,
         &allocaBMemoryNode,
@@ -184,7 +185,7 @@ TestLoad2()
     auto & allocaXMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_x);
     auto & allocaYMemoryNode = pointsToGraph.GetAllocaNode(*test.alloca_y);
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes(
       {
         &allocaAMemoryNode,
         &allocaBMemoryNode,
@@ -531,7 +532,7 @@ TestIndirectCall2()
 
     auto & externalMemoryNode = pointsToGraph.GetExternalMemoryNode();
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes(
       {
         &deltaG1MemoryNode,
         &deltaG2MemoryNode,
@@ -1014,7 +1015,7 @@ TestPhi2()
 
     auto & externalMemoryNode = pointsToGraph.GetExternalMemoryNode();
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes(
       {
         &pTestAllocaMemoryNode,
         &paAllocaMemoryNode,
@@ -1245,7 +1246,7 @@ TestEscapedMemory1()
     auto & deltaYMemoryNode = pointsToGraph.GetDeltaNode(*test.DeltaY);
     auto & externalMemoryNode = pointsToGraph.GetExternalMemoryNode();
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes({
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes({
       &lambdaMemoryNode,
       &deltaAMemoryNode,
       &deltaBMemoryNode,
@@ -1312,7 +1313,7 @@ TestEscapedMemory2()
      * Validate CallExternalFunction1 function
      */
     {
-      jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes({
+      jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes({
         &returnAddressMallocMemoryNode,
         &callExternalFunction1MallocMemoryNode,
         &returnAddressLambdaMemoryNode,
@@ -1337,7 +1338,7 @@ TestEscapedMemory2()
      * Validate CallExternalFunction2 function
      */
     {
-      jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes({
+      jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes({
         &returnAddressMallocMemoryNode,
         &callExternalFunction1MallocMemoryNode,
         &returnAddressLambdaMemoryNode,
@@ -1391,7 +1392,7 @@ TestEscapedMemory3()
     auto & deltaMemoryNode = pointsToGraph.GetDeltaNode(*test.DeltaGlobal);
     auto & externalMemoryNode = pointsToGraph.GetExternalMemoryNode();
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedMemoryNodes({
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedMemoryNodes({
       &lambdaMemoryNode,
       &deltaMemoryNode,
       &externalMemoryNode});
@@ -1469,6 +1470,80 @@ TestStatistics()
   assert(memoryNodeProvisioningStatistics.GetResolveUnknownMemoryNodeReferencesTime() != 0);
 }
 
+static void
+AssertEqualProvisionings(
+  const jive::region & region,
+  const jlm::aa::MemoryNodeProvisioning & provisioning1,
+  const jlm::aa::MemoryNodeProvisioning & provisioning2)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto lambdaNode = dynamic_cast<const jlm::lambda::node*>(&node))
+    {
+      AssertMemoryNodes(provisioning1.GetLambdaEntryNodes(*lambdaNode), provisioning2.GetLambdaEntryNodes(*lambdaNode));
+      AssertMemoryNodes(provisioning1.GetLambdaExitNodes(*lambdaNode), provisioning2.GetLambdaExitNodes(*lambdaNode));
+    }
+    else if (auto callNode = dynamic_cast<const jlm::CallNode*>(&node))
+    {
+      AssertMemoryNodes(provisioning1.GetCallEntryNodes(*callNode), provisioning2.GetCallEntryNodes(*callNode));
+      AssertMemoryNodes(provisioning1.GetCallExitNodes(*callNode), provisioning2.GetCallExitNodes(*callNode));
+    }
+
+    auto structuralNode = dynamic_cast<const jive::structural_node*>(&node);
+    if (structuralNode == nullptr || jive::is<jlm::delta::operation>(structuralNode))
+      continue;
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      AssertEqualProvisionings(*structuralNode->subregion(n), provisioning1, provisioning2);
+  }
+}
+
+static void
+TestMultipleThreads()
+{
+  auto test = [](RvsdgTest & test)
+  {
+    /*
+     * Arrange
+     */
+    auto & rvsdgModule = test.module();
+    auto pointsToGraph = RunSteensgaard(rvsdgModule);
+    jlm::StatisticsCollector statisticsCollector;
+
+    /*
+     * Act
+     */
+    auto sequentialProvisioning = jlm::aa::RegionAwareMemoryNodeProvider::Create(
+      rvsdgModule,
+      *pointsToGraph,
+      statisticsCollector);
+
+    /*
+     * Assert
+     */
+    for (size_t numThreads : {1, 2, 4, 8})
+    {
+      jlm::ThreadPool threadPool(numThreads);
+      auto provisioning = jlm::aa::RegionAwareMemoryNodeProvider::Create(
+        rvsdgModule,
+        *pointsToGraph,
+        statisticsCollector,
+        &threadPool);
+
+      AssertEqualProvisionings(*rvsdgModule.Rvsdg().root(), *sequentialProvisioning, *provisioning);
+    }
+  };
+
+  IndirectCallTest2 indirectCallTest;
+  test(indirectCallTest);
+
+  PhiTest2 phiTest;
+  test(phiTest);
+
+  EscapedMemoryTest3 escapedMemoryTest;
+  test(escapedMemoryTest);
+}
+
 static int
 TestRegionAwareMemoryNodeProvider()
 {
@@ -1505,6 +1580,8 @@ TestRegionAwareMemoryNodeProvider()
 
   TestStatistics();
 
+  TestMultipleThreads();
+
   return 0;
 }
 
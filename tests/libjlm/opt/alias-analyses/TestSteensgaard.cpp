@@ -76,7 +76,7 @@ TestStore1()
     assertTargets(lambda, {});
     assertTargets(plambda, {&lambda});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -127,7 +127,7 @@ TestStore2()
     assertTargets(lambda, {});
     assertTargets(plambda, {&lambda});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -158,7 +158,7 @@ TestLoad1()
     assertTargets(lambdaOutput, {&lambda});
     assertTargets(lambdaArgument0, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -196,7 +196,7 @@ TestLoad2()
     assertTargets(pload_x, {&alloca_x, &alloca_y});
     assertTargets(pload_a, {&alloca_a, &alloca_b});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambdaMemoryNode});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambdaMemoryNode});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -221,7 +221,7 @@ TestLoadFromUndef()
 
     assertTargets(undefValueNode, {});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambdaMemoryNode});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambdaMemoryNode});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -252,7 +252,7 @@ TestGetElementPtr()
     assertTargets(gepX, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
     assertTargets(gepY, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -282,7 +282,7 @@ TestBitCast()
     assertTargets(lambdaArg, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
     assertTargets(bitCast, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -312,7 +312,7 @@ TestConstantPointerNull()
     assertTargets(lambdaArg, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
     assertTargets(constantPointerNull, {});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -340,7 +340,7 @@ TestBits2Ptr()
 
     auto & lambdaTestMemoryNode = ptg.GetLambdaNode(*test.lambda_test);
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambdaTestMemoryNode});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambdaTestMemoryNode});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -403,7 +403,7 @@ TestCall1()
     assertTargets(lambda_h_cv0, {&lambda_f});
     assertTargets(lambda_h_cv1, {&lambda_g});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_h});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_h});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -457,7 +457,7 @@ TestCall2()
 
     assertTargets(malloc_out, {&malloc});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_test});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_test});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -506,7 +506,7 @@ TestIndirectCall()
     assertTargets(lambda_test_cv1, {&lambda_three, &lambda_four});
     assertTargets(lambda_test_cv2, {&lambda_three, &lambda_four});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_test});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_test});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -612,7 +612,7 @@ TestGamma()
       assertTargets(gammaOutput, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
     }
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -649,7 +649,7 @@ TestTheta()
     assertTargets(thetaArgument2, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
     assertTargets(thetaOutput2, {&lambda, &pointsToGraph.GetExternalMemoryNode()});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -692,7 +692,7 @@ TestDelta1()
     assertTargets(lambda_h_cv0, {&delta_f});
     assertTargets(lambda_h_cv1, {&lambda_g});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_h});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_h});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -740,7 +740,7 @@ TestDelta2()
     assertTargets(lambda_f2_cvd2, {&delta_d2});
     assertTargets(lambda_f2_cvf1, {&lambda_f1});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_f2});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_f2});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -788,7 +788,7 @@ TestImports()
     assertTargets(lambda_f2_cvd2, {&d2});
     assertTargets(lambda_f2_cvf1, {&lambda_f1});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_f2});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_f2});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -838,7 +838,7 @@ TestPhi1()
 
     assertTargets(alloca_out, {&alloca});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambda_test});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambda_test});
     assert(ptg.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -865,7 +865,7 @@ TestExternalMemory()
     assertTargets(lambdaFArgument0, {&lambdaF, &pointsToGraph.GetExternalMemoryNode()});
     assertTargets(lambdaFArgument1, {&lambdaF, &pointsToGraph.GetExternalMemoryNode()});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({&lambdaF});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({&lambdaF});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -901,7 +901,7 @@ TestEscapedMemory1()
     assertTargets(lambdaTestCv0, {deltaB});
     assertTargets(loadNode1Output, {deltaA, deltaX, deltaY, lambdaTest, externalMemory});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({
       lambdaTest,
       deltaA,
       deltaX,
@@ -948,7 +948,7 @@ TestEscapedMemory2()
         callExternalFunction1Malloc
       });
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({
       returnAddressFunction,
       callExternalFunction1,
       callExternalFunction2,
@@ -984,7 +984,7 @@ TestEscapedMemory3()
 
     assertTargets(callExternalFunctionResult, {lambdaTest, deltaGlobal, externalMemory});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes({lambdaTest, deltaGlobal});
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes({lambdaTest, deltaGlobal});
     assert(pointsToGraph.GetEscapedMemoryNodes() == expectedEscapedMemoryNodes);
   };
 
@@ -1022,7 +1022,7 @@ TestMemcpy()
     assertTargets(memCpyDest, {globalArray});
     assertTargets(memCpySrc, {localArray});
 
-    jlm::HashSet<const jlm::aa::PointsToGraph::MemoryNode*> expectedEscapedMemoryNodes(
+    jlm::aa::PointsToGraph::MemoryNodeSet expectedEscapedMemoryNodes(
       {
         globalArray,
         localArray,
@@ -1074,6 +1074,141 @@ TestLinkedList()
   validatePointsToGraph(*pointsToGraph, test);
 }
 
+static void
+TestStructFields()
+{
+  /*
+   * Arrange
+   */
+  auto validatePointsToGraph = [](
+    const jlm::aa::PointsToGraph & pointsToGraph,
+    const StructFieldTest & test)
+  {
+    assert(pointsToGraph.NumAllocaNodes() == 3);
+    assert(pointsToGraph.NumFieldNodes() == 2);
+
+    auto & allocaA = pointsToGraph.GetAllocaNode(test.GetAllocaA());
+    auto & allocaB = pointsToGraph.GetAllocaNode(test.GetAllocaB());
+    auto & allocaS = pointsToGraph.GetAllocaNode(test.GetAllocaS());
+
+    auto & fieldY = pointsToGraph.GetFieldNode(allocaS, 8);
+    auto & fieldZ = pointsToGraph.GetFieldNode(allocaS, 16);
+
+    auto & gepY = pointsToGraph.GetRegisterNode(*test.GetGepY().output(0));
+    auto & gepZ = pointsToGraph.GetRegisterNode(*test.GetGepZ().output(0));
+    auto & gepByte = pointsToGraph.GetRegisterNode(*test.GetGepByte().output(0));
+    auto & load = pointsToGraph.GetRegisterNode(*test.GetLoad().output(0));
+
+    assertTargets(gepY, {&fieldY});
+    assertTargets(gepZ, {&fieldZ});
+    assertTargets(gepByte, {&fieldY});
+    assertTargets(fieldY, {&allocaA});
+    assertTargets(fieldZ, {&allocaB});
+    assertTargets(load, {&allocaA});
+  };
+
+  StructFieldTest test;
+  // jive::view(test.graph().root(), stdout);
+
+  /*
+   * Act
+   */
+  jlm::aa::Steensgaard steensgaard(jlm::aa::Steensgaard::DefaultMaxFields);
+  jlm::StatisticsCollector statisticsCollector;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+  // std::cout << jlm::aa::PointsToGraph::ToDot(*pointsToGraph);
+
+  /*
+   * Assert
+   */
+  validatePointsToGraph(*pointsToGraph, test);
+}
+
+static void
+TestStructFieldsCollapsed()
+{
+  /*
+   * Arrange
+   */
+  auto validatePointsToGraph = [](
+    const jlm::aa::PointsToGraph & pointsToGraph,
+    const StructFieldTest & test)
+  {
+    assert(pointsToGraph.NumFieldNodes() == 0);
+
+    auto & allocaA = pointsToGraph.GetAllocaNode(test.GetAllocaA());
+    auto & allocaB = pointsToGraph.GetAllocaNode(test.GetAllocaB());
+    auto & allocaS = pointsToGraph.GetAllocaNode(test.GetAllocaS());
+
+    auto & gepY = pointsToGraph.GetRegisterNode(*test.GetGepY().output(0));
+    auto & load = pointsToGraph.GetRegisterNode(*test.GetLoad().output(0));
+
+    assertTargets(gepY, {&allocaS});
+    assertTargets(load, {&allocaA, &allocaB});
+  };
+
+  StructFieldTest test;
+  // jive::view(test.graph().root(), stdout);
+
+  /*
+   * Act
+   */
+  jlm::aa::Steensgaard steensgaard(1);
+  jlm::StatisticsCollector statisticsCollector;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+  // std::cout << jlm::aa::PointsToGraph::ToDot(*pointsToGraph);
+
+  /*
+   * Assert
+   */
+  validatePointsToGraph(*pointsToGraph, test);
+}
+
+static void
+TestWideStructFields()
+{
+  /*
+   * Arrange
+   */
+  auto validatePointsToGraph = [](
+    const jlm::aa::PointsToGraph & pointsToGraph,
+    const WideStructFieldTest & test)
+  {
+    assert(pointsToGraph.NumFieldNodes() == 1);
+
+    auto & allocaA = pointsToGraph.GetAllocaNode(test.GetAllocaA());
+    auto & allocaB = pointsToGraph.GetAllocaNode(test.GetAllocaB());
+    auto & allocaU = pointsToGraph.GetAllocaNode(test.GetAllocaU());
+
+    auto & fieldZ = pointsToGraph.GetFieldNode(allocaU, 24);
+
+    auto & gepZ = pointsToGraph.GetRegisterNode(*test.GetGepZ().output(0));
+    auto & gepByte = pointsToGraph.GetRegisterNode(*test.GetGepByte().output(0));
+    auto & load = pointsToGraph.GetRegisterNode(*test.GetLoad().output(0));
+
+    assertTargets(gepZ, {&fieldZ});
+    assertTargets(gepByte, {&fieldZ});
+    assertTargets(fieldZ, {&allocaA, &allocaB});
+    assertTargets(load, {&allocaA, &allocaB});
+  };
+
+  WideStructFieldTest test;
+  // jive::view(test.graph().root(), stdout);
+
+  /*
+   * Act
+   */
+  jlm::aa::Steensgaard steensgaard(jlm::aa::Steensgaard::DefaultMaxFields);
+  jlm::StatisticsCollector statisticsCollector;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+  // std::cout << jlm::aa::PointsToGraph::ToDot(*pointsToGraph);
+
+  /*
+   * Assert
+   */
+  validatePointsToGraph(*pointsToGraph, test);
+}
+
 static int
 test()
 {
@@ -1118,6 +1253,10 @@ test()
 
   TestLinkedList();
 
+  TestStructFields();
+  TestStructFieldsCollapsed();
+  TestWideStructFields();
+
   return 0;
 }
 
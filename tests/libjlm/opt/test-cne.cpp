@@ -385,6 +385,42 @@ test_theta5()
 	assert(region->result(2)->origin() == region->result(3)->origin());
 }
 
+static inline void
+test_chains()
+{
+	using namespace jlm;
+
+	jlm::valuetype vt;
+
+	RvsdgModule rm(jlm::filepath(""), "", "");
+	auto & graph = rm.Rvsdg();
+	auto nf = graph.node_normal_form(typeid(jive::operation));
+	nf->set_mutable(false);
+
+	auto x = graph.add_import({vt, "x"});
+
+	/*
+		Two long chains of congruent nodes. Every node of the first chain must
+		be found congruent to the corresponding node of the second chain.
+	*/
+	size_t length = 10000;
+	std::vector<jive::output*> chain1({x}), chain2({x});
+	for (size_t n = 0; n < length; n++) {
+		chain1.push_back(jlm::create_testop(graph.root(), {chain1.back(), x}, {&vt})[0]);
+		chain2.push_back(jlm::create_testop(graph.root(), {chain2.back(), x}, {&vt})[0]);
+	}
+
+	graph.add_export(chain1.back(), {vt, "c1"});
+	graph.add_export(chain2.back(), {vt, "c2"});
+
+	jlm::cne cne;
+	cne.run(rm, statisticsCollector);
+
+	assert(graph.root()->result(0)->origin() == graph.root()->result(1)->origin());
+	for (size_t n = 1; n < chain2.size(); n++)
+		assert(chain1[n]->nusers() == 0 || chain2[n]->nusers() == 0);
+}
+
 static inline void
 test_lambda()
 {
@@ -469,6 +505,53 @@ test_phi()
 	assert(f1->node()->input(0)->origin() == f2->node()->input(0)->origin());
 }
 
+static inline void
+test_parallel()
+{
+	using namespace jlm;
+
+	jlm::valuetype vt;
+	std::vector<const jive::type*> types({&vt, &vt});
+	FunctionType ft(types, types);
+
+	RvsdgModule rm(jlm::filepath(""), "", "");
+	auto & graph = rm.Rvsdg();
+	auto nf = graph.node_normal_form(typeid(jive::operation));
+	nf->set_mutable(false);
+
+	auto x = graph.add_import({vt, "x"});
+
+	std::vector<lambda::node*> lambdas;
+	for (size_t n = 0; n < 16; n++) {
+		auto lambda = lambda::node::create(graph.root(), ft, "f", linkage::external_linkage);
+
+		auto d1 = lambda->add_ctxvar(x);
+		auto d2 = lambda->add_ctxvar(x);
+
+		auto b1 = jlm::create_testop(lambda->subregion(), {d1, d2}, {&vt})[0];
+		auto b2 = jlm::create_testop(lambda->subregion(), {d2, d1}, {&vt})[0];
+		auto u1 = jlm::create_testop(lambda->subregion(), {b1}, {&vt})[0];
+		auto u2 = jlm::create_testop(lambda->subregion(), {b2}, {&vt})[0];
+
+		auto output = lambda->finalize({u1, u2});
+		graph.add_export(output, {output->type(), "f"});
+		lambdas.push_back(lambda);
+	}
+
+	jlm::cne cne;
+	StatisticsCollector collector(
+		StatisticsCollectorSettings(filepath(""), {Statistics::Id::CommonNodeElimination}));
+	optimize(rm, collector, {&cne}, 4);
+
+	for (auto lambda : lambdas) {
+		auto subregion = lambda->subregion();
+		assert(subregion->result(0)->origin() == subregion->result(1)->origin());
+	}
+
+	/* the statistics of every lambda are collected */
+	assert(collector.NumCollectedStatistics() == lambdas.size());
+}
+
 static int
 verify()
 {
@@ -479,8 +562,10 @@ verify()
 	test_theta3();
 	test_theta4();
 	test_theta5();
+	test_chains();
 	test_lambda();
 	test_phi();
+	test_parallel();
 
 	return 0;
 }
@@ -6,6 +6,7 @@
 #include "test-operation.hpp"
 #include "test-registry.hpp"
 #include "test-types.hpp"
+#include "TestRvsdgs.hpp"
 
 #include <jive/view.hpp>
 #include <jive/rvsdg/control.hpp>
@@ -201,11 +202,152 @@ test2()
 	assert(is<CallOperation>(jive::node_output::node(f2->node()->fctresult(0)->origin())));
 }
 
+static size_t
+NumCalls(const jive::region & region)
+{
+  size_t numCalls = 0;
+  for (auto & node : region.nodes)
+  {
+    if (jive::is<jlm::CallOperation>(&node))
+      numCalls++;
+
+    if (auto structuralNode = dynamic_cast<const jive::structural_node*>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        numCalls += NumCalls(*structuralNode->subregion(n));
+    }
+  }
+
+  return numCalls;
+}
+
+/**
+ * Function f1 is exported and called twice from f2.
+ */
+static void
+TestMultipleCallSites()
+{
+  using namespace jlm;
+
+  auto SetupRvsdg = [](RvsdgModule & rvsdgModule)
+  {
+    auto & graph = rvsdgModule.Rvsdg();
+
+    valuetype vt;
+    iostatetype iOStateType;
+    MemoryStateType memoryStateType;
+    loopstatetype loopStateType;
+    FunctionType functionType(
+      {&vt, &iOStateType, &memoryStateType, &loopStateType},
+      {&vt, &iOStateType, &memoryStateType, &loopStateType});
+
+    auto f1 = lambda::node::create(graph.root(), functionType, "f1", linkage::external_linkage);
+    auto t = test_op::create(f1->subregion(), {f1->fctargument(0)}, {&vt});
+    auto f1Output = f1->finalize({t->output(0), f1->fctargument(1), f1->fctargument(2), f1->fctargument(3)});
+
+    auto f2 = lambda::node::create(graph.root(), functionType, "f2", linkage::external_linkage);
+    auto d = f2->add_ctxvar(f1Output);
+    auto callResults1 = CallNode::Create(
+      d,
+      {f2->fctargument(0), f2->fctargument(1), f2->fctargument(2), f2->fctargument(3)});
+    auto callResults2 = CallNode::Create(d, callResults1);
+    auto f2Output = f2->finalize(callResults2);
+
+    graph.add_export(f1Output, {f1Output->type(), "f1"});
+    graph.add_export(f2Output, {f2Output->type(), "f2"});
+
+    return f2Output->node();
+  };
+
+  auto Inline = [&](const InliningConfiguration & configuration)
+  {
+    RvsdgModule rvsdgModule(filepath(""), "", "");
+    auto f2 = SetupRvsdg(rvsdgModule);
+
+    fctinline functionInlining(configuration);
+    functionInlining.run(rvsdgModule, statisticsCollector);
+
+    return NumCalls(*f2->subregion());
+  };
+
+  /*
+   * Both calls are inlined with the default configuration.
+   */
+  assert(Inline(InliningConfiguration()) == 0);
+
+  /*
+   * No call is inlined if the threshold is below the size of f1.
+   */
+  InliningConfiguration configuration;
+  configuration.Threshold = 0;
+  assert(Inline(configuration) == 2);
+
+  /*
+   * Only one call is inlined if the growth budget of f2 permits a single copy of f1.
+   */
+  configuration = InliningConfiguration();
+  configuration.CallerGrowthBudget = 1;
+  assert(Inline(configuration) == 1);
+
+  configuration = InliningConfiguration();
+  configuration.GlobalGrowthBudget = 0;
+  assert(Inline(configuration) == 2);
+}
+
+/**
+ * The recursive function fib is inlined into its caller, while its recursive calls are not inlined.
+ */
+static void
+TestRecursion()
+{
+  using namespace jlm;
+
+  /*
+   * Arrange
+   */
+  PhiTest1 test;
+  auto & rvsdgModule = test.module();
+
+  /*
+   * Act
+   */
+  fctinline functionInlining;
+  functionInlining.run(rvsdgModule, statisticsCollector);
+
+  /*
+   * Assert
+   */
+  assert(NumCalls(*test.lambda_fib->subregion()) == 2);
+
+  auto & lambdaTest = *test.lambda_test;
+  assert(!jive::region::Contains<CallOperation>(*lambdaTest.subregion(), false));
+  assert(NumCalls(*lambdaTest.subregion()) == 2);
+
+  for (auto & node : lambdaTest.subregion()->nodes)
+  {
+    auto gammaNode = dynamic_cast<jive::gamma_node*>(&node);
+    if (gammaNode == nullptr)
+      continue;
+
+    for (auto & callNode : gammaNode->subregion(0)->nodes)
+    {
+      if (auto call = dynamic_cast<CallNode*>(&callNode))
+      {
+        auto classifier = CallNode::ClassifyCall(*call);
+        assert(classifier->IsNonRecursiveDirectCall());
+        assert(classifier->GetLambdaOutput().node() == test.lambda_fib);
+      }
+    }
+  }
+}
+
 static int
 verify()
 {
 	test1();
 	test2();
+  TestMultipleCallSites();
+  TestRecursion();
 
 	return 0;
 }
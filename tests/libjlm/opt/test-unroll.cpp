@@ -411,6 +411,78 @@ test_nested_theta()
 	assert(thetas.size() == 3 && nthetas(thetas[0]->subregion()) == 8);
 }
 
+static inline void
+test_heuristic()
+{
+	jive::bitult_op ult(32);
+	jive::bitadd_op add(32);
+
+	auto setup = [&](jlm::RvsdgModule & rm, int64_t niterations)
+	{
+		auto & graph = rm.Rvsdg();
+		auto nf = graph.node_normal_form(typeid(jive::operation));
+		nf->set_mutable(false);
+
+		auto init = jive::create_bitconstant(graph.root(), 32, 0);
+		auto step = jive::create_bitconstant(graph.root(), 32, 1);
+		auto end = jive::create_bitconstant(graph.root(), 32, niterations);
+
+		return create_theta(ult, add, init, step, end);
+	};
+
+	{
+		/*
+			The loop has a small trip count and is unrolled completely.
+		*/
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto theta = setup(rm, 4);
+
+		auto ui = jlm::unrollinfo::create(theta);
+		assert(jlm::select_unroll_factor(*ui, jlm::UnrollHeuristic()) == 4);
+
+		jlm::loopunroll loopunroll(jlm::UnrollHeuristic{});
+		loopunroll.run(rm, statisticsCollector);
+		assert(nthetas(rm.Rvsdg().root()) == 0);
+	}
+
+	{
+		/*
+			The loop body has three nodes. The largest factor that fits into the
+			budget and divides the trip count is five.
+		*/
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto theta = setup(rm, 100);
+
+		auto ui = jlm::unrollinfo::create(theta);
+		assert(jlm::select_unroll_factor(*ui, jlm::UnrollHeuristic()) == 5);
+
+		jlm::loopunroll loopunroll(jlm::UnrollHeuristic{});
+		loopunroll.run(rm, statisticsCollector);
+
+		auto thetas = find_thetas(rm.Rvsdg().root());
+		assert(thetas.size() == 1 && thetas[0]->subregion()->nnodes() >= 15);
+	}
+
+	{
+		/*
+			The unrolled loop body would exceed the budget.
+		*/
+		jlm::RvsdgModule rm(jlm::filepath(""), "", "");
+		auto theta = setup(rm, 100);
+
+		jlm::UnrollHeuristic heuristic;
+		heuristic.BodyBudget = 5;
+
+		auto ui = jlm::unrollinfo::create(theta);
+		assert(jlm::select_unroll_factor(*ui, heuristic) == 0);
+
+		jlm::loopunroll loopunroll(heuristic);
+		loopunroll.run(rm, statisticsCollector);
+
+		auto thetas = find_thetas(rm.Rvsdg().root());
+		assert(thetas.size() == 1 && thetas[0] == theta && theta->subregion()->nnodes() == 3);
+	}
+}
 
 static int
 verify()
@@ -420,6 +492,7 @@ verify()
 	test_nested_theta();
 	test_known_boundaries();
 	test_unknown_boundaries();
+	test_heuristic();
 
 	return 0;
 }
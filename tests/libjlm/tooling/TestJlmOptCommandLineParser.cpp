@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/common.hpp>
+#include <jlm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/opt/PassManager.hpp>
+#include <jlm/opt/unroll.hpp>
+#include <jlm/tooling/CommandLine.hpp>
+
+#include <cassert>
+#include <cstring>
+
+static const jlm::JlmOptCommandLineOptions &
+ParseCommandLineArguments(const std::vector<std::string> & commandLineArguments)
+{
+  std::vector<char*> array;
+  for (const auto & commandLineArgument : commandLineArguments) {
+    array.push_back(new char[commandLineArgument.size() + 1]);
+    strncpy(array.back(), commandLineArgument.data(), commandLineArgument.size());
+    array.back()[commandLineArgument.size()] = '\0';
+  }
+
+  static jlm::JlmOptCommandLineParser commandLineParser;
+  auto & commandLineOptions = commandLineParser.ParseCommandLineArguments(
+    static_cast<int>(array.size()),
+    &array[0]);
+
+  for (const auto & ptr : array)
+    delete[] ptr;
+
+  return commandLineOptions;
+}
+
+static void
+TestPipeline()
+{
+  /*
+   * Arrange
+   */
+  std::vector<std::string> commandLineArguments({"jlm-opt", "--pipeline=iln,(red,(cne)*,dne)*,cne", "foo.ll"});
+
+  /*
+   * Act
+   */
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  /*
+   * Assert
+   */
+  auto & optimizations = commandLineOptions.Optimizations_;
+  assert(optimizations.size() == 3);
+
+  auto group = dynamic_cast<const jlm::FixpointGroup*>(optimizations[1]);
+  assert(group && group->Passes().size() == 3);
+  assert(group->Passes()[2] != optimizations[2]);
+
+  auto innerGroup = dynamic_cast<const jlm::FixpointGroup*>(group->Passes()[1]);
+  assert(innerGroup && innerGroup->Passes().size() == 1);
+  assert(innerGroup->Passes()[0] == optimizations[2]);
+}
+
+static void
+TestInvalidPipelines()
+{
+  jlm::JlmOptCommandLineParser commandLineParser;
+
+  auto ExpectError = [&](const std::string & pipeline)
+  {
+    try
+    {
+      commandLineParser.ParsePipeline(pipeline);
+      assert(false);
+    }
+    catch (const jlm::error &)
+    {}
+  };
+
+  ExpectError("");
+  ExpectError("cne,");
+  ExpectError("foo");
+  ExpectError("(cne,dne)");
+  ExpectError("(cne,dne");
+  ExpectError("cne)*");
+  ExpectError("cne dne");
+}
+
+static void
+TestLoopUnrollingAuto()
+{
+  /*
+   * Arrange
+   */
+  jlm::JlmOptCommandLineParser commandLineParser;
+
+  /*
+   * Act
+   */
+  auto optimizations = commandLineParser.ParsePipeline("url,url-auto");
+
+  /*
+   * Assert
+   */
+  assert(optimizations.size() == 2);
+  assert(dynamic_cast<jlm::loopunroll*>(optimizations[0]));
+  assert(dynamic_cast<jlm::loopunroll*>(optimizations[1]));
+  assert(optimizations[0] != optimizations[1]);
+}
+
+static void
+TestAndersenRegionAware()
+{
+  /*
+   * Arrange
+   */
+  std::vector<std::string> commandLineArguments({"jlm-opt", "--AAAndersenRegionAware", "foo.ll"});
+
+  /*
+   * Act
+   */
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  /*
+   * Assert
+   */
+  auto & optimizations = commandLineOptions.Optimizations_;
+  assert(optimizations.size() == 1);
+  assert(dynamic_cast<const jlm::aa::AndersenRegionAware*>(optimizations[0]));
+}
+
+static void
+TestSteensgaardFieldSensitiveRegionAware()
+{
+  /*
+   * Arrange
+   */
+  std::vector<std::string> commandLineArguments(
+    {"jlm-opt", "--AASteensgaardFieldSensitiveRegionAware", "foo.ll"});
+
+  /*
+   * Act
+   */
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  /*
+   * Assert
+   */
+  auto & optimizations = commandLineOptions.Optimizations_;
+  assert(optimizations.size() == 1);
+  auto steensgaard = dynamic_cast<const jlm::aa::SteensgaardRegionAware*>(optimizations[0]);
+  assert(steensgaard && steensgaard->IsFieldSensitive());
+}
+
+static void
+TestOutputFormat()
+{
+  using namespace jlm;
+
+  auto ParseOutputFormat = [](const std::string & argument)
+  {
+    std::vector<std::string> commandLineArguments({"jlm-opt", argument, "foo.ll"});
+    return ParseCommandLineArguments(commandLineArguments).OutputFormat_;
+  };
+
+  /*
+   * Act & Assert
+   */
+  assert(ParseOutputFormat("--output-format=xml") == JlmOptCommandLineOptions::OutputFormat::Xml);
+  assert(ParseOutputFormat("--output-format=rvsdg") == JlmOptCommandLineOptions::OutputFormat::Rvsdg);
+
+  /*
+   * The bare flags remain aliases of --output-format.
+   */
+  assert(ParseOutputFormat("--xml") == JlmOptCommandLineOptions::OutputFormat::Xml);
+  assert(ParseOutputFormat("--llvm") == JlmOptCommandLineOptions::OutputFormat::Llvm);
+}
+
+static int
+Test()
+{
+  TestPipeline();
+  TestInvalidPipelines();
+  TestLoopUnrollingAuto();
+  TestAndersenRegionAware();
+  TestSteensgaardFieldSensitiveRegionAware();
+  TestOutputFormat();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/tooling/TestJlmOptCommandLineParser", Test)
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <cassert>
+#include <vector>
+
+static void
+TestInsert()
+{
+  jlm::SparseBitVector bitVector({3, 64, 1000});
+
+  assert(bitVector.Size() == 3);
+  assert(bitVector.Contains(64));
+  assert(!bitVector.Contains(65));
+
+  assert(bitVector.Insert(65));
+  assert(!bitVector.Insert(65));
+  assert(bitVector.Insert(0));
+
+  std::vector<size_t> items;
+  for (auto item : bitVector.Items())
+    items.push_back(item);
+  assert(items == std::vector<size_t>({0, 3, 64, 65, 1000}));
+
+  bitVector.Clear();
+  assert(bitVector.IsEmpty());
+  assert(bitVector.Size() == 0);
+}
+
+static void
+TestUnionWith()
+{
+  jlm::SparseBitVector bitVector({1, 200});
+
+  assert(bitVector.UnionWith({1, 2, 500}));
+  assert(bitVector == jlm::SparseBitVector({1, 2, 200, 500}));
+
+  assert(!bitVector.UnionWith({2, 200}));
+  assert(!bitVector.UnionWith({}));
+}
+
+static void
+TestIntersectWith()
+{
+  jlm::SparseBitVector bitVector({1, 2, 200, 500});
+
+  assert(bitVector.IntersectWith({2, 3, 500}));
+  assert(bitVector == jlm::SparseBitVector({2, 500}));
+
+  assert(!bitVector.IntersectWith({2, 500, 1000}));
+
+  assert(bitVector.IntersectWith({}));
+  assert(bitVector.IsEmpty());
+}
+
+static void
+TestDifference()
+{
+  jlm::SparseBitVector lhs({1, 2, 200, 500});
+  jlm::SparseBitVector rhs({2, 200, 1000});
+
+  auto difference = jlm::SparseBitVector::Difference(lhs, rhs);
+  assert(difference == jlm::SparseBitVector({1, 500}));
+
+  assert(jlm::SparseBitVector::Difference(rhs, rhs).IsEmpty());
+}
+
+static void
+TestRemove()
+{
+  jlm::SparseBitVector bitVector({3, 64, 65});
+
+  assert(bitVector.Remove(64));
+  assert(!bitVector.Remove(64));
+  assert(!bitVector.Remove(1000));
+  assert(bitVector == jlm::SparseBitVector({3, 65}));
+
+  assert(bitVector.Remove(65));
+  assert(bitVector.Remove(3));
+  assert(bitVector.IsEmpty());
+}
+
+static void
+TestIsSubsetOf()
+{
+  jlm::SparseBitVector bitVector({3, 64, 1000});
+
+  assert(jlm::SparseBitVector().IsSubsetOf(bitVector));
+  assert(bitVector.IsSubsetOf(bitVector));
+  assert(jlm::SparseBitVector({3, 1000}).IsSubsetOf(bitVector));
+  assert(!jlm::SparseBitVector({3, 4}).IsSubsetOf(bitVector));
+  assert(!jlm::SparseBitVector({3, 500}).IsSubsetOf(bitVector));
+  assert(!bitVector.IsSubsetOf({3, 64}));
+}
+
+static int
+TestSparseBitVector()
+{
+  TestInsert();
+  TestUnionWith();
+  TestIntersectWith();
+  TestDifference();
+  TestRemove();
+  TestIsSubsetOf();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/util/TestSparseBitVector", TestSparseBitVector)
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/ThreadPool.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+static void
+TestSubmitAndWait()
+{
+  std::atomic<size_t> sum(0);
+  jlm::ThreadPool threadPool(4);
+  assert(threadPool.NumThreads() == 4);
+
+  for (size_t n = 1; n <= 1000; n++)
+    threadPool.Submit([&sum, n]() { sum += n; });
+  threadPool.Wait();
+  assert(sum == 500500);
+
+  /*
+   * The pool must be reusable after a call to Wait().
+   */
+  for (size_t n = 0; n < 10; n++)
+    threadPool.Submit([&sum]() { sum++; });
+  threadPool.Wait();
+  assert(sum == 500510);
+}
+
+static void
+TestWorkStealing()
+{
+  std::atomic<size_t> numStarted(0);
+  std::atomic<size_t> numDone(0);
+  jlm::ThreadPool threadPool(2);
+
+  /*
+   * The first task blocks its worker until all other tasks were executed. All other tasks are therefore executed by
+   * the second worker, including the ones that were queued at the blocked worker.
+   */
+  threadPool.Submit([&]()
+  {
+    numStarted++;
+    while (numDone != 9)
+      std::this_thread::yield();
+  });
+
+  for (size_t n = 0; n < 9; n++)
+    threadPool.Submit([&]() { numDone++; });
+
+  threadPool.Wait();
+  assert(numStarted == 1);
+  assert(numDone == 9);
+}
+
+static void
+TestDestruction()
+{
+  std::atomic<size_t> numDone(0);
+  {
+    jlm::ThreadPool threadPool(3);
+    for (size_t n = 0; n < 100; n++)
+      threadPool.Submit([&numDone]() { numDone++; });
+  }
+
+  assert(numDone == 100);
+}
+
+static void
+TestCurrentWorkerIndex()
+{
+  assert(jlm::ThreadPool::CurrentWorkerIndex() == SIZE_MAX);
+
+  std::vector<std::atomic<size_t>> numTasks(3);
+  jlm::ThreadPool threadPool(3);
+  for (size_t n = 0; n < 100; n++)
+  {
+    threadPool.Submit([&numTasks]()
+    {
+      auto workerIndex = jlm::ThreadPool::CurrentWorkerIndex();
+      assert(workerIndex < 3);
+      numTasks[workerIndex]++;
+    });
+  }
+  threadPool.Wait();
+
+  assert(numTasks[0] + numTasks[1] + numTasks[2] == 100);
+}
+
+static int
+TestThreadPool()
+{
+  TestSubmitAndWait();
+  TestWorkStealing();
+  TestDestruction();
+  TestCurrentWorkerIndex();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("libjlm/util/TestThreadPool", TestThreadPool)